@@ -28,9 +28,11 @@
 
 #include "BlockFile.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <cstdint>
+#include <zlib.h>
 #include "Supermodel.h"
 
 
@@ -38,90 +40,220 @@
  Output Functions
 ******************************************************************************/
 
-void CBlockFile::ReadString(std::string *str, uint32_t length)
+bool CBlockFile::IsOpen(void) const
 {
-  if (NULL == fp)
-    return;
-  str->clear();
-  //TODO: use fstream to get rid of this ugly hack
-  bool keep_loading = true;
-  for (uint32_t i = 0; i < length; i++)
+  return memBuffer != NULL || memData != NULL;
+}
+
+long int CBlockFile::Tell(void) const
+{
+  return memPos;
+}
+
+void CBlockFile::Seek(long int pos)
+{
+  memPos = pos;
+}
+
+unsigned CBlockFile::ReadRaw(void *data, uint32_t numBytes)
+{
+  if (inflater != NULL)
+  {
+    // Compressed block: decompress straight into the destination
+    inflater->next_out = (Bytef *) data;
+    inflater->avail_out = numBytes;
+    int result = inflate(inflater, Z_SYNC_FLUSH);
+    if (result != Z_OK && result != Z_STREAM_END)
+      return 0;
+    return numBytes - inflater->avail_out;
+  }
+  if (NULL == memData || memPos >= fileSize)
+    return 0;
+  numBytes = std::min<long int>(numBytes, fileSize - memPos);
+  memcpy(data, &memData[memPos], numBytes);
+  memPos += numBytes;
+  return numBytes;
+}
+
+/*
+ * Delta format: a sequence of runs, each an offset into the image (uint32_t),
+ * a length (uint32_t) and that many bytes to XOR in. Data is compared 8 bytes
+ * at a time, so runs are made of whole 8 byte words apart from at the end of
+ * the data. The old data is updated as the runs are found.
+ */
+static inline uint64_t LoadWord(const uint8_t *p)
+{
+  uint64_t word;
+  memcpy(&word, p, sizeof(word));
+  return word;
+}
+
+static void UpdateAndRecordDelta(std::vector<uint8_t> *delta, uint8_t *oldData, const uint8_t *newData, uint32_t numBytes, uint32_t offset)
+{
+  uint32_t numWordBytes = numBytes & ~7;
+  uint32_t i = 0;
+  while (i < numBytes)
   {
-    char c;
-    fread(&c, sizeof(char), 1, fp);
-    if (keep_loading)
+    // Skip unchanged data
+    while (i < numWordBytes && LoadWord(&oldData[i]) == LoadWord(&newData[i]))
+      i += 8;
+    if (i >= numWordBytes)
+    {
+      while (i < numBytes && oldData[i] == newData[i])
+        i++;
+      if (i >= numBytes)
+        break;
+    }
+
+    // Changed run ends at the next unchanged word
+    uint32_t runStart = i;
+    if (i < numWordBytes)
+    {
+      while (i < numWordBytes && LoadWord(&oldData[i]) != LoadWord(&newData[i]))
+        i += 8;
+      if (i == numWordBytes)
+        i = numBytes;
+    }
+    else
+      i = numBytes;
+    uint32_t runLength = i - runStart;
+
+    uint32_t header[2] = { offset + runStart, runLength };
+    size_t deltaPos = delta->size();
+    delta->resize(deltaPos + sizeof(header) + runLength);
+    uint8_t *out = &(*delta)[deltaPos];
+    memcpy(out, header, sizeof(header));
+    out += sizeof(header);
+    uint32_t j = 0;
+    for (; j + 8 <= runLength; j += 8)
     {
-      if (!c)
-        keep_loading = false;
-      else
-        *str += c;
+      uint64_t word = LoadWord(&oldData[runStart + j]) ^ LoadWord(&newData[runStart + j]);
+      memcpy(&out[j], &word, sizeof(word));
     }
+    for (; j < runLength; j++)
+      out[j] = oldData[runStart + j] ^ newData[runStart + j];
+    memcpy(&oldData[runStart], &newData[runStart], runLength);
   }
 }
 
-unsigned CBlockFile::ReadBytes(void *data, uint32_t numBytes)
+void CBlockFile::WriteMemory(const uint8_t *data, uint32_t numBytes)
 {
-  if (NULL == fp)
-    return 0;
-  return fread(data, sizeof(uint8_t), numBytes, fp);
+  size_t pos = memPos;
+  if (pos + numBytes > memBuffer->size())
+    memBuffer->resize(pos + numBytes);
+  uint8_t *dest = &(*memBuffer)[pos];
+
+  // Where the previous image is being overwritten, record what changes and
+  // only write that. Most of a state does not change from one frame to the
+  // next.
+  uint32_t overlap = (memDelta != NULL && pos < memOldSize) ? (uint32_t) std::min<size_t>(numBytes, memOldSize - pos) : 0;
+  for (uint32_t i = 0; i < overlap; i += 0x1000)
+  {
+    uint32_t chunk = std::min<uint32_t>(overlap - i, 0x1000);
+    if (memcmp(&dest[i], &data[i], chunk) != 0)  // quickly skip unchanged pages
+      UpdateAndRecordDelta(memDelta, &dest[i], &data[i], chunk, (uint32_t) (pos + i));
+  }
+  memcpy(&dest[overlap], &data[overlap], numBytes - overlap);
+
+  memPos = pos + numBytes;
+  memEnd = std::max<size_t>(memEnd, memPos);
 }
 
-unsigned CBlockFile::ReadDWord(uint32_t *data)
+void CBlockFile::WriteRaw(const void *data, uint32_t numBytes, uint8_t *dirtyPages, unsigned pageWidth)
 {
-  if (NULL == fp)
+  if (NULL == memBuffer)
+    return;
+
+  // With a dirty page bitmap, only the pages written to since the previous
+  // delta need comparing. An extra 4 bytes are included after each page to
+  // allow for a 32-bit write straddling two pages, as the render snapshots do.
+  const uint8_t *src = (const uint8_t *) data;
+  size_t start = memPos;
+  if (dirtyPages != NULL && memDelta != NULL && start + numBytes <= memOldSize)
+  {
+    uint32_t pageSize = 1 << pageWidth;
+    uint32_t numPages = (numBytes + pageSize - 1) >> pageWidth;
+    for (uint32_t page = 0; page < numPages; page++)
+    {
+      if (dirtyPages[page >> 3] & (1 << (page & 7)))
+      {
+        uint32_t offset = page << pageWidth;
+        memPos = start + offset;
+        WriteMemory(&src[offset], std::min(numBytes - offset, pageSize + 4));
+      }
+    }
+    memset(dirtyPages, 0, (numPages + 7) / 8);
+    memPos = start + numBytes;
+    memEnd = std::max<size_t>(memEnd, memPos);
+  }
+  else
+    WriteMemory(src, numBytes);
+}
+
+unsigned CBlockFile::ReadBytes(void *data, uint32_t numBytes)
+{
+  if (!IsOpen())
     return 0;
-  fread(data, sizeof(uint32_t), 1, fp);
-  return 4;
+  return ReadRaw(data, numBytes);
 }
   
 void CBlockFile::UpdateBlockSize(void)
 {
   long int  curPos;
-  unsigned  newBlockSize;
+  uint32_t  newBlockSize;
   
-  if (NULL == fp)
+  if (!IsOpen())
     return;
-  curPos = ftell(fp);       // save current file position
-  fseek(fp, blockStartPos, SEEK_SET);
+  curPos = Tell();          // save current file position
+  Seek(blockStartPos);
   newBlockSize = curPos - blockStartPos;
-  fwrite(&newBlockSize, sizeof(uint32_t), 1, fp);
-  fseek(fp, curPos, SEEK_SET);  // go back
+  WriteRaw(&newBlockSize, sizeof(uint32_t));
+  Seek(curPos);             // go back
 }
 
+// Block sizes are only filled in when the block is finished
 void CBlockFile::WriteByte(uint8_t data)
 {
-  if (NULL == fp)
+  if (!IsOpen())
     return;
-  fwrite(&data, sizeof(uint8_t), 1, fp);
-  UpdateBlockSize();
+  WriteRaw(&data, sizeof(uint8_t));
 }
 
 void CBlockFile::WriteDWord(uint32_t data)
 {
-  if (NULL == fp)
+  if (!IsOpen())
     return;
-  fwrite(&data, sizeof(uint32_t), 1, fp);
-  UpdateBlockSize();
+  WriteRaw(&data, sizeof(uint32_t));
 }
 
-void CBlockFile::WriteBytes(const void *data, uint32_t numBytes)
+void CBlockFile::WriteBytes(const void *data, uint32_t numBytes, uint8_t *dirtyPages, unsigned pageWidth)
 {
-  if (NULL == fp)
+  if (!IsOpen())
     return;
-  fwrite(data, sizeof(uint8_t), numBytes, fp);
-  UpdateBlockSize();
+  WriteRaw(data, numBytes, dirtyPages, pageWidth);
 }
 
 void CBlockFile::WriteBlockHeader(const std::string &name, const std::string &comment)
 {
-  if (NULL == fp)
+  if (!IsOpen())
     return;
+
+  // Finish the previous block
+  if (memEnd > 0)
+    UpdateBlockSize();
   
   // Record current block starting position
-  blockStartPos = ftell(fp);
+  blockStartPos = Tell();
 
   // Write the total block length field
-  WriteDWord(0);  // will be automatically updated as we write the file
+  if ((size_t) blockStartPos + 4 <= memOldSize)
+  {
+    // Leave the old length in place until the block is finished
+    memPos += 4;
+    memEnd = std::max<size_t>(memEnd, memPos);
+  }
+  else
+    WriteDWord(0);  // will be automatically updated as we write the file
   
   // Write name and comment lengths
   WriteDWord(name.size() + 1);
@@ -130,17 +262,18 @@ void CBlockFile::WriteBlockHeader(const std::string &name, const std::string &co
   Write(comment);
   
   // Record the start of the current data section
-  dataStartPos = ftell(fp);
+  dataStartPos = Tell();
 } 
 
 
 /******************************************************************************
  Block Format Container File Implementation
  
- Files are just a consecutive array of blocks that must be searched.
+ Version 1 files (and memory images) are just a consecutive array of blocks
+ that must be searched. Version 2 files start with a directory.
  
- Block Format
- ------------
+ Version 1 Block Format
+ ----------------------
  blockLength  (uint32_t)  Total length of block in bytes.
  nameLength   (uint32_t)  Length of name field including terminating 0 (up to
               1025).
@@ -148,8 +281,205 @@ void CBlockFile::WriteBlockHeader(const std::string &name, const std::string &co
  name     ...     Name string (null-terminated, up to 1025 bytes).
  comment    ...     Comment string (same as above).
  data     ...     Raw data (blockLength - total header size).
+
+ Version 2 File Format
+ ---------------------
+ magic          (8 bytes)   "SMBLOCK2".
+ numBlocks      (uint32_t)  Number of blocks.
+ directorySize  (uint32_t)  Length of directory in bytes.
+ reserved       (48 bytes)  Zero.
+ directory      ...         One entry per block, in the order written:
+   offset         (uint64_t)  File offset of data (a multiple of 64).
+   storedSize     (uint64_t)  Length of data in file.
+   size           (uint64_t)  Length of data once decompressed.
+   compression    (uint32_t)  0 for none, 1 for zlib deflate.
+   nameLength     (uint32_t)  As in version 1.
+   commentLength  (uint32_t)  As in version 1.
+   name           ...         As in version 1.
+   comment        ...         As in version 1.
+ data           ...         Each block's data, padded to 64 bytes.
 ******************************************************************************/
 
+static const char     VERSION2_MAGIC[8] = { 'S', 'M', 'B', 'L', 'O', 'C', 'K', '2' };
+static const uint32_t VERSION2_HEADER_SIZE = 64;
+static const uint32_t VERSION2_ENTRY_SIZE = 36;   // not including strings
+static const uint64_t DATA_ALIGNMENT = 64;
+static const uint64_t MIN_COMPRESSED_SIZE = 4096; // smaller blocks aren't worth compressing
+
+static uint64_t AlignData(uint64_t offset)
+{
+  return (offset + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1);
+}
+
+bool CBlockFile::ReadDirectory(void)
+{
+  blocks.clear();
+  blockIndex.clear();
+  indexed = false;
+
+  // Anything else is version 1 and is indexed when first searched
+  if (fileSize < (long int) VERSION2_HEADER_SIZE || memcmp(memData, VERSION2_MAGIC, sizeof(VERSION2_MAGIC)) != 0)
+    return OKAY;
+
+  uint32_t numBlocks, directorySize;
+  memcpy(&numBlocks, &memData[8], sizeof(uint32_t));
+  memcpy(&directorySize, &memData[12], sizeof(uint32_t));
+  if ((uint64_t) VERSION2_HEADER_SIZE + directorySize > (uint64_t) fileSize)
+    return FAIL;
+
+  const uint8_t *entry = &memData[VERSION2_HEADER_SIZE];
+  const uint8_t *directoryEnd = entry + directorySize;
+  for (uint32_t i = 0; i < numBlocks; i++)
+  {
+    if (directoryEnd - entry < (ptrdiff_t) VERSION2_ENTRY_SIZE)
+      return FAIL;
+    BlockEntry block;
+    uint32_t nameLength, commentLength;
+    memcpy(&block.offset, &entry[0], sizeof(uint64_t));
+    memcpy(&block.storedSize, &entry[8], sizeof(uint64_t));
+    memcpy(&block.size, &entry[16], sizeof(uint64_t));
+    memcpy(&block.compression, &entry[24], sizeof(uint32_t));
+    memcpy(&nameLength, &entry[28], sizeof(uint32_t));
+    memcpy(&commentLength, &entry[32], sizeof(uint32_t));
+    entry += VERSION2_ENTRY_SIZE;
+    if ((uint64_t) (directoryEnd - entry) < (uint64_t) nameLength + commentLength)
+      return FAIL;
+    block.name.assign((const char *) entry, strnlen((const char *) entry, nameLength));
+    entry += nameLength;
+    block.comment.assign((const char *) entry, strnlen((const char *) entry, commentLength));
+    entry += commentLength;
+    if (block.offset > (uint64_t) fileSize || block.storedSize > (uint64_t) fileSize - block.offset)
+      return FAIL;
+    if (block.compression != COMPRESSION_NONE && block.compression != COMPRESSION_DEFLATE)
+      return FAIL;
+    blockIndex.emplace(block.name, blocks.size());
+    blocks.push_back(block);
+  }
+  indexed = true;
+  return OKAY;
+}
+
+void CBlockFile::ScanVersion1(const uint8_t *data, size_t size, std::vector<BlockEntry> *blocks)
+{
+  size_t pos = 0;
+  while (pos + 12 <= size)
+  {
+    uint32_t header[3]; // block, name and comment lengths
+    memcpy(header, &data[pos], sizeof(header));
+    uint64_t dataStart = pos + 12 + (uint64_t) header[1] + header[2];
+    if (dataStart > size)
+      break;
+
+    BlockEntry block;
+    const char *name = (const char *) &data[pos + 12];
+    block.name.assign(name, strnlen(name, header[1]));
+    block.comment.assign(name + header[1], strnlen(name + header[1], header[2]));
+    block.offset = dataStart;
+    block.size = block.storedSize = header[0] > dataStart - pos ? std::min<uint64_t>(header[0] - (dataStart - pos), size - dataStart) : 0;
+    block.compression = COMPRESSION_NONE;
+    blocks->push_back(block);
+
+    if (header[0] == 0)  // this would never advance
+      break;
+    pos += header[0];
+  }
+}
+
+void CBlockFile::IndexBlocks(void)
+{
+  blocks.clear();
+  blockIndex.clear();
+  ScanVersion1(memData, fileSize, &blocks);
+  for (size_t i = 0; i < blocks.size(); i++)
+    blockIndex.emplace(blocks[i].name, i);  // the first of any duplicates is found, as when searching
+  indexed = true;
+}
+
+bool CBlockFile::StartInflate(const BlockEntry &block)
+{
+  inflater = new z_stream();
+  inflater->next_in = (Bytef *) &memData[block.offset];
+  inflater->avail_in = (uInt) block.storedSize;
+  if (inflateInit(inflater) != Z_OK)
+  {
+    delete inflater;
+    inflater = NULL;
+    return FAIL;
+  }
+  return OKAY;
+}
+
+void CBlockFile::EndInflate(void)
+{
+  if (inflater != NULL)
+  {
+    inflateEnd(inflater);
+    delete inflater;
+  }
+  inflater = NULL;
+}
+
+void CBlockFile::WriteVersion2(void)
+{
+  std::vector<BlockEntry> fileBlocks;
+  ScanVersion1(fileImage.data(), fileImage.size(), &fileBlocks);
+
+  // The directory doesn't depend on the data, so the data can be written
+  // (and compressed a block at a time) first
+  uint32_t directorySize = 0;
+  for (const BlockEntry &block: fileBlocks)
+    directorySize += VERSION2_ENTRY_SIZE + block.name.size() + 1 + block.comment.size() + 1;
+
+  uint64_t offset = AlignData(VERSION2_HEADER_SIZE + directorySize);
+  std::vector<uint8_t> compressed;
+  static const uint8_t padding[DATA_ALIGNMENT] = { 0 };
+  for (BlockEntry &block: fileBlocks)
+  {
+    const uint8_t *data = &fileImage[block.offset];
+    block.offset = offset;
+    block.compression = COMPRESSION_NONE;
+    if (compressFile && block.size >= MIN_COMPRESSED_SIZE)
+    {
+      uLongf compressedSize = compressBound((uLong) block.size);
+      compressed.resize(compressedSize);
+      if (compress2(compressed.data(), &compressedSize, data, (uLong) block.size, Z_BEST_SPEED) == Z_OK && compressedSize < block.size)
+      {
+        data = compressed.data();
+        block.storedSize = compressedSize;
+        block.compression = COMPRESSION_DEFLATE;
+      }
+    }
+    fseek(fp, (long int) offset, SEEK_SET);
+    fwrite(data, sizeof(uint8_t), block.storedSize, fp);
+    offset += block.storedSize;
+    fwrite(padding, sizeof(uint8_t), AlignData(offset) - offset, fp);
+    offset = AlignData(offset);
+  }
+
+  uint8_t header[VERSION2_HEADER_SIZE] = { 0 };
+  uint32_t numBlocks = fileBlocks.size();
+  memcpy(&header[0], VERSION2_MAGIC, sizeof(VERSION2_MAGIC));
+  memcpy(&header[8], &numBlocks, sizeof(uint32_t));
+  memcpy(&header[12], &directorySize, sizeof(uint32_t));
+  fseek(fp, 0, SEEK_SET);
+  fwrite(header, sizeof(uint8_t), sizeof(header), fp);
+  for (const BlockEntry &block: fileBlocks)
+  {
+    uint8_t entry[VERSION2_ENTRY_SIZE];
+    uint32_t nameLength = block.name.size() + 1;
+    uint32_t commentLength = block.comment.size() + 1;
+    memcpy(&entry[0], &block.offset, sizeof(uint64_t));
+    memcpy(&entry[8], &block.storedSize, sizeof(uint64_t));
+    memcpy(&entry[16], &block.size, sizeof(uint64_t));
+    memcpy(&entry[24], &block.compression, sizeof(uint32_t));
+    memcpy(&entry[28], &nameLength, sizeof(uint32_t));
+    memcpy(&entry[32], &commentLength, sizeof(uint32_t));
+    fwrite(entry, sizeof(uint8_t), sizeof(entry), fp);
+    fwrite(block.name.c_str(), sizeof(uint8_t), nameLength, fp);
+    fwrite(block.comment.c_str(), sizeof(uint8_t), commentLength, fp);
+  }
+}
+
 unsigned CBlockFile::Read(void *data, uint32_t numBytes)
 {
   if (mode == 'r')
@@ -172,6 +502,12 @@ void CBlockFile::Write(const void *data, uint32_t numBytes)
     WriteBytes(data, numBytes);
 }
 
+void CBlockFile::Write(const void *data, uint32_t numBytes, uint8_t *dirtyPages, unsigned pageWidth)
+{
+  if (mode == 'w')
+    WriteBytes(data, numBytes, dirtyPages, pageWidth);
+}
+
 void CBlockFile::Write(bool value)
 {
   uint8_t byte = value ? 1 : 0;
@@ -194,47 +530,42 @@ bool CBlockFile::FindBlock(const std::string &name)
 {
   if (mode != 'r')
     return FAIL;
-    
-  fseek(fp, 0, SEEK_SET);
-  
-  long int  curPos = 0;
-  while (curPos < fileSize)
-  {
-    blockStartPos = curPos;
-    
-    // Read header
-    uint32_t block_length;
-    uint32_t name_length;
-    uint32_t comment_length;
-    curPos += ReadDWord(&block_length);
-    curPos += ReadDWord(&name_length);
-    curPos += ReadDWord(&comment_length);
-    std::string block_name;
-    ReadString(&block_name, name_length);
-    
-    // Is this the block we want?
-    if (block_name == name)
-    {
-      fseek(fp, blockStartPos + 12 + name_length + comment_length, SEEK_SET); // move to beginning of data
-      dataStartPos = ftell(fp);
-      return OKAY;
-    }
-    
-    // Move to next block
-    fseek(fp, blockStartPos + block_length, SEEK_SET);
-    curPos = blockStartPos + block_length;
-    if (block_length == 0)  // this would never advance
-      break;
-  }
-  
-  return FAIL;
+  if (!indexed)
+    IndexBlocks();
+
+  auto it = blockIndex.find(name);
+  if (it == blockIndex.end())
+    return FAIL;
+  const BlockEntry &block = blocks[it->second];
+
+  // Move to beginning of data
+  EndInflate();
+  Seek(block.offset);
+  dataStartPos = Tell();
+  if (block.compression == COMPRESSION_DEFLATE)
+    return StartInflate(block);
+  return OKAY;
 }
 
-bool CBlockFile::Create(const std::string &file, const std::string &headerName, const std::string &comment)
+bool CBlockFile::Create(const std::string &file, const std::string &headerName, const std::string &comment, bool compress)
 {
   fp = fopen(file.c_str(), "wb");
   if (NULL == fp)
     return FAIL;
+  compressFile = compress;
+  fileImage.clear();
+  return Create(&fileImage, headerName, comment);
+}
+
+bool CBlockFile::Create(std::vector<uint8_t> *buffer, const std::string &headerName, const std::string &comment, std::vector<uint8_t> *delta)
+{
+  memBuffer = buffer;
+  memDelta = delta;
+  memOldSize = buffer->size();
+  memEnd = 0;
+  memPos = 0;
+  if (delta != NULL)
+    delta->clear();
   mode = 'w';
   WriteBlockHeader(headerName, comment);
   return OKAY;
@@ -242,39 +573,92 @@ bool CBlockFile::Create(const std::string &file, const std::string &headerName,
   
 bool CBlockFile::Load(const std::string &file)
 {
-  fp = fopen(file.c_str(), "rb");
-  if (NULL == fp)
+  Close();
+  if (!mappedFile.Open(file))
     return FAIL;
+  return Load(mappedFile.Data(), mappedFile.Size());
+}
+
+bool CBlockFile::Load(const uint8_t *data, size_t size)
+{
+  memData = data;
+  memPos = 0;
+  fileSize = size;
   mode = 'r';
-  
-  // TODO: is this a valid block file?
-  
-  // Get the file size
-  fseek(fp, 0, SEEK_END);
-  fileSize = ftell(fp);
-  fseek(fp, 0, SEEK_SET);
-  
+  if (OKAY != ReadDirectory())
+  {
+    Close();
+    return FAIL;
+  }
+  return OKAY;
+}
+
+bool CBlockFile::ApplyDelta(std::vector<uint8_t> *buffer, const std::vector<uint8_t> &delta)
+{
+  size_t pos = 0;
+  while (pos < delta.size())
+  {
+    uint32_t header[2];
+    if (pos + sizeof(header) > delta.size())
+      return FAIL;
+    memcpy(header, &delta[pos], sizeof(header));
+    pos += sizeof(header);
+    uint32_t offset = header[0];
+    uint32_t length = header[1];
+    if (pos + length > delta.size() || (size_t) offset + length > buffer->size())
+      return FAIL;
+    uint8_t *dest = &(*buffer)[offset];
+    for (uint32_t i = 0; i < length; i++)
+      dest[i] ^= delta[pos + i];
+    pos += length;
+  }
   return OKAY;
 }
   
 void CBlockFile::Close(void)
 {
+  if (memBuffer != NULL)
+  {
+    // Finish the last block and drop anything left over from the old image
+    if (memEnd > 0)
+      UpdateBlockSize();
+    memBuffer->resize(memEnd);
+  }
   if (fp != NULL)
+  {
+    WriteVersion2();
     fclose(fp);
+    fileImage.clear();
+    fileImage.shrink_to_fit();
+  }
+  EndInflate();
+  mappedFile.Close();
+  blocks.clear();
+  blockIndex.clear();
+  indexed = false;
   fp = NULL;
+  memBuffer = NULL;
+  memDelta = NULL;
+  memData = NULL;
   mode = 0;
 }
 
 CBlockFile::CBlockFile(void)
 {
   fp = NULL;
+  compressFile = false;
+  indexed = false;
+  inflater = NULL;
+  memBuffer = NULL;
+  memDelta = NULL;
+  memData = NULL;
+  memOldSize = 0;
+  memEnd = 0;
+  memPos = 0;
   mode = 0;   // neither reading nor writing (do nothing)
 }
 
 CBlockFile::~CBlockFile(void)
 {
-  if (fp != NULL) // in case user forgot
-    fclose(fp);
-  fp = NULL;
-  mode = 0;
+  Close();  // in case user forgot
 }
@@ -29,7 +29,13 @@
 #define INCLUDED_BLOCKFILE_H
 
 #include <cstdint>
+#include <cstdio>
 #include <string>
+#include <unordered_map>
+#include <vector>
+#include "Util/MappedFile.h"
+
+struct z_stream_s;
 
 /*
  * CBlockFile:
@@ -41,6 +47,23 @@
  * including the null terminator.
  *
  * Members do not generate any output messages.
+ *
+ * Files are written in version 2 of the format, which starts with a
+ * directory of the blocks so that they can be found without reading the rest
+ * of the file. Block data is aligned to 64 bytes and may be compressed.
+ * Files are memory mapped for reading, so that reads are copied (or
+ * decompressed) straight from the page cache into place. Version 1 files, a
+ * plain series of blocks, can still be read and are indexed on the first
+ * FindBlock().
+ *
+ * Block files can also be kept entirely in memory (see the Create() and
+ * Load() overloads taking a buffer), which is how rewind snapshots are taken.
+ * A memory image that is rewritten with the same sequence of blocks is
+ * overwritten in place, and the bytes that change can optionally be recorded
+ * as an XOR delta (see ApplyDelta()). Large regions whose writes are tracked
+ * with dirty page bitmaps can then be written with the Write() overload that
+ * takes the bitmap, so that only pages written since the previous delta are
+ * looked at.
  */
 class CBlockFile
 {
@@ -110,6 +133,24 @@ public:
    */
   void Write(const void *data, uint32_t numBytes);
 
+  /*
+   * Write(data, numBytes, dirtyPages, pageWidth):
+   *
+   * As above, for a memory region whose writes are tracked with a dirty page
+   * bitmap (bit n set when page n has been written to, pages 1<<pageWidth
+   * bytes long). When recording a delta, pages not marked in the bitmap are
+   * assumed unchanged since the previous delta was recorded and are skipped
+   * entirely, and the bitmap is cleared. Otherwise, the bitmap is ignored.
+   *
+   * Parameters:
+   *    data        Data to write.
+   *    numBytes    Number of bytes to write.
+   *    dirtyPages  Dirty page bitmap covering the data. May be NULL if pages
+   *                are not being tracked.
+   *    pageWidth   Log2 of page size.
+   */
+  void Write(const void *data, uint32_t numBytes, uint8_t *dirtyPages, unsigned pageWidth);
+
   /*
    * Write(str):
    *
@@ -134,22 +175,48 @@ public:
   void NewBlock(const std::string &title, const std::string &comment);
 
   /*
-   * Create(file, headerName, comment):
+   * Create(file, headerName, comment, compress):
    *
    * Opens a block file for writing and creates the header block. This  
    * function must be called before attempting to write data. Otherwise, all
    * write commands will be silently ignored. Read commands will be ignored
    * and will always return 0's.
+   *
+   * The blocks are collected in memory and the file is written out when it
+   * is closed.
    * 
    * Parameters:
    *    file        File path.
    *    headerName  Block name for header. Must be unique and not NULL.
    *    comment     Comment string that will be embedded into file header.
+   *    compress    If true, blocks large enough to benefit are compressed.
    *
    * Returns:
      *    OKAY if successfully opened, otherwise FAIL.
    */
-  bool Create(const std::string &file, const std::string &headerName, const std::string &comment);
+  bool Create(const std::string &file, const std::string &headerName, const std::string &comment, bool compress = false);
+
+  /*
+   * Create(buffer, headerName, comment, delta):
+   *
+   * Begins writing a block file image to memory. The buffer's previous
+   * contents are overwritten in place and it is resized to fit the image
+   * when the file is closed.
+   *
+   * Parameters:
+   *    buffer      Buffer to write the image to. Must remain valid until the
+   *                file is closed.
+   *    headerName  Block name for header.
+   *    comment     Comment string that will be embedded into header.
+   *    delta       If not NULL, receives the XOR difference between the
+   *                previous and new contents of the buffer where the two
+   *                overlap. Applying it to the new image with ApplyDelta()
+   *                yields the old one (and vice versa).
+   *
+   * Returns:
+   *    OKAY.
+   */
+  bool Create(std::vector<uint8_t> *buffer, const std::string &headerName, const std::string &comment, std::vector<uint8_t> *delta = NULL);
 
   /*
    * Load(file):
@@ -160,13 +227,43 @@ public:
    *    file  File path.
    *
    * Returns:
-   *    OKAY if successfully opened and confirmed to be a valid Supermodel
-   *    block file, otherwise FAIL. If the file could not be opened, all 
+   *    OKAY if successfully opened and (for version 2 files) its directory
+   *    is valid, otherwise FAIL. If the file could not be opened, all 
    *    subsequent operations will be silently ignored (reads will return
    *    0's). Write commands will be ignored.
    */
   bool Load(const std::string &file);
 
+  /*
+   * Load(data, size):
+   *
+   * Opens a block file image in memory for reading. The data must remain
+   * valid until the file is closed.
+   *
+   * Parameters:
+   *    data  Block file image.
+   *    size  Size of image in bytes.
+   *
+   * Returns:
+   *    OKAY, or FAIL if the image has an invalid version 2 directory.
+   */
+  bool Load(const uint8_t *data, size_t size);
+
+  /*
+   * ApplyDelta(buffer, delta):
+   *
+   * Applies a delta recorded by Create() to a memory image, converting the
+   * image written to the one that was overwritten.
+   *
+   * Parameters:
+   *    buffer  Block file image.
+   *    delta   Delta recorded when the image was written.
+   *
+   * Returns:
+   *    OKAY, or FAIL if the delta does not fit the image.
+   */
+  static bool ApplyDelta(std::vector<uint8_t> *buffer, const std::vector<uint8_t> &delta);
+
   /*
    * Close(void):
    *
@@ -184,22 +281,69 @@ public:
   ~CBlockFile(void);
 
 private:
+  enum Compression
+  {
+    COMPRESSION_NONE    = 0,
+    COMPRESSION_DEFLATE = 1
+  };
+
+  struct BlockEntry
+  {
+    std::string name;
+    std::string comment;
+    uint64_t    offset;       // start of data in file
+    uint64_t    storedSize;   // size of data in file
+    uint64_t    size;         // size of data once decompressed
+    uint32_t    compression;
+  };
+
   // Helper functions
-  void      ReadString(std::string *str, uint32_t length);
+  bool      IsOpen(void) const;
+  bool      ReadDirectory(void);
+  static void ScanVersion1(const uint8_t *data, size_t size, std::vector<BlockEntry> *blocks);
+  void      IndexBlocks(void);
+  bool      StartInflate(const BlockEntry &block);
+  void      EndInflate(void);
+  void      WriteVersion2(void);
+  long int  Tell(void) const;
+  void      Seek(long int pos);
+  unsigned  ReadRaw(void *data, uint32_t numBytes);
+  void      WriteRaw(const void *data, uint32_t numBytes, uint8_t *dirtyPages = NULL, unsigned pageWidth = 0);
+  void      WriteMemory(const uint8_t *data, uint32_t numBytes);
   unsigned  ReadBytes(void *data, uint32_t numBytes);
-  unsigned  ReadDWord(uint32_t *data);
   void      UpdateBlockSize(void);
   void      WriteByte(uint8_t data);
   void      WriteDWord(uint32_t data);
-  void      WriteBytes(const void *data, uint32_t numBytes);
+  void      WriteBytes(const void *data, uint32_t numBytes, uint8_t *dirtyPages = NULL, unsigned pageWidth = 0);
   void      WriteBlockHeader(const std::string &name, const std::string &comment);
 
   // File state data
-  FILE      *fp;
+  FILE      *fp;            // file being written, when closed
+  bool      compressFile;
   int       mode;           // 'r' for read, 'w' for write
   long int  fileSize;       // size of file in bytes
   long int  blockStartPos;  // points to beginning of current block (or file) header
   long int  dataStartPos;   // points to beginning of current block's data section 
+
+  // Block directory (read from version 2 files, built for version 1)
+  std::vector<BlockEntry>                   blocks;
+  std::unordered_map<std::string, size_t>   blockIndex;
+  bool                                      indexed;
+
+  // File being read
+  Util::MappedFile      mappedFile;
+
+  // Decompression of the current block, if compressed
+  struct z_stream_s     *inflater;
+
+  // Memory image state. Files are also written to memory first.
+  std::vector<uint8_t>  fileImage;      // image of file being written
+  std::vector<uint8_t>  *memBuffer;     // image being written
+  std::vector<uint8_t>  *memDelta;      // delta being recorded, if any
+  const uint8_t         *memData;       // image being read
+  size_t                memOldSize;     // size of image being overwritten
+  size_t                memEnd;         // end of data written so far
+  long int              memPos;         // current position
 };
 
 
@@ -35,6 +35,8 @@
 
 #include "68K.h"
 
+#include <cstddef>
+
 #include "Supermodel.h"
 #include "Musashi/m68k.h"	// Musashi 68K core
 #include "Debugger/CPU/Musashi68KDebug.h"
@@ -42,24 +44,21 @@
 /******************************************************************************
  Internal Context
  
- An active context must be mapped before calling M68K interface functions. Only
- the bus and IRQ handlers are copied here; the CPU context is passed directly
- to Musashi.
+ An active context must be mapped before calling M68K interface functions.
+ Nothing is copied: Musashi is bound to the CPU state inside the context and
+ the handlers below read the bus, IRQ callback and debugger straight out of
+ it. Both bindings are per thread (see M68K_THREAD_LOCAL in m68kconf.h).
 ******************************************************************************/
 
-// Bus
-static IBus	*s_Bus = NULL;
-
-#ifdef SUPERMODEL_DEBUGGER
-// Debugger
-static Debugger::CMusashi68KDebug *s_Debug = NULL;
-#endif
+static M68K_THREAD_LOCAL M68KCtx *s_ctx = NULL;
 
-// IRQ callback
-static int	(*IRQAck)(int nIRQ) = NULL;
+// The memory handlers are given the Musashi core, which is the start of its context
+static_assert(offsetof(M68KCtx, musashiCtx) == 0, "musashiCtx must be the first member of M68KCtx");
 
-// Cycles remaining in timeslice
-static int s_lastCycles;
+static inline IBus *BusOf(void *core)
+{
+	return reinterpret_cast<M68KCtx *>(core)->Bus;
+}
 
 
 /******************************************************************************
@@ -127,10 +126,8 @@ void M68KSaveState(CBlockFile *StateFile, const char *name)
 	 * version has to be changed, so don't do it!
 	 */
 	 
-	UINT32			data[34];
-	m68ki_cpu_core	Ctx;
-	
-	m68k_get_context(&Ctx);
+	UINT32					data[34];
+	const m68ki_cpu_core	&Ctx = s_ctx->musashiCtx;
 	
 	data[0] = Ctx.int_level;
 	data[1] = Ctx.int_cycles;
@@ -179,16 +176,14 @@ void M68KLoadState(CBlockFile *StateFile, const char *name)
 	}
 
 	UINT32			data[34];
-	m68ki_cpu_core	Ctx;
+	m68ki_cpu_core	&Ctx = s_ctx->musashiCtx;
 		
 	StateFile->Read(data, sizeof(data));
 	
 	// These must be set first, to ensure another contexts' IRQs aren't active when PC is changed 
-	m68k_get_context(&Ctx);
 	Ctx.int_level = data[0];
 	Ctx.int_cycles = data[1];
 	Ctx.stopped = data[2];
-	m68k_set_context(&Ctx);	// write them back to context
 	m68k_set_reg(M68K_REG_D0, data[3]);
 	m68k_set_reg(M68K_REG_D1, data[4]);
 	m68k_set_reg(M68K_REG_D2, data[5]);
@@ -232,18 +227,18 @@ void M68KSetIRQ(int irqLevel)
 int M68KRun(int numCycles)
 {
 #ifdef SUPERMODEL_DEBUGGER
-	if (s_Debug != NULL)
+	if (s_ctx->Debug != NULL)
 	{
-		s_Debug->CPUActive();
-		s_lastCycles += numCycles;
+		s_ctx->Debug->CPUActive();
+		s_ctx->lastCycles += numCycles;
 	}
 #endif // SUPERMODEL_DEBUGGER
 	int doneCycles = m68k_execute(numCycles);
 #ifdef SUPERMODEL_DEBUGGER
-	if (s_Debug != NULL)
+	if (s_ctx->Debug != NULL)
 	{
-		s_Debug->CPUInactive();
-		s_lastCycles -= m68k_cycles_remaining();
+		s_ctx->Debug->CPUInactive();
+		s_ctx->lastCycles -= m68k_cycles_remaining();
 	}
 #endif // SUPERMODEL_DEBUGGER
 	return doneCycles;
@@ -253,7 +248,7 @@ void M68KReset(void)
 {
 	m68k_pulse_reset();
 #ifdef SUPERMODEL_DEBUGGER
-	s_lastCycles = 0;
+	s_ctx->lastCycles = 0;
 #endif
 	DebugLog("68K reset\n");
 }
@@ -262,35 +257,26 @@ void M68KReset(void)
 
 void M68KSetIRQCallback(int (*F)(int nIRQ))
 {
-	IRQAck = F;
+	s_ctx->IRQAck = F;
 }
 
 void M68KAttachBus(IBus *BusPtr)
 {
-	s_Bus = BusPtr;
+	s_ctx->Bus = BusPtr;
 	DebugLog("Attached bus to 68K\n");
 }
 
 // Context switching
 
-void M68KGetContext(M68KCtx *Dest)
+M68KCtx *M68KGetContext(void)
 {
-	Dest->IRQAck = IRQAck;
-	Dest->Bus = s_Bus;
-#ifdef SUPERMODEL_DEBUGGER
-	Dest->Debug = s_Debug;
-#endif // SUPERMODEL_DEBUGGER
-	m68k_get_context(&(Dest->musashiCtx));
+	return s_ctx;
 }
 
-void M68KSetContext(M68KCtx *Src)
+void M68KSetContext(M68KCtx *Ctx)
 {
-	IRQAck = Src->IRQAck;
-	s_Bus = Src->Bus;
-#ifdef SUPERMODEL_DEBUGGER
-	s_Debug = Src->Debug;
-#endif // SUPERMODEL_DEBUGGER
-	m68k_set_context(&(Src->musashiCtx));
+	s_ctx = Ctx;
+	m68k_bind_context(Ctx != NULL ? &(Ctx->musashiCtx) : NULL);
 }
 
 // One-time initialization
@@ -300,9 +286,9 @@ bool M68KInit(void)
 	m68k_init();
 	m68k_set_cpu_type(M68K_CPU_TYPE_68000);
 	m68k_set_int_ack_callback(M68KIRQCallback);
-	s_Bus = NULL;
+	s_ctx->Bus = NULL;
 #ifdef SUPERMODEL_DEBUGGER
-	s_Debug = NULL;
+	s_ctx->Debug = NULL;
 #endif // SUPERMODEL_DEBUGGER
 	DebugLog("Initialized 68K\n");
 	return OKAY;
@@ -375,12 +361,12 @@ extern "C" {
 #ifdef SUPERMODEL_DEBUGGER
 void M68KDebugCallback()
 {
-	if (s_Debug != NULL)
+	if (s_ctx->Debug != NULL)
 	{
 		UINT32 pc = m68k_get_reg(NULL, M68K_REG_PC);
-		UINT32 opcode = s_Bus->Read16(pc);
-		s_Debug->CPUExecute(pc, opcode, s_lastCycles - m68k_cycles_remaining());
-		s_lastCycles = m68k_cycles_remaining();
+		UINT32 opcode = s_ctx->Bus->Read16(pc);
+		s_ctx->Debug->CPUExecute(pc, opcode, s_ctx->lastCycles - m68k_cycles_remaining());
+		s_ctx->lastCycles = m68k_cycles_remaining();
 	}
 }
 #endif // SUPERMODEL_DEBUGGER
@@ -388,64 +374,64 @@ void M68KDebugCallback()
 int M68KIRQCallback(int nIRQ)
 {
 #ifdef SUPERMODEL_DEBUGGER
-	if (s_Debug != NULL)
+	if (s_ctx->Debug != NULL)
 	{
-		s_Debug->CPUException(25);
-		s_Debug->CPUInterrupt(nIRQ - 1);
+		s_ctx->Debug->CPUException(25);
+		s_ctx->Debug->CPUInterrupt(nIRQ - 1);
 	}
 #endif // SUPERMODEL_DEBUGGER
-	if (NULL == IRQAck)	// no handler, use default behavior
+	if (NULL == s_ctx->IRQAck)	// no handler, use default behavior
 	{
 		m68k_set_irq(0);	// clear line
 		return M68K_IRQ_AUTOVECTOR;
 	}
 	else
-		return IRQAck(nIRQ);
+		return s_ctx->IRQAck(nIRQ);
 }
 
-unsigned int FASTCALL M68KFetch8(unsigned int a)
+unsigned int FASTCALL M68KFetch8(void *core, unsigned int a)
 {
-	return s_Bus->Read8(a);
+	return BusOf(core)->Read8(a);
 }
 
-unsigned int FASTCALL M68KFetch16(unsigned int a)
+unsigned int FASTCALL M68KFetch16(void *core, unsigned int a)
 {
-	return s_Bus->Read16(a);
+	return BusOf(core)->Read16(a);
 }
 
-unsigned int FASTCALL M68KFetch32(unsigned int a)
+unsigned int FASTCALL M68KFetch32(void *core, unsigned int a)
 {
-	return s_Bus->Read32(a);
+	return BusOf(core)->Read32(a);
 }
 
-unsigned int FASTCALL M68KRead8(unsigned int a)
+unsigned int FASTCALL M68KRead8(void *core, unsigned int a)
 {
-	return s_Bus->Read8(a);
+	return BusOf(core)->Read8(a);
 }
 
-unsigned int FASTCALL M68KRead16(unsigned int a)
+unsigned int FASTCALL M68KRead16(void *core, unsigned int a)
 {
-	return s_Bus->Read16(a);
+	return BusOf(core)->Read16(a);
 }
 
-unsigned int FASTCALL M68KRead32(unsigned int a)
+unsigned int FASTCALL M68KRead32(void *core, unsigned int a)
 {
-	return s_Bus->Read32(a);
+	return BusOf(core)->Read32(a);
 }
 
-void FASTCALL M68KWrite8(unsigned int a, unsigned int d)
+void FASTCALL M68KWrite8(void *core, unsigned int a, unsigned int d)
 {
-	s_Bus->Write8(a, d);
+	BusOf(core)->Write8(a, d);
 }
 
-void FASTCALL M68KWrite16(unsigned int a, unsigned int d)
+void FASTCALL M68KWrite16(void *core, unsigned int a, unsigned int d)
 {
-	s_Bus->Write16(a, d);
+	BusOf(core)->Write16(a, d);
 }
 
-void FASTCALL M68KWrite32(unsigned int a, unsigned int d)
+void FASTCALL M68KWrite32(void *core, unsigned int a, unsigned int d)
 {
-	s_Bus->Write32(a, d);
+	BusOf(core)->Write32(a, d);
 }
 
 }	// extern "C"
@@ -22,7 +22,9 @@
 /*
  * 68K.h
  * 
- * Header file for 68K CPU interface. Caution: 68K emulator is not thread-safe.
+ * Header file for 68K CPU interface. Each thread has its own active context, so
+ * different 68Ks may run concurrently (provided M68K_REENTRANT is set), but a
+ * single context must only be used by one thread at a time.
  *
  * TO-DO List:
  * -----------
@@ -69,7 +71,9 @@ namespace Debugger {
  *
  * Complete state of a single 68K. Do NOT manipulate these directly. Set the
  * context and then use the M68K* functions below to attach a bus and IRQ
- * callback to the active context.
+ * callback to the active context. The CPU runs directly out of the context
+ * while it is active, so it must not be moved or destroyed until another one
+ * is set.
  */
 typedef struct SM68KCtx
 {
@@ -79,6 +83,7 @@ public:
 	int				(*IRQAck)(int);	// IRQ acknowledge callback
 #ifdef SUPERMODEL_DEBUGGER
 	Debugger::CMusashi68KDebug *Debug;        // holds debugger (if attached)
+	int				lastCycles;		// cycles remaining in timeslice at last debugger callback
 #endif // SUPERMODEL_DEBUGGER
 
 	SM68KCtx(void)
@@ -88,6 +93,7 @@ public:
 		memset(&musashiCtx, 0, sizeof(musashiCtx));	// very important! garbage in context at reset can cause very strange bugs
 #ifdef SUPERMODEL_DEBUGGER
 		Debug = NULL;
+		lastCycles = 0;
 #endif // SUPERMODEL_DEBUGGER
 	}
 	
@@ -102,7 +108,8 @@ public:
 /******************************************************************************
  68K Interface
  
- Unless otherwise noted, all functions operate on the active context.
+ Unless otherwise noted, all functions operate on the active context of the
+ calling thread.
 ******************************************************************************/
 	
 /*
@@ -243,24 +250,24 @@ extern void M68KAttachBus(IBus *BusPtr);
 extern bool M68KInit(void);
 
 /*
- * M68KGetContext(M68KCtx *Dest):
+ * M68KGetContext():
  *
- * Copies the internal (active) 68K context back to the destination.
- *
- * Parameters:
- *		Dest	Location to which to copy 68K context.
+ * Returns:
+ *		The active context of the calling thread (NULL if none was set).
  */
-extern void M68KGetContext(M68KCtx *Dest);
+extern M68KCtx *M68KGetContext(void);
 
 /*
- * M68KSetContext(M68KCtx *Src):
+ * M68KSetContext(Ctx):
  *
- * Sets the specified 68K context by copying it to the internal context.
+ * Makes the specified 68K context active on the calling thread. Nothing is
+ * copied: the CPU runs directly out of the context, so there is no need to
+ * fetch it back afterwards.
  *
  * Parameters:
- *		Src		Location from which to copy 68K context.
+ *		Ctx		Context to activate.
  */
-extern void M68KSetContext(M68KCtx *Src);
+extern void M68KSetContext(M68KCtx *Ctx);
 
 #ifdef SUPERMODEL_DEBUGGER
 #define DBG68K_REG_PC 0
@@ -339,53 +346,56 @@ extern void M68KDebugCallback();
 extern int M68KIRQCallback(int nIRQ);
 
 /*
- * M68KFetch8(a):
- * M68KFetch16(a):
- * M68KFetch32(a):
+ * M68KFetch8(core, a):
+ * M68KFetch16(core, a):
+ * M68KFetch32(core, a):
  *
  * Read data from the program address space.
  *
  * Parameters:
+ *		core	Executing Musashi core (musashiCtx of the active context).
  *		a		Address to read from.
  *
  * Returns:
  *		The 8, 16, or 32-bit value read.
  */
-unsigned int FASTCALL M68KFetch8(unsigned int a);
-unsigned int FASTCALL M68KFetch16(unsigned int a);
-unsigned int FASTCALL M68KFetch32(unsigned int a);
+unsigned int FASTCALL M68KFetch8(void *core, unsigned int a);
+unsigned int FASTCALL M68KFetch16(void *core, unsigned int a);
+unsigned int FASTCALL M68KFetch32(void *core, unsigned int a);
 
 /*
- * M68KRead8(a):
- * M68KRead16(a):
- * M68KRead32(a):
+ * M68KRead8(core, a):
+ * M68KRead16(core, a):
+ * M68KRead32(core, a):
  *
  * Read data from the data address space.
  *
  * Parameters:
+ *		core	Executing Musashi core (musashiCtx of the active context).
  *		a		Address to read from.
  *
  * Returns:
  *		The 8, 16, or 32-bit value read.
  */
-unsigned int FASTCALL M68KRead8(unsigned int a);
-unsigned int FASTCALL M68KRead16(unsigned int a);
-unsigned int FASTCALL M68KRead32(unsigned int a);
+unsigned int FASTCALL M68KRead8(void *core, unsigned int a);
+unsigned int FASTCALL M68KRead16(void *core, unsigned int a);
+unsigned int FASTCALL M68KRead32(void *core, unsigned int a);
 
 /*
- * M68KWrite8(a, d):
- * M68KWrite16(a, d):
- * M68KWrite32(a, d):
+ * M68KWrite8(core, a, d):
+ * M68KWrite16(core, a, d):
+ * M68KWrite32(core, a, d):
  *
  * Writes to the data address space.
  *
  * Parameters:
+ *		core	Executing Musashi core (musashiCtx of the active context).
  *		a		Address to write to.
  *		d		Data to write.
  */
-void FASTCALL M68KWrite8(unsigned int a, unsigned int d);
-void FASTCALL M68KWrite16(unsigned int a, unsigned int d);
-void FASTCALL M68KWrite32(unsigned int a, unsigned int d);
+void FASTCALL M68KWrite8(void *core, unsigned int a, unsigned int d);
+void FASTCALL M68KWrite16(void *core, unsigned int a, unsigned int d);
+void FASTCALL M68KWrite32(void *core, unsigned int a, unsigned int d);
 
 }	// extern "C"
 
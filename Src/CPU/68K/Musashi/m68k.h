@@ -354,6 +354,14 @@ unsigned int m68k_get_context(void* dst);
 /* set the current cpu context */
 void m68k_set_context(void* dst);
 
+/* Make the calling thread execute directly out of a context (no copy is made,
+ * so it must stay valid while bound). NULL binds the default context.
+ */
+void m68k_bind_context(void* ctx);
+
+/* Context bound to the calling thread */
+void* m68k_get_bound_context(void);
+
 /* Register the CPU state information */
 void m68k_state_register(const char *type);
 
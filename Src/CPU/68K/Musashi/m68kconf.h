@@ -207,6 +207,24 @@
  Supermodel Interface
 ******************************************************************************/
 
+/* The core runs out of whichever context was last bound on the calling thread
+ * (m68k_bind_context()), so the sound board and DSB 68Ks can execute at the
+ * same time on different threads. Where TLS is emulated (Android before API
+ * 29) every register access would become a function call, so there the
+ * binding is a plain global and M68K_REENTRANT tells callers not to run two
+ * 68Ks at once.
+ */
+#if defined(__ANDROID__) && (!defined(__ANDROID_MIN_SDK_VERSION__) || __ANDROID_MIN_SDK_VERSION__ < 29)
+	#define M68K_THREAD_LOCAL
+	#define M68K_REENTRANT	0
+#elif defined(_MSC_VER)
+	#define M68K_THREAD_LOCAL	__declspec(thread)
+	#define M68K_REENTRANT	1
+#else
+	#define M68K_THREAD_LOCAL	__thread
+	#define M68K_REENTRANT	1
+#endif
+
 // Supermodel 68K interface (these functions defined in CPU/68K.cpp)
 //#ifndef FASTCALL (this doesn't work for now (needs to be added to the prototypes in m68k.h for m68k_read_memory*)
 	#undef FASTCALL
@@ -215,39 +233,42 @@
 
 extern int M68KIRQCallback(int irq);
 
-unsigned int FASTCALL M68KFetch8(unsigned int a);
-unsigned int FASTCALL M68KFetch16(unsigned int a);
-unsigned int FASTCALL M68KFetch32(unsigned int a);
-unsigned int FASTCALL M68KRead8(unsigned int a);
-unsigned int FASTCALL M68KRead16(unsigned int a);
-unsigned int FASTCALL M68KRead32(unsigned int a);
-void FASTCALL M68KWrite8(unsigned int a, unsigned int d);
-void FASTCALL M68KWrite16(unsigned int a, unsigned int d);
-void FASTCALL M68KWrite32(unsigned int a, unsigned int d);
+/* The handlers are passed the executing core, which is the musashiCtx at the
+ * start of the active M68KCtx, so they don't have to look the context up
+ */
+unsigned int FASTCALL M68KFetch8(void *core, unsigned int a);
+unsigned int FASTCALL M68KFetch16(void *core, unsigned int a);
+unsigned int FASTCALL M68KFetch32(void *core, unsigned int a);
+unsigned int FASTCALL M68KRead8(void *core, unsigned int a);
+unsigned int FASTCALL M68KRead16(void *core, unsigned int a);
+unsigned int FASTCALL M68KRead32(void *core, unsigned int a);
+void FASTCALL M68KWrite8(void *core, unsigned int a, unsigned int d);
+void FASTCALL M68KWrite16(void *core, unsigned int a, unsigned int d);
+void FASTCALL M68KWrite32(void *core, unsigned int a, unsigned int d);
 
 /* Read data relative to the PC */
-#define m68k_read_pcrelative_8(address) M68KFetch8(address)
-#define m68k_read_pcrelative_16(address) M68KFetch16(address)
-#define m68k_read_pcrelative_32(address) M68KFetch32(address)
+#define m68k_read_pcrelative_8(address) M68KFetch8(m68ki_cpu_p, address)
+#define m68k_read_pcrelative_16(address) M68KFetch16(m68ki_cpu_p, address)
+#define m68k_read_pcrelative_32(address) M68KFetch32(m68ki_cpu_p, address)
 
 /* Read data immediately following the PC */
-#define m68k_read_immediate_16(address) M68KFetch16(address)
-#define m68k_read_immediate_32(address) M68KFetch32(address)
+#define m68k_read_immediate_16(address) M68KFetch16(m68ki_cpu_p, address)
+#define m68k_read_immediate_32(address) M68KFetch32(m68ki_cpu_p, address)
 
 /* Memory access for the disassembler */
-#define m68k_read_disassembler_8(address) M68KRead8(address)
-#define m68k_read_disassembler_16(address) M68KRead16(address)
-#define m68k_read_disassembler_32(address) M68KRead32(address)
+#define m68k_read_disassembler_8(address) M68KRead8(m68k_get_bound_context(), address)
+#define m68k_read_disassembler_16(address) M68KRead16(m68k_get_bound_context(), address)
+#define m68k_read_disassembler_32(address) M68KRead32(m68k_get_bound_context(), address)
 
 /* Read from anywhere */
-#define m68k_read_memory_8(address) M68KRead8(address)
-#define m68k_read_memory_16(address) M68KRead16(address)
-#define m68k_read_memory_32(address) M68KRead32(address)
+#define m68k_read_memory_8(address) M68KRead8(m68ki_cpu_p, address)
+#define m68k_read_memory_16(address) M68KRead16(m68ki_cpu_p, address)
+#define m68k_read_memory_32(address) M68KRead32(m68ki_cpu_p, address)
 
 /* Write to anywhere */
-#define m68k_write_memory_8(address, value) M68KWrite8(address, value)
-#define m68k_write_memory_16(address, value) M68KWrite16(address, value)
-#define m68k_write_memory_32(address, value) M68KWrite32(address, value)
+#define m68k_write_memory_8(address, value) M68KWrite8(m68ki_cpu_p, address, value)
+#define m68k_write_memory_16(address, value) M68KWrite16(m68ki_cpu_p, address, value)
+#define m68k_write_memory_32(address, value) M68KWrite32(m68ki_cpu_p, address, value)
 
 
 /* ======================================================================== */
@@ -73,11 +73,6 @@ static const char* copyright_notice =
 /* ================================= DATA ================================= */
 /* ======================================================================== */
 
-int  m68ki_initial_cycles;
-int  m68ki_remaining_cycles = 0;                     /* Number of clocks remaining */
-uint m68ki_tracing = 0;
-uint m68ki_address_space;
-
 #ifdef M68K_LOG_ENABLE
 const char* m68ki_cpu_names[] =
 {
@@ -101,17 +96,16 @@ const char* m68ki_cpu_names[] =
 };
 #endif /* M68K_LOG_ENABLE */
 
-/* The CPU core */
-m68ki_cpu_core m68ki_cpu = {0};
+/* The CPU core. Contexts are bound per thread rather than copied in and out;
+ * the default one only exists so that an unbound thread doesn't crash.
+ */
+static m68ki_cpu_core m68ki_default_cpu = {0};
+M68K_THREAD_LOCAL m68ki_cpu_core *m68ki_cpu_p = &m68ki_default_cpu;
 
 #if M68K_EMULATE_ADDRESS_ERROR
 jmp_buf m68ki_aerr_trap;
 #endif /* M68K_EMULATE_ADDRESS_ERROR */
 
-uint    m68ki_aerr_address;
-uint    m68ki_aerr_write_mode;
-uint    m68ki_aerr_fc;
-
 /* Used by shift & rotate instructions */
 const uint8 m68ki_shift_8_table[65] =
 {
@@ -713,6 +707,12 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 /* ASG: removed per-instruction interrupt checks */
 int m68k_execute(int num_cycles)
 {
+	/* Shadows the thread's binding and is handed to every opcode handler, so
+	 * nothing below reads the thread-local again (the context can't change
+	 * while it is executing)
+	 */
+	m68ki_cpu_core* const m68ki_cpu_p = m68k_get_bound_context();
+
 	/* Make sure we're not stopped */
 	if(!CPU_STOPPED)
 	{
@@ -744,7 +744,7 @@ int m68k_execute(int num_cycles)
 
 			/* Read an instruction and call its handler */
 			REG_IR = m68ki_read_imm_16();
-			m68ki_instruction_jump_table[REG_IR]();
+			m68ki_instruction_jump_table[REG_IR](m68ki_cpu_p);
 			USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
 
 			/* Trace m68k_exception, if necessary */
@@ -892,6 +892,17 @@ void m68k_set_context(void* src)
 	if(src) m68ki_cpu = *(m68ki_cpu_core*)src;
 }
 
+/* Run directly out of the given context on the calling thread (no copy) */
+void m68k_bind_context(void* ctx)
+{
+	m68ki_cpu_p = ctx ? (m68ki_cpu_core*)ctx : &m68ki_default_cpu;
+}
+
+void* m68k_get_bound_context(void)
+{
+	return m68ki_cpu_p;
+}
+
 
 
 /* ======================================================================== */
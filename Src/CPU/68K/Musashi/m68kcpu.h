@@ -844,139 +844,253 @@ typedef unsigned int uint;
 #include "m68kctx.h"
 
 
-extern m68ki_cpu_core m68ki_cpu;
-extern sint           m68ki_remaining_cycles;
-extern uint           m68ki_tracing;
+/* Bound context of the calling thread (see m68k_bind_context()). Opcode
+ * handlers and the inline helpers below take the core as an argument named
+ * m68ki_cpu_p, which shadows this, so the thread-local is only read once per
+ * m68k_execute() call and by the API functions.
+ */
+extern M68K_THREAD_LOCAL m68ki_cpu_core *m68ki_cpu_p;
+#define m68ki_cpu (*m68ki_cpu_p)
+
+#define m68ki_remaining_cycles m68ki_cpu.remaining_cycles
+#define m68ki_initial_cycles   m68ki_cpu.initial_cycles
+#define m68ki_tracing          m68ki_cpu.tracing
+#define m68ki_address_space    m68ki_cpu.address_space
+#define m68ki_aerr_address     m68ki_cpu.aerr_address
+#define m68ki_aerr_write_mode  m68ki_cpu.aerr_write_mode
+#define m68ki_aerr_fc          m68ki_cpu.aerr_fc
+
 extern const uint8    m68ki_shift_8_table[];
 extern const uint16   m68ki_shift_16_table[];
 extern const uint     m68ki_shift_32_table[];
 extern const uint8    m68ki_exception_cycle_table[][256];
-extern uint           m68ki_address_space;
 extern const uint8    m68ki_ea_idx_cycle_table[];
 
-extern uint           m68ki_aerr_address;
-extern uint           m68ki_aerr_write_mode;
-extern uint           m68ki_aerr_fc;
-
 /* Read data immediately after the program counter */
-INLINE uint m68ki_read_imm_16(void);
-INLINE uint m68ki_read_imm_32(void);
+INLINE uint (m68ki_read_imm_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (m68ki_read_imm_32)(m68ki_cpu_core *m68ki_cpu_p);
 
 /* Read data with specific function code */
-INLINE uint m68ki_read_8_fc  (uint address, uint fc);
-INLINE uint m68ki_read_16_fc (uint address, uint fc);
-INLINE uint m68ki_read_32_fc (uint address, uint fc);
+INLINE uint (m68ki_read_8_fc)  (m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc);
+INLINE uint (m68ki_read_16_fc) (m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc);
+INLINE uint (m68ki_read_32_fc) (m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc);
 
 /* Write data with specific function code */
-INLINE void m68ki_write_8_fc (uint address, uint fc, uint value);
-INLINE void m68ki_write_16_fc(uint address, uint fc, uint value);
-INLINE void m68ki_write_32_fc(uint address, uint fc, uint value);
+INLINE void (m68ki_write_8_fc) (m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc, uint value);
+INLINE void (m68ki_write_16_fc)(m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc, uint value);
+INLINE void (m68ki_write_32_fc)(m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc, uint value);
 #if M68K_SIMULATE_PD_WRITES
-INLINE void m68ki_write_32_pd_fc(uint address, uint fc, uint value);
+INLINE void (m68ki_write_32_pd_fc)(m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc, uint value);
 #endif /* M68K_SIMULATE_PD_WRITES */
 
 /* Indexed and PC-relative ea fetching */
-INLINE uint m68ki_get_ea_pcdi(void);
-INLINE uint m68ki_get_ea_pcix(void);
-INLINE uint m68ki_get_ea_ix(uint An);
+INLINE uint (m68ki_get_ea_pcdi)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (m68ki_get_ea_pcix)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (m68ki_get_ea_ix)(m68ki_cpu_core *m68ki_cpu_p, uint An);
 
 /* Operand fetching */
-INLINE uint OPER_AY_AI_8(void);
-INLINE uint OPER_AY_AI_16(void);
-INLINE uint OPER_AY_AI_32(void);
-INLINE uint OPER_AY_PI_8(void);
-INLINE uint OPER_AY_PI_16(void);
-INLINE uint OPER_AY_PI_32(void);
-INLINE uint OPER_AY_PD_8(void);
-INLINE uint OPER_AY_PD_16(void);
-INLINE uint OPER_AY_PD_32(void);
-INLINE uint OPER_AY_DI_8(void);
-INLINE uint OPER_AY_DI_16(void);
-INLINE uint OPER_AY_DI_32(void);
-INLINE uint OPER_AY_IX_8(void);
-INLINE uint OPER_AY_IX_16(void);
-INLINE uint OPER_AY_IX_32(void);
-
-INLINE uint OPER_AX_AI_8(void);
-INLINE uint OPER_AX_AI_16(void);
-INLINE uint OPER_AX_AI_32(void);
-INLINE uint OPER_AX_PI_8(void);
-INLINE uint OPER_AX_PI_16(void);
-INLINE uint OPER_AX_PI_32(void);
-INLINE uint OPER_AX_PD_8(void);
-INLINE uint OPER_AX_PD_16(void);
-INLINE uint OPER_AX_PD_32(void);
-INLINE uint OPER_AX_DI_8(void);
-INLINE uint OPER_AX_DI_16(void);
-INLINE uint OPER_AX_DI_32(void);
-INLINE uint OPER_AX_IX_8(void);
-INLINE uint OPER_AX_IX_16(void);
-INLINE uint OPER_AX_IX_32(void);
-
-INLINE uint OPER_A7_PI_8(void);
-INLINE uint OPER_A7_PD_8(void);
-
-INLINE uint OPER_AW_8(void);
-INLINE uint OPER_AW_16(void);
-INLINE uint OPER_AW_32(void);
-INLINE uint OPER_AL_8(void);
-INLINE uint OPER_AL_16(void);
-INLINE uint OPER_AL_32(void);
-INLINE uint OPER_PCDI_8(void);
-INLINE uint OPER_PCDI_16(void);
-INLINE uint OPER_PCDI_32(void);
-INLINE uint OPER_PCIX_8(void);
-INLINE uint OPER_PCIX_16(void);
-INLINE uint OPER_PCIX_32(void);
+INLINE uint (OPER_AY_AI_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_AI_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_AI_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_PI_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_PI_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_PI_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_PD_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_PD_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_PD_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_DI_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_DI_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_DI_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_IX_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_IX_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AY_IX_32)(m68ki_cpu_core *m68ki_cpu_p);
+
+INLINE uint (OPER_AX_AI_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_AI_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_AI_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_PI_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_PI_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_PI_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_PD_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_PD_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_PD_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_DI_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_DI_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_DI_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_IX_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_IX_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AX_IX_32)(m68ki_cpu_core *m68ki_cpu_p);
+
+INLINE uint (OPER_A7_PI_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_A7_PD_8)(m68ki_cpu_core *m68ki_cpu_p);
+
+INLINE uint (OPER_AW_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AW_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AW_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AL_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AL_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_AL_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_PCDI_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_PCDI_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_PCDI_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_PCIX_8)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_PCIX_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (OPER_PCIX_32)(m68ki_cpu_core *m68ki_cpu_p);
 
 /* Stack operations */
-INLINE void m68ki_push_16(uint value);
-INLINE void m68ki_push_32(uint value);
-INLINE uint m68ki_pull_16(void);
-INLINE uint m68ki_pull_32(void);
+INLINE void (m68ki_push_16)(m68ki_cpu_core *m68ki_cpu_p, uint value);
+INLINE void (m68ki_push_32)(m68ki_cpu_core *m68ki_cpu_p, uint value);
+INLINE uint (m68ki_pull_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE uint (m68ki_pull_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE void (m68ki_fake_push_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE void (m68ki_fake_push_32)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE void (m68ki_fake_pull_16)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE void (m68ki_fake_pull_32)(m68ki_cpu_core *m68ki_cpu_p);
 
 /* Program flow operations */
-INLINE void m68ki_jump(uint new_pc);
-INLINE void m68ki_jump_vector(uint vector);
-INLINE void m68ki_branch_8(uint offset);
-INLINE void m68ki_branch_16(uint offset);
-INLINE void m68ki_branch_32(uint offset);
+INLINE void (m68ki_jump)(m68ki_cpu_core *m68ki_cpu_p, uint new_pc);
+INLINE void (m68ki_jump_vector)(m68ki_cpu_core *m68ki_cpu_p, uint vector);
+INLINE void (m68ki_branch_8)(m68ki_cpu_core *m68ki_cpu_p, uint offset);
+INLINE void (m68ki_branch_16)(m68ki_cpu_core *m68ki_cpu_p, uint offset);
+INLINE void (m68ki_branch_32)(m68ki_cpu_core *m68ki_cpu_p, uint offset);
 
 /* Status register operations. */
-INLINE void m68ki_set_s_flag(uint value);            /* Only bit 2 of value should be set (i.e. 4 or 0) */
-INLINE void m68ki_set_sm_flag(uint value);           /* only bits 1 and 2 of value should be set */
-INLINE void m68ki_set_ccr(uint value);               /* set the condition code register */
-INLINE void m68ki_set_sr(uint value);                /* set the status register */
-INLINE void m68ki_set_sr_noint(uint value);          /* set the status register */
+INLINE void (m68ki_set_s_flag)(m68ki_cpu_core *m68ki_cpu_p, uint value);            /* Only bit 2 of value should be set (i.e. 4 or 0) */
+INLINE void (m68ki_set_sm_flag)(m68ki_cpu_core *m68ki_cpu_p, uint value);           /* only bits 1 and 2 of value should be set */
+INLINE void (m68ki_set_sm_flag_nosp)(m68ki_cpu_core *m68ki_cpu_p, uint value);
+INLINE void (m68ki_set_ccr)(m68ki_cpu_core *m68ki_cpu_p, uint value);               /* set the condition code register */
+INLINE void (m68ki_set_sr)(m68ki_cpu_core *m68ki_cpu_p, uint value);                /* set the status register */
+INLINE void (m68ki_set_sr_noint)(m68ki_cpu_core *m68ki_cpu_p, uint value);          /* set the status register */
+INLINE void (m68ki_set_sr_noint_nosp)(m68ki_cpu_core *m68ki_cpu_p, uint value);
 
 /* Exception processing */
-INLINE uint m68ki_init_exception(void);              /* Initial exception processing */
-
-INLINE void m68ki_stack_frame_3word(uint pc, uint sr); /* Stack various frame types */
-INLINE void m68ki_stack_frame_buserr(uint sr);
-
-INLINE void m68ki_stack_frame_0000(uint pc, uint sr, uint vector);
-INLINE void m68ki_stack_frame_0001(uint pc, uint sr, uint vector);
-INLINE void m68ki_stack_frame_0010(uint sr, uint vector);
-INLINE void m68ki_stack_frame_1000(uint pc, uint sr, uint vector);
-INLINE void m68ki_stack_frame_1010(uint sr, uint vector, uint pc);
-INLINE void m68ki_stack_frame_1011(uint sr, uint vector, uint pc);
-
-INLINE void m68ki_exception_trap(uint vector);
-INLINE void m68ki_exception_trapN(uint vector);
-INLINE void m68ki_exception_trace(void);
-INLINE void m68ki_exception_privilege_violation(void);
-INLINE void m68ki_exception_1010(void);
-INLINE void m68ki_exception_1111(void);
-INLINE void m68ki_exception_illegal(void);
-INLINE void m68ki_exception_format_error(void);
-INLINE void m68ki_exception_address_error(void);
-INLINE void m68ki_exception_interrupt(uint int_level);
-INLINE void m68ki_check_interrupts(void);            /* ASG: check for interrupts */
+INLINE uint (m68ki_init_exception)(m68ki_cpu_core *m68ki_cpu_p);              /* Initial exception processing */
+
+INLINE void (m68ki_stack_frame_3word)(m68ki_cpu_core *m68ki_cpu_p, uint pc, uint sr); /* Stack various frame types */
+INLINE void (m68ki_stack_frame_buserr)(m68ki_cpu_core *m68ki_cpu_p, uint sr);
+
+INLINE void (m68ki_stack_frame_0000)(m68ki_cpu_core *m68ki_cpu_p, uint pc, uint sr, uint vector);
+INLINE void (m68ki_stack_frame_0001)(m68ki_cpu_core *m68ki_cpu_p, uint pc, uint sr, uint vector);
+INLINE void (m68ki_stack_frame_0010)(m68ki_cpu_core *m68ki_cpu_p, uint sr, uint vector);
+INLINE void (m68ki_stack_frame_1000)(m68ki_cpu_core *m68ki_cpu_p, uint pc, uint sr, uint vector);
+INLINE void (m68ki_stack_frame_1010)(m68ki_cpu_core *m68ki_cpu_p, uint sr, uint vector, uint pc);
+INLINE void (m68ki_stack_frame_1011)(m68ki_cpu_core *m68ki_cpu_p, uint sr, uint vector, uint pc);
+
+INLINE void (m68ki_exception_trap)(m68ki_cpu_core *m68ki_cpu_p, uint vector);
+INLINE void (m68ki_exception_trapN)(m68ki_cpu_core *m68ki_cpu_p, uint vector);
+INLINE void (m68ki_exception_trace)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE void (m68ki_exception_privilege_violation)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE void (m68ki_exception_1010)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE void (m68ki_exception_1111)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE void (m68ki_exception_illegal)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE void (m68ki_exception_format_error)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE void (m68ki_exception_address_error)(m68ki_cpu_core *m68ki_cpu_p);
+INLINE void (m68ki_exception_interrupt)(m68ki_cpu_core *m68ki_cpu_p, uint int_level);
+INLINE void (m68ki_check_interrupts)(m68ki_cpu_core *m68ki_cpu_p);            /* ASG: check for interrupts */
 
 /* quick disassembly (used for logging) */
 char* m68ki_disassemble_quick(unsigned int pc, unsigned int cpu_type);
 
+/* Calls pass the core along implicitly (the names are parenthesized above so
+ * the definitions aren't expanded)
+ */
+#define m68ki_read_imm_16() m68ki_read_imm_16(m68ki_cpu_p)
+#define m68ki_read_imm_32() m68ki_read_imm_32(m68ki_cpu_p)
+#define m68ki_read_8_fc(address, fc) m68ki_read_8_fc(m68ki_cpu_p, address, fc)
+#define m68ki_read_16_fc(address, fc) m68ki_read_16_fc(m68ki_cpu_p, address, fc)
+#define m68ki_read_32_fc(address, fc) m68ki_read_32_fc(m68ki_cpu_p, address, fc)
+#define m68ki_write_8_fc(address, fc, value) m68ki_write_8_fc(m68ki_cpu_p, address, fc, value)
+#define m68ki_write_16_fc(address, fc, value) m68ki_write_16_fc(m68ki_cpu_p, address, fc, value)
+#define m68ki_write_32_fc(address, fc, value) m68ki_write_32_fc(m68ki_cpu_p, address, fc, value)
+#define m68ki_write_32_pd_fc(address, fc, value) m68ki_write_32_pd_fc(m68ki_cpu_p, address, fc, value)
+#define m68ki_get_ea_pcdi() m68ki_get_ea_pcdi(m68ki_cpu_p)
+#define m68ki_get_ea_pcix() m68ki_get_ea_pcix(m68ki_cpu_p)
+#define m68ki_get_ea_ix(An) m68ki_get_ea_ix(m68ki_cpu_p, An)
+#define OPER_AY_AI_8() OPER_AY_AI_8(m68ki_cpu_p)
+#define OPER_AY_AI_16() OPER_AY_AI_16(m68ki_cpu_p)
+#define OPER_AY_AI_32() OPER_AY_AI_32(m68ki_cpu_p)
+#define OPER_AY_PI_8() OPER_AY_PI_8(m68ki_cpu_p)
+#define OPER_AY_PI_16() OPER_AY_PI_16(m68ki_cpu_p)
+#define OPER_AY_PI_32() OPER_AY_PI_32(m68ki_cpu_p)
+#define OPER_AY_PD_8() OPER_AY_PD_8(m68ki_cpu_p)
+#define OPER_AY_PD_16() OPER_AY_PD_16(m68ki_cpu_p)
+#define OPER_AY_PD_32() OPER_AY_PD_32(m68ki_cpu_p)
+#define OPER_AY_DI_8() OPER_AY_DI_8(m68ki_cpu_p)
+#define OPER_AY_DI_16() OPER_AY_DI_16(m68ki_cpu_p)
+#define OPER_AY_DI_32() OPER_AY_DI_32(m68ki_cpu_p)
+#define OPER_AY_IX_8() OPER_AY_IX_8(m68ki_cpu_p)
+#define OPER_AY_IX_16() OPER_AY_IX_16(m68ki_cpu_p)
+#define OPER_AY_IX_32() OPER_AY_IX_32(m68ki_cpu_p)
+#define OPER_AX_AI_8() OPER_AX_AI_8(m68ki_cpu_p)
+#define OPER_AX_AI_16() OPER_AX_AI_16(m68ki_cpu_p)
+#define OPER_AX_AI_32() OPER_AX_AI_32(m68ki_cpu_p)
+#define OPER_AX_PI_8() OPER_AX_PI_8(m68ki_cpu_p)
+#define OPER_AX_PI_16() OPER_AX_PI_16(m68ki_cpu_p)
+#define OPER_AX_PI_32() OPER_AX_PI_32(m68ki_cpu_p)
+#define OPER_AX_PD_8() OPER_AX_PD_8(m68ki_cpu_p)
+#define OPER_AX_PD_16() OPER_AX_PD_16(m68ki_cpu_p)
+#define OPER_AX_PD_32() OPER_AX_PD_32(m68ki_cpu_p)
+#define OPER_AX_DI_8() OPER_AX_DI_8(m68ki_cpu_p)
+#define OPER_AX_DI_16() OPER_AX_DI_16(m68ki_cpu_p)
+#define OPER_AX_DI_32() OPER_AX_DI_32(m68ki_cpu_p)
+#define OPER_AX_IX_8() OPER_AX_IX_8(m68ki_cpu_p)
+#define OPER_AX_IX_16() OPER_AX_IX_16(m68ki_cpu_p)
+#define OPER_AX_IX_32() OPER_AX_IX_32(m68ki_cpu_p)
+#define OPER_A7_PI_8() OPER_A7_PI_8(m68ki_cpu_p)
+#define OPER_A7_PD_8() OPER_A7_PD_8(m68ki_cpu_p)
+#define OPER_AW_8() OPER_AW_8(m68ki_cpu_p)
+#define OPER_AW_16() OPER_AW_16(m68ki_cpu_p)
+#define OPER_AW_32() OPER_AW_32(m68ki_cpu_p)
+#define OPER_AL_8() OPER_AL_8(m68ki_cpu_p)
+#define OPER_AL_16() OPER_AL_16(m68ki_cpu_p)
+#define OPER_AL_32() OPER_AL_32(m68ki_cpu_p)
+#define OPER_PCDI_8() OPER_PCDI_8(m68ki_cpu_p)
+#define OPER_PCDI_16() OPER_PCDI_16(m68ki_cpu_p)
+#define OPER_PCDI_32() OPER_PCDI_32(m68ki_cpu_p)
+#define OPER_PCIX_8() OPER_PCIX_8(m68ki_cpu_p)
+#define OPER_PCIX_16() OPER_PCIX_16(m68ki_cpu_p)
+#define OPER_PCIX_32() OPER_PCIX_32(m68ki_cpu_p)
+#define m68ki_push_16(value) m68ki_push_16(m68ki_cpu_p, value)
+#define m68ki_push_32(value) m68ki_push_32(m68ki_cpu_p, value)
+#define m68ki_pull_16() m68ki_pull_16(m68ki_cpu_p)
+#define m68ki_pull_32() m68ki_pull_32(m68ki_cpu_p)
+#define m68ki_fake_push_16() m68ki_fake_push_16(m68ki_cpu_p)
+#define m68ki_fake_push_32() m68ki_fake_push_32(m68ki_cpu_p)
+#define m68ki_fake_pull_16() m68ki_fake_pull_16(m68ki_cpu_p)
+#define m68ki_fake_pull_32() m68ki_fake_pull_32(m68ki_cpu_p)
+#define m68ki_jump(new_pc) m68ki_jump(m68ki_cpu_p, new_pc)
+#define m68ki_jump_vector(vector) m68ki_jump_vector(m68ki_cpu_p, vector)
+#define m68ki_branch_8(offset) m68ki_branch_8(m68ki_cpu_p, offset)
+#define m68ki_branch_16(offset) m68ki_branch_16(m68ki_cpu_p, offset)
+#define m68ki_branch_32(offset) m68ki_branch_32(m68ki_cpu_p, offset)
+#define m68ki_set_s_flag(value) m68ki_set_s_flag(m68ki_cpu_p, value)
+#define m68ki_set_sm_flag(value) m68ki_set_sm_flag(m68ki_cpu_p, value)
+#define m68ki_set_sm_flag_nosp(value) m68ki_set_sm_flag_nosp(m68ki_cpu_p, value)
+#define m68ki_set_ccr(value) m68ki_set_ccr(m68ki_cpu_p, value)
+#define m68ki_set_sr(value) m68ki_set_sr(m68ki_cpu_p, value)
+#define m68ki_set_sr_noint(value) m68ki_set_sr_noint(m68ki_cpu_p, value)
+#define m68ki_set_sr_noint_nosp(value) m68ki_set_sr_noint_nosp(m68ki_cpu_p, value)
+#define m68ki_init_exception() m68ki_init_exception(m68ki_cpu_p)
+#define m68ki_stack_frame_3word(pc, sr) m68ki_stack_frame_3word(m68ki_cpu_p, pc, sr)
+#define m68ki_stack_frame_buserr(sr) m68ki_stack_frame_buserr(m68ki_cpu_p, sr)
+#define m68ki_stack_frame_0000(pc, sr, vector) m68ki_stack_frame_0000(m68ki_cpu_p, pc, sr, vector)
+#define m68ki_stack_frame_0001(pc, sr, vector) m68ki_stack_frame_0001(m68ki_cpu_p, pc, sr, vector)
+#define m68ki_stack_frame_0010(sr, vector) m68ki_stack_frame_0010(m68ki_cpu_p, sr, vector)
+#define m68ki_stack_frame_1000(pc, sr, vector) m68ki_stack_frame_1000(m68ki_cpu_p, pc, sr, vector)
+#define m68ki_stack_frame_1010(sr, vector, pc) m68ki_stack_frame_1010(m68ki_cpu_p, sr, vector, pc)
+#define m68ki_stack_frame_1011(sr, vector, pc) m68ki_stack_frame_1011(m68ki_cpu_p, sr, vector, pc)
+#define m68ki_exception_trap(vector) m68ki_exception_trap(m68ki_cpu_p, vector)
+#define m68ki_exception_trapN(vector) m68ki_exception_trapN(m68ki_cpu_p, vector)
+#define m68ki_exception_trace() m68ki_exception_trace(m68ki_cpu_p)
+#define m68ki_exception_privilege_violation() m68ki_exception_privilege_violation(m68ki_cpu_p)
+#define m68ki_exception_1010() m68ki_exception_1010(m68ki_cpu_p)
+#define m68ki_exception_1111() m68ki_exception_1111(m68ki_cpu_p)
+#define m68ki_exception_illegal() m68ki_exception_illegal(m68ki_cpu_p)
+#define m68ki_exception_format_error() m68ki_exception_format_error(m68ki_cpu_p)
+#define m68ki_exception_address_error() m68ki_exception_address_error(m68ki_cpu_p)
+#define m68ki_exception_interrupt(int_level) m68ki_exception_interrupt(m68ki_cpu_p, int_level)
+#define m68ki_check_interrupts() m68ki_check_interrupts(m68ki_cpu_p)
+
 
 /* ======================================================================== */
 /* =========================== UTILITY FUNCTIONS ========================== */
@@ -988,7 +1102,7 @@ char* m68ki_disassemble_quick(unsigned int pc, unsigned int cpu_type);
 /* Handles all immediate reads, does address error check, function code setting,
  * and prefetching if they are enabled in m68kconf.h
  */
-INLINE uint m68ki_read_imm_16(void)
+INLINE uint (m68ki_read_imm_16)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_fc(FLAG_S | FUNCTION_CODE_USER_PROGRAM); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(REG_PC, MODE_READ, FLAG_S | FUNCTION_CODE_USER_PROGRAM); /* auto-disable (see m68kcpu.h) */
@@ -1005,7 +1119,7 @@ INLINE uint m68ki_read_imm_16(void)
 	return m68k_read_immediate_16(ADDRESS_68K(REG_PC-2));
 #endif /* M68K_EMULATE_PREFETCH */
 }
-INLINE uint m68ki_read_imm_32(void)
+INLINE uint (m68ki_read_imm_32)(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_EMULATE_PREFETCH
 	uint temp_val;
@@ -1046,36 +1160,36 @@ INLINE uint m68ki_read_imm_32(void)
  * These functions will also check for address error and set the function
  * code if they are enabled in m68kconf.h.
  */
-INLINE uint m68ki_read_8_fc(uint address, uint fc)
+INLINE uint (m68ki_read_8_fc)(m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	return m68k_read_memory_8(ADDRESS_68K(address));
 }
-INLINE uint m68ki_read_16_fc(uint address, uint fc)
+INLINE uint (m68ki_read_16_fc)(m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(address, MODE_READ, fc); /* auto-disable (see m68kcpu.h) */
 	return m68k_read_memory_16(ADDRESS_68K(address));
 }
-INLINE uint m68ki_read_32_fc(uint address, uint fc)
+INLINE uint (m68ki_read_32_fc)(m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(address, MODE_READ, fc); /* auto-disable (see m68kcpu.h) */
 	return m68k_read_memory_32(ADDRESS_68K(address));
 }
 
-INLINE void m68ki_write_8_fc(uint address, uint fc, uint value)
+INLINE void (m68ki_write_8_fc)(m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc, uint value)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68k_write_memory_8(ADDRESS_68K(address), value);
 }
-INLINE void m68ki_write_16_fc(uint address, uint fc, uint value)
+INLINE void (m68ki_write_16_fc)(m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc, uint value)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(address, MODE_WRITE, fc); /* auto-disable (see m68kcpu.h) */
 	m68k_write_memory_16(ADDRESS_68K(address), value);
 }
-INLINE void m68ki_write_32_fc(uint address, uint fc, uint value)
+INLINE void (m68ki_write_32_fc)(m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc, uint value)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(address, MODE_WRITE, fc); /* auto-disable (see m68kcpu.h) */
@@ -1083,7 +1197,7 @@ INLINE void m68ki_write_32_fc(uint address, uint fc, uint value)
 }
 
 #if M68K_SIMULATE_PD_WRITES
-INLINE void m68ki_write_32_pd_fc(uint address, uint fc, uint value)
+INLINE void (m68ki_write_32_pd_fc)(m68ki_cpu_core *m68ki_cpu_p, uint address, uint fc, uint value)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(address, MODE_WRITE, fc); /* auto-disable (see m68kcpu.h) */
@@ -1097,7 +1211,7 @@ INLINE void m68ki_write_32_pd_fc(uint address, uint fc, uint value)
 /* The program counter relative addressing modes cause operands to be
  * retrieved from program space, not data space.
  */
-INLINE uint m68ki_get_ea_pcdi(void)
+INLINE uint (m68ki_get_ea_pcdi)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint old_pc = REG_PC;
 	m68ki_use_program_space(); /* auto-disable */
@@ -1105,7 +1219,7 @@ INLINE uint m68ki_get_ea_pcdi(void)
 }
 
 
-INLINE uint m68ki_get_ea_pcix(void)
+INLINE uint (m68ki_get_ea_pcix)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_use_program_space(); /* auto-disable */
 	return m68ki_get_ea_ix(REG_PC);
@@ -1153,7 +1267,7 @@ INLINE uint m68ki_get_ea_pcix(void)
  * 1  011  mem indir with long outer
  * 1  100-111  reserved
  */
-INLINE uint m68ki_get_ea_ix(uint An)
+INLINE uint (m68ki_get_ea_ix)(m68ki_cpu_core *m68ki_cpu_p, uint An)
 {
 	/* An = base register */
 	uint extension = m68ki_read_imm_16();
@@ -1226,78 +1340,78 @@ INLINE uint m68ki_get_ea_ix(uint An)
 
 
 /* Fetch operands */
-INLINE uint OPER_AY_AI_8(void)  {uint ea = EA_AY_AI_8();  return m68ki_read_8(ea); }
-INLINE uint OPER_AY_AI_16(void) {uint ea = EA_AY_AI_16(); return m68ki_read_16(ea);}
-INLINE uint OPER_AY_AI_32(void) {uint ea = EA_AY_AI_32(); return m68ki_read_32(ea);}
-INLINE uint OPER_AY_PI_8(void)  {uint ea = EA_AY_PI_8();  return m68ki_read_8(ea); }
-INLINE uint OPER_AY_PI_16(void) {uint ea = EA_AY_PI_16(); return m68ki_read_16(ea);}
-INLINE uint OPER_AY_PI_32(void) {uint ea = EA_AY_PI_32(); return m68ki_read_32(ea);}
-INLINE uint OPER_AY_PD_8(void)  {uint ea = EA_AY_PD_8();  return m68ki_read_8(ea); }
-INLINE uint OPER_AY_PD_16(void) {uint ea = EA_AY_PD_16(); return m68ki_read_16(ea);}
-INLINE uint OPER_AY_PD_32(void) {uint ea = EA_AY_PD_32(); return m68ki_read_32(ea);}
-INLINE uint OPER_AY_DI_8(void)  {uint ea = EA_AY_DI_8();  return m68ki_read_8(ea); }
-INLINE uint OPER_AY_DI_16(void) {uint ea = EA_AY_DI_16(); return m68ki_read_16(ea);}
-INLINE uint OPER_AY_DI_32(void) {uint ea = EA_AY_DI_32(); return m68ki_read_32(ea);}
-INLINE uint OPER_AY_IX_8(void)  {uint ea = EA_AY_IX_8();  return m68ki_read_8(ea); }
-INLINE uint OPER_AY_IX_16(void) {uint ea = EA_AY_IX_16(); return m68ki_read_16(ea);}
-INLINE uint OPER_AY_IX_32(void) {uint ea = EA_AY_IX_32(); return m68ki_read_32(ea);}
-
-INLINE uint OPER_AX_AI_8(void)  {uint ea = EA_AX_AI_8();  return m68ki_read_8(ea); }
-INLINE uint OPER_AX_AI_16(void) {uint ea = EA_AX_AI_16(); return m68ki_read_16(ea);}
-INLINE uint OPER_AX_AI_32(void) {uint ea = EA_AX_AI_32(); return m68ki_read_32(ea);}
-INLINE uint OPER_AX_PI_8(void)  {uint ea = EA_AX_PI_8();  return m68ki_read_8(ea); }
-INLINE uint OPER_AX_PI_16(void) {uint ea = EA_AX_PI_16(); return m68ki_read_16(ea);}
-INLINE uint OPER_AX_PI_32(void) {uint ea = EA_AX_PI_32(); return m68ki_read_32(ea);}
-INLINE uint OPER_AX_PD_8(void)  {uint ea = EA_AX_PD_8();  return m68ki_read_8(ea); }
-INLINE uint OPER_AX_PD_16(void) {uint ea = EA_AX_PD_16(); return m68ki_read_16(ea);}
-INLINE uint OPER_AX_PD_32(void) {uint ea = EA_AX_PD_32(); return m68ki_read_32(ea);}
-INLINE uint OPER_AX_DI_8(void)  {uint ea = EA_AX_DI_8();  return m68ki_read_8(ea); }
-INLINE uint OPER_AX_DI_16(void) {uint ea = EA_AX_DI_16(); return m68ki_read_16(ea);}
-INLINE uint OPER_AX_DI_32(void) {uint ea = EA_AX_DI_32(); return m68ki_read_32(ea);}
-INLINE uint OPER_AX_IX_8(void)  {uint ea = EA_AX_IX_8();  return m68ki_read_8(ea); }
-INLINE uint OPER_AX_IX_16(void) {uint ea = EA_AX_IX_16(); return m68ki_read_16(ea);}
-INLINE uint OPER_AX_IX_32(void) {uint ea = EA_AX_IX_32(); return m68ki_read_32(ea);}
-
-INLINE uint OPER_A7_PI_8(void)  {uint ea = EA_A7_PI_8();  return m68ki_read_8(ea); }
-INLINE uint OPER_A7_PD_8(void)  {uint ea = EA_A7_PD_8();  return m68ki_read_8(ea); }
-
-INLINE uint OPER_AW_8(void)     {uint ea = EA_AW_8();     return m68ki_read_8(ea); }
-INLINE uint OPER_AW_16(void)    {uint ea = EA_AW_16();    return m68ki_read_16(ea);}
-INLINE uint OPER_AW_32(void)    {uint ea = EA_AW_32();    return m68ki_read_32(ea);}
-INLINE uint OPER_AL_8(void)     {uint ea = EA_AL_8();     return m68ki_read_8(ea); }
-INLINE uint OPER_AL_16(void)    {uint ea = EA_AL_16();    return m68ki_read_16(ea);}
-INLINE uint OPER_AL_32(void)    {uint ea = EA_AL_32();    return m68ki_read_32(ea);}
-INLINE uint OPER_PCDI_8(void)   {uint ea = EA_PCDI_8();   return m68ki_read_pcrel_8(ea); }
-INLINE uint OPER_PCDI_16(void)  {uint ea = EA_PCDI_16();  return m68ki_read_pcrel_16(ea);}
-INLINE uint OPER_PCDI_32(void)  {uint ea = EA_PCDI_32();  return m68ki_read_pcrel_32(ea);}
-INLINE uint OPER_PCIX_8(void)   {uint ea = EA_PCIX_8();   return m68ki_read_pcrel_8(ea); }
-INLINE uint OPER_PCIX_16(void)  {uint ea = EA_PCIX_16();  return m68ki_read_pcrel_16(ea);}
-INLINE uint OPER_PCIX_32(void)  {uint ea = EA_PCIX_32();  return m68ki_read_pcrel_32(ea);}
+INLINE uint (OPER_AY_AI_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_AY_AI_8();  return m68ki_read_8(ea); }
+INLINE uint (OPER_AY_AI_16)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AY_AI_16(); return m68ki_read_16(ea);}
+INLINE uint (OPER_AY_AI_32)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AY_AI_32(); return m68ki_read_32(ea);}
+INLINE uint (OPER_AY_PI_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_AY_PI_8();  return m68ki_read_8(ea); }
+INLINE uint (OPER_AY_PI_16)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AY_PI_16(); return m68ki_read_16(ea);}
+INLINE uint (OPER_AY_PI_32)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AY_PI_32(); return m68ki_read_32(ea);}
+INLINE uint (OPER_AY_PD_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_AY_PD_8();  return m68ki_read_8(ea); }
+INLINE uint (OPER_AY_PD_16)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AY_PD_16(); return m68ki_read_16(ea);}
+INLINE uint (OPER_AY_PD_32)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AY_PD_32(); return m68ki_read_32(ea);}
+INLINE uint (OPER_AY_DI_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_AY_DI_8();  return m68ki_read_8(ea); }
+INLINE uint (OPER_AY_DI_16)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AY_DI_16(); return m68ki_read_16(ea);}
+INLINE uint (OPER_AY_DI_32)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AY_DI_32(); return m68ki_read_32(ea);}
+INLINE uint (OPER_AY_IX_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_AY_IX_8();  return m68ki_read_8(ea); }
+INLINE uint (OPER_AY_IX_16)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AY_IX_16(); return m68ki_read_16(ea);}
+INLINE uint (OPER_AY_IX_32)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AY_IX_32(); return m68ki_read_32(ea);}
+
+INLINE uint (OPER_AX_AI_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_AX_AI_8();  return m68ki_read_8(ea); }
+INLINE uint (OPER_AX_AI_16)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AX_AI_16(); return m68ki_read_16(ea);}
+INLINE uint (OPER_AX_AI_32)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AX_AI_32(); return m68ki_read_32(ea);}
+INLINE uint (OPER_AX_PI_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_AX_PI_8();  return m68ki_read_8(ea); }
+INLINE uint (OPER_AX_PI_16)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AX_PI_16(); return m68ki_read_16(ea);}
+INLINE uint (OPER_AX_PI_32)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AX_PI_32(); return m68ki_read_32(ea);}
+INLINE uint (OPER_AX_PD_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_AX_PD_8();  return m68ki_read_8(ea); }
+INLINE uint (OPER_AX_PD_16)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AX_PD_16(); return m68ki_read_16(ea);}
+INLINE uint (OPER_AX_PD_32)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AX_PD_32(); return m68ki_read_32(ea);}
+INLINE uint (OPER_AX_DI_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_AX_DI_8();  return m68ki_read_8(ea); }
+INLINE uint (OPER_AX_DI_16)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AX_DI_16(); return m68ki_read_16(ea);}
+INLINE uint (OPER_AX_DI_32)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AX_DI_32(); return m68ki_read_32(ea);}
+INLINE uint (OPER_AX_IX_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_AX_IX_8();  return m68ki_read_8(ea); }
+INLINE uint (OPER_AX_IX_16)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AX_IX_16(); return m68ki_read_16(ea);}
+INLINE uint (OPER_AX_IX_32)(m68ki_cpu_core *m68ki_cpu_p) {uint ea = EA_AX_IX_32(); return m68ki_read_32(ea);}
+
+INLINE uint (OPER_A7_PI_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_A7_PI_8();  return m68ki_read_8(ea); }
+INLINE uint (OPER_A7_PD_8)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_A7_PD_8();  return m68ki_read_8(ea); }
+
+INLINE uint (OPER_AW_8)(m68ki_cpu_core *m68ki_cpu_p)     {uint ea = EA_AW_8();     return m68ki_read_8(ea); }
+INLINE uint (OPER_AW_16)(m68ki_cpu_core *m68ki_cpu_p)    {uint ea = EA_AW_16();    return m68ki_read_16(ea);}
+INLINE uint (OPER_AW_32)(m68ki_cpu_core *m68ki_cpu_p)    {uint ea = EA_AW_32();    return m68ki_read_32(ea);}
+INLINE uint (OPER_AL_8)(m68ki_cpu_core *m68ki_cpu_p)     {uint ea = EA_AL_8();     return m68ki_read_8(ea); }
+INLINE uint (OPER_AL_16)(m68ki_cpu_core *m68ki_cpu_p)    {uint ea = EA_AL_16();    return m68ki_read_16(ea);}
+INLINE uint (OPER_AL_32)(m68ki_cpu_core *m68ki_cpu_p)    {uint ea = EA_AL_32();    return m68ki_read_32(ea);}
+INLINE uint (OPER_PCDI_8)(m68ki_cpu_core *m68ki_cpu_p)   {uint ea = EA_PCDI_8();   return m68ki_read_pcrel_8(ea); }
+INLINE uint (OPER_PCDI_16)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_PCDI_16();  return m68ki_read_pcrel_16(ea);}
+INLINE uint (OPER_PCDI_32)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_PCDI_32();  return m68ki_read_pcrel_32(ea);}
+INLINE uint (OPER_PCIX_8)(m68ki_cpu_core *m68ki_cpu_p)   {uint ea = EA_PCIX_8();   return m68ki_read_pcrel_8(ea); }
+INLINE uint (OPER_PCIX_16)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_PCIX_16();  return m68ki_read_pcrel_16(ea);}
+INLINE uint (OPER_PCIX_32)(m68ki_cpu_core *m68ki_cpu_p)  {uint ea = EA_PCIX_32();  return m68ki_read_pcrel_32(ea);}
 
 
 
 /* ---------------------------- Stack Functions --------------------------- */
 
 /* Push/pull data from the stack */
-INLINE void m68ki_push_16(uint value)
+INLINE void (m68ki_push_16)(m68ki_cpu_core *m68ki_cpu_p, uint value)
 {
 	REG_SP = MASK_OUT_ABOVE_32(REG_SP - 2);
 	m68ki_write_16(REG_SP, value);
 }
 
-INLINE void m68ki_push_32(uint value)
+INLINE void (m68ki_push_32)(m68ki_cpu_core *m68ki_cpu_p, uint value)
 {
 	REG_SP = MASK_OUT_ABOVE_32(REG_SP - 4);
 	m68ki_write_32(REG_SP, value);
 }
 
-INLINE uint m68ki_pull_16(void)
+INLINE uint (m68ki_pull_16)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	REG_SP = MASK_OUT_ABOVE_32(REG_SP + 2);
 	return m68ki_read_16(REG_SP-2);
 }
 
-INLINE uint m68ki_pull_32(void)
+INLINE uint (m68ki_pull_32)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	REG_SP = MASK_OUT_ABOVE_32(REG_SP + 4);
 	return m68ki_read_32(REG_SP-4);
@@ -1307,22 +1421,22 @@ INLINE uint m68ki_pull_32(void)
 /* Increment/decrement the stack as if doing a push/pull but
  * don't do any memory access.
  */
-INLINE void m68ki_fake_push_16(void)
+INLINE void (m68ki_fake_push_16)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	REG_SP = MASK_OUT_ABOVE_32(REG_SP - 2);
 }
 
-INLINE void m68ki_fake_push_32(void)
+INLINE void (m68ki_fake_push_32)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	REG_SP = MASK_OUT_ABOVE_32(REG_SP - 4);
 }
 
-INLINE void m68ki_fake_pull_16(void)
+INLINE void (m68ki_fake_pull_16)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	REG_SP = MASK_OUT_ABOVE_32(REG_SP + 2);
 }
 
-INLINE void m68ki_fake_pull_32(void)
+INLINE void (m68ki_fake_pull_32)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	REG_SP = MASK_OUT_ABOVE_32(REG_SP + 4);
 }
@@ -1334,13 +1448,13 @@ INLINE void m68ki_fake_pull_32(void)
  * These functions will also call the pc_changed callback if it was enabled
  * in m68kconf.h.
  */
-INLINE void m68ki_jump(uint new_pc)
+INLINE void (m68ki_jump)(m68ki_cpu_core *m68ki_cpu_p, uint new_pc)
 {
 	REG_PC = new_pc;
 	m68ki_pc_changed(REG_PC);
 }
 
-INLINE void m68ki_jump_vector(uint vector)
+INLINE void (m68ki_jump_vector)(m68ki_cpu_core *m68ki_cpu_p, uint vector)
 {
 	REG_PC = (vector<<2) + REG_VBR;
 	REG_PC = m68ki_read_data_32(REG_PC);
@@ -1353,17 +1467,17 @@ INLINE void m68ki_jump_vector(uint vector)
  * So far I've found no problems with not calling pc_changed for 8 or 16
  * bit branches.
  */
-INLINE void m68ki_branch_8(uint offset)
+INLINE void (m68ki_branch_8)(m68ki_cpu_core *m68ki_cpu_p, uint offset)
 {
 	REG_PC += MAKE_INT_8(offset);
 }
 
-INLINE void m68ki_branch_16(uint offset)
+INLINE void (m68ki_branch_16)(m68ki_cpu_core *m68ki_cpu_p, uint offset)
 {
 	REG_PC += MAKE_INT_16(offset);
 }
 
-INLINE void m68ki_branch_32(uint offset)
+INLINE void (m68ki_branch_32)(m68ki_cpu_core *m68ki_cpu_p, uint offset)
 {
 	REG_PC += offset;
 	m68ki_pc_changed(REG_PC);
@@ -1376,7 +1490,7 @@ INLINE void m68ki_branch_32(uint offset)
 /* Set the S flag and change the active stack pointer.
  * Note that value MUST be 4 or 0.
  */
-INLINE void m68ki_set_s_flag(uint value)
+INLINE void (m68ki_set_s_flag)(m68ki_cpu_core *m68ki_cpu_p, uint value)
 {
 	/* Backup the old stack pointer */
 	REG_SP_BASE[FLAG_S | ((FLAG_S>>1) & FLAG_M)] = REG_SP;
@@ -1389,7 +1503,7 @@ INLINE void m68ki_set_s_flag(uint value)
 /* Set the S and M flags and change the active stack pointer.
  * Note that value MUST be 0, 2, 4, or 6 (bit2 = S, bit1 = M).
  */
-INLINE void m68ki_set_sm_flag(uint value)
+INLINE void (m68ki_set_sm_flag)(m68ki_cpu_core *m68ki_cpu_p, uint value)
 {
 	/* Backup the old stack pointer */
 	REG_SP_BASE[FLAG_S | ((FLAG_S>>1) & FLAG_M)] = REG_SP;
@@ -1401,7 +1515,7 @@ INLINE void m68ki_set_sm_flag(uint value)
 }
 
 /* Set the S and M flags.  Don't touch the stack pointer. */
-INLINE void m68ki_set_sm_flag_nosp(uint value)
+INLINE void (m68ki_set_sm_flag_nosp)(m68ki_cpu_core *m68ki_cpu_p, uint value)
 {
 	/* Set the S and M flags */
 	FLAG_S = value & SFLAG_SET;
@@ -1410,7 +1524,7 @@ INLINE void m68ki_set_sm_flag_nosp(uint value)
 
 
 /* Set the condition code register */
-INLINE void m68ki_set_ccr(uint value)
+INLINE void (m68ki_set_ccr)(m68ki_cpu_core *m68ki_cpu_p, uint value)
 {
 	FLAG_X = BIT_4(value)  << 4;
 	FLAG_N = BIT_3(value)  << 4;
@@ -1420,7 +1534,7 @@ INLINE void m68ki_set_ccr(uint value)
 }
 
 /* Set the status register but don't check for interrupts */
-INLINE void m68ki_set_sr_noint(uint value)
+INLINE void (m68ki_set_sr_noint)(m68ki_cpu_core *m68ki_cpu_p, uint value)
 {
 	/* Mask out the "unimplemented" bits */
 	value &= CPU_SR_MASK;
@@ -1436,7 +1550,7 @@ INLINE void m68ki_set_sr_noint(uint value)
 /* Set the status register but don't check for interrupts nor
  * change the stack pointer
  */
-INLINE void m68ki_set_sr_noint_nosp(uint value)
+INLINE void (m68ki_set_sr_noint_nosp)(m68ki_cpu_core *m68ki_cpu_p, uint value)
 {
 	/* Mask out the "unimplemented" bits */
 	value &= CPU_SR_MASK;
@@ -1450,7 +1564,7 @@ INLINE void m68ki_set_sr_noint_nosp(uint value)
 }
 
 /* Set the status register and check for interrupts */
-INLINE void m68ki_set_sr(uint value)
+INLINE void (m68ki_set_sr)(m68ki_cpu_core *m68ki_cpu_p, uint value)
 {
 	m68ki_set_sr_noint(value);
 	m68ki_check_interrupts();
@@ -1460,7 +1574,7 @@ INLINE void m68ki_set_sr(uint value)
 /* ------------------------- Exception Processing ------------------------- */
 
 /* Initiate exception processing */
-INLINE uint m68ki_init_exception(void)
+INLINE uint (m68ki_init_exception)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	/* Save the old status register */
 	uint sr = m68ki_get_sr();
@@ -1475,7 +1589,7 @@ INLINE uint m68ki_init_exception(void)
 }
 
 /* 3 word stack frame (68000 only) */
-INLINE void m68ki_stack_frame_3word(uint pc, uint sr)
+INLINE void (m68ki_stack_frame_3word)(m68ki_cpu_core *m68ki_cpu_p, uint pc, uint sr)
 {
 	m68ki_push_32(pc);
 	m68ki_push_16(sr);
@@ -1484,7 +1598,7 @@ INLINE void m68ki_stack_frame_3word(uint pc, uint sr)
 /* Format 0 stack frame.
  * This is the standard stack frame for 68010+.
  */
-INLINE void m68ki_stack_frame_0000(uint pc, uint sr, uint vector)
+INLINE void (m68ki_stack_frame_0000)(m68ki_cpu_core *m68ki_cpu_p, uint pc, uint sr, uint vector)
 {
 	/* Stack a 3-word frame if we are 68000 */
 	if(CPU_TYPE == CPU_TYPE_000 || CPU_TYPE == CPU_TYPE_008)
@@ -1500,7 +1614,7 @@ INLINE void m68ki_stack_frame_0000(uint pc, uint sr, uint vector)
 /* Format 1 stack frame (68020).
  * For 68020, this is the 4 word throwaway frame.
  */
-INLINE void m68ki_stack_frame_0001(uint pc, uint sr, uint vector)
+INLINE void (m68ki_stack_frame_0001)(m68ki_cpu_core *m68ki_cpu_p, uint pc, uint sr, uint vector)
 {
 	m68ki_push_16(0x1000 | (vector<<2));
 	m68ki_push_32(pc);
@@ -1510,7 +1624,7 @@ INLINE void m68ki_stack_frame_0001(uint pc, uint sr, uint vector)
 /* Format 2 stack frame.
  * This is used only by 68020 for trap exceptions.
  */
-INLINE void m68ki_stack_frame_0010(uint sr, uint vector)
+INLINE void (m68ki_stack_frame_0010)(m68ki_cpu_core *m68ki_cpu_p, uint sr, uint vector)
 {
 	m68ki_push_32(REG_PPC);
 	m68ki_push_16(0x2000 | (vector<<2));
@@ -1521,7 +1635,7 @@ INLINE void m68ki_stack_frame_0010(uint sr, uint vector)
 
 /* Bus error stack frame (68000 only).
  */
-INLINE void m68ki_stack_frame_buserr(uint sr)
+INLINE void (m68ki_stack_frame_buserr)(m68ki_cpu_core *m68ki_cpu_p, uint sr)
 {
 	m68ki_push_32(REG_PC);
 	m68ki_push_16(sr);
@@ -1538,7 +1652,7 @@ INLINE void m68ki_stack_frame_buserr(uint sr)
 /* Format 8 stack frame (68010).
  * 68010 only.  This is the 29 word bus/address error frame.
  */
-static inline void m68ki_stack_frame_1000(uint pc, uint sr, uint vector)
+static inline void (m68ki_stack_frame_1000)(m68ki_cpu_core *m68ki_cpu_p, uint pc, uint sr, uint vector)
 {
 	/* VERSION
 	 * NUMBER
@@ -1592,7 +1706,7 @@ static inline void m68ki_stack_frame_1000(uint pc, uint sr, uint vector)
  * if the error happens at an instruction boundary.
  * PC stacked is address of next instruction.
  */
-static inline void m68ki_stack_frame_1010(uint sr, uint vector, uint pc)
+static inline void (m68ki_stack_frame_1010)(m68ki_cpu_core *m68ki_cpu_p, uint sr, uint vector, uint pc)
 {
 	/* INTERNAL REGISTER */
 	m68ki_push_16(0);
@@ -1639,7 +1753,7 @@ static inline void m68ki_stack_frame_1010(uint sr, uint vector, uint pc)
  * if the error happens during instruction execution.
  * PC stacked is address of instruction in progress.
  */
-static inline void m68ki_stack_frame_1011(uint sr, uint vector, uint pc)
+static inline void (m68ki_stack_frame_1011)(m68ki_cpu_core *m68ki_cpu_p, uint sr, uint vector, uint pc)
 {
 	/* INTERNAL REGISTERS (18 words) */
 	m68ki_push_32(0);
@@ -1710,7 +1824,7 @@ static inline void m68ki_stack_frame_1011(uint sr, uint vector, uint pc)
 /* Used for Group 2 exceptions.
  * These stack a type 2 frame on the 020.
  */
-INLINE void m68ki_exception_trap(uint vector)
+INLINE void (m68ki_exception_trap)(m68ki_cpu_core *m68ki_cpu_p, uint vector)
 {
 	uint sr = m68ki_init_exception();
 
@@ -1726,7 +1840,7 @@ INLINE void m68ki_exception_trap(uint vector)
 }
 
 /* Trap#n stacks a 0 frame but behaves like group2 otherwise */
-INLINE void m68ki_exception_trapN(uint vector)
+INLINE void (m68ki_exception_trapN)(m68ki_cpu_core *m68ki_cpu_p, uint vector)
 {
 	uint sr = m68ki_init_exception();
 	m68ki_stack_frame_0000(REG_PC, sr, vector);
@@ -1737,7 +1851,7 @@ INLINE void m68ki_exception_trapN(uint vector)
 }
 
 /* Exception for trace mode */
-INLINE void m68ki_exception_trace(void)
+INLINE void (m68ki_exception_trace)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint sr = m68ki_init_exception();
 
@@ -1764,7 +1878,7 @@ INLINE void m68ki_exception_trace(void)
 }
 
 /* Exception for privilege violation */
-INLINE void m68ki_exception_privilege_violation(void)
+INLINE void (m68ki_exception_privilege_violation)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint sr = m68ki_init_exception();
 
@@ -1783,7 +1897,7 @@ INLINE void m68ki_exception_privilege_violation(void)
 }
 
 /* Exception for A-Line instructions */
-INLINE void m68ki_exception_1010(void)
+INLINE void (m68ki_exception_1010)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint sr;
 #if M68K_LOG_1010_1111 == OPT_ON
@@ -1801,7 +1915,7 @@ INLINE void m68ki_exception_1010(void)
 }
 
 /* Exception for F-Line instructions */
-INLINE void m68ki_exception_1111(void)
+INLINE void (m68ki_exception_1111)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint sr;
 
@@ -1820,7 +1934,7 @@ INLINE void m68ki_exception_1111(void)
 }
 
 /* Exception for illegal instructions */
-INLINE void m68ki_exception_illegal(void)
+INLINE void (m68ki_exception_illegal)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint sr;
 
@@ -1845,7 +1959,7 @@ INLINE void m68ki_exception_illegal(void)
 }
 
 /* Exception for format errror in RTE */
-INLINE void m68ki_exception_format_error(void)
+INLINE void (m68ki_exception_format_error)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint sr = m68ki_init_exception();
 	m68ki_stack_frame_0000(REG_PC, sr, EXCEPTION_FORMAT_ERROR);
@@ -1856,7 +1970,7 @@ INLINE void m68ki_exception_format_error(void)
 }
 
 /* Exception for address error */
-INLINE void m68ki_exception_address_error(void)
+INLINE void (m68ki_exception_address_error)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint sr = m68ki_init_exception();
 
@@ -1883,7 +1997,7 @@ m68k_read_memory_8(0x00ffff01);
 
 
 /* Service an interrupt request and start exception processing */
-static inline void m68ki_exception_interrupt(uint int_level)
+static inline void (m68ki_exception_interrupt)(m68ki_cpu_core *m68ki_cpu_p, uint int_level)
 {
 	uint vector;
 	uint sr;
@@ -1956,7 +2070,7 @@ static inline void m68ki_exception_interrupt(uint int_level)
 
 
 /* ASG: Check for interrupts */
-INLINE void m68ki_check_interrupts(void)
+INLINE void (m68ki_check_interrupts)(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_INT_LEVEL > FLAG_INT_MASK)
 	{
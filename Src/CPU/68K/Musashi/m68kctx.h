@@ -26,6 +26,9 @@
  * save state management. It is used internally by m68kcpu.h. 
  */
  
+#ifndef INCLUDED_M68KCTX_H
+#define INCLUDED_M68KCTX_H
+
 #include "Types.h"	// Supermodel types
 
 typedef struct
@@ -61,6 +64,15 @@ typedef struct
 	UINT32 instr_mode;   /* Stores whether we are in instruction mode or group 0/1 exception mode */
 	UINT32 run_mode;     /* Stores whether we are processing a reset, bus error, address error, or something else */
 
+	/* Timeslice state (lives here so opcode handlers reach it through their context argument) */
+	INT32  remaining_cycles; /* Number of clocks remaining */
+	INT32  initial_cycles;
+	UINT32 tracing;
+	UINT32 address_space;
+	UINT32 aerr_address;
+	UINT32 aerr_write_mode;
+	UINT32 aerr_fc;
+
 	/* Clocks required for instructions / exceptions */
 	UINT32 cyc_bcc_notake_b;
 	UINT32 cyc_bcc_notake_w;
@@ -84,4 +96,6 @@ typedef struct
 	void (*set_fc_callback)(unsigned int new_fc);     /* Called when the CPU function code changes */
 	void (*instr_hook_callback)(void);                /* Called every instruction cycle prior to execution */
 
-} m68ki_cpu_core;
\ No newline at end of file
+} m68ki_cpu_core;
+
+#endif	// INCLUDED_M68KCTX_H
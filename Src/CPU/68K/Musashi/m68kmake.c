@@ -821,13 +821,13 @@ void get_base_name(char* base_name, opcode_struct* op)
 /* Write the prototype of an opcode handler function */
 void write_prototype(FILE* filep, char* base_name)
 {
-	fprintf(filep, "void %s(void);\n", base_name);
+	fprintf(filep, "void %s(m68ki_cpu_core *m68ki_cpu_p);\n", base_name);
 }
 
 /* Write the name of an opcode handler function */
 void write_function_name(FILE* filep, char* base_name)
 {
-	fprintf(filep, "void %s(void)\n", base_name);
+	fprintf(filep, "void %s(m68ki_cpu_core *m68ki_cpu_p)\n", base_name);
 }
 
 void add_opcode_output_table_entry(opcode_struct* op, char* name)
@@ -29,6 +29,50 @@
 #define INCLUDED_BUS_H
 
 #include "Types.h"
+#include <cstring>
+
+/*
+ * BusPageMap:
+ *
+ * Maps the 32-bit address space, in 64 KB pages, directly onto host memory so
+ * that bus masters can access plain RAM and ROM without going through the
+ * IBus handlers. A NULL entry means the page must be accessed through the
+ * handlers (e.g., memory-mapped I/O or read-only memory for writes). Each
+ * entry points to the host copy of the first byte of the page; the data
+ * layout is whatever the bus owner uses (on Model 3, 32-bit words in host
+ * byte order).
+ */
+struct BusPageMap
+{
+	static const unsigned	PageBits = 16;
+	static const unsigned	NumPages = 1 << (32 - PageBits);
+	static const UINT32		PageMask = (1 << PageBits) - 1;
+
+	UINT8	*read[NumPages];
+	UINT8	*write[NumPages];
+
+	/*
+	 * Map(start, size, ptr, writeable):
+	 *
+	 * Maps a page-aligned region. Pass ptr = NULL to revert the region to the
+	 * bus handlers.
+	 */
+	void Map(UINT32 start, UINT32 size, UINT8 *ptr, bool writeable)
+	{
+		for (UINT32 offset = 0; offset < size; offset += 1 << PageBits)
+		{
+			UINT32 page = (start + offset) >> PageBits;
+			read[page] = (ptr == NULL) ? NULL : &ptr[offset];
+			write[page] = (ptr == NULL || !writeable) ? NULL : &ptr[offset];
+		}
+	}
+
+	void Clear(void)
+	{
+		memset(read, 0, sizeof(read));
+		memset(write, 0, sizeof(write));
+	}
+};
 
 /*
  * IBus:
@@ -104,7 +148,115 @@ public:
 	 *		data	Data to write.
 	 */
 	virtual void	IOWrite8(UINT32 addr, UINT8 data)	{}
+
+	/*
+	 * GetPageMap(void):
+	 *
+	 * Returns:
+	 *		Direct mapping of the memory bus to host memory, or NULL if the bus
+	 *		must always be accessed through the handlers. The map is owned by
+	 *		the bus and may change (e.g., on bank switches) but its address
+	 *		does not.
+	 */
+	virtual const BusPageMap *GetPageMap(void)	{ return NULL; }
 };
 
 
+/*
+ * BusRead8(map, bus, addr):
+ * BusRead16(map, bus, addr):
+ * BusRead32(map, bus, addr):
+ * BusRead64(map, bus, addr):
+ * BusWrite8(map, bus, addr, data):
+ * BusWrite16(map, bus, addr, data):
+ * BusWrite32(map, bus, addr, data):
+ * BusWrite64(map, bus, addr, data):
+ *
+ * Bus master fast path. Accesses to pages in the map go straight to host
+ * memory, which must hold aligned 32-bit words in host byte order (hence the
+ * address swizzling for smaller sizes). Unaligned accesses, unmapped pages,
+ * and a NULL map go through the bus handlers.
+ *
+ * Parameters:
+ *		map		Page map of the bus (may be NULL).
+ *		bus		Bus to fall back on.
+ *		addr	Address.
+ *		data	Data to write.
+ */
+static inline UINT8 BusRead8(const BusPageMap *map, IBus *bus, UINT32 addr)
+{
+	const UINT8 *page = map ? map->read[addr >> BusPageMap::PageBits] : NULL;
+	if (page != NULL)
+		return page[(addr & BusPageMap::PageMask) ^ 3];
+	return bus->Read8(addr);
+}
+
+static inline UINT16 BusRead16(const BusPageMap *map, IBus *bus, UINT32 addr)
+{
+	const UINT8 *page = map ? map->read[addr >> BusPageMap::PageBits] : NULL;
+	if (page != NULL && !(addr & 1))
+		return *(const UINT16 *) &page[(addr & BusPageMap::PageMask) ^ 2];
+	return bus->Read16(addr);
+}
+
+static inline UINT32 BusRead32(const BusPageMap *map, IBus *bus, UINT32 addr)
+{
+	const UINT8 *page = map ? map->read[addr >> BusPageMap::PageBits] : NULL;
+	if (page != NULL && !(addr & 3))
+		return *(const UINT32 *) &page[addr & BusPageMap::PageMask];
+	return bus->Read32(addr);
+}
+
+static inline UINT64 BusRead64(const BusPageMap *map, IBus *bus, UINT32 addr)
+{
+	const UINT8 *page = map ? map->read[addr >> BusPageMap::PageBits] : NULL;
+	if (page != NULL && !(addr & 7))
+	{
+		const UINT32 *data = (const UINT32 *) &page[addr & BusPageMap::PageMask];
+		return ((UINT64) data[0] << 32) | data[1];
+	}
+	return bus->Read64(addr);
+}
+
+static inline void BusWrite8(const BusPageMap *map, IBus *bus, UINT32 addr, UINT8 data)
+{
+	UINT8 *page = map ? map->write[addr >> BusPageMap::PageBits] : NULL;
+	if (page != NULL)
+		page[(addr & BusPageMap::PageMask) ^ 3] = data;
+	else
+		bus->Write8(addr, data);
+}
+
+static inline void BusWrite16(const BusPageMap *map, IBus *bus, UINT32 addr, UINT16 data)
+{
+	UINT8 *page = map ? map->write[addr >> BusPageMap::PageBits] : NULL;
+	if (page != NULL && !(addr & 1))
+		*(UINT16 *) &page[(addr & BusPageMap::PageMask) ^ 2] = data;
+	else
+		bus->Write16(addr, data);
+}
+
+static inline void BusWrite32(const BusPageMap *map, IBus *bus, UINT32 addr, UINT32 data)
+{
+	UINT8 *page = map ? map->write[addr >> BusPageMap::PageBits] : NULL;
+	if (page != NULL && !(addr & 3))
+		*(UINT32 *) &page[addr & BusPageMap::PageMask] = data;
+	else
+		bus->Write32(addr, data);
+}
+
+static inline void BusWrite64(const BusPageMap *map, IBus *bus, UINT32 addr, UINT64 data)
+{
+	UINT8 *page = map ? map->write[addr >> BusPageMap::PageBits] : NULL;
+	if (page != NULL && !(addr & 7))
+	{
+		UINT32 *dest = (UINT32 *) &page[addr & BusPageMap::PageMask];
+		dest[0] = (UINT32) (data >> 32);
+		dest[1] = (UINT32) data;
+	}
+	else
+		bus->Write64(addr, data);
+}
+
+
 #endif	// INCLUDED_BUS_H
@@ -39,6 +39,7 @@ typedef unsigned int	UINT;
 
 // Model 3 context provides read/write handlers
 static class IBus	*Bus = NULL;	// pointer to Model 3 bus object (for access handlers)
+static const BusPageMap	*PageMap = NULL;	// direct mapping of plain memory (bypasses access handlers)
 
 #ifdef SUPERMODEL_DEBUGGER
 // Pointer to current PPC debugger (if any)
@@ -315,44 +316,55 @@ static void ppc_change_pc(UINT32 newpc)
 	ppc.fatalError = true;
 }
 
+/*
+ * Memory accesses use the bus page map fast path (see Bus.h).
+ */
+
 static inline UINT8 READ8(UINT32 address)
 {
-	return Bus->Read8(address);
+	return BusRead8(PageMap, Bus, address);
 }
 
 static inline UINT16 READ16(UINT32 address)
 {
-	return Bus->Read16(address);
+	return BusRead16(PageMap, Bus, address);
 }
 
 static inline UINT32 READ32(UINT32 address)
 {
-	return Bus->Read32(address);
+	return BusRead32(PageMap, Bus, address);
 }
 
 static inline UINT64 READ64(UINT32 address)
 {
-	return Bus->Read64(address);
+	return BusRead64(PageMap, Bus, address);
 }
 
+// Decode cache hook for self-modifying code (see ppc_decode_cache.c)
+static inline void ppc_pdc_check_write(UINT32 address, UINT32 size);
+
 static inline void WRITE8(UINT32 address, UINT8 data)
 {
-	Bus->Write8(address,data);
+	ppc_pdc_check_write(address, 1);
+	BusWrite8(PageMap, Bus, address, data);
 }
 
 static inline void WRITE16(UINT32 address, UINT16 data)
 {
-	Bus->Write16(address,data);
+	ppc_pdc_check_write(address, 2);
+	BusWrite16(PageMap, Bus, address, data);
 }
 
 static inline void WRITE32(UINT32 address, UINT32 data)
 {
-	Bus->Write32(address,data);
+	ppc_pdc_check_write(address, 4);
+	BusWrite32(PageMap, Bus, address, data);
 }
 
 static inline void WRITE64(UINT32 address, UINT64 data)
 {
-	Bus->Write64(address,data);
+	ppc_pdc_check_write(address, 8);
+	BusWrite64(PageMap, Bus, address, data);
 }
 
 
@@ -663,6 +675,10 @@ static void (* optable59[1024])(UINT32);
 static void (* optable63[1024])(UINT32);
 static void (* optable[64])(UINT32);
 
+// Spin loop detection, called on taken backward branches (see ppc603.c)
+static void ppc_idle_check(void);
+
+#include "ppc_decode_cache.c"
 #include "ppc603.c"
 
 /********************************************************************/
@@ -883,6 +899,40 @@ UINT32 ppc_get_pc(void)
 void ppc_set_fetch(PPC_FETCH_REGION * fetch)
 {
 	ppc.fetch = fetch;
+	ppc_pdc_flush();
+}
+
+void ppc_set_decode_cache(bool enable, bool verify)
+{
+	ppc_pdc_init(enable, verify);
+}
+
+void ppc_invalidate_code(UINT32 start, UINT32 end)
+{
+	ppc_pdc_invalidate_range(start, end);
+}
+
+void ppc_set_idle_skip(bool enable)
+{
+	ppc_idle_init(enable);
+}
+
+void ppc_idle_timed_register(UINT32 address)
+{
+	if (!ppc_idle_is_timed_register(address, 4) && idle.numTimedRegs < IDLE_MAX_TIMED_REGS)
+		idle.timedRegs[idle.numTimedRegs++] = address;
+}
+
+void ppc_idle_barrier(UINT64 cycle)
+{
+	// Keep the earliest pending barrier
+	if (idle.barrier <= ppc_total_cycles() || cycle < idle.barrier)
+		idle.barrier = cycle;
+}
+
+UINT64 ppc_idle_skipped_cycles(void)
+{
+	return idle.skippedCycles;
 }
 
 UINT64 ppc_total_cycles(void)
@@ -917,6 +967,7 @@ int ppc_get_timer_ratio()
 void ppc_attach_bus(IBus *BusPtr)
 {
 	Bus = BusPtr;
+	PageMap = Bus->GetPageMap();
 }
 
 void ppc_save_state(CBlockFile *SaveState)
@@ -1012,6 +1063,8 @@ void ppc_load_state(CBlockFile *SaveState)
 	SaveState->Read(&ppc.pc, sizeof(ppc.pc));
 	SaveState->Read(&ppc.npc, sizeof(ppc.npc));
 	ppc_change_pc(ppc.npc);
+	ppc_pdc_flush();	// RAM contents have been replaced
+	ppc_idle_reset();
 	SaveState->Read(&ppc.lr, sizeof(ppc.lr));
 	SaveState->Read(&ppc.ctr, sizeof(ppc.ctr));
 	SaveState->Read(&ppc.xer, sizeof(ppc.xer));
@@ -355,6 +355,12 @@ extern void ppc_reset(void);
 extern void ppc_shutdown(void);
 extern void ppc_init(const PPC_CONFIG *config);		// must be called second!
 extern void ppc_set_fetch(PPC_FETCH_REGION * fetch);
+extern void ppc_set_decode_cache(bool enable, bool verify);	// call after ppc_init(); verify re-checks cached blocks before use
+extern void ppc_invalidate_code(UINT32 start, UINT32 end);	// discard decoded code in start..end, for remapped ROM
+extern void ppc_set_idle_skip(bool enable);					// skip spin loops waiting for interrupts
+extern void ppc_idle_timed_register(UINT32 address);		// idle loops may poll this word register, which only changes at barriers
+extern void ppc_idle_barrier(UINT64 cycle);					// idle skipping will not advance past this total cycle count
+extern UINT64 ppc_idle_skipped_cycles(void);				// total cycles skipped in idle loops
 extern UINT64 ppc_total_cycles(void);
 extern int ppc_get_cycles_per_sec(void);
 extern int ppc_get_bus_freq_multipler(void);
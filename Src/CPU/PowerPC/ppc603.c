@@ -235,6 +235,332 @@ static void ppc603_check_interrupts(void)
 	}
 }
 
+/******************************************************************************
+ Idle Loop Detection
+
+ Games spend much of each frame spinning on a RAM flag while waiting for an
+ interrupt. A loop qualifies as idle when it is a short, straight-line run of
+ loads, compares and simple ALU operations ending in a backward branch, and
+ every register it reads is either never written in the loop or written
+ before it is read. Such a loop performs exactly the same work on every
+ iteration until memory changes, which cannot happen while only the PowerPC
+ is running.
+
+ That only holds for RAM and ROM. Device registers (security board, JTAG,
+ gun FIFO, inputs sampled mid-frame) may change on every read, so before
+ each skip the effective address of every load is worked out from the
+ current registers and must fall in a page of the bus page map. The one
+ exception is a word register that only changes at a cycle count announced
+ beforehand with ppc_idle_barrier() (ppc_idle_timed_register()), such as the
+ Real3D status register that games poll while waiting for the frame to flip.
+
+ Once an idle loop has completed one full iteration back-to-back, whole
+ iterations are skipped in a single step by charging their cycles to icount.
+ Skipping never passes the decrementer trigger, the end of the time slice, or
+ the barrier set by devices whose registers change with the cycle count
+ (ppc_idle_barrier()), so the outcome is identical to executing the loop.
+******************************************************************************/
+
+#define IDLE_MAX_LENGTH		16	// instructions, including the branch
+#define IDLE_CACHE_SIZE		256	// must be power of 2
+#define IDLE_MAX_TIMED_REGS	4
+
+static struct
+{
+	bool	enabled;
+	UINT32	lastBranch;					// PC of last taken backward branch
+	int		lastIcount;					// icount at that time
+	UINT32	notIdle[IDLE_CACHE_SIZE];	// branches known not to close an idle loop
+	UINT64	barrier;					// total cycle count that must not be skipped past
+	UINT64	skippedCycles;
+	UINT32	timedRegs[IDLE_MAX_TIMED_REGS];	// word registers that only change at barriers
+	int		numTimedRegs;
+} idle;
+
+static void ppc_idle_reset(void)
+{
+	idle.lastBranch = 0xFFFFFFFF;
+	idle.lastIcount = 0;
+	memset(idle.notIdle, 0xFF, sizeof(idle.notIdle));
+	idle.barrier = 0;
+}
+
+// Returns true if the loop body (length instructions, the last being the branch back to start) is idle
+static bool ppc_idle_analyze(const UINT32 *body, UINT32 start, UINT32 length)
+{
+	UINT32 gprRead = 0, gprWritten = 0;	// registers read before being written in the loop, registers written
+	UINT32 crRead = 0, crWritten = 0;	// same for CR fields
+
+#define IDLE_READ_GPR(r)	gprRead |= (1 << (r)) & ~gprWritten
+#define IDLE_WRITE_GPR(r)	gprWritten |= 1 << (r)
+#define IDLE_READ_CR(f)		crRead |= (1 << (f)) & ~crWritten
+#define IDLE_WRITE_CR(f)	crWritten |= 1 << (f)
+
+	for (UINT32 i = 0; i < length; i++)
+	{
+		UINT32 op = body[i];
+		bool last = (i == length - 1);
+		switch (op >> 26)
+		{
+			case 32:	// lwz
+			case 34:	// lbz
+			case 40:	// lhz
+			case 42:	// lha
+			case 14:	// addi
+			case 15:	// addis
+				if (RA != 0)
+					IDLE_READ_GPR(RA);
+				IDLE_WRITE_GPR(RT);
+				break;
+			case 10:	// cmpli
+			case 11:	// cmpi
+				IDLE_READ_GPR(RA);
+				IDLE_WRITE_CR(CRFD);
+				break;
+			case 21:	// rlwinm
+			case 24:	// ori
+			case 25:	// oris
+			case 26:	// xori
+			case 27:	// xoris
+			case 28:	// andi.
+			case 29:	// andis.
+				IDLE_READ_GPR(RS);
+				IDLE_WRITE_GPR(RA);
+				if ((op >> 26) >= 28 || ((op >> 26) == 21 && RCBIT))
+					IDLE_WRITE_CR(0);
+				break;
+			case 31:
+				switch ((op >> 1) & 0x3ff)
+				{
+					case 23:	// lwzx
+					case 87:	// lbzx
+					case 279:	// lhzx
+						if (RA != 0)
+							IDLE_READ_GPR(RA);
+						IDLE_READ_GPR(RB);
+						IDLE_WRITE_GPR(RT);
+						break;
+					case 0:		// cmp
+					case 32:	// cmpl
+						IDLE_READ_GPR(RA);
+						IDLE_READ_GPR(RB);
+						IDLE_WRITE_CR(CRFD);
+						break;
+					case 28:	// and
+					case 316:	// xor
+					case 444:	// or
+						IDLE_READ_GPR(RS);
+						IDLE_READ_GPR(RB);
+						IDLE_WRITE_GPR(RA);
+						if (RCBIT)
+							IDLE_WRITE_CR(0);
+						break;
+					default:
+						return false;
+				}
+				break;
+			case 16:	// bc: must not touch CTR or LR; only the last one may branch back into the loop
+			{
+				if (!(BO & 0x4) || LKBIT || AABIT)
+					return false;
+				UINT32 target = start + i * 4 + (SIMM16 & ~0x3);
+				bool exits = target < start || target >= start + length * 4;
+				if (last ? target != start : !exits)
+					return false;
+				if (!(BO & 0x10))
+					IDLE_READ_CR(BI >> 2);
+				break;
+			}
+			case 18:	// b
+			{
+				INT32 li = op & 0x3fffffc;
+				if (li & 0x2000000)
+					li |= 0xfc000000;
+				if (!last || LKBIT || AABIT || start + i * 4 + li != start)
+					return false;
+				break;
+			}
+			default:
+				return false;
+		}
+	}
+
+#undef IDLE_READ_GPR
+#undef IDLE_WRITE_GPR
+#undef IDLE_READ_CR
+#undef IDLE_WRITE_CR
+
+	// Anything carried from one iteration to the next means the loop makes progress
+	return (gprRead & gprWritten) == 0 && (crRead & crWritten) == 0;
+}
+
+// Returns the GPR mask written by an instruction that ppc_idle_analyze() accepted
+static UINT32 ppc_idle_gpr_written(UINT32 op)
+{
+	switch (op >> 26)
+	{
+		case 32:	// lwz
+		case 34:	// lbz
+		case 40:	// lhz
+		case 42:	// lha
+		case 14:	// addi
+		case 15:	// addis
+			return 1 << RT;
+		case 21:	// rlwinm
+		case 24:	// ori
+		case 25:	// oris
+		case 26:	// xori
+		case 27:	// xoris
+		case 28:	// andi.
+		case 29:	// andis.
+			return 1 << RA;
+		case 31:
+			switch ((op >> 1) & 0x3ff)
+			{
+				case 23:	// lwzx
+				case 87:	// lbzx
+				case 279:	// lhzx
+					return 1 << RT;
+				case 28:	// and
+				case 316:	// xor
+				case 444:	// or
+					return 1 << RA;
+				default:
+					return 0;
+			}
+		default:
+			return 0;
+	}
+}
+
+// Returns true if a load of size bytes at ea reads a timed register whole
+static bool ppc_idle_is_timed_register(UINT32 ea, UINT32 size)
+{
+	for (int i = 0; i < idle.numTimedRegs; i++)
+	{
+		if (ea == idle.timedRegs[i] && size == 4)
+			return true;
+	}
+	return false;
+}
+
+// Returns true if every load in an idle loop body reads page-mapped RAM or ROM or a timed register, given the
+// current registers. These hold what the loads saw on the iteration just completed, as long as no address
+// register is written after the load that uses it (registers written before it are recomputed the same way
+// every iteration).
+static bool ppc_idle_loads_steady(const UINT32 *body, UINT32 length)
+{
+	if (PageMap == NULL)
+		return false;
+
+	for (UINT32 i = 0; i < length; i++)
+	{
+		UINT32 op = body[i];
+		UINT32 size;
+		bool indexed = false;
+		switch (op >> 26)
+		{
+			case 32:	size = 4;	break;	// lwz
+			case 34:	size = 1;	break;	// lbz
+			case 40:				// lhz
+			case 42:	size = 2;	break;	// lha
+			case 31:
+				switch ((op >> 1) & 0x3ff)
+				{
+					case 23:	size = 4;	indexed = true;	break;	// lwzx
+					case 87:	size = 1;	indexed = true;	break;	// lbzx
+					case 279:	size = 2;	indexed = true;	break;	// lhzx
+					default:	continue;
+				}
+				break;
+			default:
+				continue;
+		}
+
+		UINT32 addressRegs = (RA != 0 ? 1 << RA : 0) | (indexed ? 1 << RB : 0);
+		for (UINT32 j = i + 1; j < length; j++)
+		{
+			if (ppc_idle_gpr_written(body[j]) & addressRegs)
+				return false;
+		}
+
+		UINT32 ea = (RA != 0 ? REG(RA) : 0) + (indexed ? REG(RB) : (UINT32) SIMM16);
+		if (ppc_idle_is_timed_register(ea, size))
+			continue;
+		if (PageMap->read[ea >> BusPageMap::PageBits] == NULL || PageMap->read[(ea + size - 1) >> BusPageMap::PageBits] == NULL)
+			return false;
+	}
+
+	return true;
+}
+
+// Called after a taken backward branch has been executed and charged (ppc.pc = branch, ppc.npc = loop start)
+static void ppc_idle_check(void)
+{
+	if (!idle.enabled)
+		return;
+
+	UINT32 branch = ppc.pc;
+	UINT32 start = ppc.npc;
+	int length = (int) ((branch - start) / 4) + 1;
+	int consecutive = (idle.lastBranch == branch && idle.lastIcount - ppc.icount == length);
+
+	idle.lastBranch = branch;
+	idle.lastIcount = ppc.icount;
+
+	// Only loops that just completed a full iteration can be skipped
+	if (!consecutive || length > IDLE_MAX_LENGTH)
+		return;
+
+	UINT32 slot = (branch >> 2) & (IDLE_CACHE_SIZE - 1);
+	if (idle.notIdle[slot] == branch)
+		return;
+
+	// The loop body must be contiguous in one fetch region; ppc.op already points at the loop start
+	if (start < ppc.cur_fetch.start || branch > ppc.cur_fetch.end)
+		return;
+
+	if (!ppc_idle_analyze(ppc.op, start, length))
+	{
+		idle.notIdle[slot] = branch;
+		return;
+	}
+
+	// Not cached as failures: the same loop may poll RAM on one call and a device register on the next
+	if (!ppc_idle_loads_steady(ppc.op, length))
+		return;
+
+	// Cycles that may be skipped: stop short of the decrementer trigger and any device barrier
+	int avail = ppc.icount;
+	if (ppc.dec_trigger_cycle >= 0 && ppc.dec_trigger_cycle < ppc.icount)
+		avail = ppc.icount - ppc.dec_trigger_cycle - 1;
+	UINT64 now = ppc_total_cycles();
+	if (idle.barrier + length > now)
+	{
+		// A barrier passed during the iteration just completed means its loads may be out of date
+		if (idle.barrier <= now)
+			return;
+		if (idle.barrier - now < (UINT64) avail)
+			avail = (int) (idle.barrier - now);
+	}
+
+	int iterations = avail / length;
+	if (iterations <= 0)
+		return;
+
+	int skipped = iterations * length;
+	ppc.icount -= skipped;
+	idle.lastIcount = ppc.icount;
+	idle.skippedCycles += skipped;
+}
+
+static void ppc_idle_init(bool enable)
+{
+	idle.enabled = enable;
+	idle.skippedCycles = 0;
+	ppc_idle_reset();
+}
+
 void ppc_reset(void)
 {
 	ppc.fatalError = false;	// reset the fatal error flag
@@ -254,6 +580,9 @@ void ppc_reset(void)
 	ppc.total_cycles = 0;
 	ppc.cur_cycles = 0;
 	ppc.icount = 0;
+
+	ppc_pdc_flush();
+	ppc_idle_reset();
 }
 
 int ppc_execute(int cycles)
@@ -289,6 +618,15 @@ int ppc_execute(int cycles)
 		PPCDebug->CPUActive();
 #endif // SUPERMODEL_DEBUGGER
 
+	// Cached blocks are used unless the debugger needs to see every instruction
+	bool useDecodeCache = pdc.enabled;
+#ifdef SUPERMODEL_DEBUGGER
+	if (PPCDebug != NULL)
+		useDecodeCache = false;
+#endif // SUPERMODEL_DEBUGGER
+	if (useDecodeCache)
+		ppc_pdc_execute();
+
 	while( ppc.icount > 0 && !ppc.fatalError)
 	{
 		ppc.pc = ppc.npc;
@@ -330,6 +668,10 @@ int ppc_execute(int cycles)
 			ppc603_check_interrupts();
 		}
 
+		// Spin loops are detected on taken backward branches
+		if (ppc.npc <= ppc.pc)
+			ppc_idle_check();
+
 		//ppc603_check_interrupts();
 	}
 
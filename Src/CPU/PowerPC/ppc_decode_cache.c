@@ -0,0 +1,394 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011 Bart Trzynadlowski, Nik Henson
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * ppc_decode_cache.c
+ *
+ * PowerPC pre-decode cache. Included from ppc.cpp; do not compile
+ * separately.
+ *
+ * No native code is generated. This is an interpreter speedup: it removes
+ * the fetch and opcode table lookups, not the handler calls themselves.
+ *
+ * Guest code is split into basic blocks (straight-line runs ending at a
+ * branch, trap or system call, or at a 4 KB page boundary). Each block is
+ * decoded once into an array of pre-decoded operations -- the handler
+ * resolved from the opcode tables plus the raw opcode -- and kept in a block
+ * cache keyed by guest PC. Executing a block then skips fetching and the
+ * two-level opcode table decode for every instruction. The operations call
+ * the very same handlers as the interpreter, so both paths are guaranteed to
+ * produce the same results, and the backend is portable to every host
+ * (including AArch64 on Android).
+ *
+ * Timing is identical to the interpreter: icount is decremented and the
+ * decrementer trigger is checked after each instruction. A block is left
+ * early whenever an instruction redirects the PC (e.g. an IRQ asserted by a
+ * store to a device register) or when decoded code is overwritten.
+ *
+ * Self-modifying code: a bitmap records every RAM word that is part of a
+ * decoded block. Stores issued by the PowerPC test the bitmap and, on a
+ * hit, all blocks in the affected page are discarded. Writes from other bus
+ * masters (SCSI and Real3D DMA) are not tracked; they do not target program
+ * RAM on Model 3.
+ *
+ * Blocks outside RAM (ROM) are not write-tracked. Whoever remaps memory the
+ * PowerPC can fetch from, such as a ROM bank switch, must discard them with
+ * ppc_invalidate_code().
+ *
+ * In verification mode, every cached block is re-checked against guest
+ * memory before it runs. Stale blocks are reported and discarded.
+ */
+
+
+/******************************************************************************
+ Block Cache
+******************************************************************************/
+
+#define PDC_MAX_BLOCK_LENGTH	64						// instructions
+#define PDC_MAX_BLOCKS			32768
+#define PDC_MAX_OPS				(PDC_MAX_BLOCKS * 8)	// average block length we budget for
+#define PDC_HASH_SIZE			65536					// must be power of 2
+#define PDC_PAGE_SHIFT			12						// 4 KB pages
+#define PDC_RAM_SIZE			0x00800000				// size of tracked (writable) region starting at 0
+#define PDC_NUM_PAGES			(PDC_RAM_SIZE >> PDC_PAGE_SHIFT)
+#define PDC_NIL					0xFFFFFFFF
+
+typedef struct
+{
+	void	(*handler)(UINT32);
+	UINT32	op;
+} PDC_OP;
+
+typedef struct
+{
+	UINT32	pc;				// guest address of first instruction
+	UINT32	length;			// number of instructions
+	UINT32	firstOp;		// index of first operation in op pool
+	UINT32	hashNext;		// next block in hash chain
+	UINT32	pageNext;		// next block in same page
+	UINT32	*host;			// host pointer to guest code (for verification)
+} PDC_BLOCK;
+
+static struct
+{
+	bool		enabled;
+	bool		verify;
+
+	PDC_OP		ops[PDC_MAX_OPS];
+	PDC_BLOCK	blocks[PDC_MAX_BLOCKS];
+	UINT32		hash[PDC_HASH_SIZE];
+	UINT32		pageBlocks[PDC_NUM_PAGES];			// head of block list for each RAM page
+	UINT32		romBlocks;							// head of block list for everything outside RAM
+	UINT32		codeMap[PDC_RAM_SIZE / 4 / 32];		// 1 bit per decoded RAM word
+	UINT32		numOps;
+	UINT32		numBlocks;
+
+	UINT32		invalidations;		// bumped whenever decoded code is discarded
+
+	// Statistics
+	UINT64		blocksDecoded;
+	UINT64		pagesInvalidated;
+	UINT64		flushes;
+	UINT64		verifyFailures;
+} pdc;
+
+static inline UINT32 ppc_pdc_hash(UINT32 pc)
+{
+	return (pc >> 2) & (PDC_HASH_SIZE - 1);
+}
+
+static void ppc_pdc_flush(void)
+{
+	memset(pdc.hash, 0xFF, sizeof(pdc.hash));
+	memset(pdc.pageBlocks, 0xFF, sizeof(pdc.pageBlocks));
+	pdc.romBlocks = PDC_NIL;
+	memset(pdc.codeMap, 0, sizeof(pdc.codeMap));
+	pdc.numOps = 0;
+	pdc.numBlocks = 0;
+	pdc.invalidations++;
+	pdc.flushes++;
+}
+
+static void ppc_pdc_unlink(UINT32 idx)
+{
+	UINT32 *link = &pdc.hash[ppc_pdc_hash(pdc.blocks[idx].pc)];
+	while (*link != PDC_NIL)
+	{
+		if (*link == idx)
+		{
+			*link = pdc.blocks[idx].hashNext;
+			return;
+		}
+		link = &pdc.blocks[*link].hashNext;
+	}
+}
+
+// Discards all blocks decoded from the given RAM page
+static void ppc_pdc_invalidate_page(UINT32 page)
+{
+	for (UINT32 idx = pdc.pageBlocks[page]; idx != PDC_NIL; idx = pdc.blocks[idx].pageNext)
+		ppc_pdc_unlink(idx);
+	pdc.pageBlocks[page] = PDC_NIL;
+
+	const UINT32 wordsPerPage = 1 << (PDC_PAGE_SHIFT - 2);
+	memset(&pdc.codeMap[(page * wordsPerPage) / 32], 0, wordsPerPage / 8);
+
+	pdc.invalidations++;
+	pdc.pagesInvalidated++;
+}
+
+// Discards all blocks that overlap the given address range
+static void ppc_pdc_invalidate_range(UINT32 start, UINT32 end)
+{
+	if (!pdc.enabled)
+		return;
+
+	for (UINT32 page = start >> PDC_PAGE_SHIFT; page < PDC_NUM_PAGES && page <= (end >> PDC_PAGE_SHIFT); page++)
+	{
+		if (pdc.pageBlocks[page] != PDC_NIL)
+			ppc_pdc_invalidate_page(page);
+	}
+
+	bool found = false;
+	UINT32 *link = &pdc.romBlocks;
+	while (*link != PDC_NIL)
+	{
+		PDC_BLOCK *block = &pdc.blocks[*link];
+		if (block->pc <= end && block->pc + block->length * 4 - 1 >= start)
+		{
+			ppc_pdc_unlink(*link);
+			*link = block->pageNext;
+			found = true;
+		}
+		else
+			link = &block->pageNext;
+	}
+	if (found)
+		pdc.invalidations++;
+}
+
+// Called on every PowerPC store; must be cheap when nothing is decoded
+static inline void ppc_pdc_check_write(UINT32 address, UINT32 size)
+{
+	if (!pdc.enabled || address >= PDC_RAM_SIZE)
+		return;
+	UINT32 first = address >> 2;
+	UINT32 last = (address + size - 1) >> 2;
+	for (UINT32 word = first; word <= last && word < PDC_RAM_SIZE / 4; word++)
+	{
+		if (pdc.codeMap[word / 32] & (1 << (word & 31)))
+		{
+			ppc_pdc_invalidate_page(word >> (PDC_PAGE_SHIFT - 2));
+			return;
+		}
+	}
+}
+
+static inline void (*ppc_pdc_decode(UINT32 opcode))(UINT32)
+{
+	switch (opcode >> 26)
+	{
+		case 19:	return optable19[(opcode >> 1) & 0x3ff];
+		case 31:	return optable31[(opcode >> 1) & 0x3ff];
+		case 59:	return optable59[(opcode >> 1) & 0x3ff];
+		case 63:	return optable63[(opcode >> 1) & 0x3ff];
+		default:	return optable[opcode >> 26];
+	}
+}
+
+// Instructions after which a block must end (anything that may redirect the PC)
+static inline bool ppc_pdc_ends_block(UINT32 opcode)
+{
+	switch (opcode >> 26)
+	{
+		case 3:		// twi
+		case 16:	// bc
+		case 17:	// sc
+		case 18:	// b
+		case 19:	// bclr, bcctr, rfi, isync, ...
+			return true;
+		case 31:
+			return ((opcode >> 1) & 0x3ff) == 4;	// tw
+		default:
+			return false;
+	}
+}
+
+// Decodes the block starting at pc. Returns index of new block or PDC_NIL on error.
+static UINT32 ppc_pdc_decode_block(UINT32 pc)
+{
+	// Locate host memory through the normal fetch region lookup
+	ppc_change_pc(pc);
+	if (ppc.fatalError)
+		return PDC_NIL;
+
+	if (pdc.numBlocks >= PDC_MAX_BLOCKS || pdc.numOps + PDC_MAX_BLOCK_LENGTH > PDC_MAX_OPS)
+		ppc_pdc_flush();
+
+	UINT32 idx = pdc.numBlocks++;
+	PDC_BLOCK *block = &pdc.blocks[idx];
+	block->pc = pc;
+	block->host = ppc.op;
+	block->firstOp = pdc.numOps;
+
+	// Stop at the end of the fetch region and at the page boundary so that a block lives in exactly one page
+	UINT32 regionLeft = (ppc.cur_fetch.end - pc + 1) / 4;
+	UINT32 pageLeft = ((1 << PDC_PAGE_SHIFT) - (pc & ((1 << PDC_PAGE_SHIFT) - 1))) / 4;
+	UINT32 maxLength = PDC_MAX_BLOCK_LENGTH;
+	if (regionLeft < maxLength)
+		maxLength = regionLeft;
+	if (pageLeft < maxLength)
+		maxLength = pageLeft;
+
+	UINT32 length = 0;
+	while (length < maxLength)
+	{
+		UINT32 opcode = block->host[length];
+		PDC_OP *op = &pdc.ops[pdc.numOps++];
+		op->handler = ppc_pdc_decode(opcode);
+		op->op = opcode;
+		length++;
+		if (ppc_pdc_ends_block(opcode))
+			break;
+	}
+	block->length = length;
+
+	// Insert into hash table
+	UINT32 h = ppc_pdc_hash(pc);
+	block->hashNext = pdc.hash[h];
+	pdc.hash[h] = idx;
+
+	// Track code in RAM so that writes can invalidate it
+	if (pc < PDC_RAM_SIZE)
+	{
+		UINT32 page = pc >> PDC_PAGE_SHIFT;
+		block->pageNext = pdc.pageBlocks[page];
+		pdc.pageBlocks[page] = idx;
+		for (UINT32 word = pc >> 2; word < (pc >> 2) + length; word++)
+			pdc.codeMap[word / 32] |= 1 << (word & 31);
+	}
+	else
+	{
+		block->pageNext = pdc.romBlocks;
+		pdc.romBlocks = idx;
+	}
+
+	pdc.blocksDecoded++;
+	return idx;
+}
+
+static inline UINT32 ppc_pdc_lookup(UINT32 pc)
+{
+	for (UINT32 idx = pdc.hash[ppc_pdc_hash(pc)]; idx != PDC_NIL; idx = pdc.blocks[idx].hashNext)
+	{
+		if (pdc.blocks[idx].pc == pc)
+			return idx;
+	}
+	return PDC_NIL;
+}
+
+// Verification mode: compare a cached block against current guest memory
+static bool ppc_pdc_verify_block(UINT32 idx)
+{
+	const PDC_BLOCK *block = &pdc.blocks[idx];
+	for (UINT32 i = 0; i < block->length; i++)
+	{
+		const PDC_OP *op = &pdc.ops[block->firstOp + i];
+		UINT32 opcode = block->host[i];
+		if (op->op != opcode || op->handler != ppc_pdc_decode(opcode))
+		{
+			ErrorLog("PowerPC decode cache verification failed at %08X (decoded %08X, memory %08X).", block->pc + i * 4, op->op, opcode);
+			pdc.verifyFailures++;
+			return false;
+		}
+	}
+	return true;
+}
+
+
+/******************************************************************************
+ Execution
+******************************************************************************/
+
+// Runs cached blocks until the cycle budget is exhausted. Mirrors the interpreter loop in ppc_execute().
+static void ppc_pdc_execute(void)
+{
+	while (ppc.icount > 0 && !ppc.fatalError)
+	{
+		UINT32 pc = ppc.npc;
+		UINT32 idx = ppc_pdc_lookup(pc);
+		if (idx != PDC_NIL && pdc.verify && !ppc_pdc_verify_block(idx))
+		{
+			ppc_pdc_flush();
+			idx = PDC_NIL;
+		}
+		if (idx == PDC_NIL)
+		{
+			idx = ppc_pdc_decode_block(pc);
+			if (idx == PDC_NIL)
+				break;
+		}
+
+		const PDC_BLOCK *block = &pdc.blocks[idx];
+		const PDC_OP *op = &pdc.ops[block->firstOp];
+		const PDC_OP *end = op + block->length;
+		UINT32 invalidations = pdc.invalidations;
+
+		for (; op != end; op++)
+		{
+			ppc.pc = pc;
+			ppc.npc = pc + 4;
+
+			op->handler(op->op);
+
+			ppc.icount--;
+
+			if (ppc.icount == ppc.dec_trigger_cycle)
+			{
+				ppc.interrupt_pending |= 0x2;
+				ppc603_check_interrupts();
+			}
+
+			if (ppc.npc <= ppc.pc)
+				ppc_idle_check();
+
+			// Leave block on any change of flow, end of time slice, or if code was overwritten
+			pc += 4;
+			if (ppc.npc != pc || ppc.icount <= 0 || ppc.fatalError || pdc.invalidations != invalidations)
+				break;
+		}
+	}
+
+	// Keep interpreter fetch pointer coherent with npc
+	if (!ppc.fatalError)
+		ppc_change_pc(ppc.npc);
+}
+
+static void ppc_pdc_init(bool enable, bool verify)
+{
+	pdc.enabled = enable || verify;
+	pdc.verify = verify;
+	pdc.blocksDecoded = 0;
+	pdc.pagesInvalidated = 0;
+	pdc.flushes = 0;
+	pdc.verifyFailures = 0;
+	ppc_pdc_flush();
+}
@@ -51,7 +51,7 @@ namespace Debugger
 	static const char *drGroup = "Data Registers";
 	static const char *arGroup = "Address Regsters";
 
-	CMusashi68KDebug::CMusashi68KDebug(const char *name, M68KCtx *ctx) : C68KDebug(name), m_ctx(ctx), m_resetAddr(0)
+	CMusashi68KDebug::CMusashi68KDebug(const char *name, M68KCtx *ctx) : C68KDebug(name), m_ctx(ctx), m_resetAddr(0), m_savedCtx(NULL)
 	{
 		// Special registers
 		AddPCRegister      ("PC", srGroup);
@@ -48,7 +48,7 @@ namespace Debugger
 		M68KCtx *m_ctx;
 		UINT32 m_resetAddr;
 
-		M68KCtx m_savedCtx;
+		M68KCtx *m_savedCtx;
 
 		::IBus *m_bus;
 
@@ -56,8 +56,8 @@ namespace Debugger
 
 		void SetM68KContext()
 		{
-			M68KGetContext(&m_savedCtx);
-			if (m_savedCtx.Debug != this)
+			m_savedCtx = M68KGetContext();
+			if (m_savedCtx != m_ctx)
 				M68KSetContext(m_ctx);
 		}
 
@@ -68,8 +68,8 @@ namespace Debugger
 
 		void RestoreM68KContext()
 		{
-			if (m_savedCtx.Debug != this)
-				M68KSetContext(&m_savedCtx);
+			if (m_savedCtx != m_ctx)
+				M68KSetContext(m_savedCtx);
 		}
 
 	protected:
@@ -4,9 +4,14 @@
 #include "Util/ConfigBuilders.h"
 #include "Util/ByteSwap.h"
 #include "Util/Format.h"
+#include "Util/MappedFile.h"
 #include <algorithm>
+#include <atomic>
+#include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <iostream>
+#include <thread>
 
 bool GameLoader::LoadZipArchive(ZipArchive *zip, const std::string &zipfilename) const
 {
@@ -27,11 +32,11 @@ bool GameLoader::LoadZipArchive(ZipArchive *zip, const std::string &zipfilename)
     char filename_buffer[256];
     if (UNZ_OK != unzGetCurrentFileInfo(zf, &file_info, filename_buffer, sizeof(filename_buffer), NULL, 0, NULL, 0))
       continue;
-    zip->files_by_crc[file_info.crc].zf = zf;
-    zip->files_by_crc[file_info.crc].zipfilename = filename_buffer;
+    zip->files_by_crc[file_info.crc].zipfilename = zipfilename;
     zip->files_by_crc[file_info.crc].filename = filename_buffer;
     zip->files_by_crc[file_info.crc].uncompressed_size = file_info.uncompressed_size;
     zip->files_by_crc[file_info.crc].crc32 = file_info.crc;
+    zip->files_by_crc[file_info.crc].offset = unzGetOffset64(zf);
   }
 
   if (err != UNZ_END_OF_LIST_OF_FILE)
@@ -89,38 +94,124 @@ const GameLoader::ZippedFile *GameLoader::LookupFile(const File::ptr_t &file, co
   return nullptr;
 }
 
-bool GameLoader::LoadZippedFile(std::shared_ptr<uint8_t> *buffer, size_t *file_size, const GameLoader::File::ptr_t &file, const ZipArchive &zip) const
+unzFile GameLoader::ZipReader::Open(const std::string &zipfilename)
 {
-  // Locate file
-  const ZippedFile *zipped_file = LookupFile(file, zip);
-  if (!zipped_file)
-    return true;
-  if (UNZ_OK != unzLocateFile(zipped_file->zf, zipped_file->filename.c_str(), 2))
+  auto it = zfs.find(zipfilename);
+  if (it == zfs.end())
+    it = zfs.emplace(zipfilename, unzOpen(zipfilename.c_str())).first;
+  return it->second;
+}
+
+// We need to preserve the absolute offsets in order for byte swapping to work
+// properly when chunk size is 1
+static inline void CopyBytes(uint8_t *dest_base, uint32_t dest_offset, const uint8_t *src_base, uint32_t src_offset, uint32_t size, uint32_t byte_swap)
+{
+  for (uint32_t i = 0; i < size; i++)
   {
-    ErrorLog("Unable to locate '%s' in '%s'. Is zip file corrupt?", zipped_file->filename.c_str(), zipped_file->zipfilename.c_str());
-    return true;
+    dest_base[(dest_offset + i) ^ byte_swap] = src_base[src_offset + i];
   }
+}
 
-  // Read it in
-  if (UNZ_OK != unzOpenCurrentFile(zipped_file->zf))
+GameLoader::ReadResult GameLoader::LoadZippedFile(const LoadJob &job, ZipReader *reader, std::vector<uint8_t> *scratch)
+{
+  // Files are decompressed a slice at a time, straight into the region when it
+  // is contiguous and via a small scratch buffer when it is interleaved
+  const size_t SLICE_SIZE = 0x100000;
+  const size_t SCATTER_SIZE = 0x10000;
+
+  const ZippedFile *zipped_file = job.zipped_file;
+  unzFile zf = reader->Open(zipped_file->zipfilename);
+  if (!zf || UNZ_OK != unzSetOffset64(zf, zipped_file->offset) || UNZ_OK != unzOpenCurrentFile(zf))
+    return ReadResult::ReadError;
+
+  size_t file_size = zipped_file->uncompressed_size;
+  uint32_t chunk_size = (uint32_t)job.region->chunk_size;   // cache these as pointer dereferencing cripples performance in a tight loop
+  uint32_t stride = (uint32_t)job.region->stride;
+  uint32_t byte_swap = job.region->byte_swap;
+  bool error = false;
+  if (chunk_size == stride)
   {
-    ErrorLog("Unable to read '%s' from '%s'. Is zip file corrupt?", zipped_file->filename.c_str(), zipped_file->zipfilename.c_str());
-    return true;
+    // Byte swap each slice while it is still in cache
+    uint8_t *dest = job.dest + job.file->offset;
+    for (size_t done = 0; done < file_size && !error; )
+    {
+      unsigned size = (unsigned)std::min(file_size - done, SLICE_SIZE);
+      error = unzReadCurrentFile(zf, dest + done, size) != (int)size;
+      if (!error && byte_swap)
+        Util::FlipEndian16(dest + done, size);
+      done += size;
+    }
   }
-  *file_size = zipped_file->uncompressed_size;
-  buffer->reset(new uint8_t[*file_size], std::default_delete<uint8_t[]>());
-  size_t bytes_read = (size_t) unzReadCurrentFile(zipped_file->zf, buffer->get(), *file_size);
-  if (bytes_read != *file_size)
+  else
   {
-    ErrorLog("Unable to read '%s' from '%s'. Is zip file corrupt?", zipped_file->filename.c_str(), zipped_file->zipfilename.c_str());
-    unzCloseCurrentFile(zipped_file->zf);
-    return true;
+    size_t piece_size = std::max<size_t>(SCATTER_SIZE / chunk_size, 1) * chunk_size;
+    scratch->resize(piece_size);
+    const uint8_t *src = scratch->data();
+    uint32_t dest_offset = job.file->offset;
+    bool word_aligned = chunk_size == 2 && (dest_offset & 1) == 0 && (stride & 1) == 0;
+    for (size_t done = 0; done < file_size && !error; )
+    {
+      unsigned size = (unsigned)std::min(file_size - done, piece_size);
+      error = unzReadCurrentFile(zf, scratch->data(), size) != (int)size;
+      if (error)
+        break;
+      if (word_aligned)
+      {
+        // Most interleaved regions are 16-bit words, which move as a unit
+        for (unsigned i = 0; i < size; i += 2)
+        {
+          uint16_t word;
+          memcpy(&word, src + i, sizeof(word));
+          if (byte_swap)
+            word = (uint16_t)((word >> 8) | (word << 8));
+          memcpy(job.dest + dest_offset, &word, sizeof(word));
+          dest_offset += stride;
+        }
+      }
+      else
+      {
+        for (unsigned src_offset = 0; src_offset < size; src_offset += chunk_size)
+        {
+          CopyBytes(job.dest, dest_offset, src, src_offset, chunk_size, byte_swap);
+          dest_offset += stride;
+        }
+      }
+      done += size;
+    }
   }
 
-  // And close it
-  if (UNZ_CRCERROR == unzCloseCurrentFile(zipped_file->zf))
-    ErrorLog("CRC error reading '%s' from '%s'. File may be corrupt.", zipped_file->filename.c_str(), zipped_file->zipfilename.c_str());
-  return false;
+  if (error)
+  {
+    unzCloseCurrentFile(zf);
+    return ReadResult::ReadError;
+  }
+  if (UNZ_CRCERROR == unzCloseCurrentFile(zf))
+    return ReadResult::CRCError;
+  return ReadResult::OK;
+}
+
+void GameLoader::RunLoadJobs(std::vector<ReadResult> *results, const std::vector<LoadJob> &jobs)
+{
+  // Each thread takes the next job in line, so with the largest files first
+  // the threads finish at about the same time. Every job writes to its own
+  // bytes of a region, even when files are interleaved.
+  results->assign(jobs.size(), ReadResult::OK);
+  std::atomic<size_t> next_job(0);
+  auto worker = [&]()
+  {
+    ZipReader reader;
+    std::vector<uint8_t> scratch;
+    for (size_t i = next_job++; i < jobs.size(); i = next_job++)
+      (*results)[i] = LoadZippedFile(jobs[i], &reader, &scratch);
+  };
+
+  size_t num_threads = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), jobs.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < num_threads; i++)
+    threads.emplace_back(worker);
+  worker();
+  for (auto &thread: threads)
+    thread.join();
 }
 
 bool GameLoader::MissingAttrib(const GameLoader &loader, const Util::Config::Node &node, const std::string &attribute)
@@ -742,52 +833,116 @@ bool GameLoader::ComputeRegionSize(uint32_t *region_size, const GameLoader::Regi
   return error;
 }
 
-// We need to preserve the absolute offsets in order for byte swapping to work
-// properly when chunk size is 1
-static inline void CopyBytes(uint8_t *dest_base, uint32_t dest_offset, const uint8_t *src_base, uint32_t src_offset, uint32_t size, uint32_t byte_swap)
+static void HashBytes(uint64_t *hash, const void *data, size_t size)
 {
-  for (uint32_t i = 0; i < size; i++)
+  // 64-bit FNV-1a
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data);
+  for (size_t i = 0; i < size; i++)
   {
-    dest_base[(dest_offset + i) ^ byte_swap] = src_base[src_offset + i];
+    *hash ^= bytes[i];
+    *hash *= 0x100000001b3ULL;
   }
 }
 
-bool GameLoader::LoadRegion(ROM *rom, const GameLoader::Region::ptr_t &region, const ZipArchive &zip) const
+template <typename T>
+static void HashValue(uint64_t *hash, T value)
 {
-  bool error = false;
+  HashBytes(hash, &value, sizeof(value));
+}
+
+static void HashString(uint64_t *hash, const std::string &str)
+{
+  HashBytes(hash, str.c_str(), str.size() + 1);
+}
+
+// Cached regions are a 64-byte header followed by the region exactly as it is
+// assembled in memory. They are only meaningful on the machine that wrote them.
+static const char s_cache_magic[8] = { 'S', 'M', 'R', 'O', 'M', 'C', 'A', 'C' };
+static const uint32_t CACHE_VERSION = 2;  // 1 could hold regions with CRC errors
+static const size_t CACHE_HEADER_SIZE = 64;
+
+uint64_t GameLoader::ComputeCacheKey(const std::string &game_name, const Region::ptr_t &region, uint32_t region_size, const ZipArchive &zip) const
+{
+  // Anything that affects the assembled region, plus the size and time stamp
+  // of every zip file it comes from
+  uint64_t key = 0xcbf29ce484222325ULL;
+  HashString(&key, game_name);
+  HashString(&key, region->region_name);
+  HashValue(&key, (uint64_t)region->stride);
+  HashValue(&key, (uint64_t)region->chunk_size);
+  HashValue(&key, region->byte_swap);
+  HashValue(&key, region_size);
   for (auto &file: region->files)
   {
-    std::shared_ptr<uint8_t> tmp;
-    size_t file_size;
-    error |= LoadZippedFile(&tmp, &file_size, file, zip);
-    if (!error)
-    {
-      uint8_t *dest = rom->data.get();
-      uint8_t *src = tmp.get();
-      if (region->chunk_size == region->stride)
-      {
-        memcpy(dest + file->offset, src, file_size);
-        if (region->byte_swap)
-          Util::FlipEndian16(dest + file->offset, file_size);
-      }
-      else
-      {
-        uint32_t num_chunks = (uint32_t)file_size / region->chunk_size;
-        uint32_t dest_offset = file->offset;
-        uint32_t src_offset = 0;
-        uint32_t chunk_size = (uint32_t)region->chunk_size;		// cache these as pointer dereferencing cripples performance in a tight loop
-        uint32_t stride = (uint32_t)region->stride;
-        uint32_t byte_swap = region->byte_swap;
-        for (uint32_t i = 0; i < num_chunks; i++)
-        {
-          CopyBytes(dest, dest_offset, src, src_offset, chunk_size, byte_swap);
-          dest_offset += stride;
-          src_offset += chunk_size;
-        }
-      }
-    }
+    const ZippedFile *zipped_file = LookupFile(file, zip);
+    HashValue(&key, file->offset);
+    HashValue(&key, zipped_file->crc32);
+    HashValue(&key, (uint64_t)zipped_file->uncompressed_size);
+    std::error_code ec;
+    auto zip_size = std::filesystem::file_size(zipped_file->zipfilename, ec);
+    auto zip_time = std::filesystem::last_write_time(zipped_file->zipfilename, ec);
+    HashString(&key, zipped_file->zipfilename);
+    HashValue(&key, (uint64_t)zip_size);
+    HashValue(&key, (int64_t)zip_time.time_since_epoch().count());
+  }
+  return key;
+}
+
+std::string GameLoader::CacheFilePath(const std::string &game_name, const Region::ptr_t &region) const
+{
+  return m_cache_dir + "/" + game_name + "." + region->region_name + ".bin";
+}
+
+bool GameLoader::LoadCachedRegion(ROM *rom, const std::string &path, uint64_t key, uint32_t region_size) const
+{
+  auto file = std::make_shared<Util::MappedFile>();
+  if (!file->Open(path))
+    return true;
+  if (file->Size() != CACHE_HEADER_SIZE + region_size)
+    return true;
+  const uint8_t *header = file->Data();
+  uint32_t version;
+  uint64_t stored_key;
+  memcpy(&version, header + 8, sizeof(version));
+  memcpy(&stored_key, header + 16, sizeof(stored_key));
+  if (memcmp(header, s_cache_magic, sizeof(s_cache_magic)) || version != CACHE_VERSION || stored_key != key)
+    return true;
+
+  // The region aliases the mapping, which lives as long as any copy of the ROM.
+  // ROM data is only ever read, so the mapping can stay read-only.
+  rom->data = std::shared_ptr<uint8_t>(file, const_cast<uint8_t *>(file->Data()) + CACHE_HEADER_SIZE);
+  rom->size = region_size;
+  return false;
+}
+
+void GameLoader::SaveCachedRegion(const ROM &rom, const std::string &path, uint64_t key) const
+{
+  // Write to a temporary file first so that an interrupted write can never be
+  // mistaken for a valid cache file
+  std::error_code ec;
+  std::filesystem::create_directories(m_cache_dir, ec);
+  std::string tmp_path = path + ".tmp";
+  FILE *fp = fopen(tmp_path.c_str(), "wb");
+  if (!fp)
+  {
+    InfoLog("Unable to write ROM cache file '%s'.", tmp_path.c_str());
+    return;
+  }
+  uint8_t header[CACHE_HEADER_SIZE] = { 0 };
+  uint64_t size = rom.size;
+  memcpy(header, s_cache_magic, sizeof(s_cache_magic));
+  memcpy(header + 8, &CACHE_VERSION, sizeof(CACHE_VERSION));
+  memcpy(header + 16, &key, sizeof(key));
+  memcpy(header + 24, &size, sizeof(size));
+  bool error = fwrite(header, sizeof(header), 1, fp) != 1 || fwrite(rom.data.get(), rom.size, 1, fp) != 1;
+  error |= fclose(fp) != 0;
+  if (!error)
+    std::filesystem::rename(tmp_path, path, ec);
+  if (error || ec)
+  {
+    InfoLog("Unable to write ROM cache file '%s'.", path.c_str());
+    std::filesystem::remove(tmp_path, ec);
   }
-  return error;
 }
 
 bool GameLoader::LoadROMs(ROMSet *rom_set, const std::string &game_name, const ZipArchive &zip) const
@@ -799,28 +954,71 @@ bool GameLoader::LoadROMs(ROMSet *rom_set, const std::string &game_name, const Z
     return true;
   }
 
-  // Load up the ROMs
+  // Allocate each region, or map it from the cache, and collect the files that
+  // remain to be decompressed
   auto &regions_by_name = IsChildSet(it->second) ? m_regions_by_merged_game.find(game_name)->second : m_regions_by_game.find(game_name)->second;
   LogROMDefinition(game_name, regions_by_name);
-  bool error = false;
+  std::map<std::string, bool> error_by_region;
+  std::map<std::string, uint64_t> cache_key_by_region;
+  std::vector<LoadJob> jobs;
   for (auto &v: regions_by_name)
   {
     auto &region = v.second;
     uint32_t region_size = 0;
-    bool error_loading_region = false;
+    error_by_region[region->region_name] = ComputeRegionSize(&region_size, region, zip);
+    if (error_by_region[region->region_name])
+      continue;
 
-    // Attempt to load the region
-    if (ComputeRegionSize(&region_size, region, zip))
-      error_loading_region = true;
-    else
+    auto &rom = rom_set->rom_by_region[region->region_name];
+    if (!m_cache_dir.empty())
     {
-      // Load up the ROM region
-      auto &rom = rom_set->rom_by_region[region->region_name];
-      rom.data.reset(new uint8_t[region_size], std::default_delete<uint8_t[]>());
-      rom.size = region_size;
-      error_loading_region = LoadRegion(&rom, region, zip);
+      uint64_t key = ComputeCacheKey(game_name, region, region_size, zip);
+      if (!LoadCachedRegion(&rom, CacheFilePath(game_name, region), key, region_size))
+      {
+        InfoLog("Loaded ROM region '%s' from cache.", region->region_name.c_str());
+        continue;
+      }
+      cache_key_by_region[region->region_name] = key;
     }
+    rom.data.reset(new uint8_t[region_size], std::default_delete<uint8_t[]>());
+    rom.size = region_size;
+    for (auto &file: region->files)
+    {
+      jobs.push_back({ region.get(), file.get(), LookupFile(file, zip), rom.data.get() });
+    }
+  }
 
+  // Decompress all files at once
+  std::stable_sort(jobs.begin(), jobs.end(),
+    [](const LoadJob &a, const LoadJob &b)
+    {
+      return a.zipped_file->uncompressed_size > b.zipped_file->uncompressed_size;
+    });
+  std::vector<ReadResult> results;
+  RunLoadJobs(&results, jobs);
+  for (size_t i = 0; i < jobs.size(); i++)
+  {
+    const ZippedFile *zipped_file = jobs[i].zipped_file;
+    if (results[i] == ReadResult::ReadError)
+    {
+      ErrorLog("Unable to read '%s' from '%s'. Is zip file corrupt?", zipped_file->filename.c_str(), zipped_file->zipfilename.c_str());
+      error_by_region[jobs[i].region->region_name] = true;
+    }
+    else if (results[i] == ReadResult::CRCError)
+    {
+      // The cache key only covers the CRCs in the zip directory, so a region
+      // cached now would load without this warning from then on
+      ErrorLog("CRC error reading '%s' from '%s'. File may be corrupt.", zipped_file->filename.c_str(), zipped_file->zipfilename.c_str());
+      if (cache_key_by_region.erase(jobs[i].region->region_name))
+        InfoLog("ROM region '%s' will not be cached.", jobs[i].region->region_name.c_str());
+    }
+  }
+
+  bool error = false;
+  for (auto &v: regions_by_name)
+  {
+    auto &region = v.second;
+    bool error_loading_region = error_by_region[region->region_name];
     if (error_loading_region && !region->required)
     {
       // Failed to load the region but it wasn't required anyway, so remove it
@@ -833,6 +1031,10 @@ bool GameLoader::LoadROMs(ROMSet *rom_set, const std::string &game_name, const Z
       // Proceed normally: accumulate errors
       error |= error_loading_region;
     }
+
+    auto key_it = cache_key_by_region.find(region->region_name);
+    if (!error_loading_region && key_it != cache_key_by_region.end())
+      SaveCachedRegion(rom_set->rom_by_region[region->region_name], CacheFilePath(game_name, region), key_it->second);
   }
 
   // Attach the patches and do some more error checking here
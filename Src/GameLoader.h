@@ -7,6 +7,7 @@
 #include "ROMSet.h"
 #include <map>
 #include <set>
+#include <vector>
 
 class GameLoader
 {
@@ -56,11 +57,11 @@ private:
   // Single compressed file inside of a zip archive
   struct ZippedFile
   {
-    unzFile zf = nullptr;
     std::string zipfilename;  // zip archive
     std::string filename;     // file inside the zip archive
     size_t uncompressed_size = 0;
     uint32_t crc32 = 0;
+    uint64_t offset = 0;      // position in zip directory, for unzSetOffset64()
   };
 
   // Multiple zip archives
@@ -79,10 +80,46 @@ private:
     }
   };
 
+  // Zip handles belonging to one loader thread. A minizip handle can only
+  // decompress one file at a time, so threads cannot share them.
+  struct ZipReader
+  {
+    std::map<std::string, unzFile> zfs;
+    unzFile Open(const std::string &zipfilename);
+
+    ~ZipReader()
+    {
+      for (auto &v: zfs)
+      {
+        if (v.second)
+          unzClose(v.second);
+      }
+    }
+  };
+
+  // A single file to be decompressed into its place in a ROM region
+  struct LoadJob
+  {
+    const Region *region;
+    const File *file;
+    const ZippedFile *zipped_file;
+    uint8_t *dest;
+  };
+
+  enum class ReadResult
+  {
+    OK,
+    ReadError,
+    CRCError
+  };
+
+  // Directory for assembled ROM regions, empty if caching is disabled
+  std::string m_cache_dir;
+
   bool LoadZipArchive(ZipArchive *zip, const std::string &zipfilename) const;
   const ZippedFile *LookupFile(const File::ptr_t &file, const ZipArchive &zip) const;
   bool FileExistsInZipArchive(const File::ptr_t &file, const ZipArchive &zip) const;
-  bool LoadZippedFile(std::shared_ptr<uint8_t> *buffer, size_t *file_size, const GameLoader::File::ptr_t &file, const ZipArchive &zip) const;
+  static ReadResult LoadZippedFile(const LoadJob &job, ZipReader *reader, std::vector<uint8_t> *scratch);
   static bool MissingAttrib(const GameLoader &loader, const Util::Config::Node &node, const std::string &attribute);
   bool LoadGamesFromXML(const Util::Config::Node &xml);
   bool MergeChildrenWithParents();
@@ -97,7 +134,11 @@ private:
     const std::map<std::string, RegionsByName_t> &regions_by_game) const;
   bool ComputeRegionSize(uint32_t *region_size, const Region::ptr_t &region, const ZipArchive &zip) const;
   void ChooseGameInZipArchive(std::string *chosen_game, bool *missing_parent_roms, const ZipArchive &zip, const std::string &zipfilename) const;
-  bool LoadRegion(ROM *buffer, const GameLoader::Region::ptr_t &region, const ZipArchive &zip) const;
+  static void RunLoadJobs(std::vector<ReadResult> *results, const std::vector<LoadJob> &jobs);
+  uint64_t ComputeCacheKey(const std::string &game_name, const Region::ptr_t &region, uint32_t region_size, const ZipArchive &zip) const;
+  std::string CacheFilePath(const std::string &game_name, const Region::ptr_t &region) const;
+  bool LoadCachedRegion(ROM *rom, const std::string &path, uint64_t key, uint32_t region_size) const;
+  void SaveCachedRegion(const ROM &rom, const std::string &path, uint64_t key) const;
   bool LoadROMs(ROMSet *rom_set, const std::string &game_name, const ZipArchive &zip) const;
   std::string ChooseGame(const std::set<std::string> &games_found, const std::string &zipfilename) const;
   static bool CompareFilesByName(const File::ptr_t &a,const File::ptr_t &b);
@@ -105,6 +146,14 @@ private:
 public:
   GameLoader(const std::string &xml_file);
   bool Load(Game *game, ROMSet *rom_set, const std::string &zipfilename, const std::string &game_name) const;
+
+  // Assembled ROM regions are cached in this directory and memory mapped on
+  // later loads of the same, unmodified zip files. Empty disables the cache.
+  void SetCacheDirectory(const std::string &dir)
+  {
+    m_cache_dir = dir;
+  }
+
   const std::map<std::string, Game> &GetGames() const
   {
     return m_game_info_by_game;
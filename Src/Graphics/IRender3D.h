@@ -3,6 +3,20 @@
 
 #include <cstdint>
 
+/*
+ * Render3DStats:
+ *
+ * Draw submission counts for one frame, for debugging purposes.
+ */
+struct Render3DStats
+{
+  uint32_t meshes = 0;
+  uint32_t stateChanges = 0;  // meshes that needed uniforms or textures set, ie the start of each batch
+  uint32_t textureBinds = 0;
+  uint32_t ranges = 0;        // contiguous vertex ranges drawn
+  uint32_t drawCalls = 0;
+};
+
 /*
  * IRender3D:
  *
@@ -12,6 +26,8 @@ class IRender3D
 {
 public:
   virtual void RenderFrame(void) = 0;
+  virtual void BuildScene(void) {}  // optional CPU-only part of RenderFrame(), may be called from another thread beforehand
+  virtual bool QueueScene(void) { return false; }  // optional, the next RenderFrame() draws the last built scene even if BuildScene() runs again first
   virtual void BeginFrame(void) = 0;
   virtual void EndFrame(void) = 0;
   virtual void UploadTextures(unsigned level, unsigned x, unsigned y, unsigned width, unsigned height) = 0;
@@ -21,6 +37,7 @@ public:
   virtual void SetSunClamp(bool enable) = 0;
   virtual void SetSignedShade(bool enable) = 0;
   virtual float GetLosValue(int layer) = 0;
+  virtual Render3DStats GetFrameStats(void) { return Render3DStats(); }  // optional, counts for the last RenderFrame()
 
   virtual ~IRender3D()
   {
@@ -1,4 +1,5 @@
 #include "GLSLShader.h"
+#include "ProgramCache.h"
 #include <cstdio>
 
 GLSLShader::GLSLShader() 
@@ -36,6 +37,12 @@ GLSLShader& GLSLShader::operator=(GLSLShader&& other) noexcept
 
 bool GLSLShader::LoadShaders(const char* vertexShader, const char* fragmentShader) 
 {
+	m_program = New3D::ProgramCache::Load({ vertexShader, fragmentShader });
+
+	if (m_program) {
+		return true;		// no shader objects, UnloadShaders only has the program to delete
+	}
+
 	m_program = glCreateProgram();
 	m_vShader = glCreateShader(GL_VERTEX_SHADER);
 	m_fShader = glCreateShader(GL_FRAGMENT_SHADER);
@@ -49,12 +56,15 @@ bool GLSLShader::LoadShaders(const char* vertexShader, const char* fragmentShade
 	glAttachShader(m_program, m_vShader);
 	glAttachShader(m_program, m_fShader);
 
+	New3D::ProgramCache::PrepareLink(m_program);
 	glLinkProgram(m_program);
 
 	PrintShaderInfoLog(m_vShader);
 	PrintShaderInfoLog(m_fShader);
 	PrintProgramInfoLog(m_program);
 
+	New3D::ProgramCache::Save(m_program, { vertexShader, fragmentShader });
+
 	return true;
 }
 
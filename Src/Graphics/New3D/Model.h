@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <memory>
 #include <cstring>
+#include <tuple>
 #include "Texture.h"
 #include "Mat4.h"
 
@@ -55,40 +56,66 @@ struct R3DPoly
 	int number = 4;
 };
 
-struct FVertex : Vertex			// full vertex including face attributes
+struct FVertex					// full vertex including face attributes, packed for the vbo. Positions and tex coords need floats, everything else is in -1 to 1
 {
-	float faceNormal[3];
-	UINT8 faceColour[4];
+	float	pos[3];					// w is always 1
+	INT16	normal[4];				// snorm, w unused
+	float	texcoords[2];
+	UINT8	faceColour[4];
+	INT16	faceNormal[3];			// snorm
+	INT16	fixedShade;				// snorm
+
+	static INT16 PackSnorm(float f)
+	{
+		f = f < -1.0f ? -1.0f : (f > 1.0f ? 1.0f : f);
+		return (INT16)(f * 32767.0f + (f < 0.0f ? -0.5f : 0.5f));
+	}
 
-	FVertex& operator=(const Vertex& vertex) 
+	static float UnpackSnorm(INT16 i)
 	{
-		memcpy(this, &vertex, sizeof(Vertex));
-		return *this;
+		return i < -32767 ? -1.0f : i * (float)(1.0 / 32767.0);
 	}
 
 	FVertex() {}
 	FVertex(const R3DPoly& r3dPoly, int index) 
 	{
-		for (int i = 0; i < 4; i++) { faceColour[i] = r3dPoly.faceColour[i]; }
-		for (int i = 0; i < 3; i++) { faceNormal[i] = r3dPoly.faceNormal[i]; }
-
-		*this = r3dPoly.v[index];
+		Set(r3dPoly.v[index], r3dPoly);
 	}
 
 	FVertex(const R3DPoly& r3dPoly, int index1, int index2)		// average of 2 points
 	{
-		Vertex::Average(r3dPoly.v[index1], r3dPoly.v[index2], *this);
+		Vertex v;
+		Vertex::Average(r3dPoly.v[index1], r3dPoly.v[index2], v);
+		Set(v, r3dPoly);
+	}
 
-		// copy face attributes
-		for (int i = 0; i < 4; i++) { faceColour[i] = r3dPoly.faceColour[i]; }
-		for (int i = 0; i < 3; i++) { faceNormal[i] = r3dPoly.faceNormal[i]; }
+	static bool Equal(const FVertex& p1, const FVertex& p2)
+	{
+		return (p1.pos[0] == p2.pos[0] &&
+			p1.pos[1] == p2.pos[1] &&
+			p1.pos[2] == p2.pos[2]);
 	}
 
 	static void Average(const FVertex& p1, const FVertex& p2, FVertex& p3)
 	{
-		Vertex::Average(p1, p2, p3);
+		for (int i = 0; i < 3; i++) { p3.pos[i] = (p1.pos[i] + p2.pos[i]) * 0.5f; }
+		for (int i = 0; i < 3; i++) { p3.normal[i] = PackSnorm((UnpackSnorm(p1.normal[i]) + UnpackSnorm(p2.normal[i])) * 0.5f); }
+		for (int i = 0; i < 2; i++) { p3.texcoords[i] = (p1.texcoords[i] + p2.texcoords[i]) * 0.5f; }
 		for (int i = 0; i < 4; i++) { p3.faceColour[i] = p1.faceColour[i]; }
 		for (int i = 0; i < 3; i++) { p3.faceNormal[i] = p1.faceNormal[i]; }
+		p3.fixedShade = PackSnorm((UnpackSnorm(p1.fixedShade) + UnpackSnorm(p2.fixedShade)) * 0.5f);
+	}
+
+private:
+	void Set(const Vertex& v, const R3DPoly& r3dPoly)
+	{
+		for (int i = 0; i < 3; i++) { pos[i] = v.pos[i]; }
+		for (int i = 0; i < 3; i++) { normal[i] = PackSnorm(v.normal[i]); }
+		normal[3] = 0;
+		for (int i = 0; i < 2; i++) { texcoords[i] = v.texcoords[i]; }
+		for (int i = 0; i < 4; i++) { faceColour[i] = r3dPoly.faceColour[i]; }
+		for (int i = 0; i < 3; i++) { faceNormal[i] = PackSnorm(r3dPoly.faceNormal[i]); }
+		fixedShade = PackSnorm(v.fixedShade);
 	}
 };
 
@@ -125,10 +152,31 @@ struct Mesh
 
 	enum TexWrapMode : int { repeat = 0, repeatClamp, mirror, mirrorClamp };
 
+	// draw state, ie everything set by R3DShader::SetMeshUniforms() plus the texture. Meshes with the same state can go in one draw
+	static auto StateKey(const Mesh& m)
+	{
+		return std::tie(m.textured, m.format, m.x, m.y, m.width, m.height, m.microTexture, m.microTextureID, m.microTextureScale,
+			m.inverted, m.wrapModeU, m.wrapModeV, m.alphaTest, m.textureAlpha, m.translatorMap, m.layered, m.fixedShading, m.lighting, m.specular, m.shininess, m.specularValue, m.fogIntensity);
+	}
+
+	static bool SameState(const Mesh& m1, const Mesh& m2)
+	{
+		return StateKey(m1) == StateKey(m2);
+	}
+
+	// orders meshes so that the ones drawn in the same pass, and then the ones with the same state, are next to each other
+	static bool StateLess(const Mesh& m1, const Mesh& m2)
+	{
+		auto pass1 = std::tie(m1.highPriority, m1.polyAlpha, m1.textureAlpha, m1.transLSelect);
+		auto pass2 = std::tie(m2.highPriority, m2.polyAlpha, m2.textureAlpha, m2.transLSelect);
+
+		return pass1 < pass2 || (pass1 == pass2 && StateKey(m1) < StateKey(m2));
+	}
+
 	// texture
-	int format, x, y, width, height = 0;
-	TexWrapMode wrapModeU;
-	TexWrapMode wrapModeV;
+	int format = 0, x = 0, y = 0, width = 0, height = 0;
+	TexWrapMode wrapModeU = repeat;
+	TexWrapMode wrapModeV = repeat;
 	bool inverted = false;
 
 	// microtexture
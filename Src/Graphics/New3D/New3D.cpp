@@ -7,8 +7,10 @@
 #include <limits>
 #include <cstring>
 #include <unordered_map>
+#include <thread>
 #include "R3DFloat.h"
 #include "Util/BitCast.h"
+#include "OSD/Logger.h"
 
 #ifdef __ANDROID__
 #define MAX_RAM_VERTS 150000
@@ -35,8 +37,46 @@ CNew3D::CNew3D(const Util::Config::Node &config, const std::string& gameName)
 	m_sunClamp		= true;
 	m_shadeIsSigned = true;
 	m_new3dAccurate = config["New3DAccurate"].ValueAsDefault<bool>(false);
+	m_sceneReady	= false;
+	m_sceneQueued	= false;
+#ifdef __ANDROID__
+	m_gpuTextures	= config["New3DGPUTextures"].ValueAsDefault<bool>(false);
+#else
+	m_gpuTextures	= false;				// needs integer textures, the desktop shaders are still GLSL 1.20
+#endif
+	m_deferModels	= false;
+	m_verifyScene	= config["New3DVerify"].ValueAsDefault<bool>(false);
+	m_asyncLos		= config["New3DAsyncLos"].ValueAsDefault<bool>(false);
+	m_verifyVertices = config["New3DVerifyVertices"].ValueAsDefault<bool>(false);
+	m_verifyErrors	= 0;
+	m_romShortfall	= 0;
+	m_frameCount	= 0;
 	m_numPolyVerts	= 3;
 	m_primType		= GL_TRIANGLES;
+	m_streamMode	= StreamMode::subData;
+	m_ramBuffer		= 0;
+	m_ramBase		= 0;
+
+	for (auto& fence : m_ramFences) {
+		fence = 0;
+	}
+
+	for (auto& nf : m_drawNfPairs) {
+		nf.zNear = -std::numeric_limits<float>::max();
+		nf.zFar  =  std::numeric_limits<float>::max();
+	}
+
+	m_romAlloc.Reset(MAX_ROM_VERTS);
+
+	// threads used to build the scene, including the one calling BuildScene(). 0 = pick for us
+	unsigned threads = config["New3DThreads"].ValueAsDefault<unsigned>(1);
+	if (threads == 0) {
+		threads = std::max(1u, std::min(std::thread::hardware_concurrency(), 4u));
+	}
+	if (threads > 1) {
+		m_workerPool.reset(new WorkerPool(threads - 1));
+		m_arenas.resize(threads);
+	}
 
 #ifndef __ANDROID__
 	if (config["QuadRendering"].ValueAs<bool>()) {
@@ -48,7 +88,47 @@ CNew3D::CNew3D(const Util::Config::Node &config, const std::string& gameName)
 
 CNew3D::~CNew3D()
 {
+	InfoLog("New3D ROM model cache: %llu hits, %llu misses, %llu models (%llu vertices) evicted.",
+		(unsigned long long)m_romStats.hits, (unsigned long long)m_romStats.misses,
+		(unsigned long long)m_romStats.evictions, (unsigned long long)m_romStats.evictedVerts);
+
+	if (m_drawStats.frames) {
+		double frames = (double)m_drawStats.frames;
+		InfoLog("New3D draw submission per frame: %.0f meshes, %.0f state changes, %.0f texture binds, %.0f vertex ranges in %.0f draw calls.",
+			m_drawStats.meshes / frames, m_drawStats.stateChanges / frames, m_drawStats.textureBinds / frames,
+			m_drawStats.ranges / frames, m_drawStats.drawCalls / frames);
+	}
+
+	if (m_vertexErrors.checked) {
+		InfoLog("New3D packed vertices: %llu checked, %llu with values out of range, largest error %g in normals, %g in face normals, %g in fixed shading.",
+			(unsigned long long)m_vertexErrors.checked, (unsigned long long)m_vertexErrors.clamped,
+			m_vertexErrors.normal, m_vertexErrors.faceNormal, m_vertexErrors.fixedShade);
+	}
+
+	if (m_losFetches) {
+		InfoLog("New3D line of sight: %llu frames of reads fetched, %llu without waiting for the GPU.",
+			(unsigned long long)m_losFetches, (unsigned long long)(m_losFetches - m_losStalls));
+	}
+
+	for (auto& r : m_losReads) {
+		r.buffer.Destroy();
+	}
+
+	if (m_streamStats.frames) {
+		static const char* modes[] = { "buffer updates", "unsynchronized mapping", "persistent mapping" };
+		InfoLog("New3D dynamic vertex streaming (%s): %.0f KB per frame on average, %.0f KB at most, waited for the GPU in %llu of %llu frames.",
+			modes[(int)m_streamMode], m_streamStats.bytes / 1024.0 / m_streamStats.frames, m_streamStats.maxBytes / 1024.0,
+			(unsigned long long)m_streamStats.waits, (unsigned long long)m_streamStats.frames);
+	}
+
+	for (auto& fence : m_ramFences) {
+		if (fence) {
+			glDeleteSync(fence);
+		}
+	}
+
 	m_vbo.Destroy();
+	m_textureBank.Destroy();
 }
 
 void CNew3D::AttachMemory(const UINT32 *cullingRAMLoPtr, const UINT32 *cullingRAMHiPtr, const UINT32 *polyRAMPtr, const UINT32 *vromPtr, const UINT16 *textureRAMPtr)
@@ -77,7 +157,24 @@ void CNew3D::SetStepping(int stepping)
 		m_vertexFactor = (1.0f / 128.0f);		// 17.7
 	}
 
-	m_vbo.Create(GL_ARRAY_BUFFER, GL_DYNAMIC_DRAW, sizeof(FVertex) * (MAX_RAM_VERTS + MAX_ROM_VERTS));
+	// dynamic verts need fences to know when the gpu is done with each area, and glMapBufferRange to write without waiting for the gpu
+#ifdef __ANDROID__
+	bool streaming = true;
+#else
+	bool streaming = (GLEW_VERSION_3_2 || GLEW_ARB_sync) && (GLEW_VERSION_3_0 || GLEW_ARB_map_buffer_range);
+#endif
+
+	if (streaming && m_vbo.CreateMapped(GL_ARRAY_BUFFER, sizeof(FVertex) * (MAX_ROM_VERTS + RAM_BUFFERS * MAX_RAM_VERTS))) {
+		m_streamMode = StreamMode::persistent;
+	}
+	else if (streaming) {
+		m_vbo.Create(GL_ARRAY_BUFFER, GL_DYNAMIC_DRAW, sizeof(FVertex) * (MAX_ROM_VERTS + RAM_BUFFERS * MAX_RAM_VERTS));
+		m_streamMode = StreamMode::mapRange;
+	}
+	else {
+		m_vbo.Create(GL_ARRAY_BUFFER, GL_DYNAMIC_DRAW, sizeof(FVertex) * (MAX_ROM_VERTS + MAX_RAM_VERTS));
+		m_streamMode = StreamMode::subData;		// one area, the driver has to sync
+	}
 }
 
 bool CNew3D::Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yRes, unsigned totalXResParam, unsigned totalYResParam)
@@ -93,6 +190,21 @@ bool CNew3D::Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yR
 	m_totalYRes = totalYResParam;
 
 	m_r3dShader.LoadShader();
+
+	if (m_gpuTextures) {
+		m_textureBank.Create();
+	}
+
+	if (m_asyncLos && !PixelReadback::Supported()) {
+		InfoLog("New3D: asynchronous line of sight reads aren't supported by this OpenGL driver, reading synchronously.");
+		m_asyncLos = false;
+	}
+
+	if (m_asyncLos) {
+		for (auto& r : m_losReads) {
+			r.buffer.Create(sizeof(m_losAsync.value));
+		}
+	}
 #ifndef __ANDROID__
 	if (!m_r3dFrameBuffers)
 		m_r3dFrameBuffers = std::make_unique<R3DFrameBuffers>();
@@ -120,6 +232,11 @@ bool CNew3D::Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yR
 
 void CNew3D::UploadTextures(unsigned level, unsigned x, unsigned y, unsigned width, unsigned height)
 {
+	if (m_gpuTextures) {
+		m_textureBank.Invalidate(x, y, width, height);	// raw memory, so mipmaps are no different
+		return;
+	}
+
 	if (level == 0) {
 		m_texSheet.Invalidate(x, y, width, height);		// base textures only
 	} 
@@ -160,7 +277,7 @@ void CNew3D::DrawScrollFog()
 	float rgba[4];
 
 	for (int i = 0; i < 4; i++) {
-		for (auto &n : m_nodes) {
+		for (auto &n : m_drawNodes) {
 			if (n.viewport.priority == i) {
 				if (n.viewport.scrollFog != 0.f) {
 					rgba[0] = n.viewport.fogParams[0];
@@ -178,7 +295,7 @@ void CNew3D::DrawScrollFog()
 CheckScroll:
 
 	for (int i = 0; i < 4; i++) {
-		for (auto &n : m_nodes) {
+		for (auto &n : m_drawNodes) {
 			if (n.viewport.priority == i) {
 
 				//if we have a fog density value
@@ -205,7 +322,7 @@ bool CNew3D::RenderScene(int priority, bool renderOverlay, Layer layer)
 {
 	bool hasOverlay = false;		// (high priority polys)
 
-	for (auto &n : m_nodes) {
+	for (auto &n : m_drawNodes) {
 
 		if (n.viewport.priority != priority || n.models.empty()) {
 			continue;
@@ -213,7 +330,7 @@ bool CNew3D::RenderScene(int priority, bool renderOverlay, Layer layer)
 
 		std::shared_ptr<Texture> tex1;
 
-		CalcViewport(&n.viewport, std::abs(m_nfPairs[priority].zNear*0.96f), std::abs(m_nfPairs[priority].zFar*1.05f));	// make planes 5% bigger
+		CalcViewport(&n.viewport, std::abs(m_drawNfPairs[priority].zNear*0.96f), std::abs(m_drawNfPairs[priority].zFar*1.05f));	// make planes 5% bigger
 		glViewport(n.viewport.x, n.viewport.y, n.viewport.width, n.viewport.height);
 
 		m_r3dShader.SetViewportUniforms(&n.viewport);
@@ -221,6 +338,7 @@ bool CNew3D::RenderScene(int priority, bool renderOverlay, Layer layer)
 		for (auto &m : n.models) {
 
 			bool matrixLoaded = false;
+			const Mesh* drawMesh = nullptr;		// mesh whose state is set for the draw being built
 
 			if (m.meshes->empty()) {
 				continue;
@@ -234,13 +352,37 @@ bool CNew3D::RenderScene(int priority, bool renderOverlay, Layer layer)
 
 				if (!mesh.Render(layer)) continue;
 				if (mesh.highPriority != renderOverlay) continue;
+				if (mesh.vboOffset + mesh.vertexCount > MAX_ROM_VERTS + MAX_RAM_VERTS) continue;	// ran out of dynamic memory, verts weren't uploaded
+
+				m_drawStats.meshes++;
+
+				int first = mesh.vboOffset < MAX_ROM_VERTS ? mesh.vboOffset : mesh.vboOffset + m_ramBase;	// dynamic verts are in this frame's area
+
+				if (drawMesh && Mesh::SameState(*drawMesh, mesh)) {
+					QueueDraw(first, mesh.vertexCount);		// same uniforms and textures, so it can go in the same draw
+					continue;
+				}
+
+				FlushDraws();
+				m_drawStats.stateChanges++;
 
 				if (!matrixLoaded) {
 					m_r3dShader.SetModelStates(&m);
 					matrixLoaded = true;		// do this here to stop loading matrices we don't need. Ie when rendering non transparent etc
 				}
 				
-				if (mesh.textured) {
+				if (mesh.textured && m_gpuTextures) {
+
+					int x, y, mX = 0, mY = 0;
+					CalcTexOffset(m.textureOffsetX, m.textureOffsetY, m.page, mesh.x, mesh.y, x, y);
+
+					if (mesh.microTexture) {
+						m_texSheet.GetMicrotexPos(y / 1024, mesh.microTextureID, mX, mY);
+					}
+
+					m_r3dShader.SetTexturePosition(x & 2047, y & 2047, mesh.format, mX, mY);
+				}
+				else if (mesh.textured) {
 
 					int x, y;
 					CalcTexOffset(m.textureOffsetX, m.textureOffsetY, m.page, mesh.x, mesh.y, x, y);
@@ -252,6 +394,7 @@ bool CNew3D::RenderScene(int priority, bool renderOverlay, Layer layer)
 						tex1 = m_texSheet.BindTexture(m_textureRAM, mesh.format, x, y, mesh.width, mesh.height);
 						if (tex1) {
 							tex1->BindTexture();
+							m_drawStats.textureBinds++;
 						}
 					}
 
@@ -263,23 +406,67 @@ bool CNew3D::RenderScene(int priority, bool renderOverlay, Layer layer)
 						auto tex2 = m_texSheet.BindTexture(m_textureRAM, 0, mX, mY, 128, 128);
 						if (tex2) {
 							tex2->BindTexture();
+							m_drawStats.textureBinds++;
 						}
 						glActiveTexture(GL_TEXTURE0);
 					}
 				}
 				
 				m_r3dShader.SetMeshUniforms(&mesh);
-				glDrawArrays(m_primType, mesh.vboOffset, mesh.vertexCount);
+				QueueDraw(first, mesh.vertexCount);
+				drawMesh = &mesh;
 			}
+
+			FlushDraws();						// model matrix changes with the next model
 		}
 	}
 
 	return hasOverlay;
 }
 
+void CNew3D::QueueDraw(int first, int count)
+{
+	if (!m_drawFirst.empty() && m_drawFirst.back() + m_drawCount.back() == first) {
+		m_drawCount.back() += count;			// follows on from the last range
+		return;
+	}
+
+	m_drawFirst.push_back(first);
+	m_drawCount.push_back(count);
+}
+
+void CNew3D::FlushDraws()
+{
+	if (m_drawFirst.empty()) {
+		return;
+	}
+
+	m_drawStats.ranges += m_drawFirst.size();
+
+	if (m_drawFirst.size() == 1) {
+		glDrawArrays(m_primType, m_drawFirst[0], m_drawCount[0]);
+		m_drawStats.drawCalls++;
+	}
+	else {
+#ifdef __ANDROID__
+		// GLES 3.0 has no multi-draw
+		for (size_t i = 0; i < m_drawFirst.size(); i++) {
+			glDrawArrays(m_primType, m_drawFirst[i], m_drawCount[i]);
+		}
+		m_drawStats.drawCalls += m_drawFirst.size();
+#else
+		glMultiDrawArrays(m_primType, m_drawFirst.data(), m_drawCount.data(), (GLsizei)m_drawFirst.size());
+		m_drawStats.drawCalls++;
+#endif
+	}
+
+	m_drawFirst.clear();
+	m_drawCount.clear();
+}
+
 bool CNew3D::SkipLayer(int layer)
 {
-	for (const auto &n : m_nodes) {
+	for (const auto &n : m_drawNodes) {
 		if (n.viewport.priority == layer) {
 			if (!n.models.empty()) {
 				return false;
@@ -338,17 +525,23 @@ void CNew3D::SetRenderStates()
 
 	// before draw, specify vertex and index arrays with their offsets, offsetof is maybe evil ..
 	const auto& offsets = GetFVertexOffsets();
-	glVertexAttribPointer(m_r3dShader.GetVertexAttribPos("inVertex"), 4, GL_FLOAT, GL_FALSE, sizeof(FVertex), VboOffset(offsets.pos));
-	glVertexAttribPointer(m_r3dShader.GetVertexAttribPos("inNormal"), 3, GL_FLOAT, GL_FALSE, sizeof(FVertex), VboOffset(offsets.normal));
+	// positions have no w, the attribute defaults it to 1. The snorm shorts come out in -1 to 1
+	glVertexAttribPointer(m_r3dShader.GetVertexAttribPos("inVertex"), 3, GL_FLOAT, GL_FALSE, sizeof(FVertex), VboOffset(offsets.pos));
+	glVertexAttribPointer(m_r3dShader.GetVertexAttribPos("inNormal"), 3, GL_SHORT, GL_TRUE, sizeof(FVertex), VboOffset(offsets.normal));
 	glVertexAttribPointer(m_r3dShader.GetVertexAttribPos("inTexCoord"), 2, GL_FLOAT, GL_FALSE, sizeof(FVertex), VboOffset(offsets.texcoords));
 	glVertexAttribPointer(m_r3dShader.GetVertexAttribPos("inColour"), 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(FVertex), VboOffset(offsets.faceColour));
-	glVertexAttribPointer(m_r3dShader.GetVertexAttribPos("inFaceNormal"), 3, GL_FLOAT, GL_FALSE, sizeof(FVertex), VboOffset(offsets.faceNormal));
-	glVertexAttribPointer(m_r3dShader.GetVertexAttribPos("inFixedShade"), 1, GL_FLOAT, GL_FALSE, sizeof(FVertex), VboOffset(offsets.fixedShade));
+	glVertexAttribPointer(m_r3dShader.GetVertexAttribPos("inFaceNormal"), 3, GL_SHORT, GL_TRUE, sizeof(FVertex), VboOffset(offsets.faceNormal));
+	glVertexAttribPointer(m_r3dShader.GetVertexAttribPos("inFixedShade"), 1, GL_SHORT, GL_TRUE, sizeof(FVertex), VboOffset(offsets.fixedShade));
 
 	glDepthFunc		(GL_LEQUAL);
 	glEnable		(GL_DEPTH_TEST);
 	glDepthMask		(GL_TRUE);
 	glActiveTexture	(GL_TEXTURE0);
+
+	if (m_gpuTextures) {
+		m_textureBank.Bind();						// stays bound for the whole pass
+	}
+
 	glDisable		(GL_CULL_FACE);					// we'll emulate this in the shader		
 	glDisable		(GL_BLEND);
 
@@ -372,16 +565,104 @@ void CNew3D::DisableRenderStates()
 	glDisableVertexAttribArray(5);
 }
 
-void CNew3D::RenderFrame(void)
+void CNew3D::BuildScene(void)
 {
-#ifdef __ANDROID__
-	if (!m_new3dAccurate) {
-		// Android/GLES: basic mesh path (no multi-pass transparency compositing yet).
-		for (int i = 0; i < 4; i++) {
-		m_nfPairs[i].zNear = -std::numeric_limits<float>::max();
-		m_nfPairs[i].zFar  =  std::numeric_limits<float>::max();
+	m_frameCount++;
+
+	if (!m_workerPool || !m_verifyScene) {
+		TraverseScene(m_workerPool != nullptr);
+		m_sceneReady = true;
+		return;
+	}
+
+	// verification mode, build the scene serially first and keep the results to compare against
+	auto layout = [this]() {
+		std::vector<int> l;
+		for (const auto& n : m_nodes) {
+			l.push_back((int)n.models.size());
+			for (const auto& m : n.models) {
+				for (const auto& mesh : *m.meshes) {
+					l.push_back(mesh.vboOffset);
+					l.push_back(mesh.vertexCount);
+				}
+			}
+		}
+		return l;
+	};
+
+	// new ROM verts, in the order they will be uploaded
+	auto romVerts = [this]() {
+		std::vector<FVertex> v;
+		for (const auto& r : m_romUploads) {
+			v.insert(v.end(), m_polyBufferRom.begin() + r.offset, m_polyBufferRom.begin() + r.offset + r.count);
+		}
+		return v;
+	};
+
+	auto					romMap			= m_romMap;
+	RangeAllocator			romAlloc		= m_romAlloc;
+	std::vector<RomRange>	romUploads		= m_romUploads;
+	int						romShortfall	= m_romShortfall;
+	RomCacheStats			romStats		= m_romStats;
+	RomCacheStats			romStatsLog		= m_romStatsLog;
+	SharedVerts				prev			= m_prev;
+	UINT32					colorTableAddr	= m_colorTableAddr;
+
+	TraverseScene(false);
+
+	std::vector<FVertex>	serialRam(m_polyBufferRam);
+	std::vector<FVertex>	serialRom		= romVerts();
+	std::vector<RomRange>	serialUploads	= m_romUploads;
+	std::vector<int>		serialLayout	= layout();
+	NFPair					serialNF[4];
+	memcpy(serialNF, m_nfPairs, sizeof(serialNF));
+
+	// the serial build only wrote to ROM ranges that were free, or that it evicted, so those are the only ones it touched
+	m_romMap			= romMap;
+	m_romAlloc			= romAlloc;
+	m_romUploads		= romUploads;
+	m_romShortfall		= romShortfall;
+	m_romStats			= romStats;
+	m_romStatsLog		= romStatsLog;
+	m_prev				= prev;
+	m_colorTableAddr	= colorTableAddr;
+
+	TraverseScene(true);
+
+	const char* diff = nullptr;
+
+	if (layout() != serialLayout) {
+		diff = "mesh layout";
+	}
+	else if (m_polyBufferRam.size() != serialRam.size() || memcmp(m_polyBufferRam.data(), serialRam.data(), serialRam.size() * sizeof(FVertex))) {
+		diff = "dynamic vertices";
+	}
+	else if (m_romUploads.size() != serialUploads.size() || memcmp(m_romUploads.data(), serialUploads.data(), serialUploads.size() * sizeof(RomRange))) {
+		diff = "ROM cache placement";
 	}
+	else if (romVerts().size() != serialRom.size() || memcmp(romVerts().data(), serialRom.data(), serialRom.size() * sizeof(FVertex))) {
+		diff = "ROM vertices";
+	}
+	else if (memcmp(serialNF, m_nfPairs, sizeof(serialNF))) {
+		diff = "depth range";
+	}
+
+	if (diff && m_verifyErrors++ < 10) {
+		ErrorLog("New3D: parallel scene build differs from serial build (%s).", diff);
+	}
+
+	m_sceneReady = true;
+}
+
+bool CNew3D::QueueScene(void)
+{
+	TakeScene();
+	m_sceneQueued = true;
+	return true;
+}
 
+void CNew3D::TakeScene()
+{
 	{
 		std::lock_guard<std::mutex> guard(m_losMutex);
 		std::swap(m_losBack, m_losFront);
@@ -390,133 +671,262 @@ void CNew3D::RenderFrame(void)
 		}
 	}
 
-	m_polyBufferRam.clear();
-	m_nodes.clear();
-	m_modelMat.Release();
+	if (!m_sceneReady) {
+		return;										// nothing new was built, the last scene is drawn again
+	}
+
+	m_sceneReady = false;
+
+	std::swap(m_drawNodes, m_nodes);				// the old lists are cleared by the next traversal
+	std::swap(m_drawPolyBufferRam, m_polyBufferRam);
+	memcpy(m_drawNfPairs, m_nfPairs, sizeof(m_nfPairs));
+
+	for (const auto& r : m_romUploads) {
+		m_drawRomUploads.push_back({ (int)m_drawRomVerts.size(), r.count });
+		m_drawRomVerts.insert(m_drawRomVerts.end(), m_polyBufferRom.begin() + r.offset, m_polyBufferRom.begin() + r.offset + r.count);
+	}
+
+	m_romUploads.clear();
+}
+
+void CNew3D::TraverseScene(bool parallel)
+{
+	for (int i = 0; i < 4; i++) {
+		m_nfPairs[i].zNear = -std::numeric_limits<float>::max();
+		m_nfPairs[i].zFar  =  std::numeric_limits<float>::max();
+	}
+
+	// release any resources from last frame
+	PurgeSpilledRomModels();		// make room in the ROM cache for models that didn't fit last frame
+	m_polyBufferRam.clear();		// clear dynamic model memory buffer
+	m_nodes.clear();				// memory will grow during the object life time, that's fine, no need to shrink to fit
+	m_modelMat.Release();			// would hope we wouldn't need this but no harm in checking
 	m_nodeAttribs.Reset();
+	m_modelJobs.clear();
 
-	RenderViewport(0x800000);
+	for (auto& arena : m_arenas) {
+		arena.clear();
+	}
 
-	m_vbo.Bind(true);
-	m_vbo.BufferSubData(MAX_ROM_VERTS*sizeof(FVertex), m_polyBufferRam.size()*sizeof(FVertex), m_polyBufferRam.data());
-
-	if (!m_polyBufferRom.empty()) {
-		int romBytes	= (int)m_polyBufferRom.size() * sizeof(FVertex);
-		int vboBytes	= m_vbo.GetSize();
-		int size		= romBytes - vboBytes;
-
-		if (size) {
-			if (m_polyBufferRom.size() >= MAX_ROM_VERTS) {
-				m_polyBufferRom.clear();
-				m_romMap.clear();
-				m_vbo.Reset();
+	m_deferModels = parallel;
+	RenderViewport(0x800000);		// build model structure
+	m_deferModels = false;
+
+	if (parallel) {
+		RunModelJobs();				// decode + clip the queued models, then merge in traversal order
+	}
+}
+
+void CNew3D::QueueModelJob(const UINT32 *data, bool clip)
+{
+	m_modelJobs.emplace_back();
+
+	ModelJob& job = m_modelJobs.back();
+
+	job.node			= m_nodes.size() - 1;
+	job.model			= m_nodes.back().models.size() - 1;
+	job.data			= data;
+	job.colorTableAddr	= m_colorTableAddr;
+	job.priority		= m_currentPriority;
+	job.clip			= clip;
+	job.clipped			= false;
+	job.sharedPrev		= false;
+	job.written			= 0;
+
+	if (clip) {
+		for (int i = 0; i < 5; i++) {
+			job.planes[i] = m_planes[i];
+		}
+	}
+}
+
+void CNew3D::RunModelJob(ModelJob& job, unsigned thread)
+{
+	const Model& m = m_nodes[job.node].models[job.model];
+
+	job.nf.zNear	= -std::numeric_limits<float>::max();
+	job.nf.zFar		=  std::numeric_limits<float>::max();
+
+	if (job.data) {
+
+		std::vector<FVertex>& arena = m_arenas[thread];
+		SharedVerts prev = {};
+
+		job.arena		= thread;
+		job.firstVert	= arena.size();
+		job.sharedPrev	= DecodeModel(job.data, job.colorTableAddr, prev, job.meshes, arena, job.written);
+		job.numVerts	= arena.size() - job.firstVert;
+		job.prev		= prev;
+
+		if (job.clip && !job.sharedPrev) {
+			for (const auto& mesh : job.meshes) {
+				ClipVertices(m.modelMat, arena.data() + mesh.vboOffset, mesh.vertexCount, job.planes, job.nf);
+			}
+			job.clipped = true;
+		}
+	}
+	else if (job.clip && !m.meshes->empty()) {		// cached in an earlier frame, if empty its job hasn't been merged yet
+		ClipModel(&m, job.planes, job.nf);
+		job.clipped = true;
+	}
+}
+
+void CNew3D::RunModelJobs()
+{
+	m_workerPool->ParallelFor(m_modelJobs.size(), [this](size_t i, unsigned thread) { RunModelJob(m_modelJobs[i], thread); });
+
+	// serial part, vertex buffer offsets and the shared vertex chain depend on traversal order
+	for (auto& job : m_modelJobs) {
+
+		Model* m = &m_nodes[job.node].models[job.model];
+
+		if (job.data && job.sharedPrev) {
+			CacheModel(m, job.data, job.colorTableAddr);		// now that the previous model is known
+		}
+		else if (job.data) {
+
+			for (int i = 0; i < 4; i++) {
+				if (job.written & (1 << i)) {
+					m_prev.v[i] = job.prev.v[i];
+					m_prev.texCoords[i][0] = job.prev.texCoords[i][0];
+					m_prev.texCoords[i][1] = job.prev.texCoords[i][1];
+				}
+			}
+
+			const FVertex* src = m_arenas[job.arena].data() + job.firstVert;
+			size_t first = m->meshes->size();
+
+			m->meshes->reserve(first + job.meshes.size());
+
+			for (auto& mesh : job.meshes) {
+				mesh.vboOffset -= (int)job.firstVert;		// relative to the model's first vertex
+				m->meshes->push_back(mesh);
+			}
+
+			if (m->dynamic) {
+				for (size_t i = first; i < m->meshes->size(); i++) {
+					(*m->meshes)[i].vboOffset += (int)m_polyBufferRam.size() + MAX_ROM_VERTS;
+				}
+
+				m_polyBufferRam.insert(m_polyBufferRam.end(), src, src + job.numVerts);
 			}
 			else {
-				m_vbo.AppendData(size, &m_polyBufferRom[vboBytes / sizeof(FVertex)]);
+				AddRomModel(m, first, src, (int)job.numVerts);
 			}
 		}
+
+		if (job.clip && !job.clipped) {
+			ClipModel(m, job.planes, job.nf);
+		}
+
+		// min/max of finite values, so the order these are combined in doesn't matter
+		m_nfPairs[job.priority].zNear	= std::max(job.nf.zNear, m_nfPairs[job.priority].zNear);
+		m_nfPairs[job.priority].zFar	= std::min(job.nf.zFar, m_nfPairs[job.priority].zFar);
 	}
+}
+
+void CNew3D::RenderFrame(void)
+{
+#ifdef __ANDROID__
+	if (!m_new3dAccurate) {
+		// Android/GLES: basic mesh path (no multi-pass transparency compositing yet).
+		if (!m_sceneQueued) {
+			if (!m_sceneReady) {
+				BuildScene();							// not built ahead of time by the caller
+			}
+			TakeScene();
+		}
+		m_sceneQueued = false;
+		m_drawStatsFrame = m_drawStats;
+		m_drawStats.frames++;
 
- 	// Draw to default framebuffer.
- 	glDisable(GL_STENCIL_TEST);
-	// Android compositor draws TileGen bottom surface first; keep color, clear depth for 3D.
-	glClear(GL_DEPTH_BUFFER_BIT);
+		m_vbo.Bind(true);
+		UploadRamVerts();
 
-	for (int pri = 0; pri <= 3; pri++) {
-		if (SkipLayer(pri)) continue;
+		UploadRomModels();
 
-		// Reset depth per priority so layer ordering matches the hardware behavior.
-		glClear(GL_DEPTH_BUFFER_BIT);
+		if (m_gpuTextures) {
+			m_textureBank.Upload(m_textureRAM);
+		}
 
-		// Opaque pass (non-overlay).
-		SetRenderStates();
-		m_r3dShader.DiscardAlpha(true);
-		glDisable(GL_BLEND);
-		RenderScene(pri, false, Layer::colour);
-		DisableRenderStates();
-
-		// Translucent pass (rough): non-overlay with blending.
-		SetRenderStates();
-		m_r3dShader.DiscardAlpha(false);
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-		glDepthMask(GL_FALSE);
-		RenderScene(pri, false, Layer::trans1);
-		RenderScene(pri, false, Layer::trans2);
-		glDepthMask(GL_TRUE);
-		DisableRenderStates();
-
-		// Clear depth so high-priority polys are not occluded by lower-priority geometry.
+		// Draw to default framebuffer.
+		glDisable(GL_STENCIL_TEST);
+		// Android compositor draws TileGen bottom surface first; keep color, clear depth for 3D.
 		glClear(GL_DEPTH_BUFFER_BIT);
 
-		// Opaque pass (overlay).
-		SetRenderStates();
-		m_r3dShader.DiscardAlpha(true);
-		glDisable(GL_BLEND);
-		RenderScene(pri, true, Layer::colour);
-		DisableRenderStates();
-
-		// Translucent pass (overlay).
-		SetRenderStates();
-		m_r3dShader.DiscardAlpha(false);
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-		glDepthMask(GL_FALSE);
-		RenderScene(pri, true, Layer::trans1);
-		RenderScene(pri, true, Layer::trans2);
-		glDepthMask(GL_TRUE);
-		DisableRenderStates();
-	}
+		for (int pri = 0; pri <= 3; pri++) {
+			if (SkipLayer(pri)) continue;
+
+			// Reset depth per priority so layer ordering matches the hardware behavior.
+			glClear(GL_DEPTH_BUFFER_BIT);
+
+			// Opaque pass (non-overlay).
+			SetRenderStates();
+			m_r3dShader.DiscardAlpha(true);
+			glDisable(GL_BLEND);
+			RenderScene(pri, false, Layer::colour);
+			DisableRenderStates();
+
+			// Translucent pass (rough): non-overlay with blending.
+			SetRenderStates();
+			m_r3dShader.DiscardAlpha(false);
+			glEnable(GL_BLEND);
+			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			glDepthMask(GL_FALSE);
+			RenderScene(pri, false, Layer::trans1);
+			RenderScene(pri, false, Layer::trans2);
+			glDepthMask(GL_TRUE);
+			DisableRenderStates();
+
+			// Clear depth so high-priority polys are not occluded by lower-priority geometry.
+			glClear(GL_DEPTH_BUFFER_BIT);
+
+			// Opaque pass (overlay).
+			SetRenderStates();
+			m_r3dShader.DiscardAlpha(true);
+			glDisable(GL_BLEND);
+			RenderScene(pri, true, Layer::colour);
+			DisableRenderStates();
+
+			// Translucent pass (overlay).
+			SetRenderStates();
+			m_r3dShader.DiscardAlpha(false);
+			glEnable(GL_BLEND);
+			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			glDepthMask(GL_FALSE);
+			RenderScene(pri, true, Layer::trans1);
+			RenderScene(pri, true, Layer::trans2);
+			glDepthMask(GL_TRUE);
+			DisableRenderStates();
+		}
+		FenceRamVerts();
 		return;
 	}
 #endif
-	for (int i = 0; i < 4; i++) {
-		m_nfPairs[i].zNear = -std::numeric_limits<float>::max();
-		m_nfPairs[i].zFar  =  std::numeric_limits<float>::max();
-	}
-
-	{
-		std::lock_guard<std::mutex> guard(m_losMutex);
-		std::swap(m_losBack, m_losFront);
-		for (int i = 0; i < 4; i++) {
-			m_losBack->value[i] = 0;
+	if (!m_sceneQueued) {
+		if (!m_sceneReady) {
+			BuildScene();							// not built ahead of time by the caller
 		}
+		TakeScene();
 	}
+	m_sceneQueued = false;
+	m_drawStatsFrame = m_drawStats;
+	m_drawStats.frames++;
 
-	// release any resources from last frame
-	m_polyBufferRam.clear();		// clear dynamic model memory buffer
-	m_nodes.clear();				// memory will grow during the object life time, that's fine, no need to shrink to fit
-	m_modelMat.Release();			// would hope we wouldn't need this but no harm in checking
-	m_nodeAttribs.Reset();
+	FetchLosReads();
 
-	RenderViewport(0x800000);						// build model structure
 	DrawScrollFog();								// fog layer if applicable must be drawn here
 	
 	m_vbo.Bind(true);
-	m_vbo.BufferSubData(MAX_ROM_VERTS*sizeof(FVertex), m_polyBufferRam.size()*sizeof(FVertex), m_polyBufferRam.data());	// upload all the dynamic data to GPU in one go
-
-	if (!m_polyBufferRom.empty()) {
-
-		// sync rom memory with vbo
-		int romBytes	= (int)m_polyBufferRom.size() * sizeof(FVertex);
-		int vboBytes	= m_vbo.GetSize();
-		int size		= romBytes - vboBytes;
-
-		if (size) {
-			//check we haven't blown up the memory buffers
-			//we will lose rom models for 1 frame is this happens, not the end of the world, as probably won't ever happen anyway
-			if (m_polyBufferRom.size() >= MAX_ROM_VERTS) {
-				m_polyBufferRom.clear();
-				m_romMap.clear();
-				m_vbo.Reset();
-			}
-			else {
-				m_vbo.AppendData(size, &m_polyBufferRom[vboBytes / sizeof(FVertex)]);
-			}
-		}
+	UploadRamVerts();								// all the dynamic data goes to the GPU in one go
+
+	UploadRomModels();								// sync rom memory with vbo, only the ranges that changed
+
+	if (m_gpuTextures) {
+		m_textureBank.Upload(m_textureRAM);			// texture RAM written since the last frame
 	}
 
-	if (!m_r3dFrameBuffers) return;
+	if (!m_r3dFrameBuffers) return;				// nothing drawn, so nothing to fence
 	m_r3dFrameBuffers->SetFBO(Layer::trans12);
 	glClear(GL_COLOR_BUFFER_BIT);					// wipe both trans layers
 
@@ -565,6 +975,64 @@ void CNew3D::RenderFrame(void)
 	}
 
 	m_r3dFrameBuffers->CompositeAlphaLayer();
+
+	FenceRamVerts();
+	FenceLosReads();
+}
+
+void CNew3D::UploadRamVerts()
+{
+	int			count = std::min((int)m_drawPolyBufferRam.size(), MAX_RAM_VERTS);	// meshes beyond this aren't drawn
+	GLsizeiptr	bytes = count * sizeof(FVertex);
+
+	if (m_streamMode != StreamMode::subData) {
+
+		m_ramBuffer = (m_ramBuffer + 1) % RAM_BUFFERS;
+
+		// area was last drawn RAM_BUFFERS frames ago, the gpu should be long done with it
+		GLsync& fence = m_ramFences[m_ramBuffer];
+
+		if (fence) {
+			if (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED) {
+				m_streamStats.waits++;
+				while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED) {}
+			}
+			glDeleteSync(fence);
+			fence = 0;
+		}
+	}
+
+	m_ramBase = m_ramBuffer * MAX_RAM_VERTS;
+
+	GLintptr offset = (MAX_ROM_VERTS + m_ramBase) * sizeof(FVertex);
+
+	if (m_streamMode == StreamMode::persistent) {
+		memcpy((char*)m_vbo.GetMapping() + offset, m_drawPolyBufferRam.data(), bytes);
+	}
+	else if (m_streamMode == StreamMode::mapRange && bytes) {
+		void* dst = m_vbo.MapRange(offset, bytes);
+		if (dst) {
+			memcpy(dst, m_drawPolyBufferRam.data(), bytes);
+			m_vbo.Unmap();
+		}
+		else {
+			m_vbo.BufferSubData(offset, bytes, m_drawPolyBufferRam.data());
+		}
+	}
+	else {
+		m_vbo.BufferSubData(offset, bytes, m_drawPolyBufferRam.data());
+	}
+
+	m_streamStats.frames++;
+	m_streamStats.bytes		+= bytes;
+	m_streamStats.maxBytes	= std::max(m_streamStats.maxBytes, (UINT64)bytes);
+}
+
+void CNew3D::FenceRamVerts()
+{
+	if (m_streamMode != StreamMode::subData) {
+		m_ramFences[m_ramBuffer] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
 }
 
 void CNew3D::BeginFrame(void)
@@ -627,16 +1095,20 @@ bool CNew3D::DrawModel(UINT32 modelAddr)
 
 		// try to find meshes in the rom cache
 
-		m->meshes = m_romMap[modelAddr];	// will create an entry with a null pointer if empty
+		RomModel& rom = m_romMap[modelAddr];	// will create an entry with a null pointer if empty
 
-		if (m->meshes) {
+		if (rom.meshes) {
 			cached = true;
+			m_romStats.hits++;
 		}
 		else {
-			m->meshes = std::make_shared<std::vector<Mesh>>();
-			m_romMap[modelAddr] = m->meshes;		// store meshes in our rom map here
+			rom.meshes = std::make_shared<std::vector<Mesh>>();		// store meshes in our rom map here
+			m_romStats.misses++;
 		}
 
+		rom.lastUsed	= m_frameCount;
+		m->meshes		= rom.meshes;
+
 		m->dynamic = false;
 	}
 	else {
@@ -654,12 +1126,19 @@ bool CNew3D::DrawModel(UINT32 modelAddr)
 	m->page = m_nodeAttribs.currentPage;
 	m->scale = m_nodeAttribs.currentModelScale;
 
+	if (m_deferModels) {
+		if (!cached || m_nodeAttribs.currentClipStatus != Clip::INSIDE) {
+			QueueModelJob(cached ? nullptr : modelAddress, m_nodeAttribs.currentClipStatus != Clip::INSIDE);
+		}
+		return true;
+	}
+
 	if (!cached) {
-		CacheModel(m, modelAddress);
+		CacheModel(m, modelAddress, m_colorTableAddr);
 	}
 
 	if (m_nodeAttribs.currentClipStatus != Clip::INSIDE) {
-		ClipModel(m);	// not storing clipped values, only working out the Z range
+		ClipModel(m, m_planes, m_nfPairs[m_currentPriority]);	// not storing clipped values, only working out the Z range
 	}
 
 	return true;
@@ -1115,6 +1594,8 @@ void CNew3D::CopyVertexData(const R3DPoly& r3dPoly, std::vector<FVertex>& vertex
 		return;
 	}
 
+	size_t first = vertexArray.size();
+
 	if (m_numPolyVerts==4) {
 		if (r3dPoly.number == 4) {
 			vertexArray.emplace_back(r3dPoly, 0);		// construct directly inside container without copy
@@ -1155,6 +1636,53 @@ void CNew3D::CopyVertexData(const R3DPoly& r3dPoly, std::vector<FVertex>& vertex
 			vertexArray.emplace_back(r3dPoly, 3);
 		}
 	}
+
+	if (m_verifyVertices) {
+		VerifyVertices(r3dPoly, vertexArray.data() + first, (int)(vertexArray.size() - first));
+	}
+}
+
+void CNew3D::VerifyVertices(const R3DPoly& r3dPoly, const FVertex* verts, int count)
+{
+	VertexErrors e;
+	auto check = [&e](float& maxError, float value, INT16 packed) {
+		if (value < -1.0f || value > 1.0f) {
+			e.clamped++;
+		}
+		maxError = std::max(maxError, std::abs(FVertex::UnpackSnorm(packed) - value));
+	};
+
+	for (int i = 0; i < count; i++) {
+
+		const FVertex& v = verts[i];
+
+		for (int j = 0; j < 3; j++) {
+			check(e.faceNormal, r3dPoly.faceNormal[j], v.faceNormal[j]);
+		}
+
+		// averaged points for quads don't match any of the polygon's own vertices
+		for (int k = 0; k < r3dPoly.number; k++) {
+
+			const Vertex& src = r3dPoly.v[k];
+
+			if (src.pos[0] == v.pos[0] && src.pos[1] == v.pos[1] && src.pos[2] == v.pos[2]) {
+				for (int j = 0; j < 3; j++) {
+					check(e.normal, src.normal[j], v.normal[j]);
+				}
+				check(e.fixedShade, src.fixedShade, v.fixedShade);
+				break;
+			}
+		}
+
+		e.checked++;
+	}
+
+	std::lock_guard<std::mutex> guard(m_vertexErrorsMutex);
+	m_vertexErrors.checked		+= e.checked;
+	m_vertexErrors.clamped		+= e.clamped;
+	m_vertexErrors.normal		= std::max(m_vertexErrors.normal, e.normal);
+	m_vertexErrors.faceNormal	= std::max(m_vertexErrors.faceNormal, e.faceNormal);
+	m_vertexErrors.fixedShade	= std::max(m_vertexErrors.fixedShade, e.fixedShade);
 }
 
 void CNew3D::SetMeshValues(SortingMesh *currentMesh, PolyHeader &ph)
@@ -1228,11 +1756,154 @@ void CNew3D::SetMeshValues(SortingMesh *currentMesh, PolyHeader &ph)
 	}
 }
 
-void CNew3D::CacheModel(Model *m, const UINT32 *data)
+void CNew3D::CacheModel(Model *m, const UINT32 *data, UINT32 colorTableAddr)
 {
 	if (data == NULL)
 		return;
 
+	size_t		first = m->meshes->size();
+	unsigned	written;
+
+	// decode straight into the main buffer, dynamic models go after the ROM area of the VBO
+	if (m->dynamic) {
+		DecodeModel(data, colorTableAddr, m_prev, *m->meshes, m_polyBufferRam, written);
+
+		for (size_t i = first; i < m->meshes->size(); i++) {
+			(*m->meshes)[i].vboOffset += MAX_ROM_VERTS;
+		}
+	}
+	else {
+		m_romScratch.clear();
+		DecodeModel(data, colorTableAddr, m_prev, *m->meshes, m_romScratch, written);
+		AddRomModel(m, first, m_romScratch.data(), (int)m_romScratch.size());
+	}
+}
+
+void CNew3D::AddRomModel(Model *m, size_t firstMesh, const FVertex *verts, int count)
+{
+	int offset;
+
+	if (m_romAlloc.Alloc(count, offset)) {
+
+		if (m_polyBufferRom.size() < size_t(offset + count)) {
+			m_polyBufferRom.resize(offset + count);
+		}
+
+		std::copy(verts, verts + count, m_polyBufferRom.begin() + offset);
+
+		// neighbouring ranges are common when the cache is filling up, upload those in one go
+		if (!m_romUploads.empty() && m_romUploads.back().offset + m_romUploads.back().count == offset) {
+			m_romUploads.back().count += count;
+		}
+		else if (count) {
+			m_romUploads.push_back({ offset, count });
+		}
+	}
+	else {
+		// cache is full, draw it from the dynamic area for now. Nothing is evicted until the frame is
+		// built, the models drawn so far (or in the rest of the frame) may still be in use
+		offset = (int)m_polyBufferRam.size() + MAX_ROM_VERTS;
+		m_polyBufferRam.insert(m_polyBufferRam.end(), verts, verts + count);
+		m_romShortfall += count;
+	}
+
+	for (size_t i = firstMesh; i < m->meshes->size(); i++) {
+		(*m->meshes)[i].vboOffset += offset;
+	}
+}
+
+void CNew3D::EvictRomModels(int count)
+{
+	std::vector<std::pair<UINT64, UINT32>> lru;		// last used frame, model address
+
+	for (const auto& it : m_romMap) {
+		lru.emplace_back(it.second.lastUsed, it.first);
+	}
+
+	std::sort(lru.begin(), lru.end());
+
+	// free a good chunk in one go, otherwise a scene streaming in new models would be back here every frame
+	int target	= std::max(count, MAX_ROM_VERTS / 8);
+	int freed	= 0;
+	int models	= 0;
+
+	for (const auto& e : lru) {
+
+		if (freed >= target) {
+			break;
+		}
+
+		auto it = m_romMap.find(e.second);
+
+		// a model's meshes are decoded next to each other
+		int first	= MAX_ROM_VERTS;
+		int size	= 0;
+
+		for (const auto& mesh : *it->second.meshes) {
+			first = std::min(first, mesh.vboOffset);
+			size += mesh.vertexCount;
+		}
+
+		m_romAlloc.Free(first, size);
+		m_romMap.erase(it);
+
+		freed += size;
+		models++;
+	}
+
+	m_romStats.evictions	+= models;
+	m_romStats.evictedVerts	+= freed;
+
+	InfoLog("New3D: evicted %d ROM models (%d vertices), %llu hits and %llu misses since the last eviction.", models, freed,
+		(unsigned long long)(m_romStats.hits - m_romStatsLog.hits), (unsigned long long)(m_romStats.misses - m_romStatsLog.misses));
+
+	m_romStatsLog = m_romStats;
+}
+
+void CNew3D::PurgeSpilledRomModels()
+{
+	if (!m_romShortfall) {
+		return;
+	}
+
+	// the scenes already built keep their own references to these meshes, they only leave the cache
+
+	for (auto it = m_romMap.begin(); it != m_romMap.end(); ) {
+
+		bool spilled = false;
+
+		for (const auto& mesh : *it->second.meshes) {
+			spilled |= (mesh.vboOffset >= MAX_ROM_VERTS);
+		}
+
+		if (spilled) {
+			it = m_romMap.erase(it);		// decoded again next time it's drawn
+		}
+		else {
+			++it;
+		}
+	}
+
+	EvictRomModels(m_romShortfall);
+
+	m_romShortfall = 0;
+}
+
+void CNew3D::UploadRomModels()
+{
+	const FVertex* verts = m_drawRomVerts.data();
+
+	for (const auto& r : m_drawRomUploads) {
+		m_vbo.BufferSubData(r.offset * sizeof(FVertex), r.count * sizeof(FVertex), verts);
+		verts += r.count;
+	}
+
+	m_drawRomUploads.clear();
+	m_drawRomVerts.clear();
+}
+
+bool CNew3D::DecodeModel(const UINT32 *data, UINT32 colorTableAddr, SharedVerts& prev, std::vector<Mesh>& meshes, std::vector<FVertex>& verts, unsigned& written)
+{
 	UINT16			texCoords[4][2];
 	PolyHeader		ph;
 	UINT64			lastHash	= -1;
@@ -1242,11 +1913,14 @@ void CNew3D::CacheModel(Model *m, const UINT32 *data)
 
 	ph = data; 
 	int numTriangles = ph.NumTrianglesTotal();
+	bool sharedPrev = false;
+
+	written = 0;
 
 	// Cache all polygons
 	do {
 
-		R3DPoly		p;					// current polygon
+		R3DPoly		p = {};				// current polygon, cleared so unused fields (eg fixed shade) are deterministic
 		float		uvScale;
 
 		if (ph.header[6] == 0) {
@@ -1284,10 +1958,14 @@ void CNew3D::CacheModel(Model *m, const UINT32 *data)
 		{
 			if (ph.SharedVertex(i))
 			{
-				p.v[j] = m_prev[i];
+				p.v[j] = prev.v[i];
+
+				texCoords[j][0] = prev.texCoords[i][0];
+				texCoords[j][1] = prev.texCoords[i][1];
 
-				texCoords[j][0] = m_prevTexCoords[i][0];
-				texCoords[j][1] = m_prevTexCoords[i][1];
+				if (!(written & (1 << i))) {
+					sharedPrev = true;		// vertex slot not set by this model yet, comes from the previous one
+				}
 
 				//check if we need to recalc tex coords - will only happen if tex tiles are different + sharing vertices
 				if (hash != lastHash) {
@@ -1306,9 +1984,9 @@ void CNew3D::CacheModel(Model *m, const UINT32 *data)
 
 		if (!ph.PolyColor()) {
 			int colorIdx = ph.ColorIndex();
-			p.faceColour[2] = (m_polyRAM[m_colorTableAddr + colorIdx] & 0xFF);
-			p.faceColour[1] = ((m_polyRAM[m_colorTableAddr + colorIdx] >> 8) & 0xFF);
-			p.faceColour[0] = ((m_polyRAM[m_colorTableAddr + colorIdx] >> 16) & 0xFF);
+			p.faceColour[2] = (m_polyRAM[colorTableAddr + colorIdx] & 0xFF);
+			p.faceColour[1] = ((m_polyRAM[colorTableAddr + colorIdx] >> 8) & 0xFF);
+			p.faceColour[0] = ((m_polyRAM[colorTableAddr + colorIdx] >> 16) & 0xFF);
 		}
 		else {
 			p.faceColour[0] = ((ph.header[4] >> 24));
@@ -1407,44 +2085,48 @@ void CNew3D::CacheModel(Model *m, const UINT32 *data)
 			CopyVertexData(p, currentMesh->verts);
 		}
 		
-		// Copy current vertices into previous vertex array
-		for (int i = 0; i < 4; i++) {
-			m_prev[i] = p.v[i];
-			m_prevTexCoords[i][0] = texCoords[i][0];
-			m_prevTexCoords[i][1] = texCoords[i][1];
+		// Copy current vertices into previous vertex array, a triangle leaves the 4th slot as it was
+		for (int i = 0; i < p.number; i++) {
+			prev.v[i] = p.v[i];
+			prev.texCoords[i][0] = texCoords[i][0];
+			prev.texCoords[i][1] = texCoords[i][1];
 		}
 
+		written |= (1 << p.number) - 1;
+
 	} while (ph.NextPoly());
 
 	//sorted the data, now copy to main data structures
 
 	// we know how many meshes we have to reserve appropriate space
-	m->meshes->reserve(sMap.size());
+	meshes.reserve(meshes.size() + sMap.size());
+
+	// the hash map leaves the meshes in no particular order, so put the ones with the same draw state next to each other
+	// their vertices then follow on in the buffer and RenderScene() can draw them in one go
+	std::vector<SortingMesh*> sorted;
+	sorted.reserve(sMap.size());
 
 	for (auto& it : sMap) {
+		sorted.push_back(&it.second);
+	}
 
-		if (m->dynamic) {
+	std::stable_sort(sorted.begin(), sorted.end(), [](const SortingMesh* m1, const SortingMesh* m2) { return Mesh::StateLess(*m1, *m2); });
 
-			// calculate VBO values for current mesh
-			it.second.vboOffset		= (int)m_polyBufferRam.size() + MAX_ROM_VERTS;
-			it.second.vertexCount	= (int)it.second.verts.size();
+	for (auto mesh : sorted) {
 
-			// copy poly data to main buffer
-			m_polyBufferRam.insert(m_polyBufferRam.end(), it.second.verts.begin(), it.second.verts.end());
-		}
-		else {
-			// calculate VBO values for current mesh
-			it.second.vboOffset		= (int)m_polyBufferRom.size();
-			it.second.vertexCount	= (int)it.second.verts.size();
+		// calculate VBO values for current mesh, relative to the start of verts
+		mesh->vboOffset		= (int)verts.size();
+		mesh->vertexCount	= (int)mesh->verts.size();
 
-			// copy poly data to main buffer
-			m_polyBufferRom.insert(m_polyBufferRom.end(), it.second.verts.begin(), it.second.verts.end());
-		}
+		// copy poly data to main buffer
+		verts.insert(verts.end(), mesh->verts.begin(), mesh->verts.end());
 
 		//copy the temp mesh into the model structure
 		//this will lose the associated vertex data, which is now copied to the main buffer anyway
-		m->meshes->push_back(it.second);
+		meshes.push_back(*mesh);
 	}
+
+	return sharedPrev;
 }
 
 bool CNew3D::IsDynamicModel(UINT32 *data)
@@ -1714,42 +2396,44 @@ void CNew3D::ClipPolygon(ClipPoly& clipPoly, Plane planes[5])
 	}
 }
 
-void CNew3D::ClipModel(const Model *m)
+void CNew3D::ClipModel(const Model *m, Plane planes[5], NFPair& nf)
 {
-	//===============================
-	ClipPoly				clipPoly;
-	std::vector<FVertex>*	vertices;
-	int						offset;
-	//===============================
+	for (const auto &mesh : *m->meshes) {
 
-	if (m->dynamic) {
-		vertices = &m_polyBufferRam;
-		offset = MAX_ROM_VERTS;
-	}
-	else {
-		vertices = &m_polyBufferRom;
-		offset = 0;
+		// ROM models that didn't fit in the cache are in the dynamic area too, so go by the offset
+		const FVertex* verts;
+
+		if (mesh.vboOffset >= MAX_ROM_VERTS) {
+			verts = m_polyBufferRam.data() + (mesh.vboOffset - MAX_ROM_VERTS);
+		}
+		else {
+			verts = m_polyBufferRom.data() + mesh.vboOffset;
+		}
+
+		ClipVertices(m->modelMat, verts, mesh.vertexCount, planes, nf);
 	}
+}
 
-	for (const auto &mesh : *m->meshes) {
+void CNew3D::ClipVertices(const float *modelMat, const FVertex *verts, int count, Plane planes[5], NFPair& nf)
+{
+	ClipPoly clipPoly;
 
-		int start = mesh.vboOffset - offset;
-		
-		for (int i = 0; i < mesh.vertexCount; i += m_numPolyVerts) {							// inc to next poly
+	for (int i = 0; i < count; i += m_numPolyVerts) {								// inc to next poly
 
-			for (int j = 0; j < m_numPolyVerts; j++) {
-				MultVec(m->modelMat, (*vertices)[start + i + j].pos, clipPoly.list[j].pos);		// copy all 3 of 4  our transformed vertices into our clip poly struct
-			}
+		for (int j = 0; j < m_numPolyVerts; j++) {
+			const float* p = verts[i + j].pos;
+			const float pos[4] = { p[0], p[1], p[2], 1.0f };
+			MultVec(modelMat, pos, clipPoly.list[j].pos);			// copy all 3 of 4  our transformed vertices into our clip poly struct
+		}
 
-			clipPoly.count = m_numPolyVerts;
+		clipPoly.count = m_numPolyVerts;
 
-			ClipPolygon(clipPoly, m_planes);
+		ClipPolygon(clipPoly, planes);
 
-			for (int j = 0; j < clipPoly.count; j++) {
-				if (clipPoly.list[j].pos[2] < 0.f) {
-					m_nfPairs[m_currentPriority].zNear = std::max(clipPoly.list[j].pos[2], m_nfPairs[m_currentPriority].zNear);
-					m_nfPairs[m_currentPriority].zFar  = std::min(clipPoly.list[j].pos[2], m_nfPairs[m_currentPriority].zFar);
-				}
+		for (int j = 0; j < clipPoly.count; j++) {
+			if (clipPoly.list[j].pos[2] < 0.f) {
+				nf.zNear = std::max(clipPoly.list[j].pos[2], nf.zNear);
+				nf.zFar  = std::min(clipPoly.list[j].pos[2], nf.zFar);
 			}
 		}
 	}
@@ -1837,6 +2521,17 @@ float CNew3D::GetLosValue(int layer)
 	return m_losFront->value[layer];
 }
 
+Render3DStats CNew3D::GetFrameStats()
+{
+	Render3DStats stats;
+	stats.meshes		= (UINT32)(m_drawStats.meshes - m_drawStatsFrame.meshes);
+	stats.stateChanges	= (UINT32)(m_drawStats.stateChanges - m_drawStatsFrame.stateChanges);
+	stats.textureBinds	= (UINT32)(m_drawStats.textureBinds - m_drawStatsFrame.textureBinds);
+	stats.ranges		= (UINT32)(m_drawStats.ranges - m_drawStatsFrame.ranges);
+	stats.drawCalls		= (UINT32)(m_drawStats.drawCalls - m_drawStatsFrame.drawCalls);
+	return stats;
+}
+
 void CNew3D::TranslateLosPosition(int inX, int inY, int& outX, int& outY)
 {
 	// remap real3d 496x384 to our new viewport
@@ -1848,33 +2543,97 @@ void CNew3D::TranslateLosPosition(int inX, int inY, int& outX, int& outY)
 
 bool CNew3D::ProcessLos(int priority)
 {
-	for (const auto &n : m_nodes) {
+	for (const auto &n : m_drawNodes) {
 		if (n.viewport.priority == priority) {
 			if (n.viewport.losPosX || n.viewport.losPosY) {
 
 				int losX, losY;
 				TranslateLosPosition(n.viewport.losPosX, n.viewport.losPosY, losX, losY);
 
+				if (m_asyncLos) {
+					LosRead& r = m_losReads[m_losRead];
+					r.buffer.Read(priority * sizeof(float), losX, losY, 1, 1, GL_DEPTH_COMPONENT, GL_FLOAT);
+					r.read[priority]	= true;
+					r.nf[priority][0]	= m_drawNfPairs[priority].zNear;
+					r.nf[priority][1]	= m_drawNfPairs[priority].zFar;
+					return false;		// value not known yet
+				}
+
 				float depth;
 				glReadPixels(losX, losY, 1, 1, GL_DEPTH_COMPONENT, GL_FLOAT, &depth);
 
-				if (depth < 0.99f || depth == 1.0f) {		// kinda guess work but when depth = 1, haven't drawn anything, when 0.99~ drawing sky somewhere far
-					return false;
-				}
+				return CalcLosValue(depth, m_drawNfPairs[priority].zNear, m_drawNfPairs[priority].zFar, m_losBack->value[priority]);
+			}
+		}
+	}
 
-				depth = 2.0f * depth - 1.0f;
+	return false;
+}
 
-				float zNear = m_nfPairs[priority].zNear;
-				float zFar	= m_nfPairs[priority].zFar;
-				float zVal	= 2.0f * zNear * zFar / (zFar + zNear - depth * (zFar - zNear));
+bool CNew3D::CalcLosValue(float depth, float zNear, float zFar, float& value)
+{
+	if (depth < 0.99f || depth == 1.0f) {		// kinda guess work but when depth = 1, haven't drawn anything, when 0.99~ drawing sky somewhere far
+		return false;
+	}
 
-				m_losBack->value[priority] = zVal;
-				return true;
+	depth = 2.0f * depth - 1.0f;
+
+	value = 2.0f * zNear * zFar / (zFar + zNear - depth * (zFar - zNear));
+	return true;
+}
+
+void CNew3D::FetchLosReads()
+{
+	if (!m_asyncLos) {
+		return;
+	}
+
+	// the reads from 2 frames ago have to be fetched now as their buffer is about to be reused,
+	// last frame's only if the gpu is already done with them. Oldest first, so the newest values win
+	int oldest = m_losRead ^ 1;
+
+	for (int i : { oldest, m_losRead }) {
+
+		LosRead& r = m_losReads[i];
+
+		if (!r.used) {
+			continue;
+		}
+
+		float depth[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+		if (r.buffer.Pending()) {
+			bool ready = r.buffer.Ready();
+			if (!ready && i != oldest) {
+				break;
+			}
+			r.buffer.Fetch(depth, sizeof(depth));
+			m_losFetches++;
+			m_losStalls += !ready;
+		}
+
+		for (int pri = 0; pri < 4; pri++) {
+			m_losAsync.value[pri] = 0;
+			if (r.read[pri]) {
+				CalcLosValue(depth[pri], r.nf[pri][0], r.nf[pri][1], m_losAsync.value[pri]);
 			}
+			r.read[pri] = false;
 		}
+
+		r.used = false;
 	}
 
-	return false;
+	m_losRead = oldest;
+	m_losReads[m_losRead].used = true;
+
+	*m_losBack = m_losAsync;
+}
+
+void CNew3D::FenceLosReads()
+{
+	if (m_asyncLos) {
+		m_losReads[m_losRead].buffer.Fence();
+	}
 }
 
 } // New3D
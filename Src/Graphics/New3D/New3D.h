@@ -38,6 +38,8 @@
 #include "TextureSheet.h"
 #include "Graphics/IRender3D.h"
 #include "Model.h"
+#include "RangeAllocator.h"
+#include "TextureBank.h"
 #include "Mat4.h"
 #include "Util/NewConfig.h"
 #include "R3DShader.h"
@@ -48,6 +50,8 @@
 #include "R3DScrollFog.h"
 #include "PolyHeader.h"
 #include "R3DFrameBuffers.h"
+#include "WorkerPool.h"
+#include "PixelReadback.h"
 #include <mutex>
 #include <memory>
 
@@ -65,6 +69,30 @@ public:
 	*/
 	void RenderFrame(void);
 
+	/*
+	* BuildScene(void):
+	*
+	* Traverses the scene database and builds the display lists for the next call
+	* to RenderFrame(). Makes no OpenGL calls, so it may run on a worker thread
+	* while the render thread is busy with other work for the same frame. If it
+	* is not called, RenderFrame() builds the scene itself.
+	*/
+	void BuildScene(void);
+
+	/*
+	* QueueScene(void):
+	*
+	* Hands the display lists built by the last BuildScene() to the next call to
+	* RenderFrame(), so that BuildScene() can start on the following frame while
+	* this one is drawn. If no scene was built since the last one was queued,
+	* the last one is drawn again. Call it on the render thread while
+	* BuildScene() is not running.
+	*
+	* Returns:
+	*		Always true.
+	*/
+	bool QueueScene(void);
+
 	/*
 	* BeginFrame(void):
 	*
@@ -180,6 +208,13 @@ public:
 	*/
 	float GetLosValue(int layer);
 
+	/*
+	* GetFrameStats();
+	*
+	* Gets the draw submission counts for the last frame rendered
+	*/
+	Render3DStats GetFrameStats();
+
 	/*
 	* CRender3D(config):
 	* ~CRender3D(void):
@@ -211,13 +246,30 @@ private:
 	void DescendPointerList(UINT32 addr);
 	void DescendNodePtr(UINT32 nodeAddr);
 	void RenderViewport(UINT32 addr);
+	void TraverseScene(bool parallel);
+	void TakeScene();								// make the last built scene the one drawn
 
 	// building the scene
+	struct SharedVerts;
 	void SetMeshValues(SortingMesh *currentMesh, PolyHeader &ph);
-	void CacheModel(Model *m, const UINT32 *data);
+	void CacheModel(Model *m, const UINT32 *data, UINT32 colorTableAddr);
+	bool DecodeModel(const UINT32 *data, UINT32 colorTableAddr, SharedVerts& prev, std::vector<Mesh>& meshes, std::vector<FVertex>& verts, unsigned& written);	// returns true if any verts were taken from prev
 	void CopyVertexData(const R3DPoly& r3dPoly, std::vector<FVertex>& vertexArray);
+	void VerifyVertices(const R3DPoly& r3dPoly, const FVertex* verts, int count);	// compare packed vertices with the floats they came from
+
+	// ROM model cache
+	void AddRomModel(Model *m, size_t firstMesh, const FVertex *verts, int count);	// place decoded verts in the ROM area of the VBO
+	void EvictRomModels(int count);					// free at least count verts, least recently used models first
+	void PurgeSpilledRomModels();
+	void UploadRomModels();
+
+	// dynamic vertex streaming
+	void UploadRamVerts();							// into the next area of the ring, start of frame
+	void FenceRamVerts();							// end of frame
 
 	bool RenderScene(int priority, bool renderOverlay, Layer layer);		// returns if has overlay plane
+	void QueueDraw(int first, int count);			// add vertices to the draw being built, they share the current state
+	void FlushDraws();								// submit the draw being built
 	bool IsDynamicModel(UINT32 *data);				// check if the model has a colour palette
 	bool IsVROMModel(UINT32 modelAddr);
 	void DrawScrollFog();
@@ -226,6 +278,9 @@ private:
 	void DisableRenderStates();
 	void TranslateLosPosition(int inX, int inY, int& outX, int& outY);
 	bool ProcessLos(int priority);
+	bool CalcLosValue(float depth, float zNear, float zFar, float& value);	// false if nothing was drawn there
+	void FetchLosReads();							// asynchronous reads, start of frame
+	void FenceLosReads();							// end of frame
 
 	void CalcTexOffset(int offX, int offY, int page, int x, int y, int& newX, int& newY);	
 
@@ -243,6 +298,9 @@ private:
 	bool m_sunClamp;
 	bool m_shadeIsSigned;
 	bool m_new3dAccurate;
+	bool m_gpuTextures;			// decode texture RAM in the fragment shader instead of converting textures up front
+	bool m_sceneReady;			// display lists for the next frame were built by BuildScene()
+	bool m_sceneQueued;			// QueueScene() has taken the scene for the next RenderFrame()
 
 	// Stepping
 	int		m_step;
@@ -268,6 +326,7 @@ private:
 	LODBlendTable* m_LODBlendTable;
 
 	TextureSheet	m_texSheet;
+	TextureBank		m_textureBank;			// used instead of m_texSheet with m_gpuTextures
 	NodeAttributes	m_nodeAttribs;
 	Mat4			m_modelMat;				// current modelview matrix
 
@@ -280,15 +339,104 @@ private:
 	LOS* m_losBack = &m_los[1];
 	std::mutex m_losMutex;
 
-	Vertex			m_prev[4];				// these are class variables because sega bass fishing starts meshes with shared vertices from the previous one
-	UINT16			m_prevTexCoords[4][2];	// basically relying on undefined behavour
+	// With m_asyncLos the depth is read into a buffer and fetched at the start of a later frame, instead of
+	// stalling the gpu in the middle of this one. Values reach the game a frame later than the exact reads
+	struct LosRead
+	{
+		PixelReadback	buffer;
+		bool			used = false;		// frame reads were queued in, even if there weren't any
+		bool			read[4] = {};		// priority layers read
+		float			nf[4][2];			// depth range of each layer when it was read
+	};
+
+	bool		m_asyncLos;
+	LosRead		m_losReads[2];				// reads from the last 2 frames, the gpu may not be done with either
+	int			m_losRead = 0;				// reads for the current frame
+	LOS			m_losAsync;					// latest fetched values, handed to the game every frame
+	UINT64		m_losFetches = 0;
+	UINT64		m_losStalls = 0;			// fetches that had to wait for the gpu
+
+	struct SharedVerts
+	{
+		Vertex	v[4];
+		UINT16	texCoords[4][2];
+	};
+
+	SharedVerts		m_prev;					// class variable because sega bass fishing starts meshes with shared vertices from the previous one
+											// basically relying on undefined behavour
 
 	std::vector<Node>	 m_nodes;				// this represents the entire render frame
 	std::vector<FVertex> m_polyBufferRam;		// dynamic polys
-	std::vector<FVertex> m_polyBufferRom;		// rom polys
-	std::unordered_map<UINT32, std::shared_ptr<std::vector<Mesh>>> m_romMap;	// a hash table for all the ROM models. The meshes don't have model matrices or tex offsets yet
+	std::vector<FVertex> m_polyBufferRom;		// rom polys, mirrors the start of the VBO. Ranges not owned by a model hold stale data
+
+	struct RomModel
+	{
+		std::shared_ptr<std::vector<Mesh>> meshes;
+		UINT64 lastUsed = 0;					// frame number the model was last drawn in
+	};
+
+	struct RomRange
+	{
+		int offset;
+		int count;
+	};
+
+	struct RomCacheStats
+	{
+		UINT64 hits			= 0;
+		UINT64 misses		= 0;
+		UINT64 evictions	= 0;				// models
+		UINT64 evictedVerts	= 0;
+	};
+
+	std::unordered_map<UINT32, RomModel> m_romMap;	// a hash table for all the ROM models. The meshes don't have model matrices or tex offsets yet
+	RangeAllocator			m_romAlloc;				// which vertices in the ROM area are in use
+	std::vector<RomRange>	m_romUploads;			// ranges of m_polyBufferRom written since the last upload
+	std::vector<FVertex>	m_romScratch;			// ROM model verts before they have a place in the buffer
+	int						m_romShortfall;			// verts of ROM models that didn't fit and went into the dynamic area this frame
+	RomCacheStats			m_romStats;				// totals
+	RomCacheStats			m_romStatsLog;			// at the last log line
+	UINT64					m_frameCount;
+
+	// draw submission. Consecutive meshes with the same state are drawn together, with one draw call per run of contiguous
+	// vertices, or one multi-draw for all of them where that is available
+	struct DrawStats
+	{
+		UINT64 frames		= 0;
+		UINT64 meshes		= 0;
+		UINT64 stateChanges	= 0;				// meshes that needed uniforms or textures set, ie the start of each draw
+		UINT64 textureBinds	= 0;
+		UINT64 ranges		= 0;				// contiguous vertex ranges drawn
+		UINT64 drawCalls	= 0;
+	};
+
+	std::vector<GLint>		m_drawFirst;			// vertex ranges of the draw being built
+	std::vector<GLsizei>	m_drawCount;
+	DrawStats				m_drawStats;
+	DrawStats				m_drawStatsFrame;		// m_drawStats at the start of the last frame
 
 	VBO m_vbo;								// large VBO to hold our poly data, start of VBO is ROM data, ram polys follow
+
+	// The dynamic verts of each frame go in the next of a ring of areas after the ROM data, written through a persistent
+	// mapping, or an unsynchronized one where buffer storage isn't available. Each area is fenced once drawn, so it is
+	// only written again when the gpu is done with it. Without sync objects there's a single area updated with BufferSubData()
+	enum class StreamMode { subData, mapRange, persistent };
+
+	struct StreamStats
+	{
+		UINT64 frames	= 0;
+		UINT64 bytes	= 0;
+		UINT64 maxBytes	= 0;
+		UINT64 waits	= 0;				// frames that had to wait for the gpu to finish with an area
+	};
+
+	static const int RAM_BUFFERS = 3;		// frames of dynamic verts in the VBO at once
+
+	StreamMode	m_streamMode;
+	GLsync		m_ramFences[RAM_BUFFERS];
+	int			m_ramBuffer;				// area for this frame
+	int			m_ramBase;					// its first vertex, relative to the start of the dynamic verts
+	StreamStats	m_streamStats;
 	R3DShader m_r3dShader;
 	std::unique_ptr<R3DScrollFog> m_r3dScrollFog;
 	std::unique_ptr<R3DFrameBuffers> m_r3dFrameBuffers;
@@ -309,12 +457,69 @@ private:
 	NFPair m_nfPairs[4];
 	int m_currentPriority;
 
+	// The scene being drawn. TakeScene() swaps these with the ones the traversal fills, so that with
+	// QueueScene() the next scene can be built while this one is submitted
+	std::vector<Node>		m_drawNodes;
+	std::vector<FVertex>	m_drawPolyBufferRam;
+	std::vector<RomRange>	m_drawRomUploads;
+	std::vector<FVertex>	m_drawRomVerts;			// copied out of m_polyBufferRom, which the next build may grow
+	NFPair					m_drawNfPairs[4];
+
+	// Parallel scene building. The traversal itself stays serial (it is a walk over a tree with
+	// a matrix/attribute stack), but model decoding and clipping are queued and run on the pool.
+	// The results are then merged in traversal order so the output matches the serial build.
+	struct ModelJob
+	{
+		size_t			node;				// index into m_nodes
+		size_t			model;				// index into the node's models
+		const UINT32*	data;				// model to decode, null if only clipping
+		UINT32			colorTableAddr;
+		int				priority;
+		bool			clip;
+		bool			clipped;
+		bool			sharedPrev;			// decode depended on the previous model, must be redone in order
+		unsigned		written;			// slots of prev set by this model
+		Plane			planes[5];
+		NFPair			nf;
+		SharedVerts		prev;				// slots left for the next model
+		std::vector<Mesh> meshes;			// vboOffset is relative to the arena until merged
+		unsigned		arena;				// thread arena holding the verts
+		size_t			firstVert;
+		size_t			numVerts;
+	};
+
+	void QueueModelJob(const UINT32 *data, bool clip);
+	void RunModelJob(ModelJob& job, unsigned thread);
+	void RunModelJobs();
+
+	std::unique_ptr<WorkerPool>	m_workerPool;
+	std::vector<ModelJob>		m_modelJobs;
+	std::vector<std::vector<FVertex>> m_arenas;	// vertices decoded by each thread, copied to the poly buffers when merging
+	bool						m_deferModels;
+	bool						m_verifyScene;	// build every frame serially as well and compare
+	unsigned					m_verifyErrors;
+
+	// packed vertex verification
+	struct VertexErrors
+	{
+		UINT64	checked		= 0;
+		UINT64	clamped		= 0;			// source values outside -1 to 1
+		float	normal		= 0;			// largest differences
+		float	faceNormal	= 0;
+		float	fixedShade	= 0;
+	};
+
+	bool			m_verifyVertices;
+	VertexErrors	m_vertexErrors;
+	std::mutex		m_vertexErrorsMutex;		// decoding runs on the worker threads
+
 	void CalcFrustumPlanes	(Plane p[5], const float* matrix);
 	void CalcBox			(float distance, BBox& box);
 	void TransformBox		(const float *m, BBox& box);
 	void MultVec			(const float matrix[16], const float in[4], float out[4]);
 	Clip ClipBox			(const BBox& box, Plane planes[5]);
-	void ClipModel			(const Model *m);
+	void ClipModel			(const Model *m, Plane planes[5], NFPair& nf);
+	void ClipVertices		(const float *modelMat, const FVertex *verts, int count, Plane planes[5], NFPair& nf);
 	void ClipPolygon		(ClipPoly& clipPoly, Plane planes[5]);
 	void CalcBoxExtents		(const BBox& box);
 	void CalcViewport		(Viewport* vp, float near, float far);
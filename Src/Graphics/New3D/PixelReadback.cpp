@@ -0,0 +1,120 @@
+#include "PixelReadback.h"
+#include <cstring>
+
+namespace New3D {
+
+PixelReadback::PixelReadback()
+{
+	m_id		= 0;
+	m_size		= 0;
+	m_fence		= 0;
+	m_queued	= false;
+}
+
+bool PixelReadback::Supported()
+{
+#ifdef __ANDROID__
+	return true;		// all core in GLES 3.0
+#else
+	return (GLEW_VERSION_2_1 || GLEW_ARB_pixel_buffer_object)
+		&& (GLEW_VERSION_3_2 || GLEW_ARB_sync)
+		&& (GLEW_VERSION_3_0 || GLEW_ARB_map_buffer_range);
+#endif
+}
+
+bool PixelReadback::Create(GLsizeiptr size)
+{
+	if (m_id && m_size == size) {
+		return true;
+	}
+
+	Destroy();
+
+	glGenBuffers(1, &m_id);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, m_id);
+	glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	m_size = size;
+
+	return m_id != 0;
+}
+
+void PixelReadback::Destroy()
+{
+	if (m_fence) {
+		glDeleteSync(m_fence);
+		m_fence = 0;
+	}
+
+	if (m_id) {
+		glDeleteBuffers(1, &m_id);
+		m_id	= 0;
+		m_size	= 0;
+	}
+
+	m_queued = false;
+}
+
+void PixelReadback::Read(GLintptr offset, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, m_id);
+	glReadPixels(x, y, width, height, format, type, reinterpret_cast<void*>(offset));	// offset into the buffer
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	m_queued = true;
+}
+
+void PixelReadback::Fence()
+{
+	if (!m_queued) {
+		return;
+	}
+
+	if (m_fence) {
+		glDeleteSync(m_fence);		// results of earlier reads weren't fetched, they get overwritten anyway
+	}
+
+	m_fence		= glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	m_queued	= false;
+}
+
+bool PixelReadback::Pending() const
+{
+	return m_fence != 0;
+}
+
+bool PixelReadback::Ready()
+{
+	if (!m_fence) {
+		return false;
+	}
+
+	// zero timeout just polls, the flush makes sure the fence actually gets to the gpu
+	GLenum result = glClientWaitSync(m_fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+	return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+}
+
+void PixelReadback::Fetch(void* data, GLsizeiptr size)
+{
+	if (m_fence) {
+		glDeleteSync(m_fence);		// mapping waits for the reads anyway
+		m_fence = 0;
+	}
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, m_id);
+
+	const void* src = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+	if (src) {
+		memcpy(data, src, size);
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	}
+	else {
+		memset(data, 0, size);
+	}
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+} // New3D
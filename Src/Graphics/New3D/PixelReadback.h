@@ -0,0 +1,39 @@
+#ifndef _PIXELREADBACK_H_
+#define _PIXELREADBACK_H_
+
+#ifdef __ANDROID__
+#include <GLES3/gl3.h>
+#else
+#include <GL/glew.h>
+#endif
+
+namespace New3D {
+
+// Reads pixels into a buffer object so glReadPixels returns straight away, instead of waiting for the
+// gpu to finish everything queued before it. A fence marks the end of the reads, the results are
+// fetched later, once the gpu has got past it.
+class PixelReadback
+{
+public:
+	PixelReadback();
+
+	static bool Supported();			// needs pixel buffer objects, sync objects and glMapBufferRange
+
+	bool Create		(GLsizeiptr size);	// does nothing if the buffer already has this size
+	void Destroy	();
+	void Read		(GLintptr offset, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type);	// from the bound read framebuffer
+	void Fence		();					// after the last read, does nothing if there weren't any
+	bool Pending	() const;			// fenced reads that haven't been fetched
+	bool Ready		();					// the gpu is past the fence, so fetching won't wait
+	void Fetch		(void* data, GLsizeiptr size);	// waits for the gpu if the reads aren't ready
+
+private:
+	GLuint		m_id;
+	GLsizeiptr	m_size;
+	GLsync		m_fence;
+	bool		m_queued;				// reads since the last fence
+};
+
+} // New3D
+
+#endif
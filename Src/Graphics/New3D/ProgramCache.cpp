@@ -0,0 +1,201 @@
+#include "ProgramCache.h"
+#include "OSD/Logger.h"
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <filesystem>
+
+namespace New3D {
+
+// Cache files are a 32-byte header, the driver string that wrote them and then the program binary
+static const char s_magic[8] = { 'S', 'M', 'P', 'R', 'O', 'G', 'B', 'N' };
+static const uint32_t CACHE_VERSION = 1;
+static const size_t HEADER_SIZE = 32;
+
+static std::string s_directory;
+
+void ProgramCache::SetDirectory(const std::string& dir)
+{
+	s_directory = dir;
+}
+
+bool ProgramCache::Enabled()
+{
+	if (s_directory.empty()) {
+		return false;
+	}
+
+#ifndef __ANDROID__
+	if (!GLEW_VERSION_4_1 && !GLEW_ARB_get_program_binary) {
+		return false;
+	}
+#endif
+
+	// gles 3.0 always has the entry points, but drivers are free to offer no formats at all
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+
+	return formats > 0;
+}
+
+std::string ProgramCache::FilePath(Sources sources)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	for (auto s : sources) {
+		for (const char* c = s; ; c++) {		// include the terminator, so sources can't run into each other
+			hash = (hash ^ (uint8_t)*c) * 0x100000001b3ULL;
+			if (!*c) {
+				break;
+			}
+		}
+	}
+
+	char name[32];
+	snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)hash);
+
+	return s_directory + "/" + name;
+}
+
+std::string ProgramCache::Driver()
+{
+	std::string driver;
+
+	for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+		auto str = (const char*)glGetString(name);
+		driver += str ? str : "";
+		driver += '\n';
+	}
+
+	return driver;
+}
+
+GLuint ProgramCache::Load(Sources sources)
+{
+	if (!Enabled()) {
+		return 0;
+	}
+
+	auto path = FilePath(sources);
+
+	FILE* fp = fopen(path.c_str(), "rb");
+	if (!fp) {
+		return 0;
+	}
+
+	uint8_t header[HEADER_SIZE];
+	uint32_t version, format, driverLength, binaryLength;
+	std::string driver;
+	std::vector<uint8_t> binary;
+
+	bool ok = fread(header, sizeof(header), 1, fp) == 1;
+
+	memcpy(&version,		header + 8,		sizeof(version));
+	memcpy(&format,			header + 12,	sizeof(format));
+	memcpy(&driverLength,	header + 16,	sizeof(driverLength));
+	memcpy(&binaryLength,	header + 20,	sizeof(binaryLength));
+
+	ok = ok && !memcmp(header, s_magic, sizeof(s_magic)) && version == CACHE_VERSION && driverLength < 4096 && binaryLength > 0;
+
+	if (ok) {
+		driver.resize(driverLength);
+		binary.resize(binaryLength);
+		ok = (!driverLength || fread(&driver[0], driverLength, 1, fp) == 1) && fread(binary.data(), binaryLength, 1, fp) == 1;
+	}
+
+	fclose(fp);
+
+	if (!ok || driver != Driver()) {
+		return 0;		// stale or from another driver, gets written over once the program is compiled
+	}
+
+	GLuint program = glCreateProgram();
+	glProgramBinary(program, (GLenum)format, binary.data(), (GLsizei)binaryLength);
+
+	GLint linked = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &linked);
+
+	if (linked != GL_TRUE) {
+		InfoLog("Shader cache file '%s' was rejected by the driver, compiling from source.", path.c_str());
+		glDeleteProgram(program);
+		return 0;
+	}
+
+	DebugLog("Loaded shader program from '%s'.\n", path.c_str());
+
+	return program;
+}
+
+void ProgramCache::PrepareLink(GLuint program)
+{
+	if (Enabled()) {
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+}
+
+void ProgramCache::Save(GLuint program, Sources sources)
+{
+	if (!Enabled()) {
+		return;
+	}
+
+	GLint linked = GL_FALSE;
+	GLint length = 0;
+	glGetProgramiv(program, GL_LINK_STATUS, &linked);
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+	if (linked != GL_TRUE || length <= 0) {
+		return;
+	}
+
+	std::vector<uint8_t> binary(length);
+	GLenum format = 0;
+	GLsizei written = 0;
+	glGetProgramBinary(program, length, &written, &format, binary.data());
+
+	if (written <= 0) {
+		return;
+	}
+
+	auto driver = Driver();
+	auto path = FilePath(sources);
+
+	uint8_t header[HEADER_SIZE] = { 0 };
+	uint32_t driverLength = (uint32_t)driver.size();
+	uint32_t binaryLength = (uint32_t)written;
+	uint32_t binaryFormat = (uint32_t)format;
+
+	memcpy(header,			s_magic,		sizeof(s_magic));
+	memcpy(header + 8,		&CACHE_VERSION,	sizeof(CACHE_VERSION));
+	memcpy(header + 12,		&binaryFormat,	sizeof(binaryFormat));
+	memcpy(header + 16,		&driverLength,	sizeof(driverLength));
+	memcpy(header + 20,		&binaryLength,	sizeof(binaryLength));
+
+	// write to a temporary file first, so an interrupted write never looks like a valid binary
+	std::error_code ec;
+	std::filesystem::create_directories(s_directory, ec);
+	std::string tmpPath = path + ".tmp";
+
+	FILE* fp = fopen(tmpPath.c_str(), "wb");
+	if (!fp) {
+		InfoLog("Unable to write shader cache file '%s'.", tmpPath.c_str());
+		return;
+	}
+
+	bool error = fwrite(header, sizeof(header), 1, fp) != 1
+		|| fwrite(driver.data(), driverLength, 1, fp) != 1
+		|| fwrite(binary.data(), binaryLength, 1, fp) != 1;
+	error |= fclose(fp) != 0;
+
+	if (!error) {
+		std::filesystem::rename(tmpPath, path, ec);
+	}
+
+	if (error || ec) {
+		InfoLog("Unable to write shader cache file '%s'.", path.c_str());
+		std::filesystem::remove(tmpPath, ec);
+	}
+}
+
+} // New3D
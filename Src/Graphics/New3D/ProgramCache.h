@@ -0,0 +1,36 @@
+#ifndef _PROGRAMCACHE_H_
+#define _PROGRAMCACHE_H_
+
+#ifdef __ANDROID__
+#include <GLES3/gl3.h>
+#else
+#include <GL/glew.h>
+#endif
+#include <string>
+#include <initializer_list>
+
+namespace New3D {
+
+// Keeps linked shader programs on disk as driver binaries, so later runs don't have to compile them. Files are
+// named after a hash of the shader sources and only loaded back with the same gl vendor, renderer and version
+// that wrote them. Anything the driver rejects is simply compiled from source again and written over.
+class ProgramCache
+{
+public:
+	using Sources = std::initializer_list<const char*>;
+
+	static void		SetDirectory	(const std::string& dir);	// empty disables the cache
+
+	static GLuint	Load			(Sources sources);			// linked program, or 0 to compile from source
+	static void		PrepareLink		(GLuint program);			// before glLinkProgram, so the binary can be fetched
+	static void		Save			(GLuint program, Sources sources);	// after a successful link
+
+private:
+	static bool			Enabled		();
+	static std::string	FilePath	(Sources sources);
+	static std::string	Driver		();
+};
+
+} // New3D
+
+#endif
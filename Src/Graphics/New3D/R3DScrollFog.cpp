@@ -1,5 +1,7 @@
 #include "R3DScrollFog.h"
 #include "Mat4.h"
+#include "ProgramCache.h"
+#include "Types.h"
 #include <cstdio>
 #include <string>
 
@@ -9,7 +11,6 @@ namespace New3D {
 #include "Graphics/Shader.h"
 #endif
 
-#ifdef __ANDROID__
 namespace {
 static void LogShaderError(GLuint shader, const char* label)
 {
@@ -48,6 +49,9 @@ static bool CompileShaderProgram(GLuint* programOut, GLuint* vsOut, GLuint* fsOu
 	*vsOut = 0;
 	*fsOut = 0;
 
+	*programOut = ProgramCache::Load({ vsSrc, fsSrc });
+	if (*programOut) return true;
+
 	GLuint vs = glCreateShader(GL_VERTEX_SHADER);
 	glShaderSource(vs, 1, &vsSrc, nullptr);
 	glCompileShader(vs);
@@ -61,6 +65,7 @@ static bool CompileShaderProgram(GLuint* programOut, GLuint* vsOut, GLuint* fsOu
 	GLuint program = glCreateProgram();
 	glAttachShader(program, vs);
 	glAttachShader(program, fs);
+	ProgramCache::PrepareLink(program);
 	glLinkProgram(program);
 	LogProgramError(program);
 
@@ -73,13 +78,14 @@ static bool CompileShaderProgram(GLuint* programOut, GLuint* vsOut, GLuint* fsOu
 		return false;
 	}
 
+	ProgramCache::Save(program, { vsSrc, fsSrc });
+
 	*programOut = program;
 	*vsOut = vs;
 	*fsOut = fs;
 	return true;
 }
 } // namespace
-#endif
 
 #ifdef __ANDROID__
 static const char *vertexShaderFog = R"glsl(#version 300 es
@@ -263,20 +269,29 @@ void R3DScrollFog::DrawScrollFog(float rgba[4], float attenuation, float ambient
 
 void R3DScrollFog::AllocResources()
 {
-#ifdef __ANDROID__
-	bool success = CompileShaderProgram(&m_shaderProgram, &m_vertexShader, &m_fragmentShader, vertexShaderFog, fragmentShaderFog);
-#else
-	bool success =
-		LoadShaderProgram(
-			&m_shaderProgram,
-			&m_vertexShader,
-			&m_fragmentShader,
-			m_config["VertexShaderFog"].ValueAsDefault<std::string>(""),
-			m_config["FragmentShaderFog"].ValueAsDefault<std::string>(""),
-			vertexShaderFog,
-			fragmentShaderFog
-		);
+	bool success;
+#ifndef __ANDROID__
+	auto vsFile = m_config["VertexShaderFog"].ValueAsDefault<std::string>("");
+	auto fsFile = m_config["FragmentShaderFog"].ValueAsDefault<std::string>("");
+
+	if (!vsFile.empty() || !fsFile.empty()) {
+		success = OKAY ==
+			LoadShaderProgram(
+				&m_shaderProgram,
+				&m_vertexShader,
+				&m_fragmentShader,
+				vsFile,
+				fsFile,
+				vertexShaderFog,
+				fragmentShaderFog
+			);
+	}
+	else
 #endif
+	{
+		success = CompileShaderProgram(&m_shaderProgram, &m_vertexShader, &m_fragmentShader, vertexShaderFog, fragmentShaderFog);	// built in shaders go through the program cache
+	}
+
 	if (!success) {
 		m_shaderProgram = 0;
 		m_vertexShader = 0;
@@ -301,8 +316,10 @@ void R3DScrollFog::DeallocResources()
 	if (m_shaderProgram) {
 #ifdef __ANDROID__
 		glUseProgram(0);
-		glDetachShader(m_shaderProgram, m_vertexShader);
-		glDetachShader(m_shaderProgram, m_fragmentShader);
+		if (m_vertexShader) {		// none if the program came from the cache
+			glDetachShader(m_shaderProgram, m_vertexShader);
+			glDetachShader(m_shaderProgram, m_fragmentShader);
+		}
 		glDeleteShader(m_vertexShader);
 		glDeleteShader(m_fragmentShader);
 		glDeleteProgram(m_shaderProgram);
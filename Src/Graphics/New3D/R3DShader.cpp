@@ -3,6 +3,8 @@
 #include "R3DShaderQuads.h"
 #endif
 #include "R3DShaderTriangles.h"
+#include "ProgramCache.h"
+#include <string>
 
 // having 2 sets of shaders to maintain is really less than ideal
 // but hopefully not too many breaking changes at this point
@@ -43,8 +45,15 @@ void R3DShader::Start()
 	m_texWrapMode[0]	= 0;
 	m_texWrapMode[1]	= 0;
 
+	m_baseTexPos[0]		= 0;
+	m_baseTexPos[1]		= 0;
+	m_baseTexFormat		= 0;
+	m_microTexPos[0]	= 0;
+	m_microTexPos[1]	= 0;
+
 	m_dirtyMesh			= true;			// dirty means all the above are dirty, ie first run
 	m_dirtyModel		= true;
+	m_dirtyTexPos		= true;
 }
 
 bool R3DShader::LoadShader(const char* vertexShader, const char* fragmentShader)
@@ -65,36 +74,50 @@ bool R3DShader::LoadShader(const char* vertexShader, const char* fragmentShader)
 		gShader = geometryShaderR3DQuads;
 		fShader = fragmentShaderR3DQuads;
 	}
+#else
+	std::string fSource;
+
+	if (m_config["New3DGPUTextures"].ValueAsDefault<bool>(false)) {
+		fSource = fShader;
+		fSource.insert(fSource.find('\n') + 1, "#define TEXTURE_RAM\n");	// has to come after #version
+		fShader = fSource.c_str();
+	}
 #endif
 
-	m_shaderProgram		= glCreateProgram();
-	m_vertexShader		= glCreateShader(GL_VERTEX_SHADER);
-	m_fragmentShader	= glCreateShader(GL_FRAGMENT_SHADER);
+	m_shaderProgram = ProgramCache::Load({ vShader, gShader, fShader });
 
-	glShaderSource(m_vertexShader,		1, (const GLchar **)&vShader, NULL);
-	glShaderSource(m_fragmentShader,	1, (const GLchar **)&fShader, NULL);
+	if (!m_shaderProgram) {
+		m_shaderProgram		= glCreateProgram();
+		m_vertexShader		= glCreateShader(GL_VERTEX_SHADER);
+		m_fragmentShader	= glCreateShader(GL_FRAGMENT_SHADER);
 
-	glCompileShader(m_vertexShader);
-	glCompileShader(m_fragmentShader);
+		glShaderSource(m_vertexShader,		1, (const GLchar **)&vShader, NULL);
+		glShaderSource(m_fragmentShader,	1, (const GLchar **)&fShader, NULL);
+
+		glCompileShader(m_vertexShader);
+		glCompileShader(m_fragmentShader);
 
 #ifndef __ANDROID__
-	if (quads) {
-		m_geoShader = glCreateShader(GL_GEOMETRY_SHADER);
-		glShaderSource(m_geoShader, 1, (const GLchar **)&gShader, NULL);
-		glCompileShader(m_geoShader);
-		glAttachShader(m_shaderProgram, m_geoShader);
-		PrintShaderResult(m_geoShader);
-	}
+		if (quads) {
+			m_geoShader = glCreateShader(GL_GEOMETRY_SHADER);
+			glShaderSource(m_geoShader, 1, (const GLchar **)&gShader, NULL);
+			glCompileShader(m_geoShader);
+			glAttachShader(m_shaderProgram, m_geoShader);
+			PrintShaderResult(m_geoShader);
+		}
 #endif
 
-	PrintShaderResult(m_vertexShader);
-	PrintShaderResult(m_fragmentShader);
+		PrintShaderResult(m_vertexShader);
+		PrintShaderResult(m_fragmentShader);
 
-	glAttachShader(m_shaderProgram, m_vertexShader);
-	glAttachShader(m_shaderProgram, m_fragmentShader);
-	glLinkProgram(m_shaderProgram);
+		glAttachShader(m_shaderProgram, m_vertexShader);
+		glAttachShader(m_shaderProgram, m_fragmentShader);
+		ProgramCache::PrepareLink(m_shaderProgram);
+		glLinkProgram(m_shaderProgram);
 
-	PrintProgramResult(m_shaderProgram);
+		PrintProgramResult(m_shaderProgram);
+		ProgramCache::Save(m_shaderProgram, { vShader, gShader, fShader });
+	}
 
 	m_locTexture1			= glGetUniformLocation(m_shaderProgram, "tex1");
 	m_locTexture2			= glGetUniformLocation(m_shaderProgram, "tex2");
@@ -106,6 +129,10 @@ bool R3DShader::LoadShader(const char* vertexShader, const char* fragmentShader)
 	m_locBaseTexSize		= glGetUniformLocation(m_shaderProgram, "baseTexSize");
 	m_locTextureInverted	= glGetUniformLocation(m_shaderProgram, "textureInverted");
 	m_locTexWrapMode		= glGetUniformLocation(m_shaderProgram, "textureWrapMode");
+	m_locTextureBank		= glGetUniformLocation(m_shaderProgram, "textureBank");
+	m_locBaseTexPos			= glGetUniformLocation(m_shaderProgram, "baseTexPos");
+	m_locBaseTexFormat		= glGetUniformLocation(m_shaderProgram, "baseTexFormat");
+	m_locMicroTexPos		= glGetUniformLocation(m_shaderProgram, "microTexPos");
 
 	m_locFogIntensity		= glGetUniformLocation(m_shaderProgram, "fogIntensity");
 	m_locFogDensity			= glGetUniformLocation(m_shaderProgram, "fogDensity");
@@ -171,6 +198,7 @@ void R3DShader::SetMeshUniforms(const Mesh* m)
 	if (m_dirtyMesh) {
 		glUniform1i(m_locTexture1, 0);
 		glUniform1i(m_locTexture2, 1);
+		glUniform1i(m_locTextureBank, 0);
 	}
 
 	if (m_dirtyMesh || m->textured != m_textured1) {
@@ -263,6 +291,28 @@ void R3DShader::SetMeshUniforms(const Mesh* m)
 	m_dirtyMesh = false;
 }
 
+void R3DShader::SetTexturePosition(int x, int y, int format, int microX, int microY)
+{
+	if (m_dirtyTexPos || x != m_baseTexPos[0] || y != m_baseTexPos[1]) {
+		m_baseTexPos[0] = x;
+		m_baseTexPos[1] = y;
+		glUniform2iv(m_locBaseTexPos, 1, m_baseTexPos);
+	}
+
+	if (m_dirtyTexPos || format != m_baseTexFormat) {
+		glUniform1i(m_locBaseTexFormat, format);
+		m_baseTexFormat = format;
+	}
+
+	if (m_dirtyTexPos || microX != m_microTexPos[0] || microY != m_microTexPos[1]) {
+		m_microTexPos[0] = microX;
+		m_microTexPos[1] = microY;
+		glUniform2iv(m_locMicroTexPos, 1, m_microTexPos);
+	}
+
+	m_dirtyTexPos = false;
+}
+
 void R3DShader::SetViewportUniforms(const Viewport *vp)
 {
 	//didn't bother caching these, they don't get frequently called anyway
@@ -20,6 +20,7 @@ public:
 
 	bool	LoadShader			(const char* vertexShader = nullptr, const char* fragmentShader = nullptr);
 	void	SetMeshUniforms		(const Mesh* m);
+	void	SetTexturePosition	(int x, int y, int format, int microX, int microY);	// texture RAM path only
 	void	SetModelStates		(const Model* model);
 	void	SetViewportUniforms	(const Viewport *vp);
 	void	Start				();
@@ -53,6 +54,10 @@ private:
 	GLint m_locTextureInverted;
 	GLint m_locTexWrapMode;
 	GLint m_locTranslatorMap;
+	GLint m_locTextureBank;
+	GLint m_locBaseTexPos;
+	GLint m_locBaseTexFormat;
+	GLint m_locMicroTexPos;
 
 	// cached mesh values
 	bool	m_textured1;
@@ -72,6 +77,9 @@ private:
 	float	m_baseTexSize[2];
 	int		m_texWrapMode[2];
 	bool	m_textureInverted;
+	int		m_baseTexPos[2];
+	int		m_baseTexFormat;
+	int		m_microTexPos[2];
 
 	// cached model values
 	float	m_modelScale;
@@ -79,6 +87,7 @@ private:
 	// are our cache values dirty
 	bool	m_dirtyMesh;
 	bool	m_dirtyModel;
+	bool	m_dirtyTexPos;		// texture position isn't set for every mesh, so tracked separately
 
 	// viewport uniform locations
 	GLint m_locFogIntensity;
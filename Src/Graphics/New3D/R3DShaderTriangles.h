@@ -62,8 +62,15 @@ precision highp float;
 precision highp int;
 precision lowp sampler2D;
 
+#ifdef TEXTURE_RAM
+uniform highp usampler2D textureBank;   // raw 16 bit texture RAM, formats decoded here
+uniform ivec2 baseTexPos;       // position of mip level 0 in texture RAM
+uniform int   baseTexFormat;
+uniform ivec2 microTexPos;
+#else
 uniform sampler2D tex1;         // base tex
 uniform sampler2D tex2;         // micro tex (optional)
+#endif
 
 // texturing
 uniform int   textureEnabled;
@@ -155,17 +162,8 @@ float LinearTexLocations(int wrapMode, float size, float u, out float u0, out fl
   }
 }
 
-vec4 texBiLinear(sampler2D texSampler, float level, ivec2 wrapMode, vec2 texSize, vec2 texCoord)
+vec4 BlendTexels(vec4 p0q0, vec4 p1q0, vec4 p0q1, vec4 p1q1, float a, float b)
 {
-  float tx[2], ty[2];
-  float a = LinearTexLocations(wrapMode.s, texSize.x, texCoord.x, tx[0], tx[1]);
-  float b = LinearTexLocations(wrapMode.t, texSize.y, texCoord.y, ty[0], ty[1]);
-
-  vec4 p0q0 = textureLod(texSampler, vec2(tx[0], ty[0]), level);
-  vec4 p1q0 = textureLod(texSampler, vec2(tx[1], ty[0]), level);
-  vec4 p0q1 = textureLod(texSampler, vec2(tx[0], ty[1]), level);
-  vec4 p1q1 = textureLod(texSampler, vec2(tx[1], ty[1]), level);
-
   if (alphaTest != 0) {
     if (p0q0.a > p1q0.a) { p1q0.rgb = p0q0.rgb; }
     if (p0q0.a > p0q1.a) { p0q1.rgb = p0q0.rgb; }
@@ -185,6 +183,148 @@ vec4 texBiLinear(sampler2D texSampler, float level, ivec2 wrapMode, vec2 texSize
   return mix(pInterp_q0, pInterp_q1, b);
 }
 
+#ifdef TEXTURE_RAM
+
+// texel index along one axis of a size texel wide mip level, same wrapping as LinearTexLocations
+int TexelLocations(int wrapMode, int size, float u, out int u1, out float weight)
+{
+  if (wrapMode == 0) { // repeat
+    u = (u * float(size)) - 0.5;
+    int u0 = int(mod(floor(u), float(size)));
+    u1 = (u0 + 1) % size;
+    weight = fract(u);
+    return u0;
+  }
+
+  if (wrapMode == 1) { // repeat + clamp
+    u = fract(u);
+  } else { // mirror + mirror clamp
+    float odd = floor(mod(u, 2.0));
+    u = (odd > 0.0) ? 1.0 - fract(u) : fract(u);
+  }
+
+  u = (u * float(size)) - 0.5;
+  weight = fract(u);
+  u1 = clamp(int(floor(u)) + 1, 0, size - 1);
+  return clamp(int(floor(u)), 0, size - 1);
+}
+
+ivec2 MipPosition(ivec2 pos, int level)
+{
+  const int mipXBase[12] = int[12](0, 1024, 1536, 1792, 1920, 1984, 2016, 2032, 2040, 2044, 2046, 2047);
+  const int mipYBase[11] = int[11](0, 512, 768, 896, 960, 992, 1008, 1016, 1020, 1022, 1023);
+
+  int page = pos.y / 1024;
+  int y = pos.y - (page * 1024);
+
+  return ivec2(mipXBase[level] + (pos.x >> level), mipYBase[level] + (y >> level) + (page * 1024));
+}
+
+// same 8 bit values the CPU conversion in Texture.cpp produces, so the alpha thresholds match too
+vec4 DecodeTexel(uint t, int format)
+{
+  uint lo = t & 0xFFu;
+  uint hi = t >> 8;
+  uvec4 c;
+
+  switch (format) {
+  default: // debug texture
+    c = uvec4(255u, 0u, 0u, 255u);
+    break;
+  case 0: // T1RGB5
+    c = uvec4(((t >> 10) & 0x1Fu) * 255u / 0x1Fu, ((t >> 5) & 0x1Fu) * 255u / 0x1Fu, (t & 0x1Fu) * 255u / 0x1Fu, ((t & 0x8000u) != 0u) ? 0u : 255u);
+    break;
+  case 1: // A4L4 (low byte)
+    c = uvec4(uvec3((lo & 0xFu) * 17u), (lo >> 4) * 17u);
+    break;
+  case 2: // L4A4 (low byte)
+    c = uvec4(uvec3((lo >> 4) * 17u), (lo & 0xFu) * 17u);
+    break;
+  case 3: // A4L4 (high byte)
+    c = uvec4(uvec3((hi & 0xFu) * 17u), (hi >> 4) * 17u);
+    break;
+  case 4: // L4A4 (high byte)
+    c = uvec4(uvec3((hi >> 4) * 17u), (hi & 0xFu) * 17u);
+    break;
+  case 5: // 8-bit grayscale (low byte)
+    c = uvec4(uvec3(lo), (lo == 255u) ? 0u : 255u);
+    break;
+  case 6: // 8-bit grayscale (high byte)
+    c = uvec4(uvec3(hi), (hi == 255u) ? 0u : 255u);
+    break;
+  case 7: // RGBA4
+    c = uvec4(t >> 12, (t >> 8) & 0xFu, (t >> 4) & 0xFu, t & 0xFu) * 17u;
+    break;
+  case 8: // 4-bit luminance, low byte low nibble
+    c.rgb = uvec3((lo & 0xFu) * 17u);
+    c.a = (c.r == 255u) ? 0u : 255u;
+    break;
+  case 9: // low byte high nibble
+    c.rgb = uvec3((lo >> 4) * 17u);
+    c.a = (c.r == 255u) ? 0u : 255u;
+    break;
+  case 10: // high byte low nibble
+    c.rgb = uvec3((hi & 0xFu) * 17u);
+    c.a = (c.r == 255u) ? 0u : 255u;
+    break;
+  case 11: // high byte high nibble
+    c.rgb = uvec3((hi >> 4) * 17u);
+    c.a = (c.r == 255u) ? 0u : 255u;
+    break;
+  }
+
+  return vec4(c) * (1.0 / 255.0);
+}
+
+vec4 FetchTexel(ivec2 pos, int format, int x, int y)
+{
+  ivec2 p = min(pos + ivec2(x, y), ivec2(2047));   // textures don't wrap around the sheet
+  return DecodeTexel(texelFetch(textureBank, p, 0).r, format);
+}
+
+vec4 texBiLinear(ivec2 basePos, int format, int level, ivec2 wrapMode, ivec2 texSize, vec2 texCoord)
+{
+  int x0, x1, y0, y1;
+  float a, b;
+  ivec2 pos = MipPosition(basePos, level);
+
+  x0 = TexelLocations(wrapMode.s, texSize.x, texCoord.x, x1, a);
+  y0 = TexelLocations(wrapMode.t, texSize.y, texCoord.y, y1, b);
+
+  return BlendTexels(FetchTexel(pos, format, x0, y0), FetchTexel(pos, format, x1, y0),
+                     FetchTexel(pos, format, x0, y1), FetchTexel(pos, format, x1, y1), a, b);
+}
+
+vec4 textureR3D(ivec2 basePos, int format, ivec2 wrapMode, vec2 texSize, vec2 texCoord)
+{
+  float numLevels = floor(log2(min(texSize.x, texSize.y)));
+  float fLevel = min(mip_map_level(texCoord * texSize), numLevels);
+  fLevel *= (alphaTest != 0) ? 0.5 : 0.8;
+
+  int level0 = int(fLevel);
+  int level1 = min(level0 + 1, int(numLevels));
+
+  vec4 texLevel0 = texBiLinear(basePos, format, level0, wrapMode, ivec2(texSize) >> level0, texCoord);
+  vec4 texLevel1 = texBiLinear(basePos, format, level1, wrapMode, ivec2(texSize) >> level1, texCoord);
+  return mix(texLevel0, texLevel1, fract(fLevel));
+}
+
+#else
+
+vec4 texBiLinear(sampler2D texSampler, float level, ivec2 wrapMode, vec2 texSize, vec2 texCoord)
+{
+  float tx[2], ty[2];
+  float a = LinearTexLocations(wrapMode.s, texSize.x, texCoord.x, tx[0], tx[1]);
+  float b = LinearTexLocations(wrapMode.t, texSize.y, texCoord.y, ty[0], ty[1]);
+
+  vec4 p0q0 = textureLod(texSampler, vec2(tx[0], ty[0]), level);
+  vec4 p1q0 = textureLod(texSampler, vec2(tx[1], ty[0]), level);
+  vec4 p0q1 = textureLod(texSampler, vec2(tx[0], ty[1]), level);
+  vec4 p1q1 = textureLod(texSampler, vec2(tx[1], ty[1]), level);
+
+  return BlendTexels(p0q0, p1q0, p0q1, p1q1, a, b);
+}
+
 vec4 textureR3D(sampler2D texSampler, ivec2 wrapMode, vec2 texSize, vec2 texCoord)
 {
   float numLevels = floor(log2(min(texSize.x, texSize.y)));
@@ -200,9 +340,15 @@ vec4 textureR3D(sampler2D texSampler, ivec2 wrapMode, vec2 texSize, vec2 texCoor
   return mix(texLevel0, texLevel1, fract(fLevel));
 }
 
+#endif
+
 vec4 GetTextureValue()
 {
+#ifdef TEXTURE_RAM
+  vec4 tex1Data = textureR3D(baseTexPos, baseTexFormat, textureWrapMode, baseTexSize, fsTexCoord);
+#else
   vec4 tex1Data = textureR3D(tex1, textureWrapMode, baseTexSize, fsTexCoord);
+#endif
 
   if (textureInverted != 0) {
     tex1Data.rgb = vec3(1.0) - tex1Data.rgb;
@@ -210,7 +356,11 @@ vec4 GetTextureValue()
 
   if (microTexture != 0) {
     vec2 scale = (baseTexSize / 128.0) * microTextureScale;
+#ifdef TEXTURE_RAM
+    vec4 tex2Data = textureR3D(microTexPos, 0, ivec2(0, 0), vec2(128.0), fsTexCoord * scale);
+#else
     vec4 tex2Data = textureR3D(tex2, ivec2(0, 0), vec2(128.0), fsTexCoord * scale);
+#endif
 
     float lod = mip_map_level(fsTexCoord * scale * vec2(128.0));
     float blendFactor = max(lod - 1.5, 0.0);
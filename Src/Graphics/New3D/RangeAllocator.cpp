@@ -0,0 +1,96 @@
+#include "RangeAllocator.h"
+
+namespace New3D {
+
+RangeAllocator::RangeAllocator()
+{
+	m_capacity	= 0;
+	m_freeTotal	= 0;
+}
+
+void RangeAllocator::Reset(int capacity)
+{
+	m_free.clear();
+
+	if (capacity > 0) {
+		m_free[0] = capacity;
+	}
+
+	m_capacity	= capacity;
+	m_freeTotal	= capacity;
+}
+
+bool RangeAllocator::Alloc(int size, int& offset)
+{
+	if (size <= 0) {
+		offset = 0;
+		return true;
+	}
+
+	if (size > m_freeTotal) {
+		return false;
+	}
+
+	for (auto it = m_free.begin(); it != m_free.end(); ++it) {
+
+		if (it->second < size) {
+			continue;
+		}
+
+		offset = it->first;
+
+		int remaining = it->second - size;
+
+		m_free.erase(it);
+
+		if (remaining) {
+			m_free[offset + size] = remaining;
+		}
+
+		m_freeTotal -= size;
+
+		return true;
+	}
+
+	return false;		// enough space in total, but fragmented
+}
+
+void RangeAllocator::Free(int offset, int size)
+{
+	if (size <= 0) {
+		return;
+	}
+
+	m_freeTotal += size;
+
+	auto next = m_free.lower_bound(offset);
+
+	// merge with the range that follows
+	if (next != m_free.end() && next->first == offset + size) {
+		size += next->second;
+		next = m_free.erase(next);
+	}
+
+	// merge with the range in front
+	if (next != m_free.begin()) {
+		auto prev = std::prev(next);
+		if (prev->first + prev->second == offset) {
+			prev->second += size;
+			return;
+		}
+	}
+
+	m_free.emplace_hint(next, offset, size);
+}
+
+int RangeAllocator::GetFree() const
+{
+	return m_freeTotal;
+}
+
+int RangeAllocator::GetCapacity() const
+{
+	return m_capacity;
+}
+
+} // New3D
@@ -0,0 +1,30 @@
+#ifndef _RANGEALLOCATOR_H_
+#define _RANGEALLOCATOR_H_
+
+#include <iterator>
+#include <map>
+
+namespace New3D {
+
+// First fit allocator for ranges of a fixed size buffer, in units of the caller's choice (we use vertices).
+// Free ranges are kept sorted by offset so neighbours can be merged when a range is given back.
+class RangeAllocator
+{
+public:
+	RangeAllocator();
+
+	void Reset		(int capacity);				// everything free
+	bool Alloc		(int size, int& offset);
+	void Free		(int offset, int size);
+	int  GetFree	() const;
+	int  GetCapacity() const;
+
+private:
+	std::map<int, int>	m_free;					// offset -> size
+	int					m_capacity;
+	int					m_freeTotal;
+};
+
+} // New3D
+
+#endif
@@ -0,0 +1,104 @@
+#include "TextureBank.h"
+#include <algorithm>
+
+namespace New3D {
+
+static const int kSheetSize		= 2048;
+static const int kMaxUploads	= 64;		// past this it's cheaper to send the bounding box in one call
+
+TextureBank::TextureBank()
+{
+	m_textureID = 0;
+}
+
+TextureBank::~TextureBank()
+{
+	Destroy();		// make sure to have valid context before destroying
+}
+
+void TextureBank::Create()
+{
+	Destroy();
+
+	glGenTextures(1, &m_textureID);
+	glBindTexture(GL_TEXTURE_2D, m_textureID);
+
+	// integer textures can't be filtered, the shader fetches and blends the texels itself
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_R16UI, kSheetSize, kSheetSize, 0, GL_RED_INTEGER, GL_UNSIGNED_SHORT, nullptr);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	m_dirty.clear();
+	Invalidate(0, 0, kSheetSize, kSheetSize);		// contents are undefined until the first upload
+}
+
+void TextureBank::Destroy()
+{
+	if (m_textureID) {
+		glDeleteTextures(1, &m_textureID);
+		m_textureID = 0;
+	}
+}
+
+void TextureBank::Invalidate(int x, int y, int width, int height)
+{
+	x		= std::max(x, 0);
+	y		= std::max(y, 0);
+	width	= std::min(width, kSheetSize - x);
+	height	= std::min(height, kSheetSize - y);
+
+	if (width <= 0 || height <= 0) {
+		return;
+	}
+
+	m_dirty.push_back({ x, y, width, height });
+}
+
+void TextureBank::Upload(const UINT16* src)
+{
+	if (m_dirty.empty() || !m_textureID || !src) {
+		return;
+	}
+
+	if ((int)m_dirty.size() > kMaxUploads) {
+
+		int x1 = kSheetSize, y1 = kSheetSize, x2 = 0, y2 = 0;
+
+		for (const auto& r : m_dirty) {
+			x1 = std::min(x1, r.x);
+			y1 = std::min(y1, r.y);
+			x2 = std::max(x2, r.x + r.width);
+			y2 = std::max(y2, r.y + r.height);
+		}
+
+		m_dirty.clear();
+		m_dirty.push_back({ x1, y1, x2 - x1, y2 - y1 });
+	}
+
+	glBindTexture(GL_TEXTURE_2D, m_textureID);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, kSheetSize);		// rects are read straight out of texture RAM
+
+	for (const auto& r : m_dirty) {
+		glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.width, r.height, GL_RED_INTEGER, GL_UNSIGNED_SHORT, src + (r.y * kSheetSize) + r.x);
+	}
+
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	m_dirty.clear();
+}
+
+void TextureBank::Bind()
+{
+	glBindTexture(GL_TEXTURE_2D, m_textureID);
+}
+
+} // New3D
@@ -0,0 +1,41 @@
+#ifndef _TEXTURE_BANK_H_
+#define _TEXTURE_BANK_H_
+
+#include "Types.h"
+#include <vector>
+#ifdef __ANDROID__
+#include <GLES3/gl3.h>
+#else
+#include <GL/glew.h>
+#endif
+
+namespace New3D {
+
+// The whole 2048x2048 16-bit texture RAM as a single integer texture. The fragment shader
+// decodes the texel formats itself, so there are no per texture objects to create or convert.
+class TextureBank
+{
+public:
+	TextureBank();
+	~TextureBank();
+
+	void Create		();
+	void Destroy	();
+	void Invalidate	(int x, int y, int width, int height);		// area of texture RAM that was written to
+	void Upload		(const UINT16* src);						// send everything invalidated since the last call
+	void Bind		();
+
+private:
+
+	struct Rect
+	{
+		int x, y, width, height;
+	};
+
+	std::vector<Rect>	m_dirty;
+	GLuint				m_textureID;
+};
+
+} // New3D
+
+#endif
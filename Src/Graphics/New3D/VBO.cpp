@@ -5,6 +5,7 @@ namespace New3D {
 VBO::VBO()
 {
 	m_id		= 0;
+	m_mapping	= nullptr;
 	m_target	= 0;
 	m_capacity	= 0;
 	m_size		= 0;
@@ -23,6 +24,52 @@ void VBO::Create(GLenum target, GLenum usage, GLsizeiptr size, const void* data)
 	Bind(false);		// unbind
 }
 
+bool VBO::CreateMapped(GLenum target, GLsizeiptr size)
+{
+#ifdef __ANDROID__
+	return false;		// buffer storage is only an extension in GLES
+#else
+	if (!(GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage)) {
+		return false;
+	}
+
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	glGenBuffers(1, &m_id);
+	glBindBuffer(target, m_id);
+	glBufferStorage(target, size, nullptr, flags | GL_DYNAMIC_STORAGE_BIT);		// dynamic storage so BufferSubData() still works
+	m_mapping = glMapBufferRange(target, 0, size, flags);
+
+	m_target	= target;
+	m_capacity	= size;
+	m_size		= 0;
+
+	Bind(false);
+
+	if (!m_mapping) {
+		Destroy();
+		return false;
+	}
+
+	return true;
+#endif
+}
+
+void* VBO::GetMapping()
+{
+	return m_mapping;
+}
+
+void* VBO::MapRange(GLintptr offset, GLsizeiptr size)
+{
+	return glMapBufferRange(m_target, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+}
+
+void VBO::Unmap()
+{
+	glUnmapBuffer(m_target);
+}
+
 void VBO::BufferSubData(GLintptr offset, GLsizeiptr size, const GLvoid* data)
 {
 	glBufferSubData(m_target, offset, size, data);
@@ -52,6 +99,13 @@ void VBO::Reset()
 
 void VBO::Destroy()
 {
+	if (m_mapping) {
+		glBindBuffer(m_target, m_id);
+		glUnmapBuffer(m_target);
+		glBindBuffer(m_target, 0);
+		m_mapping = nullptr;
+	}
+
 	if (m_id) {
 		glDeleteBuffers(1, &m_id);
 		m_id		= 0;
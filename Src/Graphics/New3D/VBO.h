@@ -15,6 +15,10 @@ public:
 	VBO();
 
 	void Create			(GLenum target, GLenum usage, GLsizeiptr size, const void* data=nullptr);
+	bool CreateMapped	(GLenum target, GLsizeiptr size);			// immutable storage, persistently mapped for writing. False if not supported
+	void* GetMapping	();											// null unless created with CreateMapped()
+	void* MapRange		(GLintptr offset, GLsizeiptr size);		// unsynchronized, the caller makes sure the gpu is done with the range
+	void Unmap			();
 	void BufferSubData	(GLintptr offset, GLsizeiptr size, const GLvoid* data);
 	bool AppendData		(GLsizeiptr size, const GLvoid* data);
 	void Reset			();		// don't delete data, just go back to start
@@ -25,6 +29,7 @@ public:
 
 private:
 	GLuint	m_id;
+	void*	m_mapping;
 	GLenum	m_target;
 	int		m_capacity;
 	int		m_size;
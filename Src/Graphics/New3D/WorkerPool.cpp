@@ -0,0 +1,114 @@
+#include "WorkerPool.h"
+#include <algorithm>
+
+namespace New3D {
+
+static const size_t kBatchSize = 16;		// items claimed per trip to the shared counter
+
+WorkerPool::WorkerPool(unsigned numThreads)
+	: m_func(nullptr),
+	  m_count(0),
+	  m_next(0),
+	  m_generation(0),
+	  m_busy(0),
+	  m_exit(false)
+{
+	for (unsigned i = 0; i < numThreads; i++) {
+		m_threads.emplace_back(&WorkerPool::Run, this, i + 1);
+	}
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_exit = true;
+	}
+
+	m_wake.notify_all();
+
+	for (auto& t : m_threads) {
+		t.join();
+	}
+}
+
+void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t, unsigned)>& func)
+{
+	if (count == 0) {
+		return;
+	}
+
+	// not worth waking anyone for a single batch
+	if (m_threads.empty() || count <= kBatchSize) {
+		for (size_t i = 0; i < count; i++) {
+			func(i, 0);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_func	= &func;
+		m_count	= count;
+		m_next	= 0;
+		m_busy	= (unsigned)m_threads.size();
+		m_generation++;
+	}
+
+	m_wake.notify_all();
+
+	Work(0);
+
+	// func and the items it writes to belong to the caller, so wait for everyone to let go
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this] { return m_busy == 0; });
+	m_func = nullptr;
+}
+
+void WorkerPool::Work(unsigned thread)
+{
+	for (;;) {
+
+		size_t start = m_next.fetch_add(kBatchSize);
+
+		if (start >= m_count) {
+			break;
+		}
+
+		size_t end = std::min(start + kBatchSize, m_count);
+
+		for (size_t i = start; i < end; i++) {
+			(*m_func)(i, thread);
+		}
+	}
+}
+
+void WorkerPool::Run(unsigned thread)
+{
+	unsigned generation = 0;
+
+	for (;;) {
+
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [&] { return m_exit || m_generation != generation; });
+
+			if (m_exit) {
+				return;
+			}
+
+			generation = m_generation;
+		}
+
+		Work(thread);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_busy--;
+		}
+
+		m_done.notify_one();
+	}
+}
+
+} // New3D
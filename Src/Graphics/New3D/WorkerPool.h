@@ -0,0 +1,49 @@
+#ifndef _WORKERPOOL_H_
+#define _WORKERPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace New3D {
+
+// Small fixed set of threads for splitting per-frame scene work. The calling thread
+// always takes part, so a pool of N threads runs N+1 tasks at once.
+class WorkerPool
+{
+public:
+	WorkerPool(unsigned numThreads);
+	~WorkerPool();
+
+	// Calls func(i, thread) for every i in [0, count) and returns once all calls have finished.
+	// thread is 0 for the calling thread and 1..NumThreads() for the workers, for picking
+	// per-thread scratch data. Indices are handed out in small batches from a shared counter,
+	// so threads that finish early keep pulling work from the ones stuck on expensive items.
+	void ParallelFor(size_t count, const std::function<void(size_t, unsigned)>& func);
+
+	unsigned NumThreads() const { return (unsigned)m_threads.size(); }
+
+private:
+	void Run(unsigned thread);
+	void Work(unsigned thread);
+
+	std::vector<std::thread>	m_threads;
+	std::mutex					m_mutex;
+	std::condition_variable		m_wake;			// new batch of work or exit
+	std::condition_variable		m_done;			// a worker has left the current batch
+
+	const std::function<void(size_t, unsigned)>* m_func;
+	size_t						m_count;
+	std::atomic<size_t>			m_next;
+	unsigned					m_generation;	// bumped for every ParallelFor() call
+	unsigned					m_busy;			// workers still inside the current batch
+	bool						m_exit;
+};
+
+} // New3D
+
+#endif
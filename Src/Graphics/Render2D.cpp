@@ -277,6 +277,7 @@
 #include "Render2D.h"
 
 #include "Supermodel.h"
+#include "TileRaster.h"
 #include "Shader.h"
 #include "Shaders2D.h" // fragment and vertex shaders
 
@@ -293,128 +294,22 @@
 #define FRAGMENT_2D_SHADER_FILE "Src/Graphics/Fragment2D.glsl"
 
 
-/******************************************************************************
- Layer Rendering
-
- This code is quite slow and badly needs to be optimized. Dirty rectangles
- should be implemented first and tile pre-decoding second.
-******************************************************************************/
-
-template <int bits, bool alphaTest, bool clip>
-static inline void DrawTileLine(uint32_t *line, int pixelOffset, uint16_t tile, int patternLine, const uint32_t *vram, const uint32_t *palette, uint16_t mask)
+// A surface line has to be redrawn if it changed in any of the layers drawn to it
+void CRender2D::GetSurfaceDirtyLines(uint8_t *lines, unsigned layers, bool all)
 {
-  static_assert(bits == 4 || bits == 8, "Tiles are either 4- or 8-bit");
-
-  // For 8-bit pixels, each line of tile pattern is two words
-  if (bits == 8)
-    patternLine *= 2;
-
-  // Compute offset of pattern for this line
-  int patternOffset;
-  if (bits == 4)
+  if (all || !m_dirtyLines)
   {
-    patternOffset = ((tile & 0x3FFF) << 1) | ((tile >> 15) & 1);
-    patternOffset *= 32;
-    patternOffset /= 4;
+    memset(lines, 1, 384);
+    return;
   }
-  else
-  {
-    patternOffset = tile & 0x3FFF;
-    patternOffset *= 64;
-    patternOffset /= 4;
-  }
-
-  // Name table entry provides high color bits
-  uint32_t colorHi = tile & ((bits == 4) ? 0x7FF0 : 0x7F00);
-
-  // Draw
-  if (bits == 4)
-  {
-    uint32_t pattern = vram[patternOffset + patternLine];
-    for (int p = 7; p >= 0; p--)
-    {
-      if (!clip || (/*pixelOffset >= 0 &&*/ (unsigned int)pixelOffset < 496u)) // the >= 0 check is accounted for, as the cast to uint makes them appear as very large unsigned values
-      {
-        uint16_t maskTest = 1 << (15-((pixelOffset+0)/32));
-        bool visible = (mask & maskTest) != 0;
-        uint32_t pixel = visible ? palette[((pattern >> (p*4)) & 0xF) | colorHi] : 0;
-        if (!alphaTest || (visible && (pixel >> 24) != 0))  // only draw opaque pixels
-            line[pixelOffset] = pixel;
-      }
-      ++pixelOffset;
-    }
-  }
-  else
-  {
-    for (int i = 0; i < 2; i++) // 4 pixels per word
-    {
-      uint32_t pattern = vram[patternOffset + patternLine + i];
-      for (int p = 3; p >= 0; p--)
-      {
-        if (!clip || (/*pixelOffset >= 0 &&*/ (unsigned int)pixelOffset < 496u)) // the >= 0 check is accounted for, as the cast to uint makes them appear as very large unsigned values
-        {
-          uint16_t maskTest = 1 << (15-((pixelOffset+0)/32));
-          bool visible = (mask & maskTest) != 0;
-          uint32_t pixel = visible ? palette[((pattern >> (p*8)) & 0xFF) | colorHi] : 0;
-          if (!alphaTest || (visible && (pixel >> 24) != 0))
-              line[pixelOffset] = pixel;
-        }
-        ++pixelOffset;
-      }
-    }
-  }
-}
-
-template <int bits, bool alphaTest>
-static void DrawLayer(uint32_t *pixels, int layerNum, const uint32_t *vram, const uint32_t *regs, const uint32_t *palette)
-{
-  const uint16_t *nameTableBase = (const uint16_t *) &vram[(0xF8000 + layerNum * 0x2000) / 4];
-  const uint16_t *hScrollTable = (const uint16_t *) &vram[(0xF6000 + layerNum * 0x400) / 4];
-  bool lineScrollMode = (regs[0x60/4 + layerNum] & 0x8000) != 0;
-  int hFullScroll = regs[0x60/4 + layerNum] & 0x3FF;
-  int vScroll = (regs[0x60/4 + layerNum] >> 16) & 0x1FF;
-
-  const uint16_t  *maskTable = (const uint16_t *) &vram[0xF7000 / 4];
-  if (layerNum < 2) // little endian: layers A and A' use second word in each pair
-    maskTable += 1;
-
-  // If mask bit is clear, alternate layer is shown. We want to test for non-
-  // zero, so we flip the mask when drawing alternate layers (layers 1 and 3).
-  const uint16_t maskPolarity = (layerNum & 1) ? 0xFFFF : 0x0000;
-
-  uint32_t *line = pixels;
-
-  for (int y = 0; y < 384; y++)
+  memset(lines, 0, 384);
+  for (int layerNum = 0; layerNum < 4; layerNum++)
   {
-    int hScroll = (lineScrollMode ? hScrollTable[y] : hFullScroll) & 0x1FF;
-    int hTile = hScroll / 8;
-    int hFine = hScroll & 7;        // horizontal pixel offset within tile line
-    int vFine = (y + vScroll) & 7;  // vertical pixel offset within 8x8 tile
-    const uint16_t *nameTable = &nameTableBase[(64 * ((y + vScroll) / 8)) & 0xFFF]; // clamp to 64x64 = 0x1000
-    uint16_t mask = *maskTable ^ maskPolarity;  // each bit covers 32 pixels
-
-    int pixelOffset = -hFine;
-    int extraTile = (hFine != 0) ? 1 : 0; // h-scrolling requires part of 63rd tile
-
-    // First tile may be clipped
-    DrawTileLine<bits, alphaTest, true>(line, pixelOffset, nameTable[(hTile ^ 1) & 63], vFine, vram, palette, mask);
-    ++hTile;
-    pixelOffset += 8;
-    // Middle tiles will not be clipped
-    for (int tx = 1; tx < (62 - 1 + extraTile); tx++)
+    if (layers & (1 << layerNum))
     {
-      DrawTileLine<bits, alphaTest, false>(line, pixelOffset, nameTable[(hTile ^ 1) & 63], vFine, vram, palette, mask);
-      ++hTile;
-      pixelOffset += 8;
+      for (int y = 0; y < 384; y++)
+        lines[y] |= m_dirtyLines[layerNum * 384 + y];
     }
-    // Last tile may be clipped
-    DrawTileLine<bits, alphaTest, true>(line, pixelOffset, nameTable[(hTile ^ 1) & 63], vFine, vram, palette, mask);
-    ++hTile;
-    pixelOffset += 8;
-
-    // Advance one line
-    maskTable += 2;
-    line += 496;
   }
 }
 
@@ -422,6 +317,12 @@ std::pair<bool, bool> CRender2D::DrawTilemaps(uint32_t *pixelsBottom, uint32_t *
 {
   unsigned priority = (m_regs[0x20/4] >> 8) & 0xF;
 
+  // Work out which lines have to be redrawn. A change to the layer setup marks
+  // the affected layers as a whole, so only the selected layers matter here.
+  GetSurfaceDirtyLines(m_bottomDirty, ~priority & 0xF, !m_surfacesValid);
+  GetSurfaceDirtyLines(m_topDirty, priority, !m_surfacesValid);
+  m_surfacesValid = true;
+
   // Render bottom layers
   bool noBottomSurface = true;
   static const int bottomOrder[4] = { 3, 2, 1, 0 };
@@ -433,20 +334,8 @@ std::pair<bool, bool> CRender2D::DrawTilemaps(uint32_t *pixelsBottom, uint32_t *
     bool selected = (priority & (1 << layerNum)) == 0;
     if (enabled && selected)
     {
-      if (noBottomSurface)
-      {
-        if (is4Bit)
-          DrawLayer<4, false>(pixelsBottom, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-        else
-          DrawLayer<8, false>(pixelsBottom, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-      }
-      else
-      {
-        if (is4Bit)
-          DrawLayer<4, true>(pixelsBottom, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-        else
-          DrawLayer<8, true>(pixelsBottom, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-      }
+      // Layers drawn over another one only draw their opaque pixels
+      TileRaster::DrawLayer(pixelsBottom, layerNum, is4Bit, !noBottomSurface, false, m_vram, m_regs, m_palette[layerNum / 2], m_bottomDirty);
       noBottomSurface = false;
     }
   }
@@ -465,20 +354,8 @@ std::pair<bool, bool> CRender2D::DrawTilemaps(uint32_t *pixelsBottom, uint32_t *
     bool selected = (priority & (1 << layerNum)) != 0;
     if (enabled && selected)
     {
-      if (noTopSurface)
-      {
-        if (is4Bit)
-          DrawLayer<4, false>(pixelsTop, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-        else
-          DrawLayer<8, false>(pixelsTop, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-      }
-      else
-      {
-        if (is4Bit)
-          DrawLayer<4, true>(pixelsTop, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-        else
-          DrawLayer<8, true>(pixelsTop, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-      }
+      // Layers drawn over another one only draw their opaque pixels
+      TileRaster::DrawLayer(pixelsTop, layerNum, is4Bit, !noTopSurface, false, m_vram, m_regs, m_palette[layerNum / 2], m_topDirty);
       noTopSurface = false;
     }
   }
@@ -545,21 +422,44 @@ void CRender2D::BeginFrame(void)
 {
 }
 
+// Uploads each run of redrawn lines
+void CRender2D::UploadSurface(GLuint texID, const uint32_t *pixels, const uint8_t *lines)
+{
+  glBindTexture(GL_TEXTURE_2D, texID);
+  int y = 0;
+  while (y < 384)
+  {
+    if (!lines[y])
+    {
+      ++y;
+      continue;
+    }
+    int firstLine = y;
+    while (y < 384 && lines[y])
+      ++y;
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, firstLine, 496, y - firstLine, GL_RGBA, GL_UNSIGNED_BYTE, &pixels[firstLine * 496]);
+  }
+}
+
 void CRender2D::PreRenderFrame(void)
 {
-  // Update all layers
+  DrawSurfaces();
+  UploadSurfaces();
+}
+
+void CRender2D::DrawSurfaces(void)
+{
+  // Update modified lines of all layers
   m_surfaces_present = DrawTilemaps(m_bottomSurface, m_topSurface);
+}
+
+void CRender2D::UploadSurfaces(void)
+{
   glActiveTexture(GL_TEXTURE0); // texture unit 0
   if (m_surfaces_present.first)
-  {
-    glBindTexture(GL_TEXTURE_2D, m_texID[0]);
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 496, 384, GL_RGBA, GL_UNSIGNED_BYTE, m_topSurface);
-  }
+    UploadSurface(m_texID[0], m_topSurface, m_topDirty);
   if (m_surfaces_present.second)
-  {
-    glBindTexture(GL_TEXTURE_2D, m_texID[1]);
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 496, 384, GL_RGBA, GL_UNSIGNED_BYTE, m_bottomSurface);
-  }
+    UploadSurface(m_texID[1], m_bottomSurface, m_bottomDirty);
 }
 
 void CRender2D::RenderFrameBottom(void)
@@ -619,6 +519,13 @@ void CRender2D::AttachVRAM(const uint8_t *vramPtr)
   DebugLog("Render2D attached VRAM\n");
 }
 
+void CRender2D::AttachDirtyLines(const uint8_t *dirtyPtr)
+{
+  m_dirtyLines = dirtyPtr;
+  m_surfacesValid = false;
+  DebugLog("Render2D attached dirty lines\n");
+}
+
 // Memory pool and offsets within it
 #define MEMORY_POOL_SIZE      (2*512*384*4)
 #define OFFSET_TOP_SURFACE    0             // 512*384*4 bytes
@@ -640,6 +547,7 @@ bool CRender2D::Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned
   if (NULL == m_memoryPool)
     return ErrorLog("Insufficient memory for tilemap surfaces (need %1.1f MB).", float(MEMORY_POOL_SIZE) / 0x100000);
   memset(m_memoryPool, 0, MEMORY_POOL_SIZE);  // clear textures
+  m_surfacesValid = false;
 
   // Set up pointers to memory regions
   m_topSurface    = (uint32_t *) &m_memoryPool[OFFSET_TOP_SURFACE];
@@ -653,6 +561,7 @@ bool CRender2D::Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned
   m_totalXPixels = totalXRes;
   m_totalYPixels = totalYRes;
   m_correction = (UINT32)(((yRes / 384.f) * 2) + 0.5f);		// for some reason the 2d layer is 2 pixels off the 3D
+  InfoLog("Tilemap rasterizer: %s", TileRaster::GetKernelName(TileRaster::GetKernel()));
 
   // Create textures
   glActiveTexture(GL_TEXTURE0); // texture unit 0
@@ -45,12 +45,15 @@ public:
 
   void BeginFrame(void);
   void PreRenderFrame(void);
+  void DrawSurfaces(void);
+  void UploadSurfaces(void);  // nothing to do, the surfaces are composited on the CPU
   void RenderFrameBottom(void);
   void RenderFrameTop(void);
   void EndFrame(void);
   void AttachVRAM(const uint8_t *vramPtr);
   void AttachPalette(const uint32_t *palPtr[2]);
   void AttachRegisters(const uint32_t *regPtr);
+  void AttachDirtyLines(const uint8_t *dirtyPtr);
   bool Init(unsigned xOffset, unsigned yOffset, unsigned xRes, unsigned yRes, unsigned totalXRes, unsigned totalYRes);
 
   const uint32_t* GetFrameBufferARGB() const { return m_frame.data(); }
@@ -62,12 +65,14 @@ public:
 
 private:
   std::pair<bool, bool> DrawTilemaps(uint32_t *pixelsBottom, uint32_t *pixelsTop);
+  void GetSurfaceDirtyLines(uint8_t *lines, unsigned layers, bool all);
   void CompositeTopOntoFrame();
 
   const Util::Config::Node &m_config;
   const uint32_t *m_vram = nullptr;
   const uint32_t *m_palette[2] = { nullptr, nullptr };
   const uint32_t *m_regs = nullptr;
+  const uint8_t *m_dirtyLines = nullptr; // 4 layers x 384 lines
 
   unsigned m_xPixels = 496;
   unsigned m_yPixels = 384;
@@ -76,6 +81,9 @@ private:
   std::vector<uint32_t> m_bottomSurface;
   std::vector<uint32_t> m_frame;
   std::pair<bool, bool> m_surfacesPresent{false, false}; // top, bottom
+  bool m_surfacesValid = false; // false until the surfaces have been drawn in full
+  uint8_t m_topDirty[384];
+  uint8_t m_bottomDirty[384];
 };
 
 #else
@@ -111,6 +119,17 @@ public:
    */
   void PreRenderFrame(void);
 
+  /*
+   * DrawSurfaces(void):
+   * UploadSurfaces(void):
+   *
+   * The two halves of PreRenderFrame(). DrawSurfaces() makes no GL calls and
+   * only updates the surfaces in memory. UploadSurfaces() sends the lines it
+   * redrew to the GPU and must be called before the next DrawSurfaces().
+   */
+  void DrawSurfaces(void);
+  void UploadSurfaces(void);
+
   /*
    * RenderFrameBottom(void):
    *
@@ -189,6 +208,19 @@ public:
    */
   void AttachVRAM(const uint8_t *vramPtr);
 
+  /*
+   * AttachDirtyLines(dirtyPtr):
+   *
+   * Attaches the tile generator's list of modified lines. Only those lines
+   * of each surface are redrawn and uploaded. Without it, everything is
+   * redrawn every frame.
+   *
+   * Parameters:
+   *    dirtyPtr  4 layers x 384 lines of flags, non-zero if the line has
+   *              to be redrawn. Must remain valid while attached.
+   */
+  void AttachDirtyLines(const uint8_t *dirtyPtr);
+
   /*
    * Init(xOffset, yOffset, xRes, yRes, totalXRes, totalYRes);
    *
@@ -226,6 +258,8 @@ public:
 private:
   // Private member functions
   std::pair<bool, bool> DrawTilemaps(uint32_t *destBottom, uint32_t *destTop);
+  void GetSurfaceDirtyLines(uint8_t *lines, unsigned layers, bool all);
+  void UploadSurface(GLuint texID, const uint32_t *pixels, const uint8_t *lines);
   void DisplaySurface(int surface);
   void Setup2D(bool isBottom);
       
@@ -236,6 +270,7 @@ private:
   const uint32_t *m_vram;
   const uint32_t *m_palette[2]; // palettes for A/A' and B/B'
   const uint32_t *m_regs;
+  const uint8_t  *m_dirtyLines = nullptr; // 4 layers x 384 lines
   
   // OpenGL data
   GLuint    m_texID[2];       // IDs for the 2 layer textures (top and bottom)
@@ -253,9 +288,14 @@ private:
   GLuint m_fragmentShader;  // fragment shader
   GLuint m_textureMapLoc;   // location of "textureMap" uniform
 
-  // PreRenderFrame() tracks which surfaces exist in current frame
+  // DrawSurfaces() tracks which surfaces exist in current frame
   std::pair<bool, bool> m_surfaces_present = std::pair<bool, bool>(false, false);
 
+  // Lines of each surface redrawn this frame
+  bool      m_surfacesValid = false;  // false until the surfaces have been drawn in full
+  uint8_t   m_topDirty[384];
+  uint8_t   m_bottomDirty[384];
+
   // Buffers
   uint8_t   *m_memoryPool = 0;    // all memory is allocated here
   uint32_t  *m_topSurface = 0;    // 512x384x32bpp pixel surface for top layers
@@ -0,0 +1,75 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2012 Bart Trzynadlowski, Nik Henson
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * TileRaster.h
+ *
+ * Software rasterizer for the tile generator's tilemap layers. Shared by the
+ * OpenGL (Render2D.cpp) and Android (render2d_android.cpp) front ends.
+ */
+
+#ifndef INCLUDED_TILERASTER_H
+#define INCLUDED_TILERASTER_H
+
+#include <cstdint>
+
+namespace TileRaster
+{
+  // Kernels used for the unclipped tiles of each line. The scalar kernel is
+  // the reference implementation and is always available.
+  enum class Kernel
+  {
+    Scalar,
+    SSE41,
+    AVX2,
+    NEON
+  };
+
+  // Fastest kernel supported by this CPU
+  Kernel GetBestKernel();
+
+  // Kernel used by DrawLayer(). Returns false (and leaves the current kernel
+  // in place) if the CPU does not support the one requested.
+  bool SetKernel(Kernel kernel);
+  Kernel GetKernel();
+  const char *GetKernelName(Kernel kernel);
+
+  /*
+   * DrawLayer():
+   *
+   * Draws one 496x384 tilemap layer.
+   *
+   * Parameters:
+   *    pixels    Output surface, 496x384 32-bit pixels.
+   *    layerNum  Layer number (0-3).
+   *    is4Bit    4-bit tiles if true, otherwise 8-bit.
+   *    alphaTest Only draw opaque pixels (layers drawn over another one).
+   *    argb      Convert palette entries (little endian RGBA) to 0xAARRGGBB.
+   *    vram      Tile generator VRAM.
+   *    regs      Tile generator registers.
+   *    palette   Palette for this layer pair.
+   *    lines     Optional, 384 flags. Only lines whose flag is non-zero are
+   *              drawn, the rest of the surface is left untouched.
+   */
+  void DrawLayer(uint32_t *pixels, int layerNum, bool is4Bit, bool alphaTest, bool argb, const uint32_t *vram, const uint32_t *regs, const uint32_t *palette, const uint8_t *lines = nullptr);
+} // TileRaster
+
+#endif  // INCLUDED_TILERASTER_H
@@ -203,6 +203,11 @@ bool CInput::Configure(bool append, const char *escapeMapping)
 	return true;
 }
 
+bool CInput::Sample(UINT16 &sampledValue)
+{
+	return false;
+}
+
 bool CInput::Changed()
 {
 	return value != prevValue;
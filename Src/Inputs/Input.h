@@ -189,6 +189,12 @@ public:
 	 */
 	virtual void Poll() = 0;
 
+	/*
+	 * Reads what the input's value would be if it were polled now, without changing its state, so that it can be sampled more often than
+	 * once per frame. Returns false for inputs whose value depends on their previous values or on other inputs, which can't be sampled.
+	 */
+	virtual bool Sample(UINT16 &sampledValue);
+
 	/*
 	 * Returns true if the value of this input changed during the last poll.
 	 */
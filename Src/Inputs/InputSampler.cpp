@@ -0,0 +1,191 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2021 Bart Trzynadlowski, Nik Henson, Ian Curtis,
+ **                     Harry Tuttle, and Spindizzi
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * InputSampler.cpp
+ *
+ * Implementation of CInputSampler.
+ *
+ * The buffers are handed around as in any triple buffer: the producer fills
+ * its own buffer and swaps it with the shared one, marking that fresh, and the
+ * consumer swaps its buffer with the shared one only when it is fresh. Neither
+ * side ever touches a buffer the other one holds, so the consumer always sees
+ * a complete sample and the producer never waits for it.
+ */
+
+#include "InputSampler.h"
+
+#include "Supermodel.h"
+#include "Input.h"
+#include "InputSystem.h"
+#include <algorithm>
+#include <chrono>
+
+uint64_t CInputSampler::Now()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool CInputSampler::Start(CInputSystem *system, const std::vector<CInput *> &inputs, unsigned rateHz, const std::string &name)
+{
+	Stop();
+	if (rateHz == 0 || inputs.empty() || !system->RefreshDevices())
+		return FAIL;
+
+	m_system = system;
+	m_inputs = inputs;
+	m_name = name;
+	m_polled.resize(m_inputs.size());
+	for (size_t i = 0; i < m_inputs.size(); i++)
+		m_polled[i] = m_inputs[i]->value;
+	for (Sample &sample: m_samples)
+	{
+		sample.time = 0;
+		sample.pollTime = 0;
+		sample.values = m_polled;
+	}
+	m_back = 0;
+	m_shared.store(1, std::memory_order_relaxed);
+	m_front = 2;
+	m_pollTime = 0;
+
+	m_reads = 0;
+	m_samplesApplied = 0;
+	m_totalAgeUS = 0;
+	m_maxAgeUS = 0;
+	m_totalPollAgeUS = 0;
+
+	m_stop.store(false, std::memory_order_relaxed);
+	m_running.store(true, std::memory_order_relaxed);
+	m_thread = std::thread(&CInputSampler::ThreadProc, this, rateHz);
+	return OKAY;
+}
+
+void CInputSampler::Stop()
+{
+	if (!Running())
+		return;
+	m_stop.store(true, std::memory_order_relaxed);
+	m_thread.join();
+	m_running.store(false, std::memory_order_relaxed);
+
+	if (m_reads > 0)
+		InfoLog("Input latency (%s): %llu port reads, newest sample %.2f ms old on average (%.2f ms at most) against %.2f ms for the last poll, %llu samples used.",
+			m_name.c_str(), (unsigned long long) m_reads, m_totalAgeUS / m_reads / 1e3, m_maxAgeUS / 1e3, m_totalPollAgeUS / m_reads / 1e3,
+			(unsigned long long) m_samplesApplied);
+}
+
+void CInputSampler::Publish(uint64_t time)
+{
+	Sample &sample = m_samples[m_back];
+	sample.time = time;
+	sample.pollTime = m_pollTime;
+	m_back = m_shared.exchange(m_back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+}
+
+void CInputSampler::BeginPoll()
+{
+	if (!Running())
+		return;
+	m_mutex.lock();
+	for (size_t i = 0; i < m_inputs.size(); i++)
+		m_inputs[i]->value = m_polled[i];
+}
+
+void CInputSampler::EndPoll()
+{
+	if (!Running())
+		return;
+	m_pollTime = Now();
+	for (size_t i = 0; i < m_inputs.size(); i++)
+		m_polled[i] = m_inputs[i]->value;
+	m_samples[m_back].values = m_polled;
+	Publish(m_pollTime);
+	m_mutex.unlock();
+}
+
+void CInputSampler::Apply()
+{
+	if (!Running())
+		return;
+
+	if (m_shared.load(std::memory_order_relaxed) & FRESH)
+	{
+		m_front = m_shared.exchange(m_front, std::memory_order_acq_rel) & INDEX_MASK;
+		const std::vector<UINT16> &values = m_samples[m_front].values;
+		for (size_t i = 0; i < m_inputs.size(); i++)
+			m_inputs[i]->value = values[i];
+		m_samplesApplied++;
+	}
+
+	const Sample &sample = m_samples[m_front];
+	if (sample.pollTime == 0)
+		return;
+	uint64_t now = Now();
+	double ageUS = (now - sample.time) / 1e3;
+	m_reads++;
+	m_totalAgeUS += ageUS;
+	m_maxAgeUS = std::max(m_maxAgeUS, ageUS);
+	m_totalPollAgeUS += (now - sample.pollTime) / 1e3;
+}
+
+void CInputSampler::ThreadProc(unsigned rateHz)
+{
+	const std::chrono::nanoseconds period(1000000000 / rateHz);
+	auto next = std::chrono::steady_clock::now();
+	while (!m_stop.load(std::memory_order_relaxed))
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_system->RefreshDevices();
+			std::vector<UINT16> &values = m_samples[m_back].values;
+			for (size_t i = 0; i < m_inputs.size(); i++)
+				m_inputs[i]->Sample(values[i]);
+			Publish(Now());
+		}
+
+		// If sampling fell behind, carry on from now rather than catching up
+		next = std::max(next + period, std::chrono::steady_clock::now());
+		std::this_thread::sleep_until(next);
+	}
+}
+
+CInputSampler::CInputSampler()
+	: m_system(NULL),
+	  m_back(0),
+	  m_shared(1),
+	  m_front(2),
+	  m_pollTime(0),
+	  m_running(false),
+	  m_stop(false),
+	  m_reads(0),
+	  m_samplesApplied(0),
+	  m_totalAgeUS(0),
+	  m_maxAgeUS(0),
+	  m_totalPollAgeUS(0)
+{
+}
+
+CInputSampler::~CInputSampler()
+{
+	Stop();
+}
@@ -0,0 +1,141 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2021 Bart Trzynadlowski, Nik Henson, Ian Curtis,
+ **                     Harry Tuttle, and Spindizzi
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * InputSampler.h
+ *
+ * Sub-frame input sampling. CInputs::Poll() updates every input once per host
+ * frame, but games read their input ports wherever they happen to be in the
+ * frame, often late, after the VBlank work. The sampler re-reads the inputs
+ * that can be sampled on its own thread at a fixed rate and publishes each set
+ * of values with its time through a lock-free triple buffer, from which the
+ * emulated CPU takes the newest set when it reads an input port.
+ */
+
+#ifndef INCLUDED_INPUTSAMPLER_H
+#define INCLUDED_INPUTSAMPLER_H
+
+#include "Types.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class CInputSystem;
+class CInput;
+
+class CInputSampler
+{
+public:
+	/*
+	 * Start(system, inputs, rateHz, name):
+	 *
+	 * Starts sampling the given inputs, which must all support
+	 * CInput::Sample(). The name is used when logging latency statistics.
+	 *
+	 * Returns:
+	 *		OKAY if the sampling thread is running, FAIL if the input system
+	 *		can't be sampled between polls.
+	 */
+	bool Start(CInputSystem *system, const std::vector<CInput *> &inputs, unsigned rateHz, const std::string &name);
+
+	/*
+	 * Stop():
+	 *
+	 * Stops the sampling thread and logs how old the values served to the
+	 * emulated CPU were. Must not be called while the CPU is running.
+	 */
+	void Stop();
+
+	bool Running() const
+	{
+		return m_running.load(std::memory_order_relaxed);
+	}
+
+	/*
+	 * BeginPoll():
+	 * EndPoll():
+	 *
+	 * Bracket CInputs::Poll(). Sampling is held off in between, inputs get
+	 * back the values of their last poll before being polled again (so that
+	 * Pressed() and Released() still compare one frame with the next) and
+	 * the result of the poll is published as the newest sample.
+	 */
+	void BeginPoll();
+	void EndPoll();
+
+	/*
+	 * Apply():
+	 *
+	 * Called by the emulated CPU when it reads an input port. Copies the
+	 * newest sample into the inputs, if there is a newer one than last time,
+	 * and records its age. Never blocks.
+	 */
+	void Apply();
+
+	CInputSampler();
+	~CInputSampler();
+
+private:
+	// Triple buffer indices: the low bits select a buffer, FRESH is set when the shared buffer hasn't been taken yet
+	static const unsigned INDEX_MASK = 3;
+	static const unsigned FRESH = 4;
+
+	struct Sample
+	{
+		uint64_t time = 0;        // when the inputs were read (ns, steady clock)
+		uint64_t pollTime = 0;    // when they were last polled, for comparison
+		std::vector<UINT16> values;
+	};
+
+	static uint64_t Now();
+	void Publish(uint64_t time);
+	void ThreadProc(unsigned rateHz);
+
+	CInputSystem          *m_system;
+	std::vector<CInput *> m_inputs;
+	std::string           m_name;
+
+	// Producers (sampling thread and CInputs::Poll()) take turns with the mutex, the consumer never waits
+	std::mutex            m_mutex;
+	Sample                m_samples[3];
+	unsigned              m_back;         // producer's buffer
+	std::atomic<unsigned> m_shared;       // buffer passed between producer and consumer, and FRESH
+	unsigned              m_front;        // consumer's buffer
+	std::vector<UINT16>   m_polled;       // values from the last poll
+	uint64_t              m_pollTime;
+
+	std::thread           m_thread;
+	std::atomic<bool>     m_running;
+	std::atomic<bool>     m_stop;
+
+	// Statistics, only touched by the consumer until Stop()
+	uint64_t              m_reads;
+	uint64_t              m_samplesApplied;
+	double                m_totalAgeUS;
+	double                m_maxAgeUS;
+	double                m_totalPollAgeUS;
+};
+
+#endif	// INCLUDED_INPUTSAMPLER_H
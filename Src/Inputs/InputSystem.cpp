@@ -1815,6 +1815,11 @@ Finish:
   return !cancelled;
 }
 
+bool CInputSystem::RefreshDevices()
+{
+  return false;
+}
+
 void CInputSystem::GrabMouse()
 {
   m_grabMouse = true;
@@ -841,6 +841,12 @@ public:
    */
   virtual bool Poll() = 0;
 
+  /*
+   * Updates whatever device state can safely be updated from a thread other than the one that calls Poll(), for sampling inputs
+   * between polls. Returns false if the input system has no such state, in which case its inputs are only updated by Poll().
+   */
+  virtual bool RefreshDevices();
+
   virtual void GrabMouse();
 
   virtual void UngrabMouse();
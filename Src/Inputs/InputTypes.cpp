@@ -50,6 +50,16 @@ void CSwitchInput::Poll()
 		value = m_offVal;
 }
 
+bool CSwitchInput::Sample(UINT16 &sampledValue)
+{
+	bool boolValue = false;
+	if (m_source != NULL && m_source->GetValueAsSwitch(boolValue))
+		sampledValue = (boolValue ? m_onVal : m_offVal);
+	else
+		sampledValue = m_offVal;
+	return true;
+}
+
 bool CSwitchInput::Pressed()
 {
 	return prevValue == m_offVal && value == m_onVal;
@@ -85,14 +95,34 @@ void CAnalogInput::Poll()
 		value = m_minVal;
 }
 
+bool CAnalogInput::Sample(UINT16 &sampledValue)
+{
+	int intValue = m_minVal;
+	if (m_source != NULL && m_source->GetValueAsAnalog(intValue, m_minVal, m_minVal, m_maxVal))
+		sampledValue = intValue;
+	else
+		sampledValue = m_minVal;
+	return true;
+}
+
 bool CAnalogInput::HasValue()
 {
-	return value > m_minVal;
+	return HasValue(value);
+}
+
+bool CAnalogInput::HasValue(UINT16 inputValue)
+{
+	return inputValue > m_minVal;
 }
 
 double CAnalogInput::ValueAsFraction()
 {
-	double frac = (double)(value - m_minVal)/(double)(m_maxVal - m_minVal);
+	return ValueAsFraction(value);
+}
+
+double CAnalogInput::ValueAsFraction(UINT16 inputValue)
+{
+	double frac = (double)(inputValue - m_minVal)/(double)(m_maxVal - m_minVal);
 	return (frac >= 0.0 ? frac : -frac);
 }
 
@@ -114,26 +144,45 @@ void CAxisInput::Poll()
 	// Try getting value from analog inputs that represent negative and positive range of the axis first and then try the default input source
 	int intValue = value;
 	if ((m_negInput != NULL && m_negInput->HasValue()) || (m_posInput != NULL && m_posInput->HasValue()))
-	{
-		if (m_maxVal > m_minVal)
-		{
-			value = m_offVal;
-			if (m_posInput != NULL) value += (int)(m_posInput->ValueAsFraction() * (double)(m_maxVal - m_offVal));
-			if (m_negInput != NULL) value -= (int)(m_negInput->ValueAsFraction() * (double)(m_offVal - m_minVal));
-		}
-		else
-		{ 
-			value = m_offVal;
-			if (m_posInput != NULL) value -= (int)(m_posInput->ValueAsFraction() * (double)(m_offVal - m_maxVal));
-			if (m_negInput != NULL) value += (int)(m_negInput->ValueAsFraction() * (double)(m_minVal - m_offVal));
-		}
-	}
+		value = ValueFromHalfAxes(m_negInput != NULL ? m_negInput->ValueAsFraction() : 0.0, m_posInput != NULL ? m_posInput->ValueAsFraction() : 0.0);
 	else if (m_source != NULL && m_source->GetValueAsAnalog(intValue, m_minVal, m_offVal, m_maxVal))
 		value = intValue;
 	else 
 		value = m_offVal;
 }
 
+bool CAxisInput::Sample(UINT16 &sampledValue)
+{
+	// Same as Poll() but with the analog inputs for the negative and positive ranges sampled too, rather than taken from their last poll
+	UINT16 negValue = 0, posValue = 0;
+	bool negHasValue = m_negInput != NULL && m_negInput->Sample(negValue) && m_negInput->HasValue(negValue);
+	bool posHasValue = m_posInput != NULL && m_posInput->Sample(posValue) && m_posInput->HasValue(posValue);
+	int intValue = m_offVal;
+	if (negHasValue || posHasValue)
+		sampledValue = ValueFromHalfAxes(m_negInput != NULL ? m_negInput->ValueAsFraction(negValue) : 0.0, m_posInput != NULL ? m_posInput->ValueAsFraction(posValue) : 0.0);
+	else if (m_source != NULL && m_source->GetValueAsAnalog(intValue, m_minVal, m_offVal, m_maxVal))
+		sampledValue = intValue;
+	else
+		sampledValue = m_offVal;
+	return true;
+}
+
+UINT16 CAxisInput::ValueFromHalfAxes(double negFrac, double posFrac)
+{
+	UINT16 axisValue = m_offVal;
+	if (m_maxVal > m_minVal)
+	{
+		axisValue += (int)(posFrac * (double)(m_maxVal - m_offVal));
+		axisValue -= (int)(negFrac * (double)(m_offVal - m_minVal));
+	}
+	else
+	{
+		axisValue -= (int)(posFrac * (double)(m_offVal - m_maxVal));
+		axisValue += (int)(negFrac * (double)(m_minVal - m_offVal));
+	}
+	return axisValue;
+}
+
 bool CAxisInput::HasValue()
 {
 	return value != m_offVal;
@@ -25,6 +25,8 @@ public:
 	 */
 	void Poll();
 
+	bool Sample(UINT16 &sampledValue);
+
 	/*
 	 * Returns true if the input was pressed during last update (ie currently on but previously off)
 	 */
@@ -55,15 +57,21 @@ public:
 	 */
 	void Poll();
 
+	bool Sample(UINT16 &sampledValue);
+
 	/*
-	 * Returns true if the input is currently activated
+	 * Returns true if the input is currently activated (or would be with the given value)
 	 */
 	bool HasValue();
 
+	bool HasValue(UINT16 inputValue);
+
 	/*
-	 * Returns current value as a fraction 0.0 to 1.0 of the full range
+	 * Returns current (or the given) value as a fraction 0.0 to 1.0 of the full range
 	 */
 	double ValueAsFraction();
+
+	double ValueAsFraction(UINT16 inputValue);
 };
 
 /*
@@ -82,6 +90,9 @@ private:
 	UINT16 m_minVal;
 	UINT16 m_offVal;
 	UINT16 m_maxVal;
+
+	// Value of the axis when the analog inputs for its negative and positive ranges are at the given fractions
+	UINT16 ValueFromHalfAxes(double negFrac, double posFrac);
 	
 public:
 	CAxisInput(const char *inputId, const char *inputLabel, unsigned inputGameFlags, const char *defaultMapping, CAnalogInput *negInput, CAnalogInput *posInput,
@@ -92,6 +103,8 @@ public:
 	 */
 	void Poll();
 
+	bool Sample(UINT16 &sampledValue);
+
 	/*
 	 * Returns true if the input is currently activated (ie axis is not centered)
 	 */
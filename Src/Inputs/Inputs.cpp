@@ -62,6 +62,7 @@ CInputs::CInputs(CInputSystem *system)
 	uiToggleFrLimit    = AddSwitchInput("UIToggleFrameLimit", "Toggle Frame Limiting", Game::INPUT_UI, "KEY_ALT+KEY_T");
 	uiDumpInpState     = AddSwitchInput("UIDumpInputState",   "Dump Input State",      Game::INPUT_UI, "KEY_ALT+KEY_U");
 	uiDumpTimings      = AddSwitchInput("UIDumpTimings",      "Dump Frame Timings",    Game::INPUT_UI, "KEY_ALT+KEY_O");
+	uiRewind           = AddSwitchInput("UIRewind",           "Rewind (hold)",         Game::INPUT_UI, "KEY_BACKSPACE");
 	//uiScreenshot       = AddSwitchInput("UIScreenShot",	      "Screenshot",            Game::INPUT_UI, "KEY_ALT+KEY_S");
 #ifdef SUPERMODEL_DEBUGGER
 	uiEnterDebugger    = AddSwitchInput("UIEnterDebugger",    "Enter Debugger",        Game::INPUT_UI, "KEY_ALT+KEY_B");
@@ -754,9 +755,15 @@ bool CInputs::Poll(const Game *game, unsigned dispX, unsigned dispY, unsigned di
 	// Update the input system with the current display geometry
 	m_system->SetDisplayGeom(dispX, dispY, dispW, dispH);
 
+	// Hold off sampling while polling
+	m_sampler.BeginPoll();
+
 	// Poll the input system
 	if (!m_system->Poll())
+	{
+		m_sampler.EndPoll();
 		return false;
+	}
 
 	// Poll all UI inputs and all the inputs used by the current game, or all inputs if game is NULL
 	uint32_t gameFlags = game ? game->inputs : Game::INPUT_ALL;
@@ -765,9 +772,38 @@ bool CInputs::Poll(const Game *game, unsigned dispX, unsigned dispY, unsigned di
 		if ((*it)->IsUIInput() || ((*it)->gameFlags & gameFlags))
 			(*it)->Poll();
 	}
+
+	m_sampler.EndPoll();
 	return true;
 }
 
+bool CInputs::StartSampling(const Game &game, unsigned rateHz)
+{
+	// Sample the game's own inputs that support it
+	vector<CInput*> sampled;
+	UINT16 sampledValue;
+	for (vector<CInput*>::iterator it = m_inputs.begin(); it != m_inputs.end(); ++it)
+	{
+		if ((*it)->IsUIInput() || !((*it)->gameFlags & game.inputs) || ((*it)->gameFlags & (Game::INPUT_GUN1 | Game::INPUT_GUN2)))
+			continue;
+		if ((*it)->Sample(sampledValue))
+			sampled.push_back(*it);
+	}
+
+	if (m_sampler.Start(m_system, sampled, rateHz, game.name) != OKAY)
+	{
+		InfoLog("Sub-frame input sampling is not available with the current input devices.");
+		return false;
+	}
+	InfoLog("Sampling %u inputs at %u Hz.", (unsigned)sampled.size(), rateHz);
+	return true;
+}
+
+void CInputs::StopSampling()
+{
+	m_sampler.Stop();
+}
+
 void CInputs::DumpState(const Game *game)
 {
 	// Print header
@@ -29,6 +29,7 @@
 #define INCLUDED_INPUTS_H
 
 #include "InputTypes.h"
+#include "InputSampler.h"
 #include "Types.h"
 #include "Util/NewConfig.h"
 #include <vector>
@@ -49,6 +50,9 @@ private:
   // Vector of all created inputs
   std::vector<CInput*> m_inputs;
 
+  // Sub-frame sampling of the current game's inputs
+  CInputSampler m_sampler;
+
   /*
    * Adds a switch input (eg button) to this collection.
    */ 
@@ -101,6 +105,7 @@ public:
   CSwitchInput  *uiToggleFrLimit;
   CSwitchInput  *uiDumpInpState;
   CSwitchInput  *uiDumpTimings;
+  CSwitchInput  *uiRewind;
   CSwitchInput  *uiScreenshot;
 #ifdef SUPERMODEL_DEBUGGER
   CSwitchInput  *uiEnterDebugger;
@@ -299,6 +304,27 @@ public:
    */
   bool Poll(const Game *game, unsigned dispX, unsigned dispY, unsigned dispW, unsigned dispH);
 
+  /*
+   * Starts sampling the inputs of the given game rateHz times a second on a separate thread, in between polls, so that the game can be
+   * given values newer than those of the last poll when it reads them (see ApplyLatestSample()). Only inputs that can be read without
+   * changing their state are sampled; virtual inputs and lightguns (whose positions are read a byte at a time) keep their polled values.
+   * Returns false if sampling is not possible with the current input system.
+   */
+  bool StartSampling(const Game &game, unsigned rateHz);
+
+  /*
+   * Stops sampling and logs the age of the values the game was given.
+   */
+  void StopSampling();
+
+  /*
+   * Updates the sampled inputs with the newest sample, if sampling is active. Called by the emulator when the game reads its inputs.
+   */
+  void ApplyLatestSample()
+  {
+    m_sampler.Apply();
+  }
+
   /*
    * Prints the current values of the inputs for the given game, or all inputs if game is NULL, to stdout for debugging purposes.
    */
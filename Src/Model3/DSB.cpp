@@ -150,7 +150,7 @@ int CDSBResampler::UpSampleAndMix(INT16 *outL, INT16 *outR, INT16 *inL, INT16 *i
 	INT32	v[2], musicVol;
 
 	// Obtain program volume settings and convert to 24.8 fixed point (0-200 -> 0x00-0x200)
-	musicVol = m_config["MusicVolume"].ValueAs<int>();
+	musicVol = m_musicVolume.Get();
 	musicVol = (INT32) ((float) 0x100 * (float) musicVol / 100.0f);
 
 	// Scale volume from 0x00-0xFF -> 0x00-0x100 (24.8 fixed point)
@@ -427,16 +427,21 @@ void CDSB1::SendCommand(UINT8 data)
 }
 
 void CDSB1::RunFrame(INT16 *audioL, INT16 *audioR)
+{
+	RunCPUFrame();
+	MixFrame(audioL, audioR);
+}
+
+void CDSB1::RunCPUFrame(void)
 {
 	int		cycles;
-	UINT8	v;
 
-	if (!m_config["EmulateDSB"].ValueAs<bool>())
+	emulateDSB = m_emulateDSB.Get();
+	if (!emulateDSB)
 	{
-		// DSB code applies SCSP volume, too, so we must still mix
+		// DSB code applies SCSP volume, too, so MixFrame() must still mix
 		memset(mpegL, 0, (32000/60+2)*sizeof(INT16));
 		memset(mpegR, 0, (32000/60+2)*sizeof(INT16));
-		retainedSamples = Resampler.UpSampleAndMix(audioL, audioR, mpegL, mpegR, 0, 0, NUM_SAMPLES_PER_FRAME, 32000/60+2, 44100, 32000);
 		return;
 	}
 
@@ -451,13 +456,20 @@ void CDSB1::RunFrame(INT16 *audioL, INT16 *audioR)
 	// Run remaining cycles
 	Z80.Run(cycles);
 
+	// Decode MPEG for this frame
+	MpegDec::DecodeAudio(&mpegL[retainedSamples], &mpegR[retainedSamples], 32000 / 60 - retainedSamples + 2);
+}
+
+void CDSB1::MixFrame(INT16 *audioL, INT16 *audioR)
+{
+	UINT8	v = 0;
+
 	//printf("VOLUME=%02X STEREO=%02X\n", volume, stereo);
 
 	// Convert volume from 0x00-0x7F -> 0x00-0xFF
-	v = (UINT8) ((float) 255.0f * (float) volume /127.0f);
+	if (emulateDSB)
+		v = (UINT8) ((float) 255.0f * (float) volume /127.0f);
 
-	// Decode MPEG for this frame
-	MpegDec::DecodeAudio(&mpegL[retainedSamples], &mpegR[retainedSamples], 32000 / 60 - retainedSamples + 2);
 	retainedSamples = Resampler.UpSampleAndMix(audioL, audioR, mpegL, mpegR, v, v, NUM_SAMPLES_PER_FRAME, 32000/60+2, 44100, 32000);
 }
 
@@ -608,7 +620,7 @@ CZ80 *CDSB1::GetZ80(void)
 }
 
 CDSB1::CDSB1(const Util::Config::Node &config)
-  : m_config(config),
+  : m_emulateDSB(config["EmulateDSB"], true),
     Resampler(config)
 {
 	progROM		= NULL;
@@ -617,6 +629,7 @@ CDSB1::CDSB1(const Util::Config::Node &config)
 	ram			= NULL;
 	mpegL		= NULL;
 	mpegR		= NULL;
+	emulateDSB	= false;
 
 	// must init these otherwise we end up trying to read illegal addresses
 	mpegStart	= 0;
@@ -997,12 +1010,18 @@ void CDSB2::SendCommand(UINT8 data)
 
 void CDSB2::RunFrame(INT16 *audioL, INT16 *audioR)
 {
-  if (!m_config["EmulateDSB"].ValueAs<bool>())
+  RunCPUFrame();
+  MixFrame(audioL, audioR);
+}
+
+void CDSB2::RunCPUFrame(void)
+{
+  emulateDSB = m_emulateDSB.Get();
+  if (!emulateDSB)
   {
-    // DSB code applies SCSP volume, too, so we must still mix
+    // DSB code applies SCSP volume, too, so MixFrame() must still mix
     memset(mpegL, 0, (32000 / 60 + 2) * sizeof(INT16));
     memset(mpegR, 0, (32000 / 60 + 2) * sizeof(INT16));
-    retainedSamples = Resampler.UpSampleAndMix(audioL, audioR, mpegL, mpegR, volume[0], volume[1], NUM_SAMPLES_PER_FRAME, 32000 / 60 + 2, 44100, 32000);
     return;
   }
 
@@ -1041,10 +1060,18 @@ void CDSB2::RunFrame(INT16 *audioL, INT16 *audioR)
   m_cyclesElapsedThisFrame -= k_framePeriod;
   m_nextTimerInterruptCycles -= k_framePeriod;
 
-  M68KGetContext(&M68K);
 
   // Decode MPEG for this frame
   MpegDec::DecodeAudio(&mpegL[retainedSamples], &mpegR[retainedSamples], 32000 / 60 - retainedSamples + 2);
+}
+
+void CDSB2::MixFrame(INT16 *audioL, INT16 *audioR)
+{
+  if (!emulateDSB)
+  {
+    retainedSamples = Resampler.UpSampleAndMix(audioL, audioR, mpegL, mpegR, volume[0], volume[1], NUM_SAMPLES_PER_FRAME, 32000 / 60 + 2, 44100, 32000);
+    return;
+  }
 
   INT16 *leftChannelSource = nullptr;
   INT16 *rightChannelSource = nullptr;
@@ -1097,7 +1124,6 @@ void CDSB2::Reset(void)
 	M68KSetContext(&M68K);
 	M68KReset();
 	//printf("DSB2 PC=%06X\n", M68KGetPC());
-	M68KGetContext(&M68K);
 
 	m_cyclesElapsedThisFrame = 0;
 	m_nextTimerInterruptCycles = k_timerPeriod;
@@ -1182,7 +1208,6 @@ void CDSB2::LoadState(CBlockFile *StateFile)
 
 	M68KSetContext(&M68K);
 	M68KLoadState(StateFile, "DSB2 68K");
-	M68KGetContext(&M68K);
 
 	// Technically these should be saved/restored rather than being reset but that would mean
 	// the save state format has to be modified and the difference would be imperceptible anyway
@@ -1242,7 +1267,6 @@ bool CDSB2::Init(const UINT8 *progROMPtr, const UINT8 *mpegROMPtr)
 	M68KInit();
 	M68KAttachBus(this);
 	M68KSetIRQCallback(NULL);	// use default behavior (autovector, clear interrupt)
-	M68KGetContext(&M68K);
 
 	retainedSamples = 0;
 
@@ -1255,7 +1279,7 @@ M68KCtx *CDSB2::GetM68K(void)
 }
 
 CDSB2::CDSB2(const Util::Config::Node &config)
-  : m_config(config),
+  : m_emulateDSB(config["EmulateDSB"], true),
     Resampler(config)
 {
 	progROM		= NULL;
@@ -1264,6 +1288,7 @@ CDSB2::CDSB2(const Util::Config::Node &config)
 	ram			= NULL;
 	mpegL		= NULL;
 	mpegR		= NULL;
+	emulateDSB	= false;
 
 	cmdLatch	= 0;
 	mpegState	= 0;
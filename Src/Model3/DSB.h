@@ -74,11 +74,11 @@ public:
 	int		UpSampleAndMix(INT16 *outL, INT16 *outR, INT16 *inL, INT16 *inR, UINT8 volumeL, UINT8 volumeR, int sizeOut, int sizeIn, int outRate, int inRate);
 	void	Reset(void);
 	CDSBResampler(const Util::Config::Node &config)
-	  : m_config(config)
+	  : m_musicVolume(config["MusicVolume"], 100)
   {
   }
 private:
-	const Util::Config::Node &m_config;
+	Util::Config::Binding<int> m_musicVolume;
 	int	nFrac;
 	int	pFrac;
 };
@@ -116,6 +116,18 @@ public:
 	 */
 	virtual void RunFrame(INT16 *audioL, INT16 *audioR) = 0;
 
+	/*
+	 * RunCPUFrame(void):
+	 * MixFrame(audioL, audioR):
+	 *
+	 * RunFrame() in two halves. RunCPUFrame() runs the DSB CPU for one frame
+	 * and decodes the MPEG audio. It does not touch the SCSP output, so it may
+	 * run on another thread while the SCSP is being updated. MixFrame() must
+	 * follow it and mixes the result into the supplied buffers.
+	 */
+	virtual void RunCPUFrame(void) = 0;
+	virtual void MixFrame(INT16 *audioL, INT16 *audioR) = 0;
+
 	/*
 	 * Reset(void):
 	 *
@@ -188,6 +200,8 @@ public:
 	// DSB interface (see CDSB definition)
 	void 	SendCommand(UINT8 data);
 	void 	RunFrame(INT16 *audioL, INT16 *audioR);
+	void	RunCPUFrame(void);
+	void	MixFrame(INT16 *audioL, INT16 *audioR);
 	void 	Reset(void);
 	void	SaveState(CBlockFile *StateFile);
 	void	LoadState(CBlockFile *StateFile);
@@ -201,7 +215,7 @@ public:
 	~CDSB1(void);
 
 private:
-  const Util::Config::Node &m_config;
+  Util::Config::Binding<bool> m_emulateDSB;
 
 	// Resampler
 	CDSBResampler	Resampler;
@@ -209,6 +223,7 @@ private:
 
   // MPEG decode buffers (48KHz, 1/60th second + 2 extra padding samples)
 	INT16	*mpegL, *mpegR;
+	bool	emulateDSB;		// EmulateDSB setting seen by the last RunCPUFrame()
 
 	// DSB memory
 	const UINT8	*progROM;		// Z80 program ROM (passed in from parent object)
@@ -265,6 +280,8 @@ public:
 	// DSB interface (see definition of CDSB)
 	void 	SendCommand(UINT8 data);
 	void 	RunFrame(INT16 *audioL, INT16 *audioR);
+	void	RunCPUFrame(void);
+	void	MixFrame(INT16 *audioL, INT16 *audioR);
 	void 	Reset(void);
 	void	SaveState(CBlockFile *StateFile);
 	void	LoadState(CBlockFile *StateFile);
@@ -278,7 +295,7 @@ public:
 	~CDSB2(void);
 
 private:
-	const Util::Config::Node &m_config;
+	Util::Config::Binding<bool> m_emulateDSB;
 
 	// Private helper functions
 	void	WriteMPEGFIFO(UINT8 byte);
@@ -289,6 +306,7 @@ private:
 
 	// MPEG decode buffers (48KHz, 1/60th second + 2 extra padding samples)
 	INT16	*mpegL, *mpegR;
+	bool	emulateDSB;		// EmulateDSB setting seen by the last RunCPUFrame()
 
 	// Stereo mode (do not change values because they are used in save states!)
 	enum class StereoMode: uint8_t
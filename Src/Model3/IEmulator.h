@@ -110,6 +110,41 @@ public:
    */
   virtual void RenderFrame(void) = 0;
 
+  /*
+   * SetFrameOutput(video, audio):
+   *
+   * Selects whether the frames run by RunFrame() are rendered and whether
+   * their audio is output. Frames with neither are still emulated in full,
+   * only faster. Both are on by default.
+   *
+   * Parameters:
+   *    video   Render frames.
+   *    audio   Output audio.
+   */
+  virtual void SetFrameOutput(bool video, bool audio) = 0;
+
+  /*
+   * SetFrameKept(kept):
+   *
+   * Selects whether the frames run by RunFrame() are kept. Frames that are not
+   * will be undone by loading an earlier state, so they leave out everything
+   * that reaches outside the emulator: drive board force feedback, lamps and
+   * other outputs. Frames are kept by default.
+   *
+   * Parameters:
+   *    kept    Frames are kept.
+   */
+  virtual void SetFrameKept(bool kept) = 0;
+
+  /*
+   * IsLinked(void):
+   *
+   * Returns:
+   *    True if the machine is linked to others through the net board. They
+   *    have seen its frames as they were run, so none can be undone.
+   */
+  virtual bool IsLinked(void) = 0;
+
   /*
    * Reset(void):
    *
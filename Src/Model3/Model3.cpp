@@ -247,6 +247,11 @@ UINT8 CModel3::ReadInputs(unsigned reg)
   UINT8 adc[8];
   UINT8 data;
   reg &= 0x3F;
+
+  // Reads of the control ports get the newest input sample rather than the one from the start of the frame
+  if (reg == 0x04 || reg == 0x08 || reg == 0x0C || reg == 0x3C)
+    Inputs->ApplyLatestSample();
+
   switch (reg)
   {
   case 0x00:  // input bank
@@ -656,15 +661,15 @@ void CModel3::WriteInputs(unsigned reg, UINT8 data)
     break;
 
   case 0x10:  // Drive board
-    if (DriveBoard->IsAttached())
+    if (DriveBoard->IsAttached() && m_frameKept)
       DriveBoard->Write(data);
-    if (NULL != Outputs) // TODO - check gameInputs
+    if (NULL != Outputs && m_frameKept) // TODO - check gameInputs
       Outputs->SetValue(OutputRawDrive, data);
     OutputRegister[0] = data;
     break;
 
   case 0x14:  // Lamp outputs (Daytona/Scud Race/Sega Rally/Le Mans 24)
-    if (NULL != Outputs) // TODO - check gameInputs
+    if (NULL != Outputs && m_frameKept) // TODO - check gameInputs
     {
       Outputs->SetValue(OutputLampStart, !!(data&0x04));
       Outputs->SetValue(OutputLampView1, !!(data&0x08));
@@ -858,6 +863,9 @@ void CModel3::SetCROMBank(unsigned idx)
   cromBankReg = idx;
   idx = (~idx) & 0xF;
   cromBank = &crom[0x800000 + (idx*0x800000)];
+  if (pageMap != NULL)
+    pageMap->Map(0xFF000000, 0x800000, cromBank, false);
+  ppc_invalidate_code(0xFF000000, 0xFF7FFFFF);
   DebugLog("CROM bank setting: %d (%02X), PC=%08X, LR=%08X\n", idx, cromBankReg, ppc_get_pc(), ppc_get_lr());
 }
 
@@ -978,6 +986,11 @@ UINT8 CModel3::Read8(UINT32 addr)
       }
       break;
 
+    // Backup RAM
+    case 0x0C:
+    case 0x0D:
+      return backupRAM[(addr&0x1FFFF)^3];
+
     // System registers
     case 0x10:
       return ReadSystemRegister(addr & 0x3F);
@@ -1854,6 +1867,17 @@ void CModel3::Write64(UINT32 addr, UINT64 data)
     Write32(addr+4, (UINT32) data);
 }
 
+/*
+ * CModel3::GetPageMap():
+ *
+ * Returns the direct mapping of RAM, CROM (fixed and banked), and backup RAM.
+ * Everything else goes through the handlers above.
+ */
+const BusPageMap *CModel3::GetPageMap(void)
+{
+  return pageMap;
+}
+
 
 /******************************************************************************
  Emulation and Interface Functions
@@ -1963,6 +1987,7 @@ void CModel3::ClearNVRAM(void)
 void CModel3::RunFrame(void)
 {
   UINT32 start = CThread::GetTicks();
+  bool runDriveBoard = DriveBoard->IsAttached() && m_frameKept;
 
   // See if currently running multi-threaded
   if (m_multiThreaded)
@@ -1971,10 +1996,10 @@ void CModel3::RunFrame(void)
     if (!StartThreads())
       goto ThreadError;
 
-    // Wake threads for PPC main board (if multi-threading GPU), sound board (if sync'd) and drive board (if attached) so they can process a frame
+    // Wake threads for PPC main board (if multi-threading GPU), sound board (if sync'd) and drive board (if attached and the frame is kept) so they can process a frame
     if ((m_gpuMultiThreaded       && !ppcBrdThreadSync->Post()) ||
         (syncSndBrdThread         && !sndBrdThreadSync->Post()) ||
-        (DriveBoard->IsAttached()  && !drvBrdThreadSync->Post()))
+        (runDriveBoard            && !drvBrdThreadSync->Post()))
       goto ThreadError;
 
     // If not multi-threading GPU, then run PPC main board for a frame and sync GPUs now in this thread
@@ -1985,7 +2010,8 @@ void CModel3::RunFrame(void)
     }
 
     // Render frame
-    RenderFrame();
+    if (m_frameVideo)
+      RenderFrame();
 
     // Enter notify wait critical section
     if (!notifyLock->Lock())
@@ -1994,7 +2020,7 @@ void CModel3::RunFrame(void)
     // Wait for PPC main board, sound board and drive board threads to finish their work (if they are running and haven't finished already)
     while ((m_gpuMultiThreaded      && !ppcBrdThreadDone) ||
            (syncSndBrdThread        && !sndBrdThreadDone) ||
-           (DriveBoard->IsAttached() && !drvBrdThreadDone))
+           (runDriveBoard           && !drvBrdThreadDone))
     {
       if (!notifySync->Wait(notifyLock))
         goto ThreadError;
@@ -2012,7 +2038,7 @@ void CModel3::RunFrame(void)
       SyncGPUs();
 
 #ifdef NET_BOARD
-    if (NetBoard->IsRunning() && m_config["SimulateNet"].ValueAs<bool>())
+    if (NetBoard->IsRunning() && m_simulateNet.Get())
         RunNetBoardFrame();
 #endif
   }
@@ -2021,9 +2047,10 @@ void CModel3::RunFrame(void)
     // If not multi-threaded, then just process and render a single frame for PPC main board, sound board and drive board in turn in this thread
     RunMainBoardFrame();
     SyncGPUs();
-    RenderFrame();
+    if (m_frameVideo)
+      RenderFrame();
     RunSoundBoardFrame();
-    if (DriveBoard->IsAttached())
+    if (runDriveBoard)
       RunDriveBoardFrame();
 #ifdef NET_BOARD
     if (NetBoard->IsRunning())
@@ -2044,9 +2071,10 @@ ThreadError:
 void CModel3::RunMainBoardFrame(void)
 {
 	UINT32 start = CThread::GetTicks();
+	UINT64 idleStart = ppc_idle_skipped_cycles();
 
 	// Compute display and VBlank timings
-	unsigned ppcCycles		= m_config["PowerPCFrequency"].ValueAs<unsigned>() * 1000000;
+	unsigned ppcCycles		= m_ppcFrequency.Get() * 1000000;
 	unsigned frameCycles	= (unsigned)((float)ppcCycles / 57.524160f);
 	unsigned gapCycles		= (unsigned)((float)frameCycles * 2.5f / 100.0f);	// we need a gap between asserting irq2 & irq 0x40
 	unsigned offsetCycles = (unsigned)((float)frameCycles * 33.f / 100.0f);
@@ -2120,6 +2148,7 @@ void CModel3::RunMainBoardFrame(void)
 	ppc_execute(dispCycles);
 
 	timings.ppcTicks = CThread::GetTicks() - start;
+	timings.ppcIdleCycles = (UINT32) (ppc_idle_skipped_cycles() - idleStart);
 }
 
 void CModel3::SyncGPUs(void)
@@ -2139,26 +2168,88 @@ void CModel3::RenderFrame(void)
   // Call OSD video callbacks
   if (BeginFrameVideo() && gpusReady)
   {
-    // Render frame
-    TileGen.BeginFrame();
-    GPU.BeginFrame();
-    TileGen.PreRenderFrame();
-    TileGen.RenderFrameBottom();
-    GPU.RenderFrame();
-    TileGen.RenderFrameTop();
-    GPU.EndFrame();
-    TileGen.EndFrame();
+    if (m_pipelineDepth >= 3 && GPU.QueueScene())
+    {
+      // Display the frame before, whose scene was built and 2D layers drawn
+      // last time, while the scene of this one is built. Both must be done
+      // before the next SyncGPUs() overwrites the snapshots.
+      bool sceneThreaded = StartSceneBuild();
+
+      UINT32 submitStart = CThread::GetTicks();
+      TileGen.BeginFrame();
+      GPU.BeginFrame();
+      TileGen.UploadSurfaces();
+      TileGen.RenderFrameBottom();
+      GPU.RenderFrame();
+      timings.drawStats = GPU.GetRenderStats();
+      TileGen.RenderFrameTop();
+      GPU.EndFrame();
+      timings.submitTicks = CThread::GetTicks() - submitStart;
+
+      UINT32 tileStart = CThread::GetTicks();
+      TileGen.DrawSurfaces();
+      timings.tileTicks = CThread::GetTicks() - tileStart;
+      FinishSceneBuild(sceneThreaded);
+      TileGen.EndFrame();
+    }
+    else
+    {
+      // With a deeper pipeline, the 3D scene is built on its own thread while the 2D layers are drawn here
+      bool sceneThreaded = StartSceneBuild();
+
+      // Render frame
+      TileGen.BeginFrame();
+      GPU.BeginFrame();
+      UINT32 tileStart = CThread::GetTicks();
+      TileGen.PreRenderFrame();
+      timings.tileTicks = CThread::GetTicks() - tileStart;
+      TileGen.RenderFrameBottom();
+      FinishSceneBuild(sceneThreaded);
+      UINT32 submitStart = CThread::GetTicks();
+      GPU.RenderFrame();
+      timings.drawStats = GPU.GetRenderStats();
+      TileGen.RenderFrameTop();
+      GPU.EndFrame();
+      timings.submitTicks = CThread::GetTicks() - submitStart;
+      TileGen.EndFrame();
+    }
   }
+  else
+    timings.drawStats = Render3DStats();
 
   EndFrameVideo();
 
   timings.renderTicks = CThread::GetTicks() - start;
 }
 
+void CModel3::SetFrameOutput(bool video, bool audio)
+{
+  // Skipped frames still sync the GPUs, so the next rendered frame picks up
+  // everything written in the meantime
+  m_frameVideo = video;
+  m_frameAudio = audio;
+}
+
+void CModel3::SetFrameKept(bool kept)
+{
+  // The drive board isn't run either, as it sends force feedback as it goes.
+  // Its state is undone along with the rest.
+  m_frameKept = kept;
+}
+
+bool CModel3::IsLinked(void)
+{
+#ifdef NET_BOARD
+  return m_runNetBoard;
+#else
+  return false;
+#endif
+}
+
 bool CModel3::RunSoundBoardFrame(void)
 {
   UINT32 start = CThread::GetTicks();
-  bool bufferFull = SoundBoard.RunFrame();
+  bool bufferFull = SoundBoard.RunFrame(m_frameAudio);
   timings.sndTicks = CThread::GetTicks() - start;
   return bufferFull;
 }
@@ -2170,6 +2261,73 @@ void CModel3::RunDriveBoardFrame(void)
   timings.drvTicks = CThread::GetTicks() - start;
 }
 
+bool CModel3::StartSceneBuild(void)
+{
+  if (!m_multiThreaded || sceneThread == NULL)
+    return false;
+
+  // Enter notify critical section
+  if (!notifyLock->Lock())
+    goto ThreadError;
+
+  sceneThreadDone = false;
+
+  // Leave notify critical section
+  if (!notifyLock->Unlock())
+    goto ThreadError;
+
+  // Wake scene thread
+  if (!sceneThreadSync->Post())
+    goto ThreadError;
+  return true;
+
+ThreadError:
+  ErrorLog("Threading error in CModel3::StartSceneBuild: %s\nSwitching back to single-threaded mode.\n", CThread::GetLastError());
+  m_multiThreaded = false;
+  return false;
+}
+
+void CModel3::WaitForSceneBuild(void)
+{
+  UINT32 start = CThread::GetTicks();
+
+  // Enter notify critical section
+  if (!notifyLock->Lock())
+    goto ThreadError;
+
+  // Wait for scene thread to finish
+  while (!sceneThreadDone)
+  {
+    if (!notifySync->Wait(notifyLock))
+      goto ThreadError;
+  }
+
+  // Leave notify critical section
+  if (!notifyLock->Unlock())
+    goto ThreadError;
+
+  timings.sceneWaitTicks = CThread::GetTicks() - start;
+  return;
+
+ThreadError:
+  ErrorLog("Threading error in CModel3::WaitForSceneBuild: %s\nSwitching back to single-threaded mode.\n", CThread::GetLastError());
+  m_multiThreaded = false;
+}
+
+void CModel3::FinishSceneBuild(bool sceneThreaded)
+{
+  if (sceneThreaded)
+  {
+    WaitForSceneBuild();
+    return;
+  }
+
+  UINT32 start = CThread::GetTicks();
+  GPU.BuildScene();
+  timings.sceneTicks = CThread::GetTicks() - start;
+  timings.sceneWaitTicks = 0;
+}
+
 #ifdef NET_BOARD
 void CModel3::RunNetBoardFrame(void)
 {
@@ -2204,6 +2362,12 @@ bool CModel3::StartThreads(void)
     if (drvBrdThreadSync == NULL)
       goto ThreadError;
   }
+  if (m_pipelineDepth >= 2)
+  {
+    sceneThreadSync = CThread::CreateSemaphore(0);
+    if (sceneThreadSync == NULL)
+      goto ThreadError;
+  }
   notifyLock = CThread::CreateMutex();
   if (notifyLock == NULL)
     goto ThreadError;
@@ -2239,6 +2403,14 @@ bool CModel3::StartThreads(void)
       goto ThreadError;
   }
 
+  // Create 3D scene build thread, if running a deeper frame pipeline
+  if (m_pipelineDepth >= 2)
+  {
+    sceneThread = CThread::CreateThread("SceneBuild", StartSceneThread, this);
+    if (sceneThread == NULL)
+      goto ThreadError;
+  }
+
   // Set audio callback if sound board thread is unsync'd
   if (!syncSndBrdThread)
   {
@@ -2358,6 +2530,11 @@ bool CModel3::StopThreads(void)
     if (drvBrdThreadSync->Post())
       drvBrdThread->Wait();
   }
+  if (sceneThread != NULL)
+  {
+    if (sceneThreadSync->Post())
+      sceneThread->Wait();
+  }
 
   // Delete all thread and synchronization objects
   DeleteThreadObjects();
@@ -2388,6 +2565,11 @@ void CModel3::DeleteThreadObjects(void)
     delete drvBrdThread;
     drvBrdThread = NULL;
   }
+  if (sceneThread != NULL)
+  {
+    delete sceneThread;
+    sceneThread = NULL;
+  }
 
 
   // Delete synchronization objects
@@ -2406,6 +2588,11 @@ void CModel3::DeleteThreadObjects(void)
     delete drvBrdThreadSync;
     drvBrdThreadSync = NULL;
   }
+  if (sceneThreadSync != NULL)
+  {
+    delete sceneThreadSync;
+    sceneThreadSync = NULL;
+  }
 
 
   if (sndBrdNotifyLock != NULL)
@@ -2432,9 +2619,13 @@ void CModel3::DeleteThreadObjects(void)
 
 void CModel3::DumpTimings(void)
 {
-  printf("PPC:%3ums%c render:%3ums%c sync:%4uK%c%3ums%c snd:%3ums%c drv:%3ums%c frame:%3ums%c\n",
+  printf("PPC:%3ums%c idle:%5uK, render:%3ums%c scene:%3ums/%3ums%c 2d:%3ums, submit:%3ums, draws:%4u/%4u, sync:%4uK%c%3ums%c snd:%3ums%c drv:%3ums%c frame:%3ums%c\n",
     timings.ppcTicks, (timings.ppcTicks > timings.renderTicks ? '!' : ','),
+    timings.ppcIdleCycles / 1000,
     timings.renderTicks, (timings.renderTicks > timings.ppcTicks ? '!' : ','),
+    timings.sceneTicks, timings.sceneWaitTicks, (timings.sceneWaitTicks > 1 ? '!' : ','),
+    timings.tileTicks, timings.submitTicks,
+    timings.drawStats.drawCalls, timings.drawStats.meshes,
     timings.syncSize / 1024, (timings.syncSize / 1024 > 128 ? '!' : ','),
     timings.syncTicks, (timings.syncTicks > 1 ? '!' : ','),
     timings.sndTicks, (timings.sndTicks > 10 ? '!' : ','),
@@ -2475,6 +2666,13 @@ int CModel3::StartDriveBoardThread(void *data)
   return model3->RunDriveBoardThread();
 }
 
+int CModel3::StartSceneThread(void *data)
+{
+  // Call method on CModel3 to run 3D scene build thread
+  CModel3 *model3 = (CModel3*)data;
+  return model3->RunSceneThread();
+}
+
 int CModel3::RunMainBoardThread(void)
 {
   for (;;)
@@ -2772,6 +2970,48 @@ ThreadError:
   return 1;
 }
 
+int CModel3::RunSceneThread(void)
+{
+  for (;;)
+  {
+    // Wait on scene thread semaphore, posted once per rendered frame
+    if (!sceneThreadSync->Wait())
+      goto ThreadError;
+
+    // Check thread is not being stopped
+    if (!notifyLock->Lock())
+      goto ThreadError;
+    bool exit = stopThreads;
+    if (!notifyLock->Unlock())
+      goto ThreadError;
+    if (exit)
+      return 0;
+
+    // Build 3D scene (CPU-side only, render thread submits it)
+    UINT32 start = CThread::GetTicks();
+    GPU.BuildScene();
+    timings.sceneTicks = CThread::GetTicks() - start;
+
+    // Enter notify critical section
+    if (!notifyLock->Lock())
+      goto ThreadError;
+
+    // Let render thread know scene is ready
+    sceneThreadDone = true;
+    if (!notifySync->SignalAll())
+      goto ThreadError;
+
+    // Leave notify critical section
+    if (!notifyLock->Unlock())
+      goto ThreadError;
+  }
+
+ThreadError:
+  ErrorLog("Threading error in RunSceneThread: %s\nSwitching back to single-threaded mode.\n", CThread::GetLastError());
+  m_multiThreaded = false;
+  return 1;
+}
+
 void CModel3::Reset(void)
 {
   // Clear memory (but do not modify backup RAM!)
@@ -2814,11 +3054,17 @@ void CModel3::Reset(void)
   gpusReady = false;
 
   timings.ppcTicks = 0;
+  timings.ppcIdleCycles = 0;
   timings.syncSize = 0;
   timings.syncTicks = 0;
   timings.renderTicks = 0;
+  timings.sceneTicks = 0;
+  timings.sceneWaitTicks = 0;
+  timings.tileTicks = 0;
+  timings.submitTicks = 0;
   timings.sndTicks = 0;
   timings.drvTicks = 0;
+  timings.drawStats = Render3DStats();
 #ifdef NET_BOARD
   timings.netTicks = 0;
   NetBoard->Reset();
@@ -2942,6 +3188,9 @@ bool CModel3::LoadGame(const Game &game, const ROMSet &rom_set)
   PPCFetchRegions[2].end = 0;
   PPCFetchRegions[2].ptr = NULL;
   ppc_set_fetch(PPCFetchRegions);
+  ppc_set_decode_cache(m_config["PowerPCDecodeCache"].ValueAsDefault<bool>(false), m_config["PowerPCDecodeCacheVerify"].ValueAsDefault<bool>(false));
+  ppc_set_idle_skip(m_config["PowerPCIdleSkip"].ValueAsDefault<bool>(true));
+  ppc_idle_timed_register(0x84000000);  // Real3D status, flips at the barrier set in CReal3D::BeginVBlank()
 
   // Initialize Real3D
   m_stepping = ((game.stepping[0] - '0') << 4) | (game.stepping[2] - '0');
@@ -3145,6 +3394,16 @@ bool CModel3::Init(void)
   netRAM = &memoryPool[NETRAM_OFFSET];
   netBuffer = &memoryPool[NETBUFFER_OFFSET];
 
+  // Map plain memory for direct access (banked CROM is mapped by SetCROMBank())
+  pageMap = new(std::nothrow) BusPageMap;
+  if (NULL == pageMap)
+    return ErrorLog("Insufficient memory for Model 3 object.");
+  pageMap->Clear();
+  pageMap->Map(0x00000000, 0x800000, ram, true);
+  pageMap->Map(0xFF800000, 0x800000, crom, false);
+  pageMap->Map(0xF00C0000, 0x20000, backupRAM, true);
+  pageMap->Map(0xFE0C0000, 0x20000, backupRAM, true);  // mirror
+
   SetCROMBank(0xFF);
 
   // Initialize other devices (PowerPC, DSB, and security board initialized after ROMs loaded)
@@ -3197,6 +3456,10 @@ INetBoard *CModel3::GetNetBoard(void)
 
 CModel3::CModel3(Util::Config::Node &config)
   : m_config(config),
+  m_ppcFrequency(config["PowerPCFrequency"], 50),
+#ifdef NET_BOARD
+  m_simulateNet(config["SimulateNet"], false),
+#endif
   m_multiThreaded(
     [&config]() {
       try { return config["MultiThreaded"].ValueAs<bool>(); }
@@ -3207,6 +3470,26 @@ CModel3::CModel3(Util::Config::Node &config)
       try { return config["GPUMultiThreaded"].ValueAs<bool>(); }
       catch (...) { return false; }
     }()),
+  m_pipelineDepth(
+    [&config]() {
+      // The third stage keeps the texture RAM snapshot a frame behind, so it
+      // needs the snapshots of the multi-threaded GPU
+      unsigned depth = config["PipelineDepth"].ValueAsDefault<unsigned>(1);
+      if (depth > 3)
+      {
+        InfoLog("PipelineDepth %u is not supported; using 3.", depth);
+        depth = 3;
+      }
+      if (depth == 3 && !config["GPUMultiThreaded"].ValueAs<bool>())
+      {
+        InfoLog("PipelineDepth 3 needs GPUMultiThreaded; using 2.");
+        depth = 2;
+      }
+      return depth < 1 ? 1 : depth;
+    }()),
+  m_frameVideo(true),
+  m_frameAudio(true),
+  m_frameKept(true),
     TileGen(config),
     GPU(config),
     SoundBoard(config),
@@ -3226,6 +3509,7 @@ CModel3::CModel3(Util::Config::Node &config)
   dsbROM = NULL;
   mpegROM = NULL;
   cromBank = NULL;
+  pageMap = NULL;
   backupRAM = NULL;
   securityRAM = NULL;
   netRAM = NULL;
@@ -3242,6 +3526,7 @@ CModel3::CModel3(Util::Config::Node &config)
   ppcBrdThread = NULL;
   sndBrdThread = NULL;
   drvBrdThread = NULL;
+  sceneThread = NULL;
 
   ppcBrdThreadRunning = false;
   ppcBrdThreadDone = false;
@@ -3249,11 +3534,16 @@ CModel3::CModel3(Util::Config::Node &config)
   sndBrdThreadDone = false;
   drvBrdThreadRunning = false;
   drvBrdThreadDone = false;
+  sceneThreadDone = false;
 
-  syncSndBrdThread = false;
+  // Running ahead reloads the whole machine state every frame, so the sound
+  // board must run exactly one frame per frame rather than as the audio
+  // callback demands
+  syncSndBrdThread = config["RunAhead"].ValueAsDefault<unsigned>(0) > 0;
   ppcBrdThreadSync = NULL;
   sndBrdThreadSync = NULL;
   drvBrdThreadSync = NULL;
+  sceneThreadSync = NULL;
 
   notifyLock = NULL;
   notifySync = NULL;
@@ -3301,6 +3591,12 @@ CModel3::~CModel3(void)
     memoryPool = NULL;
   }
 
+  if (pageMap != NULL)
+  {
+    delete pageMap;
+    pageMap = NULL;
+  }
+
   if (DSB != NULL)
   {
     delete DSB;
@@ -54,11 +54,17 @@
 struct FrameTimings
 {
   UINT32 ppcTicks;
+  UINT32 ppcIdleCycles;   // PowerPC cycles skipped in idle loops
   UINT32 syncSize;
   UINT32 syncTicks;
   UINT32 renderTicks;
+  UINT32 sceneTicks;      // 3D scene build (on the scene thread with pipeline depth 2 and up)
+  UINT32 sceneWaitTicks;  // time the render thread waited for the scene build
+  UINT32 tileTicks;       // 2D layers drawn on the CPU
+  UINT32 submitTicks;     // 2D and 3D drawn on the GPU
   UINT32 sndTicks;
   UINT32 drvTicks;
+  Render3DStats drawStats;  // 3D draw submission (zero when the frame was not rendered)
 #ifdef NET_BOARD
   UINT32 netTicks;
 #endif
@@ -90,6 +96,9 @@ public:
   void ClearNVRAM(void);
   void RunFrame(void);
   void RenderFrame(void);
+  void SetFrameOutput(bool video, bool audio);
+  void SetFrameKept(bool kept);
+  bool IsLinked(void);
   void Reset(void);
   const Game &GetGame(void) const;
   void AttachRenderers(CRender2D *Render2DPtr, IRender3D *Render3DPtr);
@@ -112,6 +121,7 @@ public:
   void Write16(UINT32 addr, UINT16 data);
   void Write32(UINT32 addr, UINT32 data);
   void Write64(UINT32 addr, UINT64 data);
+  const BusPageMap *GetPageMap(void);
 
   /*
    * LoadGame(game, rom_set):
@@ -221,6 +231,7 @@ private:
   static int StartSoundBoardThread(void *data);       // Callback to start sound board thread (unsync'd)
   static int StartSoundBoardThreadSyncd(void *data);  // Callback to start sound board thread (sync'd)
   static int StartDriveBoardThread(void *data);       // Callback to start drive board thread
+  static int StartSceneThread(void *data);            // Callback to start 3D scene build thread
 
   static void AudioCallback(void *data);              // Audio buffer callback
 
@@ -229,11 +240,23 @@ private:
   int     RunSoundBoardThread(void);                  // Runs sound board thread (not sync'd in step with render thread, ie running at full speed)
   int     RunSoundBoardThreadSyncd(void);             // Runs sound board thread (sync'd in step with render thread)
   int     RunDriveBoardThread(void);                  // Runs drive board thread (sync'd in step with render thread)
+  int     RunSceneThread(void);                       // Runs 3D scene build thread (sync'd in step with render thread)
+  bool    StartSceneBuild(void);                      // Wakes scene thread to build the 3D scene, returns false if it must be built inline
+  void    WaitForSceneBuild(void);                    // Waits for scene thread to finish building the 3D scene
+  void    FinishSceneBuild(bool sceneThreaded);       // Waits for the scene thread, or builds the 3D scene now if it wasn't started
 
   // Runtime configuration
   Util::Config::Node &m_config;
+  Util::Config::Binding<unsigned> m_ppcFrequency;   // MHz, read every frame
+#ifdef NET_BOARD
+  Util::Config::Binding<bool> m_simulateNet;
+#endif
   bool m_multiThreaded;
   bool m_gpuMultiThreaded;
+  unsigned m_pipelineDepth;   // 1: PPC overlaps rendering, 2: 3D scene build also runs as its own stage, 3: frame N is drawn while the scene of N+1 is built
+  bool m_frameVideo;          // RunFrame() renders (cleared for frames that are run ahead)
+  bool m_frameAudio;          // RunFrame() outputs audio
+  bool m_frameKept;           // RunFrame() drives outputs (cleared for frames that will be undone)
 
   // Game and hardware information
   Game m_game;
@@ -272,6 +295,9 @@ private:
   UINT8     *cromBank;    // currently mapped in CROM bank
   unsigned  cromBankReg;  // the CROM bank register
 
+  // Direct host mapping of RAM, CROM, and backup RAM for the PowerPC and DMA
+  BusPageMap *pageMap;
+
   // Security device
   bool      m_securityFirstRead = true;
   unsigned  securityPtr;  // pointer to current offset in security data
@@ -295,6 +321,8 @@ private:
   bool        sndBrdWakeNotify;    // Flag to indicate that sound board thread has been woken by audio callback (when not sync'd with render thread)
   bool        drvBrdThreadRunning; // Flag to indicate drive board thread is currently processing
   bool        drvBrdThreadDone;    // Flag to indicate drive board thread has finished processing
+  CThread     *sceneThread;        // 3D scene build thread (pipeline depth 2)
+  bool        sceneThreadDone;     // Flag to indicate scene thread has finished building the scene
 
   // Thread synchronization objects
   CSemaphore  *ppcBrdThreadSync;
@@ -302,6 +330,7 @@ private:
   CMutex      *sndBrdNotifyLock;
   CCondVar    *sndBrdNotifySync;
   CSemaphore  *drvBrdThreadSync;
+  CSemaphore  *sceneThreadSync;
   CMutex      *notifyLock;
   CCondVar    *notifySync;
 
@@ -87,6 +87,19 @@ public:
     EndFrameVideo();
   }
 
+  void SetFrameOutput(bool video, bool audio) override
+  {
+  }
+
+  void SetFrameKept(bool kept) override
+  {
+  }
+
+  bool IsLinked(void) override
+  {
+    return false;
+  }
+
   void Reset(void) override
   {
     // Load state
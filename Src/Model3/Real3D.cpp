@@ -47,8 +47,10 @@
 #include "JTAG.h"
 #include "CPU/PowerPC/ppc.h"
 #include "Util/BMPFile.h"
+#include "Util/ByteSwap.h"
 #include <cstring>
 #include <algorithm>
+#include <random>
 
 // Macros that divide memory regions into pages and mark them as dirty when they are written to
 #define PAGE_WIDTH 12
@@ -73,20 +75,84 @@
 #define OFFSET_98_DIRTY     (OFFSET_8E_DIRTY+DIRTY_SIZE(0x100000))
 #define OFFSET_TEXRAM_DIRTY (OFFSET_98_DIRTY+DIRTY_SIZE(0x400000))
 #define MEM_POOL_SIZE_DIRTY (DIRTY_SIZE(MEM_POOL_SIZE_RO))
-#define MEMORY_POOL_SIZE  (MEM_POOL_SIZE_RW+MEM_POOL_SIZE_RO+MEM_POOL_SIZE_DIRTY)
+#define OFFSET_STATE_DIRTY  (OFFSET_8C_DIRTY+MEM_POOL_SIZE_DIRTY) // same layout, pages changed since last save state delta
+#define MEMORY_POOL_SIZE  (MEM_POOL_SIZE_RW+MEM_POOL_SIZE_RO+2*MEM_POOL_SIZE_DIRTY)
+#define OFFSET_TEXRAM_STAGE       MEMORY_POOL_SIZE // 8 MB, texture RAM of the frame whose scene is being built [pipeline depth 3]
+#define OFFSET_TEXRAM_STAGE_DIRTY (OFFSET_TEXRAM_STAGE+0x800000)
+#define MEM_POOL_SIZE_STAGE       (0x800000+DIRTY_SIZE(0x800000))
 
 static void UpdateRenderConfig(IRender3D *Render3D, uint64_t internalRenderConfig[]);
 
+// Texture RAM rows are exactly one page
+#define TEXTURE_ROW_DIRTY(dirtyArray, y) (dirtyArray[(y)>>3] & (1<<((y)&7)))
+
 
 /******************************************************************************
  Save States
 ******************************************************************************/
 
+// Identifies each save state written, so that loading one back can tell
+// whether texture RAM still holds it apart from the rows written since. Starts
+// at a random value so that states from earlier runs never match.
+static uint64_t NewStateID(void)
+{
+  static uint64_t nextID = ((uint64_t) std::random_device()() << 32) | std::random_device()();
+  if (++nextID == 0)
+    ++nextID;
+  return nextID;
+}
+
+void CReal3D::UploadSavedTextures(bool all)
+{
+  if (all)
+    Render3D->UploadTextures(0, 0, 0, 2048, 2048);
+  else
+  {
+    // Upload runs of written rows, widened to the 32-row blocks the legacy
+    // renderer invalidates in. Rows in the mipmap area of each 1024-row page
+    // are passed as level 1 too, so the base textures they belong to are
+    // decoded again, as after StoreTexture().
+    unsigned y = 0;
+    while (y < 2048)
+    {
+      if (!TEXTURE_ROW_DIRTY(textureSavedDirty, y))
+      {
+        y++;
+        continue;
+      }
+      unsigned start = y & ~31u;
+      while (y < 2048 && TEXTURE_ROW_DIRTY(textureSavedDirty, y))
+        y++;
+      y = (y + 31) & ~31u;
+      Render3D->UploadTextures(0, 0, start, 2048, y - start);
+      for (unsigned page = start / 1024; page * 1024 < y; page++)
+      {
+        unsigned mipStart = (std::max)(start, page * 1024 + 512);
+        unsigned mipEnd = (std::min)(y, page * 1024 + 1024);
+        if (mipStart < mipEnd)
+          Render3D->UploadTextures(1, 1024, mipStart, 1024, mipEnd - mipStart);
+      }
+    }
+  }
+  memset(textureSavedDirty, 0, sizeof(textureSavedDirty));
+}
+
 void CReal3D::SaveState(CBlockFile *SaveState)
 {
   SaveState->NewBlock("Real3D", __FILE__);
 
-  SaveState->Write(memoryPool, MEM_POOL_SIZE_RW); // Don't write out read-only snapshots or dirty page arrays
+  // Don't write out read-only snapshots or dirty page arrays. Pages written to
+  // since the last delta are those synced to the snapshots since then plus
+  // those still waiting to be.
+  if (m_gpuMultiThreaded)
+  {
+    for (unsigned i = 0; i < MEM_POOL_SIZE_DIRTY; i++)  // dirty page arrays for all regions follow each other
+      stateDirty[i] |= cullingRAMLoDirty[i];
+    SaveState->Write(memoryPool, MEM_POOL_SIZE_RO, stateDirty, PAGE_WIDTH);
+  }
+  else
+    SaveState->Write(memoryPool, MEM_POOL_SIZE_RO);
+  SaveState->Write(&memoryPool[OFFSET_TEXFIFO], MEM_POOL_SIZE_RW - MEM_POOL_SIZE_RO);
   SaveState->Write(&fifoIdx, sizeof(fifoIdx));
   SaveState->Write(m_vromTextureFIFO, sizeof(m_vromTextureFIFO));
 
@@ -102,7 +168,10 @@ void CReal3D::SaveState(CBlockFile *SaveState)
   SaveState->Write(m_internalRenderConfig, sizeof(m_internalRenderConfig));
   SaveState->Write(commandPortWritten);
   SaveState->Write(&m_pingPong, sizeof(m_pingPong));
-  for (int i = 0; i < 39; i++)
+  savedStateID = NewStateID();
+  memset(textureSavedDirty, 0, sizeof(textureSavedDirty));
+  SaveState->Write(&savedStateID, sizeof(savedStateID));
+  for (int i = 0; i < 31; i++)
   {
     uint8_t nul = 0;
     SaveState->Write(&nul, sizeof(uint8_t));
@@ -121,10 +190,13 @@ void CReal3D::LoadState(CBlockFile *SaveState)
 
   SaveState->Read(memoryPool, MEM_POOL_SIZE_RW);
 
-  // If multi-threaded, update read-only snapshots too
+  // If multi-threaded, update read-only snapshots too. Nothing is known about
+  // how memory differs from the last save state delta anymore.
   if (m_gpuMultiThreaded)
+  {
     UpdateSnapshots(true);
-  Render3D->UploadTextures(0, 0, 0, 2048, 2048);
+    memset(stateDirty, 0xFF, MEM_POOL_SIZE_DIRTY);
+  }
   SaveState->Read(&fifoIdx, sizeof(fifoIdx));
   SaveState->Read(&m_vromTextureFIFO, sizeof(m_vromTextureFIFO));
 
@@ -140,13 +212,21 @@ void CReal3D::LoadState(CBlockFile *SaveState)
   UpdateRenderConfig(Render3D, m_internalRenderConfig);
   SaveState->Read(&commandPortWritten);
   SaveState->Read(&m_pingPong, sizeof(m_pingPong));
-  for (int i = 0; i < 39; i++)
+  uint64_t stateID;
+  SaveState->Read(&stateID, sizeof(stateID));  // 0 in states written before IDs were
+  for (int i = 0; i < 31; i++)
   {
     uint8_t nul;
     SaveState->Read(&nul, sizeof(uint8_t));
   }
 
   SaveState->Read(&m_vromTextureFIFOIdx, sizeof(m_vromTextureFIFOIdx));
+
+  // Reloading the state last saved or loaded (as run-ahead does every frame)
+  // only undoes the rows written since, and if there are none the renderer
+  // already has the right textures
+  UploadSavedTextures(stateID == 0 || stateID != savedStateID);
+  savedStateID = stateID;
 }
 
 
@@ -168,6 +248,7 @@ void CReal3D::BeginVBlank(int statusCycles)
   // and in WriteDMARegister32/ReadDMARegister32, however it may be that they are completely unrelated.  It appears that step 1.x games
   // access just the former while step 2.x access the latter.  It is not known yet what this bit/these bits actually represent.
 	statusChange = ppc_total_cycles() + statusCycles;
+	ppc_idle_barrier(statusChange);	// status bit is polled in spin loops; they must not be skipped past the flip
 	m_evenFrame = !m_evenFrame;
 }
 
@@ -185,15 +266,22 @@ uint32_t CReal3D::SyncSnapshots(void)
   if (!m_gpuMultiThreaded)
     return 0;
 
-  // Update read-only queue
-  queuedUploadTexturesRO = queuedUploadTextures;
+  // Update read-only queue. Appended to, as the queue of a frame that isn't
+  // rendered must still be performed by the next one that is.
+  if (m_stageTextures)
+  {
+    queuedUploadTexturesRO.insert(queuedUploadTexturesRO.end(), queuedUploadTexturesStage.begin(), queuedUploadTexturesStage.end());
+    queuedUploadTexturesStage.swap(queuedUploadTextures);
+  }
+  else
+    queuedUploadTexturesRO.insert(queuedUploadTexturesRO.end(), queuedUploadTextures.begin(), queuedUploadTextures.end());
   queuedUploadTextures.clear();
 
   // Update read-only snapshots
   return UpdateSnapshots(false);
 }
 
-uint32_t CReal3D::UpdateSnapshot(bool copyWhole, uint8_t *src, uint8_t *dst, unsigned size, uint8_t *dirty)
+uint32_t CReal3D::UpdateSnapshot(bool copyWhole, uint8_t *src, uint8_t *dst, unsigned size, uint8_t *dirty, uint8_t *stateDirty)
 {
   unsigned dirtySize = DIRTY_SIZE(size);
   if (copyWhole)
@@ -214,6 +302,7 @@ uint32_t CReal3D::UpdateSnapshot(bool copyWhole, uint8_t *src, uint8_t *dst, uns
       uint8_t d = dirty[i];
       if (d)
       {
+        stateDirty[i] |= d;
         for (unsigned j = 0; j < 8; j++)
         {
           if (d&1)
@@ -242,10 +331,26 @@ uint32_t CReal3D::UpdateSnapshot(bool copyWhole, uint8_t *src, uint8_t *dst, uns
 uint32_t CReal3D::UpdateSnapshots(bool copyWhole)
 {
   // Update all memory region snapshots
-  uint32_t cullLoCopied  = UpdateSnapshot(copyWhole, (uint8_t*)cullingRAMLo, (uint8_t*)cullingRAMLoRO, 0x400000, cullingRAMLoDirty);
-  uint32_t cullHiCopied  = UpdateSnapshot(copyWhole, (uint8_t*)cullingRAMHi, (uint8_t*)cullingRAMHiRO, 0x100000, cullingRAMHiDirty);
-  uint32_t polyCopied    = UpdateSnapshot(copyWhole, (uint8_t*)polyRAM,      (uint8_t*)polyRAMRO,      0x400000, polyRAMDirty);
-  uint32_t textureCopied = UpdateSnapshot(copyWhole, (uint8_t*)textureRAM,   (uint8_t*)textureRAMRO,   0x800000, textureRAMDirty);
+  uint32_t cullLoCopied  = UpdateSnapshot(copyWhole, (uint8_t*)cullingRAMLo, (uint8_t*)cullingRAMLoRO, 0x400000, cullingRAMLoDirty, stateDirty);
+  uint32_t cullHiCopied  = UpdateSnapshot(copyWhole, (uint8_t*)cullingRAMHi, (uint8_t*)cullingRAMHiRO, 0x100000, cullingRAMHiDirty, &stateDirty[OFFSET_8E_DIRTY - OFFSET_8C_DIRTY]);
+  uint32_t polyCopied    = UpdateSnapshot(copyWhole, (uint8_t*)polyRAM,      (uint8_t*)polyRAMRO,      0x400000, polyRAMDirty,      &stateDirty[OFFSET_98_DIRTY - OFFSET_8C_DIRTY]);
+  uint32_t textureCopied;
+  uint8_t *textureStateDirty = &stateDirty[OFFSET_TEXRAM_DIRTY - OFFSET_8C_DIRTY];
+  if (m_stageTextures && !copyWhole)
+  {
+    // The scene drawn is a frame behind the one being built, so texture RAM
+    // goes through the stage: the pages copied in last time move on to the
+    // snapshot, and those written since take their place
+    textureCopied  = UpdateSnapshot(false, (uint8_t*)textureRAMStage, (uint8_t*)textureRAMRO, 0x800000, textureRAMStageDirty, textureStateDirty);
+    memcpy(textureRAMStageDirty, textureRAMDirty, DIRTY_SIZE(0x800000));
+    textureCopied += UpdateSnapshot(false, (uint8_t*)textureRAM, (uint8_t*)textureRAMStage, 0x800000, textureRAMDirty, textureStateDirty);
+  }
+  else
+  {
+    textureCopied = UpdateSnapshot(copyWhole, (uint8_t*)textureRAM, (uint8_t*)textureRAMRO, 0x800000, textureRAMDirty, textureStateDirty);
+    if (copyWhole && textureRAMStage != NULL)
+      UpdateSnapshot(true, (uint8_t*)textureRAM, (uint8_t*)textureRAMStage, 0x800000, textureRAMStageDirty, textureStateDirty);
+  }
   //printf("Read3D copied - cullLo:%4uK, cullHi:%4uK, poly:%4uK, texture:%4uK\n", cullLoCopied / 1024, cullHiCopied / 1024, polyCopied / 1024, textureCopied / 1024);
   return cullLoCopied + cullHiCopied + polyCopied + textureCopied;
 }
@@ -266,6 +371,30 @@ void CReal3D::BeginFrame(void)
   Render3D->BeginFrame();
 }
 
+void CReal3D::BuildScene(void)
+{
+  Render3D->BuildScene();
+}
+
+bool CReal3D::QueueScene(void)
+{
+  bool queued = Render3D->QueueScene();
+
+  // Texture RAM is only held back while scenes are queued. When the renderer
+  // stops queuing them, the stage is flushed into the snapshot.
+  if (textureRAMStage != NULL && queued != m_stageTextures)
+  {
+    if (!queued)
+    {
+      UpdateSnapshot(false, (uint8_t*)textureRAMStage, (uint8_t*)textureRAMRO, 0x800000, textureRAMStageDirty, &stateDirty[OFFSET_TEXRAM_DIRTY - OFFSET_8C_DIRTY]);
+      queuedUploadTexturesRO.insert(queuedUploadTexturesRO.end(), queuedUploadTexturesStage.begin(), queuedUploadTexturesStage.end());
+      queuedUploadTexturesStage.clear();
+    }
+    m_stageTextures = queued;
+  }
+  return queued;
+}
+
 void CReal3D::RenderFrame(void)
 {
   //if (commandPortWrittenRO)
@@ -277,6 +406,11 @@ void CReal3D::EndFrame(void)
   Render3D->EndFrame();
 }
 
+Render3DStats CReal3D::GetRenderStats(void)
+{
+  return Render3D->GetFrameStats();
+}
+
 
 /******************************************************************************
  Texture Uploading and Decoding
@@ -439,6 +573,9 @@ void CReal3D::StoreTexture(unsigned level, unsigned xPos, unsigned yPos, unsigne
   }
   else
     Render3D->UploadTextures(level, xPos, yPos, width, height);
+
+  for (uint32_t y = yPos; y < (yPos + height); y++)
+    MARK_DIRTY(textureSavedDirty, y * 2048 * 2);
 }
 
 /*
@@ -523,26 +660,93 @@ void CReal3D::DMACopy(void)
 {
   DebugLog("Real3D DMA copy (PC=%08X, LR=%08X): %08X -> %08X, %X %s\n", ppc_get_pc(), ppc_get_lr(), dmaSrc, dmaDest, dmaLength*4, (dmaConfig&0x80)?"(byte reversed)":"");
   //printf("Real3D DMA copy (PC=%08X, LR=%08X): %08X -> %08X, %X %s\n", ppc_get_pc(), ppc_get_lr(), dmaSrc, dmaDest, dmaLength*4, (dmaConfig&0x80)?"(byte reversed)":"");
-  if ((dmaConfig&0x80)) // reverse bytes
+  bool reverse = (dmaConfig&0x80) != 0;
+  const BusPageMap *pageMap = Bus->GetPageMap();
+  while (dmaLength != 0)
   {
-    while (dmaLength != 0)
+    // Resolve source: plain memory is read directly, one page at a time
+    const uint8_t *srcPage = (pageMap != NULL && (dmaSrc&3) == 0) ? pageMap->read[dmaSrc >> BusPageMap::PageBits] : NULL;
+    uint32_t srcLeft = ((BusPageMap::PageMask + 1) - (dmaSrc & BusPageMap::PageMask)) / 4;
+
+    // Resolve destination: Real3D memory is written directly (the bus would byte reverse each word, so an unreversed
+    // transfer stores swapped words), other plain memory through the page map
+    uint32_t *dest = NULL;
+    uint8_t *dirty = NULL;
+    uint32_t destOffset = 0;
+    uint32_t destLeft = 0;
+    bool swap = reverse;
+    if ((dmaDest&3) == 0)
     {
-      uint32_t  data = Bus->Read32(dmaSrc);
-      Bus->Write32(dmaDest, FLIPENDIAN32(data));
-      dmaSrc += 4;
-      dmaDest += 4;
-      --dmaLength;
+      switch (dmaDest >> 24)
+      {
+      case 0x8C:
+        destOffset = dmaDest & 0x3FFFFF;
+        dest = &cullingRAMLo[destOffset/4];
+        destLeft = (0x400000 - destOffset) / 4;
+        dirty = cullingRAMLoDirty;
+        swap = !reverse;
+        break;
+      case 0x8E:
+        destOffset = dmaDest & 0xFFFFF;
+        dest = &cullingRAMHi[destOffset/4];
+        destLeft = (0x100000 - destOffset) / 4;
+        dirty = cullingRAMHiDirty;
+        swap = !reverse;
+        break;
+      case 0x94:
+        if (fifoIdx < (0x100000/4)) // on overflow, WriteTextureFIFO() below reports the error
+        {
+          dest = &textureFIFO[fifoIdx];
+          destLeft = (0x100000/4) - fifoIdx;
+          swap = !reverse;
+        }
+        break;
+      case 0x98:
+        destOffset = dmaDest & 0x3FFFFF;
+        dest = &polyRAM[destOffset/4];
+        destLeft = (0x400000 - destOffset) / 4;
+        dirty = polyRAMDirty;
+        swap = !reverse;
+        break;
+      default:
+        break;
+      }
     }
-  }
-  else
-  {
-    while (dmaLength != 0)
+
+    if (srcPage != NULL && dest != NULL)
     {
-      Bus->Write32(dmaDest, Bus->Read32(dmaSrc));
-      dmaSrc += 4;
-      dmaDest += 4;
-      --dmaLength;
+      // Bulk copy
+      uint32_t count = std::min(dmaLength, std::min(srcLeft, destLeft));
+      const uint8_t *src = &srcPage[dmaSrc & BusPageMap::PageMask];
+      if (swap)
+        Util::CopyFlipEndian32((uint8_t *) dest, src, count*4);
+      else
+        memcpy(dest, src, count*4);
+      if ((dmaDest >> 24) == 0x94)
+        fifoIdx += count;
+      else if (dirty != NULL && m_gpuMultiThreaded)
+      {
+        for (uint32_t addr = destOffset & ~(PAGE_SIZE-1); addr < destOffset + count*4; addr += PAGE_SIZE)
+          MARK_DIRTY(dirty, addr);
+      }
+      dmaSrc += count*4;
+      dmaDest += count*4;
+      dmaLength -= count;
+      continue;
     }
+
+    // Anything else (MMIO, unaligned addresses) goes through the bus one word at a time
+    uint8_t *destPage = (pageMap != NULL && dest == NULL && (dmaDest&3) == 0) ? pageMap->write[dmaDest >> BusPageMap::PageBits] : NULL;
+    uint32_t data = srcPage ? *(const uint32_t *) &srcPage[dmaSrc & BusPageMap::PageMask] : Bus->Read32(dmaSrc);
+    if (reverse)
+      data = FLIPENDIAN32(data);
+    if (destPage)
+      *(uint32_t *) &destPage[dmaDest & BusPageMap::PageMask] = data;
+    else
+      Bus->Write32(dmaDest, data);
+    dmaSrc += 4;
+    dmaDest += 4;
+    --dmaLength;
   }
 }
 
@@ -871,6 +1075,7 @@ void CReal3D::Reset(void)
   commandPortWrittenRO = false;
 
   queuedUploadTextures.clear();
+  queuedUploadTexturesStage.clear();
   queuedUploadTexturesRO.clear();
 
   fifoIdx = 0;
@@ -884,8 +1089,12 @@ void CReal3D::Reset(void)
   dmaStatus = 0;
   dmaConfig = 0;
 
-  unsigned memSize = (m_gpuMultiThreaded ? MEMORY_POOL_SIZE : MEM_POOL_SIZE_RW);
+  unsigned memSize = (m_gpuMultiThreaded ? MEMORY_POOL_SIZE : MEM_POOL_SIZE_RW) + (m_pipelineTextures ? MEM_POOL_SIZE_STAGE : 0);
   memset(memoryPool, 0, memSize);
+  if (m_gpuMultiThreaded)
+    memset(stateDirty, 0xFF, MEM_POOL_SIZE_DIRTY);
+  memset(textureSavedDirty, 0xFF, sizeof(textureSavedDirty));
+  savedStateID = 0;
   memset(m_vromTextureFIFO, 0, sizeof(m_vromTextureFIFO));
   memset(m_internalRenderConfig, 0, sizeof(m_internalRenderConfig));
 
@@ -975,7 +1184,7 @@ void CReal3D::SetStepping(int stepping, uint32_t pciIDValue)
 
 bool CReal3D::Init(const uint8_t *vromPtr, IBus *BusObjectPtr, CIRQ *IRQObjectPtr, unsigned dmaIRQBit)
 {
-  uint32_t memSize = (m_gpuMultiThreaded ? MEMORY_POOL_SIZE : MEM_POOL_SIZE_RW);
+  uint32_t memSize = (m_gpuMultiThreaded ? MEMORY_POOL_SIZE : MEM_POOL_SIZE_RW) + (m_pipelineTextures ? MEM_POOL_SIZE_STAGE : 0);
   float  memSizeMB = (float)memSize/(float)0x100000;
 
   // IRQ and bus objects
@@ -1006,6 +1215,14 @@ bool CReal3D::Init(const uint8_t *vromPtr, IBus *BusObjectPtr, CIRQ *IRQObjectPt
     cullingRAMHiDirty = (uint8_t *) &memoryPool[OFFSET_8E_DIRTY];
     polyRAMDirty = (uint8_t *) &memoryPool[OFFSET_98_DIRTY];
     textureRAMDirty = (uint8_t *) &memoryPool[OFFSET_TEXRAM_DIRTY];
+    stateDirty = (uint8_t *) &memoryPool[OFFSET_STATE_DIRTY];
+  }
+
+  // Texture RAM stage for pipeline depth 3, used once scenes are queued
+  if (m_pipelineTextures)
+  {
+    textureRAMStage = (uint16_t *) &memoryPool[OFFSET_TEXRAM_STAGE];
+    textureRAMStageDirty = (uint8_t *) &memoryPool[OFFSET_TEXRAM_STAGE_DIRTY];
   }
 
   // VROM pointer passed to us
@@ -1017,10 +1234,14 @@ bool CReal3D::Init(const uint8_t *vromPtr, IBus *BusObjectPtr, CIRQ *IRQObjectPt
 
 CReal3D::CReal3D(const Util::Config::Node &config)
   : m_config(config),
-    m_gpuMultiThreaded(config["GPUMultiThreaded"].ValueAs<bool>())
+    m_gpuMultiThreaded(config["GPUMultiThreaded"].ValueAs<bool>()),
+    m_pipelineTextures(m_gpuMultiThreaded && config["PipelineDepth"].ValueAsDefault<unsigned>(1) >= 3)
 {
   Render3D = NULL;
   memoryPool = NULL;
+  textureRAMStage = NULL;
+  textureRAMStageDirty = NULL;
+  m_stageTextures = false;
   cullingRAMLo = NULL;
   cullingRAMHi = NULL;
   polyRAM = NULL;
@@ -1034,6 +1255,8 @@ CReal3D::CReal3D(const Util::Config::Node &config)
   m_vromTextureFIFOIdx = 0;
   m_internalRenderConfig[0] = 0;
   m_internalRenderConfig[1] = 0;
+  memset(textureSavedDirty, 0xFF, sizeof(textureSavedDirty));
+  savedStateID = 0;
   DebugLog("Built Real3D\n");
 }
 
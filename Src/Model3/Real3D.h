@@ -159,6 +159,30 @@ public:
    */
   void RenderFrame(void);
 
+  /*
+   * BuildScene(void):
+   *
+   * Optionally called before RenderFrame() to traverse the scene database
+   * ahead of time. It makes no graphics API calls and may run on a different
+   * thread than the other rendering functions, concurrently with BeginFrame().
+   */
+  void BuildScene(void);
+
+  /*
+   * QueueScene(void):
+   *
+   * Hands the scene built by the last BuildScene() to the next RenderFrame(),
+   * so that BuildScene() can start on the next frame while it is drawn. While
+   * scenes are queued, the texture RAM snapshot is kept a frame behind, to
+   * match the scene drawn. Must be called before BeginFrame() and while
+   * BuildScene() is not running. Only used with pipeline depth 3.
+   *
+   * Returns:
+   *    False if the renderer can't queue scenes. RenderFrame() then builds the
+   *    current frame as usual.
+   */
+  bool QueueScene(void);
+
   /*
    * EndFrame(void):
    *
@@ -167,6 +191,14 @@ public:
    * may be running in a separate thread.
    */
   void EndFrame(void);
+
+  /*
+   * GetRenderStats(void):
+   *
+   * Returns:
+   *    Draw submission counts of the renderer for the last frame.
+   */
+  Render3DStats GetRenderStats(void);
   
   /*
    * Flush(void):
@@ -435,11 +467,14 @@ private:
 
   void      UploadTexture(uint32_t header, const uint16_t *texData);
   uint32_t  UpdateSnapshots(bool copyWhole);
-  uint32_t  UpdateSnapshot(bool copyWhole, uint8_t *src, uint8_t *dst, unsigned size, uint8_t *dirty);
+  uint32_t  UpdateSnapshot(bool copyWhole, uint8_t *src, uint8_t *dst, unsigned size, uint8_t *dirty, uint8_t *stateDirty);
+  void      UploadSavedTextures(bool all);
 
   // Config 
   const Util::Config::Node &m_config;
   const bool                m_gpuMultiThreaded;
+  const bool                m_pipelineTextures; // texture RAM stage is allocated (pipeline depth 3)
+  bool                      m_stageTextures;    // scenes are being queued, so textures go through the stage
 
   // Renderer attached to the Real3D
   IRender3D *Render3D;
@@ -468,15 +503,25 @@ private:
   uint32_t  *cullingRAMHiRO;    // 1MB of culling RAM at 8E000000 [read-only snapshot]
   uint32_t  *polyRAMRO;         // 4MB of polygon RAM at 98000000 [read-only snapshot]
   uint16_t  *textureRAMRO;      // 8MB of internal texture RAM    [read-only snapshot]
+  uint16_t  *textureRAMStage;   // 8MB of internal texture RAM    [next read-only snapshot, with pipeline depth 3]
   
   // Arrays to keep track of dirty pages in memory regions
   uint8_t   *cullingRAMLoDirty;
   uint8_t   *cullingRAMHiDirty;
   uint8_t   *polyRAMDirty;
   uint8_t   *textureRAMDirty;
+  uint8_t   *textureRAMStageDirty;  // pages in the stage not yet in the snapshot
+  uint8_t   *stateDirty;        // all of the above, accumulated since the last save state delta
+
+  // Texture RAM rows (one 4KB page each) written since the state identified
+  // by savedStateID was saved or loaded. Reloading that same state, as
+  // run-ahead does every frame, only has to upload these again.
+  uint8_t   textureSavedDirty[2048/8];
+  uint64_t  savedStateID;       // 0 if texture RAM matches no known state
 
   // Queued texture uploads
   std::vector<QueuedUploadTextures> queuedUploadTextures;
+  std::vector<QueuedUploadTextures> queuedUploadTexturesStage;  // Queue of the texture RAM stage
   std::vector<QueuedUploadTextures> queuedUploadTexturesRO;  // Read-only copy of queue
   
   // Big endian bus object for DMA memory access
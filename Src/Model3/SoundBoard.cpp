@@ -351,14 +351,26 @@ void CSoundBoard::WriteMIDIPort(UINT8 data)
 		DSB->SendCommand(data);
 }
 
-bool CSoundBoard::RunFrame(void)
+bool CSoundBoard::RunFrame(bool outputAudio)
 {
+	// The DSB only needs the SCSP audio for its final mix, so its CPU can run
+	// on its own thread in the meantime
+	bool dsbThreaded = false;
+	if ((NULL != DSB) && StartThreads())
+	{
+		dsbThreaded = dsbThreadSync->Post();
+		if (!dsbThreaded)
+		{
+			ErrorLog("Threading error in CSoundBoard::RunFrame: %s\nRunning DSB on the sound board thread.", CThread::GetLastError());
+			m_multiThreaded = false;
+		}
+	}
+
 	// Run sound board first to generate SCSP audio
-	if (m_config["EmulateSound"].ValueAs<bool>())
+	if (m_emulateSound.Get())
 	{
 		M68KSetContext(&M68K);
 		SCSP_Update();
-		M68KGetContext(&M68K);
 	}
 	else
 	{
@@ -369,7 +381,7 @@ bool CSoundBoard::RunFrame(void)
 	}
 
 	// Compute sound volume as 
-	INT32 soundVol = m_config["SoundVolume"].ValueAs<int>();
+	INT32 soundVol = m_soundVolume.Get();
 	soundVol = (INT32)((float)0x100 * (float)soundVol / 100.0f);
 
 	// Apply sound volume setting to SCSP channels only
@@ -382,17 +394,31 @@ bool CSoundBoard::RunFrame(void)
 
 	// Run DSB and mix with existing audio, apply music volume
 	if (NULL != DSB) {
-		// Will need to mix with proper front, rear channels or both (game specific)
-		bool mixDSBWithFront = true; // Everything to front channels for now
-		// Case "both" not handled for now
-		if (mixDSBWithFront)
-			DSB->RunFrame(audioFL, audioFR);
-		else
-			DSB->RunFrame(audioRL, audioRR);
+		bool dsbDone = true;
+		if (!dsbThreaded)
+			DSB->RunCPUFrame();
+		else if (!dsbThreadDone->Wait())
+		{
+			ErrorLog("Threading error in CSoundBoard::RunFrame: %s\nRunning DSB on the sound board thread.", CThread::GetLastError());
+			m_multiThreaded = false;
+			dsbDone = false;
+		}
+
+		if (dsbDone) {
+			// Will need to mix with proper front, rear channels or both (game specific)
+			bool mixDSBWithFront = true; // Everything to front channels for now
+			// Case "both" not handled for now
+			if (mixDSBWithFront)
+				DSB->MixFrame(audioFL, audioFR);
+			else
+				DSB->MixFrame(audioRL, audioRR);
+		}
 	}
 
 	// Output the audio buffers
-	bool bufferFull = OutputAudio(NUM_SAMPLES_PER_FRAME, audioFL, audioFR, audioRL, audioRR, m_config["FlipStereo"].ValueAs<bool>());
+	if (!outputAudio)
+		return true;
+	bool bufferFull = OutputAudio(NUM_SAMPLES_PER_FRAME, audioFL, audioFR, audioRL, audioRR, m_flipStereo.Get());
 
 #ifdef SUPERMODEL_LOG_AUDIO
 	// Output to binary file
@@ -418,7 +444,6 @@ void CSoundBoard::Reset(void)
 	M68KSetContext(&M68K);
 	M68KReset();
 	//printf("SBrd PC=%06X\n", M68KGetPC());
-	M68KGetContext(&M68K);
 	if (NULL != DSB)
 		DSB->Reset();
 	DebugLog("Sound Board Reset\n");
@@ -457,15 +482,84 @@ void CSoundBoard::LoadState(CBlockFile *SaveState)
 	UpdateROMBanks();
 	
 	// All other devices
-	M68KSetContext(&M68K);	// so we don't lose callback pointers when copying context back
+	M68KSetContext(&M68K);
 	M68KLoadState(SaveState, "Sound Board 68K");
-	M68KGetContext(&M68K);
 	SCSP_LoadState(SaveState);
 	if (NULL != DSB)
 		DSB->LoadState(SaveState);
 }
 
 
+/******************************************************************************
+ DSB Thread
+ 
+ Each 68K has its own context and the binding is per thread (see CPU/68K.h),
+ so the DSB CPU can run at the same time as the sound board 68K. The thread
+ only ever runs between the Post() and Wait() in RunFrame(), so resets and
+ save states never race with it.
+******************************************************************************/
+
+bool CSoundBoard::StartThreads(void)
+{
+	if (dsbThread != NULL)
+		return true;
+	if (!m_multiThreaded)
+		return false;
+
+	dsbThreadSync = CThread::CreateSemaphore(0);
+	dsbThreadDone = CThread::CreateSemaphore(0);
+	if ((dsbThreadSync != NULL) && (dsbThreadDone != NULL))
+		dsbThread = CThread::CreateThread("DSB", StartDSBThread, this);
+	if (dsbThread == NULL)
+	{
+		ErrorLog("Unable to create DSB thread: %s\nRunning DSB on the sound board thread.", CThread::GetLastError());
+		StopThreads();
+		m_multiThreaded = false;
+		return false;
+	}
+	return true;
+}
+
+void CSoundBoard::StopThreads(void)
+{
+	if (dsbThread != NULL)
+	{
+		dsbThreadQuit = true;
+		if (dsbThreadSync->Post())
+			dsbThread->Wait();
+		delete dsbThread;
+		dsbThread = NULL;
+		dsbThreadQuit = false;
+	}
+	if (dsbThreadSync != NULL)
+	{
+		delete dsbThreadSync;
+		dsbThreadSync = NULL;
+	}
+	if (dsbThreadDone != NULL)
+	{
+		delete dsbThreadDone;
+		dsbThreadDone = NULL;
+	}
+}
+
+int CSoundBoard::StartDSBThread(void *data)
+{
+	return ((CSoundBoard *) data)->RunDSBThread();
+}
+
+int CSoundBoard::RunDSBThread(void)
+{
+	while (dsbThreadSync->Wait() && !dsbThreadQuit)
+	{
+		DSB->RunCPUFrame();
+		if (!dsbThreadDone->Post())
+			break;
+	}
+	return 0;
+}
+
+
 /******************************************************************************
  Configuration, Initialization, and Shutdown
 ******************************************************************************/
@@ -506,7 +600,6 @@ bool CSoundBoard::Init(const UINT8 *soundROMPtr, const UINT8 *sampleROMPtr)
 	M68KInit();
 	M68KAttachBus(this);
 	M68KSetIRQCallback(IRQAck);
-	M68KGetContext(&M68K);
 		
 	// Initialize SCSPs
 	SCSP_SetBuffers(audioFL, audioFR, audioRL, audioRR, NUM_SAMPLES_PER_FRAME);
@@ -537,10 +630,22 @@ CDSB *CSoundBoard::GetDSB(void)
 }
 
 CSoundBoard::CSoundBoard(const Util::Config::Node &config)
-  : m_config(config)
+  : m_config(config),
+    m_emulateSound(config["EmulateSound"], true),
+    m_soundVolume(config["SoundVolume"], 100),
+    m_flipStereo(config["FlipStereo"], false)
 {
 	DSB = NULL;
 	memoryPool = NULL;
+	// The 68K core can only run two boards at once where it is reentrant
+	m_multiThreaded = M68K_REENTRANT && [&config]() {
+		try { return config["MultiThreaded"].ValueAs<bool>(); }
+		catch (...) { return false; }
+	}();
+	dsbThread = NULL;
+	dsbThreadSync = NULL;
+	dsbThreadDone = NULL;
+	dsbThreadQuit = false;
 	ram1 = NULL;
 	ram2 = NULL;
 	audioFL = NULL;
@@ -573,6 +678,7 @@ CSoundBoard::~CSoundBoard(void)
 	fclose(soundFP);
 #endif
 
+	StopThreads();
 	SCSP_Deinit();
 	
 	DSB = NULL;
@@ -106,11 +106,18 @@ public:
 	void LoadState(CBlockFile *SaveState);
 
 	/*
-	 * RunFrame(void):
+	 * RunFrame(outputAudio):
 	 *
 	 * Runs the sound board for one frame, updating sound in the process.
+	 *
+	 * Parameters:
+	 *		outputAudio		If false, the frame's audio is generated but not
+	 *						output.
+	 *
+	 * Returns:
+	 *		True if the audio buffer is full (or nothing was output).
 	 */
-	bool RunFrame(void);
+	bool RunFrame(bool outputAudio);
 	
 	/*
 	 * Reset(void):
@@ -182,12 +189,29 @@ public:
 private:
 	// Private helper functions
 	void		UpdateROMBanks(void);
+
+	// DSB thread
+	bool		StartThreads(void);
+	void		StopThreads(void);
+	static int	StartDSBThread(void *data);
+	int			RunDSBThread(void);
 	
 	// Config
 	const Util::Config::Node &m_config;
+	Util::Config::Binding<bool> m_emulateSound;
+	Util::Config::Binding<int>	m_soundVolume;
+	Util::Config::Binding<bool> m_flipStereo;
 
 	// Digital Sound Board
 	CDSB		*DSB;
+
+	// DSB thread: with MultiThreaded set, the DSB CPU runs its frame while the
+	// SCSP 68K runs on the calling thread
+	bool		m_multiThreaded;
+	CThread		*dsbThread;
+	CSemaphore	*dsbThreadSync;		// posted to start a DSB frame
+	CSemaphore	*dsbThreadDone;		// posted when the DSB frame is done
+	bool		dsbThreadQuit;
 	
 	// 68K context
 	M68KCtx		M68K;
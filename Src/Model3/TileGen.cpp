@@ -43,6 +43,15 @@
  * The read-only copy of the palette, which is generated for the renderer, only
  * stores the two computed palettes.
  *
+ * Dirty Lines
+ * -----------
+ *
+ * The renderer only redraws and uploads the scanlines of each layer that may
+ * have changed since the last frame it drew. Writes to the name tables, scroll
+ * and mask tables, and layer registers map to lines directly. Pattern and
+ * palette writes are only resolved into lines when the frame is synced, by
+ * checking which name table entries refer to the modified tiles and banks.
+ *
  * TO-DO List:
  * -----------
  * - For consistency, the registers should probably be byte reversed (this is a
@@ -77,7 +86,10 @@
 #define OFFSET_PAL_B_DIRTY	(OFFSET_PAL_A_DIRTY+DIRTY_SIZE(0x20000))
 #define MEM_POOL_SIZE_DIRTY (DIRTY_SIZE(0x120000)+2*DIRTY_SIZE(0x20000))	// VRAM + 2 palette dirty buffers
 
-#define MEMORY_POOL_SIZE	(MEM_POOL_SIZE_RW+MEM_POOL_SIZE_RO+MEM_POOL_SIZE_DIRTY)
+#define OFFSET_VRAM_STATE_DIRTY	(OFFSET_VRAM_DIRTY+MEM_POOL_SIZE_DIRTY)	// VRAM pages changed since last save state delta
+#define MEM_POOL_SIZE_STATE_DIRTY	(DIRTY_SIZE(0x120000))
+
+#define MEMORY_POOL_SIZE	(MEM_POOL_SIZE_RW+MEM_POOL_SIZE_RO+MEM_POOL_SIZE_DIRTY+MEM_POOL_SIZE_STATE_DIRTY)
 
 
 /******************************************************************************
@@ -87,7 +99,16 @@
 void CTileGen::SaveState(CBlockFile *SaveState)
 {
 	SaveState->NewBlock("Tile Generator", __FILE__);
-	SaveState->Write(vram, 0x120000); // Don't write out palette, read-only snapshots or dirty page arrays, just VRAM
+	
+	// Don't write out palette, read-only snapshots or dirty page arrays, just VRAM
+	if (m_gpuMultiThreaded)
+	{
+		for (unsigned i = 0; i < MEM_POOL_SIZE_STATE_DIRTY; i++)
+			vramStateDirty[i] |= vramDirty[i];
+		SaveState->Write(vram, 0x120000, vramStateDirty, PAGE_WIDTH);
+	}
+	else
+		SaveState->Write(vram, 0x120000);
 	SaveState->Write(regs, sizeof(regs));
 }
 
@@ -111,10 +132,14 @@ void CTileGen::LoadState(CBlockFile *SaveState)
 	
 	// Because regs were read after palette, must recompute
 	RecomputePalettes();
+	MarkLayersDirty(0, 4);
 	
 	// If multi-threaded, update read-only snapshots too
 	if (m_gpuMultiThreaded)
+	{
 		UpdateSnapshots(true);
+		memset(vramStateDirty, 0xFF, MEM_POOL_SIZE_STATE_DIRTY);
+	}
 }
 
 
@@ -169,7 +194,10 @@ UINT32 CTileGen::SyncSnapshots(void)
 	{
 		RecomputePalettes();
 		recomputePalettes = false;
+		MarkLayersDirty(0, 4);	// both palettes are rebuilt
 	}
+
+	UpdateDirtyLines();
 	
 	if (!m_gpuMultiThreaded)
 		return 0;
@@ -178,7 +206,7 @@ UINT32 CTileGen::SyncSnapshots(void)
 	return UpdateSnapshots(false);
 }
 
-UINT32 CTileGen::UpdateSnapshot(bool copyWhole, UINT8 *src, UINT8 *dst, unsigned size, UINT8 *dirty)
+UINT32 CTileGen::UpdateSnapshot(bool copyWhole, UINT8 *src, UINT8 *dst, unsigned size, UINT8 *dirty, UINT8 *stateDirty)
 {
 	unsigned dirtySize = DIRTY_SIZE(size);
 	if (copyWhole)
@@ -199,6 +227,8 @@ UINT32 CTileGen::UpdateSnapshot(bool copyWhole, UINT8 *src, UINT8 *dst, unsigned
 			UINT8 d = dirty[i];
 			if (d)
 			{
+				if (stateDirty != NULL)
+					stateDirty[i] |= d;
 				for (unsigned j = 0; j < 8; j++)
 				{
 					if (d&1)
@@ -227,21 +257,135 @@ UINT32 CTileGen::UpdateSnapshot(bool copyWhole, UINT8 *src, UINT8 *dst, unsigned
 UINT32 CTileGen::UpdateSnapshots(bool copyWhole)
 {
 	// Update all memory region snapshots
-	UINT32 palACopied  = UpdateSnapshot(copyWhole, (UINT8*)pal[0],  (UINT8*)palRO[0],  0x020000, palDirty[0]);
-	UINT32 palBCopied  = UpdateSnapshot(copyWhole, (UINT8*)pal[1],  (UINT8*)palRO[1],  0x020000, palDirty[1]);
-	UINT32 vramCopied = UpdateSnapshot(copyWhole, (UINT8*)vram, (UINT8*)vramRO, 0x120000, vramDirty);
+	UINT32 palACopied  = UpdateSnapshot(copyWhole, (UINT8*)pal[0],  (UINT8*)palRO[0],  0x020000, palDirty[0], NULL);
+	UINT32 palBCopied  = UpdateSnapshot(copyWhole, (UINT8*)pal[1],  (UINT8*)palRO[1],  0x020000, palDirty[1], NULL);
+	UINT32 vramCopied = UpdateSnapshot(copyWhole, (UINT8*)vram, (UINT8*)vramRO, 0x120000, vramDirty, vramStateDirty);
 	memcpy(regsRO, regs, sizeof(regs)); // Always copy whole of regs buffer
 	//printf("TileGen copied - palA:%4uK, palB:%4uK, vram:%4uK, regs:%uK\n", palACopied / 1024, palBCopied / 1024, vramCopied / 1024, sizeof(regs) / 1024);
 	return palACopied + palBCopied + vramCopied + sizeof(regs);
 }
 
+void CTileGen::MarkLinesDirty(UINT32 addr)
+{
+	if (addr >= 0x100000)
+	{
+		unsigned bank = (addr - 0x100000) >> 6;	// 16 colors
+		dirtyBanks[bank] = 1;
+		dirtyBanks256[bank >> 4] = 1;
+		anyDirtyBanks = true;
+		return;
+	}
+
+	// Tiles may be fetched from anywhere below the palette, tables included
+	dirtyTiles[addr >> 5] = 1;
+	anyDirtyTiles = true;
+
+	if (addr >= 0xF8000)		// name tables, 64x64 entries of 16 bits per layer
+	{
+		unsigned layer = (addr - 0xF8000) >> 13;
+		dirtyTileRows[layer] |= UINT64(1) << ((addr >> 7) & 63);
+	}
+	else if (addr >= 0xF7000)	// layer mask, one word per line for all layers
+	{
+		unsigned line = (addr - 0xF7000) >> 2;
+		if (line < 384)
+		{
+			for (unsigned layer = 0; layer < 4; layer++)
+				dirtyLines[layer][line] = 1;
+		}
+	}
+	else if (addr >= 0xF6000)	// horizontal scroll tables, 16 bits per line
+	{
+		unsigned layer = (addr - 0xF6000) >> 10;
+		unsigned line = (addr & 0x3FF) >> 1;
+		for (unsigned i = line; i < line + 2 && i < 384; i++)	// word covers two lines
+			dirtyLines[layer][i] = 1;
+	}
+}
+
+void CTileGen::ResetDirtyLines(void)
+{
+	// Everything has to be drawn again
+	memset(dirtyLines, 0, sizeof(dirtyLines));
+	memset(dirtyTileRows, 0, sizeof(dirtyTileRows));
+	memset(dirtyTiles, 0, sizeof(dirtyTiles));
+	memset(dirtyBanks, 0, sizeof(dirtyBanks));
+	memset(dirtyBanks256, 0, sizeof(dirtyBanks256));
+	anyDirtyTiles = false;
+	anyDirtyBanks = false;
+	MarkLayersDirty(0, 4);
+	memset(dirtyLinesRO, 1, sizeof(dirtyLinesRO));
+}
+
+void CTileGen::MarkLayersDirty(unsigned firstLayer, unsigned numLayers)
+{
+	for (unsigned layer = firstLayer; layer < firstLayer + numLayers; layer++)
+		dirtyLayers[layer] = true;
+}
+
+void CTileGen::UpdateDirtyLines(void)
+{
+	// Find the name table rows that refer to a modified tile or palette bank
+	if (anyDirtyTiles || anyDirtyBanks)
+	{
+		for (unsigned layer = 0; layer < 4; layer++)
+		{
+			if (dirtyLayers[layer])
+				continue;
+
+			bool is4Bit = (regs[0x20/4] & (1 << (12 + layer))) != 0;
+			const UINT16 *nameTable = (const UINT16 *) &vram[0xF8000 + layer * 0x2000];
+			for (unsigned row = 0; row < 64; row++)
+			{
+				if (dirtyTileRows[layer] & (UINT64(1) << row))
+					continue;
+				for (unsigned i = 0; i < 64; i++)
+				{
+					UINT16 tile = nameTable[row * 64 + i];
+					bool dirty;
+					if (is4Bit)
+						dirty = dirtyTiles[((tile & 0x3FFF) << 1) | ((tile >> 15) & 1)] || dirtyBanks[(tile & 0x7FF0) >> 4];
+					else
+						dirty = dirtyTiles[(tile & 0x3FFF) * 2] || dirtyTiles[(tile & 0x3FFF) * 2 + 1] || dirtyBanks256[(tile & 0x7F00) >> 8];
+					if (dirty)
+					{
+						dirtyTileRows[layer] |= UINT64(1) << row;
+						break;
+					}
+				}
+			}
+		}
+
+		memset(dirtyTiles, 0, sizeof(dirtyTiles));
+		memset(dirtyBanks, 0, sizeof(dirtyBanks));
+		memset(dirtyBanks256, 0, sizeof(dirtyBanks256));
+		anyDirtyTiles = false;
+		anyDirtyBanks = false;
+	}
+
+	// Resolve into lines with the final scroll values. These accumulate until a
+	// frame is actually drawn.
+	for (unsigned layer = 0; layer < 4; layer++)
+	{
+		UINT8 *lines = dirtyLinesRO[layer];
+		if (dirtyLayers[layer])
+			memset(lines, 1, 384);
+		else
+		{
+			unsigned vScroll = (regs[0x60/4 + layer] >> 16) & 0x1FF;
+			for (unsigned y = 0; y < 384; y++)
+				lines[y] |= dirtyLines[layer][y] | ((dirtyTileRows[layer] >> (((y + vScroll) / 8) & 63)) & 1);
+		}
+		dirtyLayers[layer] = false;
+		dirtyTileRows[layer] = 0;
+	}
+	memset(dirtyLines, 0, sizeof(dirtyLines));
+}
+
 void CTileGen::BeginFrame(void)
 {
-	// NOTE: Render2D->WriteVRAM(addr, data) is no longer being called for RAM addresses that are written
-	// to and instead this class relies upon the fact that Render2D currently marks everything as dirty
-	// with every frame.  If this were to change in the future then code to handle marking the correct
-	// parts of the renderer as dirty would need to be added here.
-	
+	// Render2D redraws the lines in dirtyLinesRO, which were worked out by
+	// SyncSnapshots() from the writes made since the last frame was drawn.
 	Render2D->BeginFrame();
 }
 
@@ -250,6 +394,16 @@ void CTileGen::PreRenderFrame(void)
   Render2D->PreRenderFrame();
 }
 
+void CTileGen::DrawSurfaces(void)
+{
+  Render2D->DrawSurfaces();
+}
+
+void CTileGen::UploadSurfaces(void)
+{
+  Render2D->UploadSurfaces();
+}
+
 void CTileGen::RenderFrameBottom(void)
 {
   Render2D->RenderFrameBottom();
@@ -263,6 +417,7 @@ void CTileGen::RenderFrameTop(void)
 void CTileGen::EndFrame(void)
 {
 	Render2D->EndFrame();
+	memset(dirtyLinesRO, 0, sizeof(dirtyLinesRO));
 }
 
 /******************************************************************************
@@ -278,6 +433,9 @@ void CTileGen::WriteRAM32(unsigned addr, UINT32 data)
 {
 	if (m_gpuMultiThreaded)
 		MARK_DIRTY(vramDirty, addr);
+	MarkLinesDirty(addr);
+	if (addr & 3)	// 16-bit writes may straddle two words
+		MarkLinesDirty(addr + 3);
 	*(UINT32 *) &vram[addr] = data;
 		
 	// Update palette if required
@@ -415,11 +573,17 @@ void CTileGen::WriteRegister(unsigned reg, UINT32 data)
   case 0x00:
 	case 0x08:
 	case 0x0C:
-	case 0x20:
-	case 0x60:
+		break;
+	case 0x20:	// layer configuration
+		if (regs[reg/4] != data)
+			MarkLayersDirty(0, 4);
+		break;
+	case 0x60:	// layer scroll
 	case 0x64:
 	case 0x68:
 	case 0x6C:
+		if (regs[reg/4] != data)
+			MarkLayersDirty((reg - 0x60) / 4, 1);
 		break;
 	case 0x40:	// layer A/A' color offset
 	case 0x44:	// layer B/B' color offset
@@ -448,12 +612,16 @@ void CTileGen::Reset(void)
 {
 	unsigned memSize = (m_gpuMultiThreaded ? MEMORY_POOL_SIZE : MEM_POOL_SIZE_RW);
 	memset(memoryPool, 0, memSize);
+	if (m_gpuMultiThreaded)
+		memset(vramStateDirty, 0xFF, MEM_POOL_SIZE_STATE_DIRTY);
 	memset(regs, 0, sizeof(regs));
 	memset(regsRO, 0, sizeof(regsRO));
 	
 	InitPalette();
 	recomputePalettes = false;
 
+	ResetDirtyLines();
+
 	DebugLog("Tile Generator reset\n");
 }
 
@@ -479,6 +647,7 @@ void CTileGen::AttachRenderer(CRender2D *Render2DPtr)
 		Render2D->AttachPalette((const UINT32 **)pal);
 		Render2D->AttachRegisters(regs);
 	}
+	Render2D->AttachDirtyLines(&dirtyLinesRO[0][0]);
 
 	DebugLog("Tile Generator attached a Render2D object\n");
 }
@@ -508,6 +677,7 @@ bool CTileGen::Init(CIRQ *IRQObjectPtr)
 		vramDirty = (UINT8 *) &memoryPool[OFFSET_VRAM_DIRTY];
 		palDirty[0] = (UINT8 *) &memoryPool[OFFSET_PAL_A_DIRTY];
 		palDirty[1] = (UINT8 *) &memoryPool[OFFSET_PAL_B_DIRTY];
+		vramStateDirty = (UINT8 *) &memoryPool[OFFSET_VRAM_STATE_DIRTY];
 	}
 
 	// Hook up the IRQ controller
@@ -523,6 +693,7 @@ CTileGen::CTileGen(const Util::Config::Node &config)
 {
 	IRQ = NULL;
 	memoryPool = NULL;
+	ResetDirtyLines();
 	DebugLog("Built Tile Generator\n");
 }
 
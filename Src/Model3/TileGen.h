@@ -106,6 +106,20 @@ public:
    */
   void PreRenderFrame(void);
 
+  /*
+   * DrawSurfaces(void):
+   * UploadSurfaces(void):
+   *
+   * The two halves of PreRenderFrame(). DrawSurfaces() draws the layers into
+   * memory only. UploadSurfaces() sends what it drew to the GPU and must come
+   * before the next DrawSurfaces(), so the layers of one frame can be drawn
+   * while those of the frame before are displayed.
+   *
+   * Invoke the equivalent methods in the underlying 2D renderer.
+   */
+  void DrawSurfaces(void);
+  void UploadSurfaces(void);
+
   /*
    * RenderFrameBottom(void):
    *
@@ -258,7 +272,11 @@ private:
 	void		InitPalette(void);
 	void		WritePalette(unsigned color, UINT32 data);
 	UINT32		UpdateSnapshots(bool copyWhole);
-	UINT32		UpdateSnapshot(bool copyWhole, UINT8 *src, UINT8 *dst, unsigned size, UINT8 *dirty);
+	UINT32		UpdateSnapshot(bool copyWhole, UINT8 *src, UINT8 *dst, unsigned size, UINT8 *dirty, UINT8 *stateDirty);
+	void		ResetDirtyLines(void);
+	void		MarkLinesDirty(UINT32 addr);
+	void		MarkLayersDirty(unsigned firstLayer, unsigned numLayers);
+	void		UpdateDirtyLines(void);
 
   const Util::Config::Node &m_config;
   const bool m_gpuMultiThreaded;
@@ -283,10 +301,29 @@ private:
 	// Arrays to keep track of dirty pages in memory regions
 	UINT8   *vramDirty;
 	UINT8   *palDirty[2];	// one for each palette
+	UINT8   *vramStateDirty;	// VRAM pages changed since the last save state delta
 
 	// Registers
 	UINT32	regs[64];
 	UINT32  regsRO[64];     // Read-only copy of registers
+
+	/*
+	 * Scanlines of each layer that have to be redrawn. Writes mark them as they
+	 * happen and SyncSnapshots() resolves them into dirtyLinesRO, which the
+	 * renderer reads and EndFrame() clears once a frame has been drawn.
+	 * Pattern and palette writes can't be mapped to lines until the name tables
+	 * are final, so they are recorded per tile (32 bytes of pattern) and per
+	 * 16-color palette bank and checked against every name table entry then.
+	 */
+	UINT8	dirtyLines[4][384];
+	UINT64	dirtyTileRows[4];		// name table rows written, one bit each
+	bool	dirtyLayers[4];			// whole layer
+	UINT8	dirtyTiles[0x8000];
+	UINT8	dirtyBanks[0x800];		// 16-color banks
+	UINT8	dirtyBanks256[0x80];	// 256-color banks
+	bool	anyDirtyTiles;
+	bool	anyDirtyBanks;
+	UINT8	dirtyLinesRO[4][384];
 	
 };
 
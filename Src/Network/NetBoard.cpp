@@ -1152,7 +1152,6 @@ bool CNetBoard::Init(UINT8 * netRAMPtr, UINT8 *netBufferPtr)
 	M68KAttachBus(this);
 	M68KSetIRQCallback(NetIRQAck);
 	//M68KSetIRQCallback(NULL);
-	M68KGetContext(&M68K);
 	//Net_SetCB(NET68KRunCallback, NET68KIRQCallback);
 
 
@@ -1263,7 +1262,6 @@ void CNetBoard::RunFrame(void)
 	M68KSetIRQ(5);
 	M68KRun((4000000 / 60));
 
-	M68KGetContext(&M68K);
 }
 
 void CNetBoard::Reset(void)
@@ -1290,7 +1288,6 @@ void CNetBoard::Reset(void)
 	DebugLog("RESET NetBoard PC=%06X\n", M68KGetPC());
 	M68KReset();
 
-	M68KGetContext(&M68K);
 
 }
 
@@ -0,0 +1,418 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2020 Bart Trzynadlowski, Nik Henson, Ian Curtis,
+ **                     Harry Tuttle, and Spindizzi
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "RingLink.h"
+#include "OSD/Logger.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <random>
+
+using namespace std::chrono_literals;
+
+#if defined(_DEBUG)
+#include <stdio.h>
+#define DPRINTF DebugLog
+#else
+#define DPRINTF(a, ...)
+#endif
+
+static const int HEADER_SIZE = offsetof(RingLink::Frame, payload);
+
+RingLink::FrameQueue::FrameQueue() :
+	m_frames(new Frame[QUEUE_SIZE]),
+	m_pushCount(0),
+	m_popCount(0)
+{
+}
+
+RingLink::Frame* RingLink::FrameQueue::BeginPush()
+{
+	unsigned push = m_pushCount.load(std::memory_order_relaxed);
+	if (push - m_popCount.load(std::memory_order_acquire) == QUEUE_SIZE) {
+		return nullptr;
+	}
+	return &m_frames[push & (QUEUE_SIZE - 1)];
+}
+
+void RingLink::FrameQueue::EndPush()
+{
+	m_pushCount.store(m_pushCount.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+RingLink::Frame* RingLink::FrameQueue::Front()
+{
+	unsigned pop = m_popCount.load(std::memory_order_relaxed);
+	if (pop == m_pushCount.load(std::memory_order_acquire)) {
+		return nullptr;
+	}
+	return &m_frames[pop & (QUEUE_SIZE - 1)];
+}
+
+void RingLink::FrameQueue::Pop()
+{
+	m_popCount.store(m_popCount.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+unsigned RingLink::FrameQueue::Size() const
+{
+	return m_pushCount.load(std::memory_order_acquire) - m_popCount.load(std::memory_order_acquire);
+}
+
+RingLink::RingLink(const std::string& addressOut, int portOut, int portIn) :
+	m_addressOut(addressOut),
+	m_portOut(portOut),
+	m_id(std::random_device()()),
+	m_listenSocket(nullptr),
+	m_sendSocket(nullptr),
+	m_receiveSocket(nullptr),
+	m_socketSet(nullptr),
+	m_discard(new Frame),
+	m_rttCount(0),
+	m_quit(false),
+	m_connected(false),
+	m_broken(false)
+{
+	SDLNet_Init();
+
+	m_socketSet = SDLNet_AllocSocketSet(1);
+
+	IPaddress ip;
+	if (SDLNet_ResolveHost(&ip, nullptr, portIn) == 0) {
+		m_listenSocket = SDLNet_TCP_Open(&ip);
+	}
+	if (!m_listenSocket) {
+		ErrorLog("Unable to listen on port %d for the net board link.", portIn);
+	}
+
+	m_ioThread = std::thread(&RingLink::IOThread, this);
+}
+
+RingLink::~RingLink()
+{
+	m_quit = true;
+
+	if (m_ioThread.joinable()) {
+		m_ioThread.join();
+	}
+
+	if (m_connect) {
+		std::lock_guard<std::mutex> lock(m_connect->mutex);
+		m_connect->abandoned = true;
+		if (m_connect->socket) {
+			SDLNet_TCP_Close(m_connect->socket);
+			m_connect->socket = nullptr;
+		}
+	}
+
+	if (m_sendSocket) {
+		SDLNet_TCP_Close(m_sendSocket);
+	}
+
+	if (m_receiveSocket) {
+		SDLNet_TCP_Close(m_receiveSocket);
+	}
+
+	if (m_listenSocket) {
+		SDLNet_TCP_Close(m_listenSocket);
+	}
+
+	if (m_socketSet) {
+		SDLNet_FreeSocketSet(m_socketSet);
+	}
+
+	SDLNet_Quit();
+}
+
+bool RingLink::Connected()
+{
+	return m_connected;
+}
+
+bool RingLink::Broken()
+{
+	return m_broken;
+}
+
+void RingLink::Restart()
+{
+	m_broken = false;
+}
+
+void RingLink::Flush()
+{
+	while (m_rxQueue.Front()) {
+		m_rxQueue.Pop();
+	}
+}
+
+bool RingLink::Send(FrameType type, uint32_t frameNumber, const void* data, unsigned length)
+{
+	if (length > MAX_PAYLOAD) {
+		return false;
+	}
+
+	Frame* frame = m_txQueue.BeginPush();
+	if (!frame) {
+		DPRINTF("Send queue full, dropping frame\n");
+		std::lock_guard<std::mutex> lock(m_statsMutex);
+		m_stats.framesDropped++;
+		return false;
+	}
+
+	frame->type = type;
+	frame->hops = 1;
+	frame->length = (uint16_t)length;
+	frame->frameNumber = frameNumber;
+	frame->origin = m_id;
+	if (length) {
+		memcpy(frame->payload, data, length);
+	}
+	m_txQueue.EndPush();
+
+	std::lock_guard<std::mutex> lock(m_statsMutex);
+	m_stats.txQueueDepth = m_txQueue.Size();
+	m_stats.maxTxQueueDepth = std::max(m_stats.maxTxQueueDepth, m_stats.txQueueDepth);
+	return true;
+}
+
+const RingLink::Frame* RingLink::Receive(std::chrono::steady_clock::time_point deadline)
+{
+	const Frame* frame = m_rxQueue.Front();
+	if (frame || std::chrono::steady_clock::now() >= deadline) {
+		return frame;
+	}
+
+	std::unique_lock<std::mutex> lock(m_rxMutex);
+	m_rxReady.wait_until(lock, deadline, [this] { return m_rxQueue.Front() != nullptr || m_broken || m_quit; });
+	return m_rxQueue.Front();
+}
+
+void RingLink::Pop()
+{
+	m_rxQueue.Pop();
+}
+
+RingLink::Stats RingLink::GetStats()
+{
+	std::lock_guard<std::mutex> lock(m_statsMutex);
+	Stats stats = m_stats;
+	stats.txQueueDepth = m_txQueue.Size();
+	stats.rxQueueDepth = m_rxQueue.Size();
+	return stats;
+}
+
+void RingLink::SetBroken()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_rxMutex);
+		m_broken = true;
+	}
+	m_rxReady.notify_one();
+}
+
+void RingLink::Connect()
+{
+	if (m_connect) {
+		std::lock_guard<std::mutex> lock(m_connect->mutex);
+		if (!m_connect->done) {
+			return;
+		}
+		m_sendSocket = m_connect->socket;
+		m_connect->socket = nullptr;
+		m_connect.reset();
+		return;
+	}
+
+	// resolving and connecting block until they succeed or the OS gives up
+	auto connect = std::make_shared<PendingConnect>();
+	m_connect = connect;
+
+	std::thread([connect, address = m_addressOut, port = m_portOut] {
+		SDLNet_Init();		// keeps the library up if the link goes first
+
+		TCPsocket socket = nullptr;
+		IPaddress ip;
+		if (SDLNet_ResolveHost(&ip, address.c_str(), port) == 0) {
+			socket = SDLNet_TCP_Open(&ip);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(connect->mutex);
+			if (connect->abandoned) {
+				if (socket) {
+					SDLNet_TCP_Close(socket);
+				}
+			}
+			else {
+				connect->socket = socket;
+			}
+			connect->done = true;
+		}
+
+		SDLNet_Quit();
+	}).detach();
+}
+
+void RingLink::IOThread()
+{
+	while (!m_quit) {
+
+		// (re)connect to the next machine and accept the previous one
+		if (!m_sendSocket) {
+			Connect();
+		}
+
+		if (!m_receiveSocket && m_listenSocket) {
+			m_receiveSocket = SDLNet_TCP_Accept(m_listenSocket);
+			if (m_receiveSocket) {
+				SDLNet_TCP_AddSocket(m_socketSet, m_receiveSocket);
+				DPRINTF("Accepted connection.\n");
+			}
+		}
+
+		m_connected = m_sendSocket && m_receiveSocket;
+		if (!m_connected) {
+			std::this_thread::sleep_for(16ms);
+			continue;
+		}
+
+		// send everything the emulation thread has queued up
+		while (Frame* frame = m_txQueue.Front()) {
+			if (frame->type == FrameType::Data) {
+				m_sendTimes[frame->frameNumber & (QUEUE_SIZE - 1)] = std::chrono::steady_clock::now();
+			}
+			bool sent = SendFrame(*frame);
+			m_txQueue.Pop();
+			if (!sent) {
+				break;
+			}
+		}
+
+		// wait briefly for the previous machine, so that queued frames still go out promptly
+		if (m_receiveSocket && SDLNet_CheckSockets(m_socketSet, 1) > 0) {
+			ReceiveFrame();
+		}
+	}
+}
+
+bool RingLink::SendFrame(const Frame& frame)
+{
+	if (!m_sendSocket || m_quit) {
+		return false;
+	}
+
+	int length = HEADER_SIZE + frame.length;
+	if (SDLNet_TCP_Send(m_sendSocket, &frame, length) < length) {
+		DPRINTF("Lost connection to next machine\n");
+		SDLNet_TCP_Close(m_sendSocket);
+		m_sendSocket = nullptr;
+		m_connected = false;
+		SetBroken();
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(m_statsMutex);
+	m_stats.framesSent++;
+	return true;
+}
+
+bool RingLink::ReceiveAll(void* data, int length)
+{
+	// the rest of a frame may be slow to arrive, so wait for it in short steps
+	uint8_t* dest = (uint8_t*)data;
+	while (length > 0) {
+		int ready = SDLNet_CheckSockets(m_socketSet, 16);
+		if (ready < 0 || m_quit) {
+			return false;
+		}
+		if (ready == 0) {
+			continue;
+		}
+		int result = SDLNet_TCP_Recv(m_receiveSocket, dest, length);
+		if (result <= 0) {
+			return false;
+		}
+		dest += result;
+		length -= result;
+	}
+	return true;
+}
+
+void RingLink::ReceiveFrame()
+{
+	// receive straight into the queue unless it is full
+	Frame* frame = m_rxQueue.BeginPush();
+	bool queued = frame != nullptr;
+	if (!queued) {
+		frame = m_discard.get();
+	}
+
+	if (!ReceiveAll(frame, HEADER_SIZE) || frame->length > MAX_PAYLOAD || !ReceiveAll(frame->payload, frame->length)) {
+		DPRINTF("Lost connection to previous machine\n");
+		SDLNet_TCP_DelSocket(m_socketSet, m_receiveSocket);
+		SDLNet_TCP_Close(m_receiveSocket);
+		m_receiveSocket = nullptr;
+		m_connected = false;
+		SetBroken();
+		return;
+	}
+
+	bool own = frame->origin == m_id;
+	if (frame->type == FrameType::Data && own) {
+		// back where it started
+		double rtt = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_sendTimes[frame->frameNumber & (QUEUE_SIZE - 1)]).count();
+		std::lock_guard<std::mutex> lock(m_statsMutex);
+		m_stats.rttMS = rtt;
+		m_stats.maxRttMS = std::max(m_stats.maxRttMS, rtt);
+		m_stats.avgRttMS += (rtt - m_stats.avgRttMS) / (double)++m_rttCount;
+	}
+	else if (frame->type != FrameType::Control && !own) {
+		frame->hops++;
+		SendFrame(*frame);
+		frame->hops--;
+	}
+
+	if (frame->type == FrameType::LinkDown) {
+		SetBroken();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_statsMutex);
+		m_stats.framesReceived++;
+		if (queued) {
+			m_stats.maxRxQueueDepth = std::max(m_stats.maxRxQueueDepth, m_rxQueue.Size() + 1);
+		}
+		else {
+			m_stats.framesDropped++;
+		}
+	}
+
+	if (queued) {
+		{
+			std::lock_guard<std::mutex> lock(m_rxMutex);	// so a waiting Receive() can't miss the notification
+			m_rxQueue.EndPush();
+		}
+		m_rxReady.notify_one();
+	}
+}
@@ -0,0 +1,177 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2020 Bart Trzynadlowski, Nik Henson, Ian Curtis,
+ **                     Harry Tuttle, and Spindizzi
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef _RINGLINK_H_
+#define _RINGLINK_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "SDLIncludes.h"
+
+/*
+ * RingLink:
+ *
+ * Transport for the simulated net board. Linked machines form a ring, each
+ * one sending to the next and receiving from the previous one.
+ *
+ * All socket I/O, including connecting and accepting, happens on a dedicated
+ * thread. The emulation thread only touches two preallocated single producer,
+ * single consumer frame queues, so it never blocks on the network: Send()
+ * drops the frame if the queue is full and Receive() waits no longer than the
+ * deadline it is given.
+ *
+ * The I/O thread itself only waits in steps of a few milliseconds, so that it
+ * notices when it is asked to quit. It only reads what a socket set says has
+ * arrived, and connecting, which can take as long as the OS likes, is left to
+ * a short-lived thread of its own that does not depend on the link object.
+ *
+ * Data frames are passed on around the ring by the I/O thread as soon as they
+ * arrive, until they get back to the machine that sent them. Every machine
+ * also gets a copy, marked with the number of hops it has travelled (1 for a
+ * frame sent by the previous machine), which says whose data it is. Control
+ * frames only travel one hop, for the link set-up handshake.
+ */
+class RingLink
+{
+public:
+	static const unsigned MAX_PAYLOAD = 0x8000;
+	static const unsigned QUEUE_SIZE = 32;		// frames, must be a power of two
+
+	enum class FrameType : uint8_t
+	{
+		Data,
+		Control,
+		LinkDown								// sent when a machine leaves the ring
+	};
+
+	// Frames go on the wire as is, a fixed size header followed by the payload
+	struct Frame
+	{
+		FrameType	type;
+		uint8_t		hops;
+		uint16_t	length;
+		uint32_t	frameNumber;
+		uint32_t	origin;						// ID of the sending machine
+		uint8_t		payload[MAX_PAYLOAD];
+	};
+
+	struct Stats
+	{
+		double		rttMS = 0;					// time for own data frames to go around the ring
+		double		avgRttMS = 0;
+		double		maxRttMS = 0;
+		unsigned	txQueueDepth = 0;			// frames waiting to be sent
+		unsigned	maxTxQueueDepth = 0;
+		unsigned	rxQueueDepth = 0;			// frames waiting for the emulation thread
+		unsigned	maxRxQueueDepth = 0;
+		uint64_t	framesSent = 0;
+		uint64_t	framesReceived = 0;
+		uint64_t	framesDropped = 0;			// a queue was full
+	};
+
+	RingLink(const std::string& addressOut, int portOut, int portIn);
+	~RingLink();
+
+	bool Connected();							// to both neighbours
+	bool Broken();								// a neighbour was lost or left since Restart()
+	void Restart();
+	void Flush();								// discards received frames
+
+	bool Send(FrameType type, uint32_t frameNumber, const void* data, unsigned length);
+	const Frame* Receive(std::chrono::steady_clock::time_point deadline);	// nullptr if none by the deadline, else call Pop() when done with it
+	void Pop();
+
+	Stats GetStats();
+
+private:
+
+	// Lock-free ring of preallocated frames, for one producer and one consumer
+	class FrameQueue
+	{
+	public:
+		Frame* BeginPush();						// nullptr if full
+		void EndPush();
+		Frame* Front();							// nullptr if empty
+		void Pop();
+		unsigned Size() const;
+
+		FrameQueue();
+
+	private:
+		std::unique_ptr<Frame[]>	m_frames;
+		std::atomic<unsigned>		m_pushCount;
+		std::atomic<unsigned>		m_popCount;
+	};
+
+	// A connection attempt to the next machine. Shared with the thread making
+	// it, which closes the socket itself if the link has gone by the time it
+	// gets one.
+	struct PendingConnect
+	{
+		std::mutex	mutex;
+		TCPsocket	socket = nullptr;
+		bool		done = false;
+		bool		abandoned = false;
+	};
+
+	void IOThread();
+	void Connect();
+	bool SendFrame(const Frame& frame);
+	void ReceiveFrame();
+	bool ReceiveAll(void* data, int length);
+	void SetBroken();
+
+	std::string				m_addressOut;
+	int						m_portOut;
+	uint32_t				m_id;
+
+	TCPsocket				m_listenSocket;
+	TCPsocket				m_sendSocket;
+	TCPsocket				m_receiveSocket;
+	SDLNet_SocketSet		m_socketSet;
+	std::shared_ptr<PendingConnect>	m_connect;	// nullptr if not connecting
+
+	FrameQueue				m_txQueue;			// emulation thread -> I/O thread
+	FrameQueue				m_rxQueue;			// I/O thread -> emulation thread
+	std::unique_ptr<Frame>	m_discard;			// receives frames when m_rxQueue is full
+	std::mutex				m_rxMutex;			// only for waiting on m_rxReady
+	std::condition_variable	m_rxReady;
+
+	std::chrono::steady_clock::time_point m_sendTimes[QUEUE_SIZE];	// by frame number, for RTT
+
+	std::mutex				m_statsMutex;
+	Stats					m_stats;
+	uint64_t				m_rttCount;
+
+	std::thread				m_ioThread;
+	std::atomic_bool		m_quit;
+	std::atomic_bool		m_connected;
+	std::atomic_bool		m_broken;
+};
+
+#endif
@@ -20,8 +20,9 @@
  ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
  **/
 
+#include <algorithm>
 #include <chrono>
-#include <thread>
+#include <cstring>
 #include "Supermodel.h"
 #include "SimNetBoard.h"
 
@@ -29,7 +30,7 @@
 #define RAM16 *(uint16_t*)&RAM
 #define CommRAM16 *(uint16_t*)&CommRAM
 
-static const uint64_t netGUID = 0x5bf177da34872;
+static const uint64_t netGUID = 0x5bf177da34873;
 
 inline bool CSimNetBoard::IsGame(const char* gameName)
 {
@@ -42,10 +43,8 @@ CSimNetBoard::CSimNetBoard(const Util::Config::Node& config) : m_config(config)
 
 CSimNetBoard::~CSimNetBoard(void)
 {
-	m_quit = true;
-
-	if (m_connectThread.joinable())
-		m_connectThread.join();
+	if (m_link)
+		LogLinkStats();
 }
 
 void CSimNetBoard::SaveState(CBlockFile* SaveState)
@@ -85,9 +84,9 @@ bool CSimNetBoard::Init(uint8_t* netRAMPtr, uint8_t* netBufferPtr)
 	port_in = m_config["PortIn"].ValueAs<unsigned>();
 	port_out = m_config["PortOut"].ValueAs<unsigned>();
 	addr_out = m_config["AddressOut"].ValueAs<std::string>();
+	m_deadlineMS = m_config["NetFrameDeadline"].ValueAsDefault<unsigned>(50);
 
-	nets = std::make_unique<TCPSend>(addr_out, port_out);
-	netr = std::make_unique<TCPReceive>(port_in);
+	m_link = std::make_unique<RingLink>(addr_out, port_out, port_in);
 
 	return 0;
 }
@@ -100,8 +99,8 @@ void CSimNetBoard::RunFrame(void)
 	switch (m_state)
 	{
 	case State::start:
-		if (!m_connected && !m_connectThread.joinable())
-			m_connectThread = std::thread(&CSimNetBoard::ConnectProc, this);
+		m_link->Restart();
+		m_handshakeStep = 0;
 		m_status0 = 0;
 		m_status1 = IsGame("dirtdvls") ? 0x4004 : 0xe000;
 		m_state = State::init;
@@ -135,99 +134,15 @@ void CSimNetBoard::RunFrame(void)
 
 	case State::testing:
 		if (m_gameType == GameType::one)
-		{
 			m_status0 += 1; // type 1 games require this to be incremented every frame
 
-			if (!m_connected)
-				break;
-
-			uint8_t numMachines, machineIndex;
-
-			if (RAM16[0x400] == 0)	// master
-			{
-				// flush receive buffer
-				while (netr->CheckDataAvailable())
-				{
-					netr->Receive();
-				}
+		if (!m_link->Connected() || !RunHandshake())
+			break;
 
-				// check all linked instances have the same GUID
-				nets->Send(&netGUID, sizeof(netGUID));
-				auto& recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				uint64_t testGUID;
-				memcpy(&testGUID, &recv_data[0], recv_data.size());
-				if (testGUID != netGUID)
-					testGUID = 0;
-
-				// send the GUID for one more loop
-				nets->Send(&testGUID, sizeof(testGUID));
-				netr->Receive();
-				
-				if (testGUID != netGUID)
-				{
-					ErrorLog("unable to verify connection. Make sure all machines are using same build!");
-					m_state = State::error;
-					break;
-				}
-
-				// master has an index of zero
-				machineIndex = 0;
-				nets->Send(&machineIndex, sizeof(machineIndex));
-
-				// receive back the number of other linked machines
-				recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				numMachines = recv_data[0];
-
-				// send the number of other linked machines
-				nets->Send(&numMachines, sizeof(numMachines));
-				netr->Receive();
-			}
-			else
-			{
-				// receive GUID from the previous machine and check it matches
-				auto& recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				uint64_t testGUID;
-				memcpy(&testGUID, &recv_data[0], recv_data.size());
-				if (testGUID != netGUID)
-					testGUID = 0;
-				nets->Send(&testGUID, sizeof(testGUID));
-
-				// one more time, in case a later machine has a GUID mismatch
-				recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				memcpy(&testGUID, &recv_data[0], recv_data.size());
-				if (testGUID != netGUID)
-					testGUID = 0;
-				nets->Send(&testGUID, sizeof(testGUID));
-
-				if (testGUID != netGUID)
-				{
-					ErrorLog("unable to verify connection. Make sure all machines are using same build!");
-					m_state = State::error;
-					break;
-				}
-
-				// receive the previous machine's index, increment it, send it to the next machine
-				recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				machineIndex = recv_data[0] + 1;
-				nets->Send(&machineIndex, sizeof(machineIndex));
-
-				// receive the number of other linked machines and forward it on
-				recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				numMachines = recv_data[0];
-				nets->Send(&numMachines, sizeof(numMachines));
-			}
+		if (m_gameType == GameType::one)
+		{
+			uint8_t numMachines = m_linkedMachines.total;
+			uint8_t machineIndex = m_machineIndex.total;
 
 			// if there are no other linked machines, only continue if Supermodel is linked to itself
 			// there might be more than one machine set to master which would cause glitches
@@ -257,163 +172,11 @@ void CSimNetBoard::RunFrame(void)
 			CommRAM16[0xa] = FLIPENDIAN16(RAM16[0x402] - m_segmentSize - 1);
 			CommRAM16[0xc] = FLIPENDIAN16(0x100);
 			CommRAM16[0xe] = FLIPENDIAN16(RAM16[0x402] - m_segmentSize + 0x200);
-
-			m_state = State::ready;
 		}
 		else
 		{
-			if (!m_connected)
-				break;
-
-			// we have to track both playable and non-playable machines for type 2
-			struct
-			{
-				uint8_t total;
-				uint8_t playable;
-			} numMachines, machineIndex;
-
-			if (RAM16[0x200] == 0)	// master
-			{
-				// flush receive buffer
-				while (netr->CheckDataAvailable())
-					netr->Receive();
-
-				// check all linked instances have the same GUID
-				nets->Send(&netGUID, sizeof(netGUID));
-				auto& recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-
-				uint64_t testGUID;
-				memcpy(&testGUID, &recv_data[0], recv_data.size());
-				if (testGUID != netGUID)
-					testGUID = 0;
-
-				// send the GUID for one more loop
-				nets->Send(&testGUID, sizeof(testGUID));
-				netr->Receive();
-
-				if (testGUID != netGUID)
-				{
-					ErrorLog("unable to verify connection. Make sure all machines are using same build!");
-					m_state = State::error;
-					break;
-				}
-
-				// master has indices set to zero
-				machineIndex.total = 0, machineIndex.playable = 0;
-				nets->Send(&machineIndex, sizeof(machineIndex));
-
-				// receive back the number of other linked machines
-				recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				memcpy(&numMachines, &recv_data[0], recv_data.size());
-
-				// send the number of other linked machines
-				nets->Send(&numMachines, sizeof(numMachines));
-				netr->Receive();
-			}
-			else if (RAM16[0x200] < 0x8000)	// slave
-			{
-				// receive GUID from the previous machine and check it matches
-				auto& recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				uint64_t testGUID;
-				memcpy(&testGUID, &recv_data[0], recv_data.size());
-				if (testGUID != netGUID)
-					testGUID = 0;
-				nets->Send(&testGUID, sizeof(testGUID));
-
-				// one more time, in case a later machine has a GUID mismatch
-				recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				memcpy(&testGUID, &recv_data[0], recv_data.size());
-				if (testGUID != netGUID)
-					testGUID = 0;
-				nets->Send(&testGUID, sizeof(testGUID));
-
-				if (testGUID != netGUID)
-				{
-					ErrorLog("unable to verify connection. Make sure all machines are using same build!");
-					m_state = State::error;
-					break;
-				}
-
-				// receive the indices of the previous machine and increment them
-				recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				memcpy(&machineIndex, &recv_data[0], recv_data.size());
-				machineIndex.total++, machineIndex.playable++;
-
-				// send our indices to the next machine
-				nets->Send(&machineIndex, sizeof(machineIndex));
-
-				// receive the number of machines
-				recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				memcpy(&numMachines, &recv_data[0], recv_data.size());
-
-				// forward the number of machines
-				nets->Send(&numMachines, sizeof(numMachines));
-			}
-			else
-			{
-				// relay/satellite
-				
-				// receive GUID from the previous machine and check it matches
-				auto& recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				uint64_t testGUID;
-				memcpy(&testGUID, &recv_data[0], recv_data.size());
-				if (testGUID != netGUID)
-					testGUID = 0;
-				nets->Send(&testGUID, sizeof(testGUID));
-
-				// one more time, in case a later machine has a GUID mismatch
-				recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				memcpy(&testGUID, &recv_data[0], recv_data.size());
-				if (testGUID != netGUID)
-					testGUID = 0;
-				nets->Send(&testGUID, sizeof(testGUID));
-
-				if (testGUID != netGUID)
-				{
-					ErrorLog("unable to verify connection. Make sure all machines are using same build!");
-					m_state = State::error;
-					break;
-				}
-
-				// receive the indices of the previous machine; don't increment the playable index
-				recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				memcpy(&machineIndex, &recv_data[0], recv_data.size());
-				machineIndex.total++;
-
-				// send our indices to the next machine
-				nets->Send(&machineIndex, sizeof(machineIndex));
-
-				// receive the number of machines
-				recv_data = netr->Receive();
-				if (recv_data.empty())
-					break;
-				memcpy(&numMachines, &recv_data[0], recv_data.size());
-
-				// forward the number of machines
-				nets->Send(&numMachines, sizeof(numMachines));
-
-				// indicate that this machine is a relay/satellite
-				if (!IsGame("dirtdvls"))
-					machineIndex.playable |= 0x80;
-			}
+			MachineCount numMachines = m_linkedMachines;
+			MachineCount machineIndex = m_machineIndex;
 
 			// if there are no other linked machines, only continue if Supermodel is linked to itself
 			// there might be more than one machine set to master which would cause glitches
@@ -448,31 +211,39 @@ void CSimNetBoard::RunFrame(void)
 			CommRAM16[0xa] = FLIPENDIAN16(RAM16[0x206]);
 			CommRAM16[0xc] = FLIPENDIAN16(0x100);
 			CommRAM16[0xe] = FLIPENDIAN16(RAM16[0x206] + 0x80);
+		}
 
-			m_state = State::ready;
+		// each machine's segment plus the one for its own data coming back must fit in a CommRAM bank
+		if (m_segmentSize > RingLink::MAX_PAYLOAD || 0x100 + (m_numMachines + 1) * m_segmentSize > 0x10000)
+		{
+			ErrorLog("net board segment size 0x%x is too large for %d machines.", m_segmentSize, m_numMachines);
+			m_state = State::error;
+			break;
 		}
+
+		m_frameNumber = 0;
+		m_slotReceived.assign(m_numMachines + 1, false);
+		m_state = State::ready;
 		break;
 
 	case State::ready:
 		m_counter++;
 		CommRAM16[0x6] = FLIPENDIAN16(m_counter);
-		
+
 		// we only send what we need to; helps cut down on bandwidth
-		// each machine has to receive back its own data (TODO: copy this data manually?)
-		for (int i = 0; i < m_numMachines; i++)
+		// the link passes our segment around the ring and brings back everyone else's, and finally our own
+		m_link->Send(RingLink::FrameType::Data, ++m_frameNumber, CommRAM + 0x100, m_segmentSize);
+		ReceiveSegments();
+
+		if (m_link->Broken())
 		{
-			nets->Send(CommRAM + 0x100 + i * m_segmentSize, m_segmentSize);
-			auto& recv_data = netr->Receive();
-			if (recv_data.size() == 0)
-			{
-				// link broken - send an "empty" packet to alert other machines
-				nets->Send(nullptr, 0);
-				m_state = State::error;
-				if (m_gameType == GameType::one)
-					m_status1 = 0x40;			// send "link broken" message to mainboard
-				break;
-			}
-			memcpy(CommRAM + 0x100 + (i + 1) * m_segmentSize, recv_data.data(), recv_data.size());
+			// link broken - tell the other machines, if they can still hear us
+			m_link->Send(RingLink::FrameType::LinkDown, m_frameNumber, nullptr, 0);
+			m_state = State::error;
+			if (m_gameType == GameType::one)
+				m_status1 = 0x40;			// send "link broken" message to mainboard
+			ErrorLog("net board link broken.");
+			LogLinkStats();
 		}
 
 		// swap CommRAM banks
@@ -499,12 +270,9 @@ void CSimNetBoard::RunFrame(void)
 
 void CSimNetBoard::Reset(void)
 {
-	// if netboard was active, send an "empty" packet so the other machines don't get stuck waiting for data
+	// if netboard was active, tell the other machines so they don't wait for our data
 	if (m_state == State::ready)
-	{
-		nets->Send(nullptr, 0);
-		netr->Receive();
-	}
+		m_link->Send(RingLink::FrameType::LinkDown, m_frameNumber, nullptr, 0);
 
 	m_running = false;
 	m_state = State::start;
@@ -525,33 +293,177 @@ void CSimNetBoard::GetGame(const Game& gameInfo)
 	m_gameInfo = gameInfo;
 }
 
-void CSimNetBoard::ConnectProc(void)
+void CSimNetBoard::SendControl(const void* data, unsigned length)
 {
-	using namespace std::chrono_literals;
+	m_link->Send(RingLink::FrameType::Control, 0, data, length);
+}
 
-	if (m_connected)
-		return;
+bool CSimNetBoard::RunHandshake(void)
+{
+	// The master sends the GUID around the ring twice to check that all linked
+	// instances have the same one, then each machine's index and finally the
+	// number of machines. Everyone else receives each of these from the
+	// previous machine and passes it on. This takes more than one frame, so
+	// carry on from wherever the last call got to.
+	bool master, relay;
+	unsigned countSize;
+	if (m_gameType == GameType::one)
+	{
+		master = RAM16[0x400] == 0;
+		relay = false;
+		countSize = 1;
+	}
+	else
+	{
+		// we have to track both playable and non-playable machines for type 2
+		master = RAM16[0x200] == 0;
+		relay = RAM16[0x200] >= 0x8000;		// relay/satellite
+		countSize = sizeof(MachineCount);
+	}
+
+	if (m_handshakeStep == 0)
+	{
+		if (master)
+		{
+			// flush receive buffer
+			m_link->Flush();
+			SendControl(&netGUID, sizeof(netGUID));
+		}
+		m_handshakeStep = 1;
+	}
+
+	while (m_handshakeStep < 5)
+	{
+		const RingLink::Frame* frame = m_link->Receive(std::chrono::steady_clock::now());
+		if (!frame)
+			return false;
+		if (frame->type != RingLink::FrameType::Control)
+		{
+			m_link->Pop();		// left over from before a reset
+			continue;
+		}
+		uint8_t data[sizeof(uint64_t)] = {};
+		memcpy(data, frame->payload, std::min<size_t>(frame->length, sizeof(data)));
+		m_link->Pop();
+
+		switch (m_handshakeStep++)
+		{
+		case 1:
+			// receive the GUID (master: back from the last machine) and pass it on
+			memcpy(&m_testGUID, data, sizeof(m_testGUID));
+			if (m_testGUID != netGUID)
+				m_testGUID = 0;
+			SendControl(&m_testGUID, sizeof(m_testGUID));
+			break;
+
+		case 2:
+			// one more time, in case a later machine has a GUID mismatch
+			if (!master)
+			{
+				memcpy(&m_testGUID, data, sizeof(m_testGUID));
+				if (m_testGUID != netGUID)
+					m_testGUID = 0;
+				SendControl(&m_testGUID, sizeof(m_testGUID));
+			}
+
+			if (m_testGUID != netGUID)
+			{
+				ErrorLog("unable to verify connection. Make sure all machines are using same build!");
+				m_state = State::error;
+				return false;
+			}
 
-	printf("Connecting to %s:%i ..\n", addr_out.c_str(), port_out);
+			if (master)
+			{
+				// master has indices set to zero
+				m_machineIndex = {};
+				SendControl(&m_machineIndex, countSize);
+			}
+			break;
 
-	// wait until TCPSend has connected to the next machine
-	while (!nets->Connect())
+		case 3:
+			if (master)
+			{
+				// receive back the number of other linked machines and send it around
+				memcpy(&m_linkedMachines, data, countSize);
+				SendControl(&m_linkedMachines, countSize);
+			}
+			else
+			{
+				// receive the indices of the previous machine, increment them (a relay isn't playable) and send them on
+				memcpy(&m_machineIndex, data, countSize);
+				m_machineIndex.total++;
+				if (!relay)
+					m_machineIndex.playable++;
+				SendControl(&m_machineIndex, countSize);
+			}
+			break;
+
+		case 4:
+			if (!master)
+			{
+				// receive the number of machines and forward it on
+				memcpy(&m_linkedMachines, data, countSize);
+				SendControl(&m_linkedMachines, countSize);
+
+				// indicate that this machine is a relay/satellite
+				if (relay && !IsGame("dirtdvls"))
+					m_machineIndex.playable |= 0x80;
+			}
+			break;
+		}
+	}
+
+	return true;
+}
+
+void CSimNetBoard::ReceiveSegments(void)
+{
+	// Segment i is the data of the machine i hops back along the ring, and the
+	// last one is our own. Wait (up to the deadline) for a new one from every
+	// machine, then take any newer ones that are already here so that a machine
+	// that has fallen behind can't leave us working through a backlog. Segments
+	// that don't arrive in time keep their contents from the last frame.
+	for (int slot = 1; slot <= m_numMachines; slot++)
 	{
-		if (m_quit)
-			return;
+		unsigned offset = 0x100 + slot * m_segmentSize;
+		memcpy(CommRAM + offset, externalCommRAM + offset, m_segmentSize);
 	}
+	std::fill(m_slotReceived.begin(), m_slotReceived.end(), false);
 
-	// wait until TCPReceive has accepted a connection from the previous machine
-	while (!netr->Connected())
+	int received = 0;
+	auto now = std::chrono::steady_clock::now();
+	auto deadline = now + (m_deadlineMS ? std::chrono::milliseconds(m_deadlineMS) : std::chrono::hours(24));
+	while (!m_link->Broken())
 	{
-		if (m_quit)
-			return;
-		std::this_thread::sleep_for(1ms);
+		const RingLink::Frame* frame = m_link->Receive(received < m_numMachines ? deadline : now);
+		if (!frame)
+			break;
+
+		int slot = frame->hops;
+		if (frame->type == RingLink::FrameType::Data && slot >= 1 && slot <= m_numMachines && frame->length == m_segmentSize)
+		{
+			memcpy(CommRAM + 0x100 + slot * m_segmentSize, frame->payload, m_segmentSize);
+			if (!m_slotReceived[slot])
+			{
+				m_slotReceived[slot] = true;
+				received++;
+			}
+		}
+		m_link->Pop();
 	}
 
-	printf("Successfully connected.\n");
+	m_missedSegments += m_numMachines - received;
+}
 
-	m_connected = true;
+void CSimNetBoard::LogLinkStats(void)
+{
+	RingLink::Stats stats = m_link->GetStats();
+	if (!stats.framesSent)
+		return;
+	InfoLog("Net board link: round trip %.2f ms average, %.2f ms worst; %llu frames sent, %llu received, %llu dropped; queue depth %u out, %u in at most; %llu segments missed the %u ms deadline.",
+		stats.avgRttMS, stats.maxRttMS, (unsigned long long)stats.framesSent, (unsigned long long)stats.framesReceived, (unsigned long long)stats.framesDropped,
+		stats.maxTxQueueDepth, stats.maxRxQueueDepth, (unsigned long long)m_missedSegments, m_deadlineMS);
 }
 
 uint8_t CSimNetBoard::ReadCommRAM8(unsigned addr)
@@ -24,8 +24,9 @@
 #define INCLUDED_SIMNETBOARD_H
 
 #include <cstdint>
-#include "TCPSend.h"
-#include "TCPReceive.h"
+#include <memory>
+#include <vector>
+#include "RingLink.h"
 #include "INetBoard.h"
 
 enum class State
@@ -86,12 +87,24 @@ private:
 	uint16_t port_in = 0;
 	uint16_t port_out = 0;
 	std::string addr_out;
-	std::thread m_connectThread;
-	std::atomic_bool m_quit = false;
-	std::atomic_bool m_connected = false;
-
-	std::unique_ptr<TCPSend> nets = nullptr;
-	std::unique_ptr<TCPReceive> netr = nullptr;
+	std::unique_ptr<RingLink> m_link = nullptr;
+	unsigned m_deadlineMS = 0;		// longest wait for other machines' data each frame, 0 = no limit
+
+	// link set-up handshake, run a step at a time as frames arrive
+	struct MachineCount
+	{
+		uint8_t total;
+		uint8_t playable;			// type 2 only
+	};
+	int m_handshakeStep = 0;
+	uint64_t m_testGUID = 0;
+	MachineCount m_linkedMachines = {};
+	MachineCount m_machineIndex = {};
+
+	// data exchange
+	uint32_t m_frameNumber = 0;
+	std::vector<bool> m_slotReceived;			// this frame, by hop count
+	uint64_t m_missedSegments = 0;
 
 	Game m_gameInfo;
 	GameType m_gameType = GameType::unknown;
@@ -111,7 +124,10 @@ private:
 	bool m_commbank = false;
 
 	inline bool IsGame(const char* gameName);
-	void ConnectProc(void);
+	bool RunHandshake(void);
+	void SendControl(const void* data, unsigned length);
+	void ReceiveSegments(void);
+	void LogLinkStats(void);
 };
 
 #endif
\ No newline at end of file
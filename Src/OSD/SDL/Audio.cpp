@@ -57,6 +57,7 @@
 
 #include "Supermodel.h"
 #include "SDLIncludes.h"
+#include "Sound/Resampler.h"
 
 #include <cmath>
 #include <algorithm>
@@ -68,7 +69,8 @@
 
 #define MAX_SND_FREQ       (75)
 #define MIN_SND_FREQ       (45)
-#define MAX_LATENCY        (100)
+#define MIN_LATENCY_MS     (10)
+#define MAX_LATENCY_MS     (500)
 
 #define NUM_CHANNELS_M3 (4)
 
@@ -83,7 +85,6 @@ int nbHostAudioChannels = NUM_CHANNELS_M3;   // Number of channels on host
 
 static int samples_per_frame_host = SAMPLES_PER_FRAME_M3;
 static int bytes_per_sample_host = BYTES_PER_SAMPLE_M3;
-static int bytes_per_frame_host = BYTES_PER_FRAME_M3;
 
 // Balance percents for mixer
 float BalanceLeftRight = 0; // 0 mid balance, 100: left only,  -100:right only 
@@ -95,21 +96,23 @@ float balanceFactorRearLeft   = 1.0f;
 float balanceFactorRearRight  = 1.0f;
 
 static bool enabled = true;         // True if sound output is enabled
-static constexpr unsigned latency = 20;       // Audio latency to use (ie size of audio buffer) as percentage of max buffer size
-static constexpr bool underRunLoop = true;    // True if should loop back to beginning of buffer on under-run, otherwise sound is just skipped
 
 static constexpr unsigned playSamples = 512;  // Size (in samples) of callback play buffer
 
-static UINT32 audioBufferSize = 0;  // Size (in bytes) of audio buffer
-static INT8* audioBuffer = NULL;    // Audio buffer
+static SDL_AudioDeviceID audioDevice = 0;     // Host audio device, opened at its own sample rate
+static int hostSampleRate = SAMPLE_RATE_M3;
 
-static UINT32 writePos = 0;         // Current position at which writing into buffer
-static UINT32 playPos = 0;          // Current position at which playing data in buffer via callback
+// Mixed Model 3 audio is converted to the host rate by the resampler on the
+// emulation thread and handed to the audio callback through a lock-free ring.
+// The resampler's rate control holds the ring at targetFrames (the configured
+// latency), so there is no need for a large safety margin.
+static CAudioRing audioRing;
+static CResampler resampler;
+static std::vector<INT16> resampleBuffer;
+static unsigned targetFrames = 0;  // Desired ring fill level (in host samples)
 
-static bool writeWrapped = false;   // True if write position has wrapped around at end of buffer but play position has not done so yet
-
-static unsigned underRuns = 0;      // Number of buffer under-runs that have occured
-static unsigned overRuns = 0;       // Number of buffer over-runs that have occured
+static std::atomic<unsigned> underRuns(0);  // Number of buffer under-runs that have occured
+static unsigned overRuns = 0;               // Number of buffer over-runs that have occured
 
 static AudioCallbackFPtr callback = NULL; // Pointer to audio callback that is called when audio buffer is less than half empty
 static void* callbackData = NULL;         // Pointer to data to be passed to audio callback when it is called
@@ -120,12 +123,14 @@ static const Util::Config::Node* s_config = 0;
 void SetAudioCallback(AudioCallbackFPtr newCallback, void* newData)
 {
     // Lock audio whilst changing callback pointers
-    SDL_LockAudio();
+    if (audioDevice)
+        SDL_LockAudioDevice(audioDevice);
 
     callback = newCallback;
     callbackData = newData;
 
-    SDL_UnlockAudio();
+    if (audioDevice)
+        SDL_UnlockAudioDevice(audioDevice);
 }
 
 void SetAudioEnabled(bool newEnabled)
@@ -168,106 +173,21 @@ static INT16 MixINT16(INT32 x, INT32 y)
 
 static void PlayCallback(void* data, Uint8* stream, int len)
 {
-    //printf("PlayCallback(%d) [writePos = %u, writeWrapped = %s, playPos = %u, audioBufferSize = %u]\n",
-    //	len, writePos, (writeWrapped ? "true" : "false"), playPos, audioBufferSize);
-
-    // Get current write position and adjust it if write has wrapped but play position has not
-    UINT32 adjWritePos = writePos;
-    if (writeWrapped)
-        adjWritePos += audioBufferSize;
+    unsigned numSamples = len / bytes_per_sample_host;
+    unsigned got = audioRing.Read((INT16*)stream, numSamples);
 
-    // Check if play position overlaps write position (ie buffer under-run)
-	if (playPos + len > adjWritePos)
-	{
+    // On under-run, play silence for the rest rather than repeating old data
+    if (got < numSamples)
+    {
         underRuns++;
-
-        //printf("Audio buffer under-run #%u in PlayCallback(%d) [writePos = %u, writeWrapped = %s, playPos = %u, audioBufferSize = %u]\n",
-        //	underRuns, len, writePos, (writeWrapped ? "true" : "false"), playPos, audioBufferSize);
-
-        // See what action to take on under-run
-		if (underRunLoop)
-		{
-            // If loop, then move play position back to beginning of data in buffer
-            playPos = adjWritePos + bytes_per_frame_host;
-
-            // Check if play position has moved past end of buffer
-            if (playPos >= audioBufferSize)
-                // If so, wrap it around to beginning again (but keep write wrapped flag as before)
-                playPos -= audioBufferSize;
-            else
-                // Otherwise, set write wrapped flag as will now appear as if write has wrapped but play position has not
-                writeWrapped = true;
-		}
-		else
-		{
-            // Otherwise, just copy silence to audio output stream and exit
-            memset(stream, 0, len);
-            return;
-        }
+        memset(stream + got * bytes_per_sample_host, 0, (numSamples - got) * bytes_per_sample_host);
     }
 
-    INT8* src1;
-    INT8* src2;
-    UINT32 len1;
-    UINT32 len2;
-
-    // Check if play region extends past end of buffer
-	if (playPos + len > audioBufferSize)
-	{
-        // If so, split play region into two
-        src1 = audioBuffer + playPos;
-        src2 = audioBuffer;
-        len1 = audioBufferSize - playPos;
-        len2 = len - len1;
-	}
-	else
-	{
-        // Otherwise, just copy whole region
-        src1 = audioBuffer + playPos;
-        src2 = 0;
-        len1 = len;
-        len2 = 0;
-    }
-
-    // Check if audio is enabled
-	if (enabled)
-	{
-        // If so, copy play region into audio output stream
-        memcpy(stream, src1, len1);
-
-        // Also, if not looping on under-runs then blank region out
-        if (!underRunLoop)
-            memset(src1, 0, len1);
-
-		if (len2)
-		{
-            // If region was split into two, copy second half into audio output stream as well
-            memcpy(stream + len1, src2, len2);
-
-            // Also, if not looping on under-runs then blank region out
-            if (!underRunLoop)
-                memset(src2, 0, len2);
-        }
-	}
-	else
-        // Otherwise, just copy silence to audio output stream
+    if (!enabled)
         memset(stream, 0, len);
 
-    // Move play position forward for next time
-    playPos += len;
-
-    bool bufferFull = adjWritePos + 2 * bytes_per_frame_host > playPos + audioBufferSize;
-
-    // Check if play position has moved past end of buffer
-	if (playPos >= audioBufferSize)
-	{
-        // If so, wrap it around to beginning again and reset write wrapped flag
-        playPos -= audioBufferSize;
-        writeWrapped = false;
-    }
-
-    // If buffer is not full then call audio callback
-    if (callback && !bufferFull)
+    // If buffer has dropped below target then call audio callback
+    if (callback && audioRing.Available() < targetFrames)
         callback(callbackData);
 }
 
@@ -461,26 +381,30 @@ bool OpenAudio(const Util::Config::Node& config)
     balanceFactorRearLeft   = (BalanceLeftRight < 0.f ? 1.f + BalanceLeftRight : 1.f) * (BalanceFrontRear > 0 ? 1.f - BalanceFrontRear : 1.f);
     balanceFactorRearRight  = (BalanceLeftRight > 0.f ? 1.f - BalanceLeftRight : 1.f) * (BalanceFrontRear > 0 ? 1.f - BalanceFrontRear : 1.f);
 
-    // Set up audio specification
+    // Set up audio specification. The device may run at whatever rate suits
+    // it (usually 48KHz), the resampler converts to it.
     SDL_AudioSpec desired;
+    SDL_AudioSpec obtained;
     memset(&desired, 0, sizeof(SDL_AudioSpec));
-    desired.freq = SAMPLE_RATE_M3;
+    desired.freq = 48000;
     // Number of host channels to use (choice limited to 1,2,4)
     desired.channels = nbHostAudioChannels;
     desired.format = AUDIO_S16SYS;
     desired.samples = playSamples;
     desired.callback = PlayCallback;
 
-    // Now force SDL to use the format we requested (nullptr); it will convert if necessary
-    if (SDL_OpenAudio(&desired, nullptr) < 0) {
+    // SDL converts format and channels if necessary, only the rate may change
+    audioDevice = SDL_OpenAudioDevice(nullptr, 0, &desired, &obtained, SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
+    if (audioDevice == 0) {
         if (desired.channels==2) {
-            return ErrorLog("Unable to open 44.1KHz 2-channel audio with SDL: %s\n", SDL_GetError());
+            return ErrorLog("Unable to open 2-channel audio with SDL: %s\n", SDL_GetError());
         } else if (desired.channels==4) {
-            return ErrorLog("Unable to open 44.1KHz 4-channel audio with SDL: %s\n", SDL_GetError());
+            return ErrorLog("Unable to open 4-channel audio with SDL: %s\n", SDL_GetError());
         } else {
-            return ErrorLog("Unable to open 44.1KHz channel audio with SDL: %s\n", SDL_GetError());
+            return ErrorLog("Unable to open channel audio with SDL: %s\n", SDL_GetError());
         }
     }
+    hostSampleRate = obtained.freq;
 
     float soundFreq_Hz = (float)s_config->Get("SoundFreq").ValueAs<float>();
     if (soundFreq_Hz>MAX_SND_FREQ)
@@ -489,58 +413,41 @@ bool OpenAudio(const Util::Config::Node& config)
         soundFreq_Hz = MIN_SND_FREQ;
     samples_per_frame_host = (INT32)(SAMPLE_RATE_M3 / soundFreq_Hz);
     bytes_per_sample_host = (nbHostAudioChannels * sizeof(INT16));
-    bytes_per_frame_host =  (samples_per_frame_host * bytes_per_sample_host);
-
 
-    // Create audio buffer
-    uint32_t bufferSize = ((SAMPLE_RATE_M3 * latency) / MAX_LATENCY) * bytes_per_sample_host;
-    if (!(bufferSize % bytes_per_sample_host == 0)) {
-        return ErrorLog("must be an integer multiple of the sample size\n");
-    }
-    audioBufferSize = bufferSize;
-
-    int minBufferSize = 3 * bytes_per_frame_host;
-    audioBufferSize = std::max<int>(minBufferSize, audioBufferSize);
-    audioBuffer = new(std::nothrow) INT8[audioBufferSize];
-    if (audioBuffer == NULL) {
-        float audioBufMB = (float)audioBufferSize / (float)0x100000;
-        return ErrorLog("Insufficient memory for audio latency buffer (need %1.1f MB).", audioBufMB);
-    }
-    memset(audioBuffer, 0, sizeof(INT8) * audioBufferSize);
-
-    // Set initial play position to be beginning of buffer and initial write position to be half-way into buffer
-    playPos = 0;
-    uint32_t endOfBuffer = bufferSize - bytes_per_frame_host;
-    uint32_t midpointAfterFirstFrameUnaligned = bytes_per_frame_host + (bufferSize - bytes_per_frame_host) / 2;
-    uint32_t extraPaddingNeeded = (bytes_per_frame_host - midpointAfterFirstFrameUnaligned % bytes_per_frame_host) % bytes_per_frame_host;
-    uint32_t midpointAfterFirstFrame = midpointAfterFirstFrameUnaligned + extraPaddingNeeded;
-    if (!((endOfBuffer % (nbHostAudioChannels*sizeof(INT16))) == 0)) {
-        return ErrorLog("must be an integer multiple of the sample size\n");
-    }
-    if (!((midpointAfterFirstFrame % nbHostAudioChannels*sizeof(INT16)) == 0)) {
-        return ErrorLog("must be an integer multiple of the sample size\n");
+    if (OKAY != resampler.Init(SAMPLE_RATE_M3, hostSampleRate, nbHostAudioChannels)) {
+        SDL_CloseAudioDevice(audioDevice);
+        audioDevice = 0;
+        return FAIL;
     }
+    resampleBuffer.resize(resampler.MaxOutputFrames(SAMPLE_RATE_M3 / MIN_SND_FREQ) * nbHostAudioChannels);
+
+    // Buffer level to hold, at least two callbacks' worth so that one burst
+    // from the device never empties it
+    unsigned latencyMs = s_config->Get("AudioLatency").ValueAs<unsigned>();
+    latencyMs = std::max<unsigned>(MIN_LATENCY_MS, std::min<unsigned>(MAX_LATENCY_MS, latencyMs));
+    targetFrames = std::max<unsigned>((hostSampleRate * latencyMs) / 1000, 2 * obtained.samples);
 
-    writePos = std::min<int>(endOfBuffer, midpointAfterFirstFrame);
-    writeWrapped = false;
+    // Ring has plenty of headroom above the target, rate control keeps it from being used.
+    // Start it at the target with silence.
+    audioRing.Init(4 * targetFrames, nbHostAudioChannels);
+    std::vector<INT16> silence(targetFrames * nbHostAudioChannels, 0);
+    audioRing.Write(silence.data(), targetFrames);
 
     // Reset counters
     underRuns = 0;
     overRuns = 0;
 
+    InfoLog("Audio output: %d Hz, %d channels, %u ms buffer.", hostSampleRate, nbHostAudioChannels, (targetFrames * 1000) / hostSampleRate);
+
     // Start audio playing
-    SDL_PauseAudio(0);
+    SDL_PauseAudioDevice(audioDevice, 0);
     return OKAY;
 }
 
 bool OutputAudio(unsigned numSamples, INT16* leftFrontBuffer, INT16* rightFrontBuffer, INT16* leftRearBuffer, INT16* rightRearBuffer, bool flipStereo)
 {
-    //printf("OutputAudio(%u) [writePos = %u, writeWrapped = %s, playPos = %u, audioBufferSize = %u]\n",
-    //	numSamples, writePos, (writeWrapped ? "true" : "false"), playPos, audioBufferSize);
-
-    UINT32 bytesRemaining;
-    UINT32 bytesToCopy;
-    INT16* src;
+    if (audioDevice == 0)
+        return true;
 
     // Number of samples should never be more than max number of samples per frame
     if (numSamples > (unsigned)samples_per_frame_host)
@@ -550,146 +457,29 @@ bool OutputAudio(unsigned numSamples, INT16* leftFrontBuffer, INT16* rightFrontB
     INT16 mixBuffer[NUM_CHANNELS_M3 * (SAMPLE_RATE_M3 / MIN_SND_FREQ)];
     MixChannels(numSamples, leftFrontBuffer, rightFrontBuffer, leftRearBuffer, rightRearBuffer, mixBuffer, flipStereo);
 
-    // Lock SDL audio callback so that it doesn't interfere with following code
-    SDL_LockAudio();
-
-    // Calculate number of bytes for current sound chunk
-    UINT32 numBytes = numSamples * bytes_per_sample_host;
-
-    // Get end of current play region (writing must occur past this point)
-    UINT32 playEndPos = playPos + bytes_per_frame_host;
-
-    // Undo any wrap-around of the write position that may have occured to create following ordering: playPos < playEndPos < writePos
-    if (playEndPos > writePos && writeWrapped)
-        writePos += audioBufferSize;
-
-    // Check if play region has caught up with write position and now overlaps it (ie buffer under-run)
-	if (playEndPos > writePos)
-	{
-        underRuns++;
-
-        //printf("Audio buffer under-run #%u in OutputAudio(%u) [writePos = %u, writeWrapped = %s, playPos = %u, audioBufferSize = %u, numBytes = %u]\n",
-        //	underRuns, numSamples, writePos, (writeWrapped ? "true" : "false"), playPos, audioBufferSize, numBytes);
-
-        // See what action to take on under-run
-		if (underRunLoop)
-		{
-            // If loop, then move play position back to beginning of data in buffer
-            playPos = writePos + numBytes + bytes_per_frame_host;
-
-            // Check if play position has moved past end of buffer
-            if (playPos >= audioBufferSize)
-                // If so, wrap it around to beginning again (but keep write wrapped flag as before)
-                playPos -= audioBufferSize;
-			else
-			{
-                // Otherwise, set write wrapped flag as will now appear as if write has wrapped but play position has not
-                writeWrapped = true;
-                writePos += audioBufferSize;
-            }
-		}
-		else
-		{
-            // Otherwise, bump write position forward in chunks until it is past end of play region
-			do
-			{
-                writePos += numBytes;
-			}
-			while (playEndPos > writePos);
-        }
-    }
-
-    // Check if write position has caught up with play region and now overlaps it (ie buffer over-run)
-    bool overRun = writePos + numBytes > playPos + audioBufferSize;
-
-    bool bufferFull = writePos + 2 * bytes_per_frame_host > playPos + audioBufferSize;
-
-    // Move write position back to within buffer
-    if (writePos >= audioBufferSize)
-        writePos -= audioBufferSize;
-
-    // Handle buffer over-run
-	if (overRun)
-	{
+    // Convert to host rate, adjusting the ratio to hold the buffer level, and queue it
+    resampler.UpdateBufferLevel(audioRing.Available(), targetFrames);
+    unsigned numFrames = resampler.Process(resampleBuffer.data(), mixBuffer, numSamples);
+    if (audioRing.Write(resampleBuffer.data(), numFrames) < numFrames)
+    {
+        // Buffer over-run, remainder of chunk is discarded
         overRuns++;
-
-        //printf("Audio buffer over-run #%u in OutputAudio(%u) [writePos = %u, writeWrapped = %s, playPos = %u, audioBufferSize = %u, numBytes = %u]\n",
-        //	overRuns, numSamples, writePos, (writeWrapped ? "true" : "false"), playPos, audioBufferSize, numBytes);
-
-        bufferFull = true;
-
-        // Discard current chunk of data
-        goto Finish;
     }
 
-    src = mixBuffer;
-    INT8* dst1;
-    INT8* dst2;
-    UINT32 len1;
-    UINT32 len2;
-
-    // Check if write region extends past end of buffer
-	if (writePos + numBytes > audioBufferSize)
-	{
-        // If so, split write region into two
-        dst1 = audioBuffer + writePos;
-        dst2 = audioBuffer;
-        len1 = audioBufferSize - writePos;
-        len2 = numBytes - len1;
-	}
-	else
-	{
-        // Otherwise, just copy whole region
-        dst1 = audioBuffer + writePos;
-        dst2 = 0;
-        len1 = numBytes;
-        len2 = 0;
-    }
-
-    // Copy chunk to write position in buffer
-    bytesRemaining = numBytes;
-    bytesToCopy = (bytesRemaining > len1 ? len1 : bytesRemaining);
-    memcpy(dst1, src, bytesToCopy);
-
-    // Adjust for number of bytes copied
-    bytesRemaining -= bytesToCopy;
-    src = (INT16*)((UINT8*)src + bytesToCopy);
-
-	if (bytesRemaining)
-	{
-        // If write region was split into two, copy second half of chunk into buffer as well
-        bytesToCopy = (bytesRemaining > len2 ? len2 : bytesRemaining);
-        memcpy(dst2, src, bytesToCopy);
-    }
-
-    // Move write position forward for next time
-    writePos += numBytes;
-
-    // Check if write position has moved past end of buffer
-	if (writePos >= audioBufferSize)
-	{
-        // If so, wrap it around to beginning again and set write wrapped flag
-        writePos -= audioBufferSize;
-        writeWrapped = true;
-    }
-
-Finish:
-    // Unlock SDL audio callback
-    SDL_UnlockAudio();
-
-    // Return whether buffer is half full
-    return bufferFull;
+    // Return whether buffer has reached its target level
+    return audioRing.Available() >= targetFrames;
 }
 
 void CloseAudio()
 {
     // Close SDL audio output
-    SDL_CloseAudio();
-
-    // Delete audio buffer
-	if (audioBuffer != NULL)
-	{
-        delete[] audioBuffer;
-        audioBuffer = NULL;
+    if (audioDevice != 0)
+    {
+        SDL_CloseAudioDevice(audioDevice);
+        audioDevice = 0;
     }
-}
\ No newline at end of file
+
+    // Delete audio buffers
+    resampleBuffer.clear();
+    audioRing.Init(0, 1);
+}
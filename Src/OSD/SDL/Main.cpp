@@ -67,11 +67,15 @@
 #include "Util/NewConfig.h"
 #include "Util/ConfigBuilders.h"
 #include "GameLoader.h"
+#include "RewindBuffer.h"
+#include "RunAhead.h"
 #include "SDLInputSystem.h"
 #include "SDLIncludes.h"
 #include "Debugger/SupermodelDebugger.h"
 #include "Graphics/Legacy3D/Legacy3D.h"
 #include "Graphics/New3D/New3D.h"
+#include "Graphics/New3D/PixelReadback.h"
+#include "Graphics/New3D/ProgramCache.h"
 #include "Model3/IEmulator.h"
 #include "Model3/Model3.h"
 #include "OSD/Audio.h"
@@ -434,6 +438,26 @@ static void SaveFrameBuffer(const std::string& file)
     Util::WriteSurfaceToBMP<Util::RGBA8>(file, pixels.get(), totalXRes, totalYRes, true);
 }
 
+// Screenshots are read into a buffer object and written out once the GPU has
+// got to them, so taking one doesn't stall the frame
+static struct
+{
+    New3D::PixelReadback buffer;
+    std::string file;
+    unsigned width = 0;
+    unsigned height = 0;
+} s_screenshot;
+
+static void SaveScreenshot(bool wait)
+{
+    if (!s_screenshot.buffer.Pending() || (!wait && !s_screenshot.buffer.Ready()))
+      return;
+    size_t size = s_screenshot.width * s_screenshot.height * 4;
+    std::shared_ptr<uint8_t> pixels(new uint8_t[size], std::default_delete<uint8_t[]>());
+    s_screenshot.buffer.Fetch(pixels.get(), size);
+    Util::WriteSurfaceToBMP<Util::RGBA8>(s_screenshot.file, pixels.get(), s_screenshot.width, s_screenshot.height, true);
+}
+
 void Screenshot()
 {
     // Make a screenshot
@@ -446,7 +470,24 @@ void Screenshot()
 
     info += file;
     puts(info.c_str());
-    SaveFrameBuffer(file);
+
+    if (!New3D::PixelReadback::Supported())
+    {
+      SaveFrameBuffer(file);
+      return;
+    }
+
+    SaveScreenshot(true); // one still waiting for the GPU
+    if (!s_screenshot.buffer.Create(totalXRes * totalYRes * 4))
+    {
+      SaveFrameBuffer(file);
+      return;
+    }
+    s_screenshot.buffer.Read(0, 0, 0, totalXRes, totalYRes, GL_RGBA, GL_UNSIGNED_BYTE);
+    s_screenshot.buffer.Fence();
+    s_screenshot.file = file;
+    s_screenshot.width = totalXRes;
+    s_screenshot.height = totalYRes;
 }
 
 /******************************************************************************
@@ -583,7 +624,7 @@ static void SaveState(IEmulator *Model3)
   CBlockFile  SaveState;
 
   std::string file_path = Util::Format() << "Saves/" << Model3->GetGame().name << ".st" << s_saveSlot;
-  if (OKAY != SaveState.Create(file_path, "Supermodel Save State", "Supermodel Version " SUPERMODEL_VERSION))
+  if (OKAY != SaveState.Create(file_path, "Supermodel Save State", "Supermodel Version " SUPERMODEL_VERSION, s_runtime_config["CompressSaveStates"].ValueAs<bool>()))
   {
     ErrorLog("Unable to save state to '%s'.", file_path.c_str());
     return;
@@ -946,6 +987,8 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
   bool        quit = false;
   bool        paused = false;
   bool        dumpTimings = false;
+  CRewindBuffer rewind;
+  CRunAhead   runAhead;
 
   // Initialize and load ROMs
   if (OKAY != Model3->Init())
@@ -1004,6 +1047,7 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
   uint64_t nextTime = 0;
 
   // Initialize the renderers
+  New3D::ProgramCache::SetDirectory(s_runtime_config["ShaderCache"].ValueAs<bool>() ? "ShaderCache" : "");
   CRender2D *Render2D = new CRender2D(s_runtime_config);
   IRender3D *Render3D = s_runtime_config["New3DEngine"].ValueAs<bool>() ? ((IRender3D *) new New3D::CNew3D(s_runtime_config, Model3->GetGame().name)) : ((IRender3D *) new Legacy3D::CLegacy3D(s_runtime_config));
   if (OKAY != Render2D->Init(xOffset, yOffset, xRes, yRes, totalXRes, totalYRes))
@@ -1019,6 +1063,30 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
   if (initialState.length() > 0)
     LoadState(Model3, initialState);
 
+  // Keep recent states for rewinding
+  if (s_runtime_config["Rewind"].ValueAs<bool>())
+  {
+    unsigned interval = std::max(1u, s_runtime_config["RewindInterval"].ValueAs<unsigned>());
+    unsigned maxStates = s_runtime_config["RewindSeconds"].ValueAs<unsigned>() * 60 / interval;
+    size_t maxBytes = size_t(s_runtime_config["RewindBufferSize"].ValueAs<unsigned>()) << 20;
+    rewind.Init(maxStates, interval, maxBytes);
+  }
+
+  // Present frames from a little in the future to hide input lag. Linked
+  // machines have already seen the frames that would be undone.
+  unsigned runAheadFrames = s_runtime_config["RunAhead"].ValueAs<unsigned>();
+  if (runAheadFrames > 0 && Model3->IsLinked())
+  {
+    InfoLog("Run-ahead disabled: frames run ahead cannot be undone on the other machines linked through the net board.");
+    runAheadFrames = 0;
+  }
+  runAhead.Init(runAheadFrames);
+
+  // Sample inputs between frames so the game reads newer values
+  unsigned inputSampleRate = s_runtime_config["InputSampleRate"].ValueAs<unsigned>();
+  if (inputSampleRate > 0)
+    Inputs->StartSampling(game, inputSampleRate);
+
 #ifdef SUPERMODEL_DEBUGGER
   // If debugger was supplied, set it as logger and attach it to system
   oldLogger = GetLogger();
@@ -1029,6 +1097,10 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
   }
 #endif // SUPERMODEL_DEBUGGER
 
+  // Settings checked every frame, kept up to date when they change
+  Util::Config::Binding<bool> throttle(s_runtime_config["Throttle"], true);
+  Util::Config::Binding<bool> showFrameRate(s_runtime_config["ShowFrameRate"], false);
+
   // Emulate!
   fpsFramesElapsed = 0;
   prevFPSTicks = SDL_GetPerformanceCounter();
@@ -1052,7 +1124,24 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
     if (paused)
       Model3->RenderFrame();
     else
-      Model3->RunFrame();
+    {
+      // While rewinding, each frame is run from an earlier state instead of
+      // being captured
+      bool rewinding = rewind.Enabled() && Inputs->uiRewind->value;
+      if (rewinding)
+      {
+        Model3->PauseThreads();
+        rewind.StepBack(Model3);
+        Model3->ResumeThreads();
+      }
+      runAhead.RunFrame(Model3);
+      if (!rewinding && rewind.CaptureDue())
+      {
+        Model3->PauseThreads();
+        rewind.Capture(Model3);
+        Model3->ResumeThreads();
+      }
+    }
 
 #ifdef SUPERMODEL_DEBUGGER
     bool processUI = true;
@@ -1076,6 +1165,9 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
     {
 #endif // SUPERMODEL_DEBUGGER
 
+    // Write out a screenshot taken in an earlier frame if it has been read back
+    SaveScreenshot(false);
+
     // Check UI controls
     if (Inputs->uiExit->Pressed())
     {
@@ -1092,6 +1184,7 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
 
       // Reset emulator
       Model3->Reset();
+      rewind.Reset();
 
 #ifdef SUPERMODEL_DEBUGGER
       // If debugger was supplied, reset it too
@@ -1196,6 +1289,7 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
 
       // Load game state
       LoadState(Model3);
+      rewind.Reset();
 
 #ifdef SUPERMODEL_DEBUGGER
       // If debugger was supplied, reset it after loading state
@@ -1295,8 +1389,8 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
     else if (Inputs->uiToggleFrLimit->Pressed())
     {
       // Toggle frame limiting
-      s_runtime_config.Get("Throttle").SetValue(!s_runtime_config["Throttle"].ValueAs<bool>());
-      printf("Frame limiting: %s\n", s_runtime_config["Throttle"].ValueAs<bool>() ? "On" : "Off");
+      s_runtime_config.Get("Throttle").SetValue(!throttle.Get());
+      printf("Frame limiting: %s\n", throttle.Get() ? "On" : "Off");
     }
     else if (Inputs->uiScreenshot->Pressed())
     {
@@ -1313,7 +1407,7 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
 #endif // SUPERMODEL_DEBUGGER
 
     // Refresh rate (frame limiting)
-    if (paused || s_runtime_config["Throttle"].ValueAs<bool>())
+    if (paused || throttle.Get())
     {
         SuperSleepUntil(nextTime);
         nextTime = SDL_GetPerformanceCounter() + perfCountPerFrame;
@@ -1321,7 +1415,7 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
 
     // Measure frame rate
     uint64_t currentFPSTicks = SDL_GetPerformanceCounter();
-    if (s_runtime_config["ShowFrameRate"].ValueAs<bool>())
+    if (showFrameRate.Get())
     {
       fpsFramesElapsed += 1;
       uint64_t measurementTicks = currentFPSTicks - prevFPSTicks;
@@ -1340,9 +1434,20 @@ int Supermodel(const Game &game, ROMSet *rom_set, IEmulator *Model3, CInputs *In
       CModel3 *M = dynamic_cast<CModel3 *>(Model3);
       if (M)
         M->DumpTimings();
+      runAhead.DumpTimings();
     }
   }
 
+  // Report what running ahead cost, to help with choosing how far to run ahead
+  runAhead.LogTimings();
+
+  // Don't lose a screenshot the GPU hadn't got to yet
+  SaveScreenshot(true);
+  s_screenshot.buffer.Destroy();
+
+  // Stop sampling inputs (this reports how old the values read by the game were)
+  Inputs->StopSampling();
+
   // Make sure all threads are paused before shutting down
   Model3->PauseThreads();
 
@@ -1473,10 +1578,21 @@ static Util::Config::Node DefaultConfig()
   Util::Config::Node config("Global");
   config.Set("GameXMLFile", s_gameXMLFilePath);
   config.Set("InitStateFile", "");
+  config.Set("Rewind", false);
+  config.Set("RewindSeconds", "10");
+  config.Set("RewindInterval", "4");
+  config.Set("RewindBufferSize", "256");
+  config.Set("RunAhead", "0");
+  config.Set("CompressSaveStates", false);
+  config.Set("ROMCache", false);
   // CModel3
   config.Set("MultiThreaded", true);
   config.Set("GPUMultiThreaded", true);
+  config.Set("PipelineDepth", "1");
   config.Set("PowerPCFrequency", "50");
+  config.Set("PowerPCDecodeCache", false);
+  config.Set("PowerPCDecodeCacheVerify", false);
+  config.Set("PowerPCIdleSkip", true);
   // 2D and 3D graphics engines
   config.Set("MultiTexture", false);
   config.Set("VertexShader", "");
@@ -1492,6 +1608,7 @@ static Util::Config::Node DefaultConfig()
   config.Set("BalanceFrontRear", "0");
   config.Set("NbSoundChannels", "4");
   config.Set("SoundFreq", "57.6"); // 60.0f? 57.524160f?
+  config.Set("AudioLatency", "50");
   // CDSB
   config.Set("EmulateDSB", true);
   config.Set("SoundVolume", "100");
@@ -1500,9 +1617,17 @@ static Util::Config::Node DefaultConfig()
   config.Set("LegacySoundDSP", false); // New config option for games that do not play correctly with MAME's SCSP sound core.
   // CDriveBoard
   config.Set("ForceFeedback", false);
+  // CInputs
+  config.Set("InputSampleRate", "0");
   // Platform-specific/UI
   config.Set("New3DEngine", false);
   config.Set("QuadRendering", false);
+  config.Set("New3DThreads", "1");
+  config.Set("New3DVerify", false);
+  config.Set("New3DVerifyVertices", false);
+  config.Set("New3DGPUTextures", false);
+  config.Set("New3DAsyncLos", false);
+  config.Set("ShaderCache", true);
   config.Set("XResolution", "496");
   config.Set("YResolution", "384");
   config.Set("FullScreen", false);
@@ -1543,6 +1668,7 @@ static Util::Config::Node DefaultConfig()
   config.Set("PortIn", unsigned(1970));
   config.Set("PortOut", unsigned(1971));
   config.Set("AddressOut", "127.0.0.1");
+  config.Set("NetFrameDeadline", unsigned(50));
 #endif
 #else
   config.Set("InputSystem", "sdl");
@@ -1581,10 +1707,30 @@ static void Help(void)
   puts("");
   puts("Core Options:");
   printf("  -ppc-frequency=<freq>   PowerPC frequency in MHz [Default: %d]\n", defaultConfig["PowerPCFrequency"].ValueAs<unsigned>());
+  puts("  -ppc-decode-cache       Run PowerPC code from a cache of pre-decoded basic");
+  puts("                          blocks");
+  puts("  -ppc-decode-cache-verify");
+  puts("                          Check cached PowerPC blocks against memory before");
+  puts("                          running them (implies -ppc-decode-cache)");
+  puts("  -no-idle-skip           Execute PowerPC spin loops instead of skipping them");
   puts("  -no-threads             Disable multi-threading entirely");
   puts("  -gpu-multi-threaded     Run graphics rendering in separate thread [Default]");
   puts("  -no-gpu-thread          Run graphics rendering in main thread");
+  puts("  -pipeline-depth=<n>     Frame pipeline stages: 1, 2 to also build the 3D");
+  puts("                          scene in its own thread, or 3 to build the next");
+  puts("                          frame while one is drawn (adds a frame of latency,");
+  puts("                          needs -gpu-multi-threaded) [Default: 1]");
   puts("  -load-state=<file>      Load save state after starting");
+  puts("  -compress-states        Compress save states (smaller but slower to save)");
+  puts("  -rom-cache              Keep assembled ROM regions in ROMCache/ so later");
+  puts("                          loads can map them instead of unzipping");
+  puts("  -rewind                 Keep recent states in memory so that play can be");
+  puts("                          rewound (hold Backspace)");
+  puts("  -rewind-seconds=<s>     How far back to keep states [Default: 10]");
+  puts("  -rewind-interval=<n>    Frames between kept states [Default: 4]");
+  puts("  -rewind-buffer=<mb>     Memory limit for kept states [Default: 256]");
+  puts("  -run-ahead=<n>          Frames to run ahead to hide input lag. Each one costs");
+  puts("                          a full emulated frame [Default: 0]");
   puts("");
   puts("Video Options:");
   puts("  -res=<x>,<y>            Resolution [Default: 496,384]");
@@ -1607,6 +1753,17 @@ static void Help(void)
   puts("  -nomousecursor          Disable desktop mouse cursor in SDL Windowed mode");
   puts("  -new3d                  New 3D engine by Ian Curtis");
   puts("  -quad-rendering         Enable proper quad rendering");
+  puts("  -new3d-threads=<n>      Threads for decoding and clipping 3D models, 0 picks");
+  puts("                          one per core (up to 4) [Default: 1]");
+  puts("  -new3d-verify           Check the threaded 3D scene against a serial build");
+  puts("  -new3d-verify-vertices  Check packed vertices against their float values");
+  puts("  -new3d-gpu-textures     Decode textures in the shader from a copy of texture");
+  puts("                          RAM (GLES only)");
+  puts("  -new3d-async-los        Read gun line of sight a frame late instead of");
+  puts("                          stalling the GPU mid-frame");
+  puts("  -shader-cache           Keep compiled shaders in ShaderCache/ so later runs");
+  puts("                          can skip compiling them (new engine) [Default]");
+  puts("  -no-shader-cache        Always compile shaders from source");
   puts("  -legacy3d               Legacy 3D engine (faster but less accurate) [Default]");
   puts("  -multi-texture          Use 8 texture maps for decoding (legacy engine)");
   puts("  -no-multi-texture       Decode to single texture (legacy engine) [Default]");
@@ -1624,6 +1781,7 @@ static void Help(void)
   puts("  -music-volume=<vol>     Digital Sound Board volume in % [Default: 100]");
   puts("  -balance=<bal>          Relative front/rear balance in % [Default: 0]");
   puts("  -channels=<c>           Number of sound channels to use on host [Default: 4]");
+  puts("  -audio-latency=<ms>     Audio buffer length in milliseconds [Default: 50]");
   puts("  -flip-stereo            Swap left and right audio channels");
   puts("  -no-sound               Disable sound board emulation (sound effects)");
   puts("  -no-dsb                 Disable Digital Sound Board (MPEG music)");
@@ -1636,11 +1794,15 @@ static void Help(void)
   puts("  -net                    Enable net board");
   puts("  -simulate-netboard      Simulate the net board [Default]");
   puts("  -emulate-netboard       Emulate the net board (requires -no-threads)");
+  puts("  -net-deadline=<ms>      Longest wait each frame for linked machines' data,");
+  puts("                          0 to always wait [Default: 50]");
   puts("");
 #endif
   puts("Input Options:");
   puts("  -force-feedback         Enable force feedback (DirectInput, XInput)");
   puts("  -config-inputs          Configure keyboards, mice, and game controllers");
+  puts("  -input-sample-rate=<hz> Read game controllers this many times a second");
+  puts("                          between frames, 0 for once per frame [Default: 0]");
 #ifdef SUPERMODEL_WIN32
   printf("  -input-system=<s>       Input system [Default: %s]\n", defaultConfig["InputSystem"].ValueAs<std::string>().c_str());
   printf("  -outputs=<s>            Outputs [Default: %s]\n", defaultConfig["Outputs"].ValueAs<std::string>().c_str());
@@ -1690,7 +1852,16 @@ static ParsedCommandLine ParseCommandLine(int argc, char **argv)
   { // -option=value
     { "-game-xml-file",         "GameXMLFile"             },
     { "-load-state",            "InitStateFile"           },
+    { "-rewind-seconds",        "RewindSeconds"           },
+    { "-rewind-interval",       "RewindInterval"          },
+    { "-rewind-buffer",         "RewindBufferSize"        },
+    { "-run-ahead",             "RunAhead"                },
+#ifdef NET_BOARD
+    { "-net-deadline",          "NetFrameDeadline"        },
+#endif
     { "-ppc-frequency",         "PowerPCFrequency"        },
+    { "-pipeline-depth",        "PipelineDepth"           },
+    { "-new3d-threads",         "New3DThreads"            },
     { "-crosshairs",            "Crosshairs"              },
     { "-border",                "Border"                  },
     { "-sinden",                "Border"                  },
@@ -1705,7 +1876,9 @@ static ParsedCommandLine ParseCommandLine(int argc, char **argv)
     { "-balance",               "Balance"                 },
     { "-channels", 	            "NbSoundChannels"         },
     { "-soundfreq",             "SoundFreq"               },
+    { "-audio-latency",         "AudioLatency"            },
     { "-input-system",          "InputSystem"             },
+    { "-input-sample-rate",     "InputSampleRate"         },
     { "-outputs",               "Outputs"                 },
     { "-log-output",            "LogOutput"               },
     { "-log-level",             "LogLevel"                }
@@ -1714,8 +1887,18 @@ static ParsedCommandLine ParseCommandLine(int argc, char **argv)
   { // -option
     { "-threads",             { "MultiThreaded",    true } },
     { "-no-threads",          { "MultiThreaded",    false } },
+    { "-ppc-decode-cache",    { "PowerPCDecodeCache", true } },
+    { "-no-ppc-decode-cache", { "PowerPCDecodeCache", false } },
+    { "-ppc-decode-cache-verify", { "PowerPCDecodeCacheVerify", true } },
+    { "-idle-skip",           { "PowerPCIdleSkip", true } },
+    { "-no-idle-skip",        { "PowerPCIdleSkip", false } },
     { "-gpu-multi-threaded",  { "GPUMultiThreaded", true } },
     { "-no-gpu-thread",       { "GPUMultiThreaded", false } },
+    { "-rewind",              { "Rewind",           true } },
+    { "-no-rewind",           { "Rewind",           false } },
+    { "-compress-states",     { "CompressSaveStates", true } },
+    { "-rom-cache",           { "ROMCache",         true } },
+    { "-no-rom-cache",        { "ROMCache",         false } },
     { "-window",              { "FullScreen",       false } },
     { "-fullscreen",          { "FullScreen",       true } },
     { "-no-wide-screen",      { "WideScreen",       false } },
@@ -1734,6 +1917,12 @@ static ParsedCommandLine ParseCommandLine(int argc, char **argv)
     { "-no-fps",              { "ShowFrameRate",    false } },
     { "-new3d",               { "New3DEngine",      true } },
     { "-quad-rendering",      { "QuadRendering",    true } },
+    { "-new3d-verify",        { "New3DVerify",      true } },
+    { "-new3d-verify-vertices", { "New3DVerifyVertices", true } },
+    { "-new3d-gpu-textures",  { "New3DGPUTextures", true } },
+    { "-new3d-async-los",     { "New3DAsyncLos",    true } },
+    { "-shader-cache",        { "ShaderCache",      true } },
+    { "-no-shader-cache",     { "ShaderCache",      false } },
     { "-legacy3d",            { "New3DEngine",      false } },
     { "-no-flip-stereo",      { "FlipStereo",       false } },
     { "-flip-stereo",         { "FlipStereo",       true } },
@@ -1954,6 +2143,8 @@ int main(int argc, char **argv)
     {
       std::string xml_file = config3["GameXMLFile"].ValueAs<std::string>();
       GameLoader loader(xml_file);
+      if (config3["ROMCache"].ValueAs<bool>())
+        loader.SetCacheDirectory("ROMCache");
       if (print_games)
       {
         PrintGameList(xml_file, loader.GetGames());
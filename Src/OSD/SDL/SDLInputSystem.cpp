@@ -884,6 +884,16 @@ bool CSDLInputSystem::Poll()
   return true;
 }
 
+bool CSDLInputSystem::RefreshDevices()
+{
+  // Joysticks and game controllers can be updated from any thread (SDL locks them while it does so). Keyboard and mouse state only
+  // changes when events are pumped, which has to happen on the main thread in Poll().
+  if (m_joysticks.empty())
+    return false;
+  SDL_JoystickUpdate();
+  return true;
+}
+
 void CSDLInputSystem::SetMouseVisibility(bool visible)
 {
   SDL_ShowCursor(visible ? SDL_ENABLE : SDL_DISABLE);
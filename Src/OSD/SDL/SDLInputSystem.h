@@ -190,6 +190,8 @@ public:
 
 	bool Poll();
 
+	bool RefreshDevices();
+
 	void SetMouseVisibility(bool visible);
 };
 
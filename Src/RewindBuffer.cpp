@@ -0,0 +1,123 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2021 Bart Trzynadlowski, Nik Henson, Ian Curtis,
+ **                     Harry Tuttle, and Spindizzi
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * RewindBuffer.cpp
+ *
+ * Implementation of the CRewindBuffer class.
+ */
+
+#include "RewindBuffer.h"
+
+#include "BlockFile.h"
+#include "Model3/IEmulator.h"
+#include "Supermodel.h"
+
+
+void CRewindBuffer::Init(unsigned maxStates, unsigned interval, size_t maxBytes)
+{
+  m_maxStates = maxStates;
+  m_interval = interval > 0 ? interval : 1;
+  m_maxBytes = maxBytes;
+  Reset();
+}
+
+bool CRewindBuffer::CaptureDue(void)
+{
+  if (!Enabled())
+    return false;
+  if (++m_frameCount < m_interval)
+    return false;
+  m_frameCount = 0;
+  return true;
+}
+
+void CRewindBuffer::Capture(IEmulator *Model3)
+{
+  size_t oldSize = m_image.size();
+
+  CBlockFile state;
+  state.Create(&m_image, "Supermodel Rewind State", "Supermodel Version " SUPERMODEL_VERSION, &m_delta);
+  Model3->SaveState(&state);
+  state.Close();
+
+  // The first state has nothing to go back to. If the layout of the state ever
+  // changed, the difference would not cover all of the old one.
+  if (oldSize == 0)
+    return;
+  if (m_image.size() != oldSize)
+  {
+    m_history.clear();
+    m_historyBytes = 0;
+    return;
+  }
+
+  m_history.emplace_back(m_delta.begin(), m_delta.end());
+  m_historyBytes += m_delta.size();
+  while (m_history.size() > m_maxStates || (m_historyBytes > m_maxBytes && m_history.size() > 1))
+  {
+    m_historyBytes -= m_history.front().size();
+    m_history.pop_front();
+  }
+}
+
+bool CRewindBuffer::StepBack(IEmulator *Model3)
+{
+  if (m_image.empty())
+    return FAIL;
+
+  if (!m_history.empty())
+  {
+    if (OKAY != CBlockFile::ApplyDelta(&m_image, m_history.back()))
+    {
+      ErrorLog("Rewind buffer is corrupt.");
+      Reset();
+      return FAIL;
+    }
+    m_historyBytes -= m_history.back().size();
+    m_history.pop_back();
+  }
+
+  CBlockFile state;
+  state.Load(m_image.data(), m_image.size());
+  Model3->LoadState(&state);
+  state.Close();
+  m_frameCount = 0;
+  return OKAY;
+}
+
+void CRewindBuffer::Reset(void)
+{
+  m_image.clear();
+  m_history.clear();
+  m_historyBytes = 0;
+  m_frameCount = 0;
+}
+
+CRewindBuffer::CRewindBuffer(void)
+  : m_historyBytes(0),
+    m_maxStates(0),
+    m_interval(1),
+    m_frameCount(0),
+    m_maxBytes(0)
+{
+}
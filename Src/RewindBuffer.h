@@ -0,0 +1,153 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2021 Bart Trzynadlowski, Nik Henson, Ian Curtis,
+ **                     Harry Tuttle, and Spindizzi
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * RewindBuffer.h
+ *
+ * Keeps the last few seconds of emulator states in memory so that play can be
+ * rewound.
+ */
+
+#ifndef INCLUDED_REWINDBUFFER_H
+#define INCLUDED_REWINDBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+class IEmulator;
+
+/*
+ * CRewindBuffer:
+ *
+ * Only the newest state is kept whole, as an in-memory block file. Each time
+ * a new state is captured it overwrites the previous one in place and the
+ * XOR difference between the two (see CBlockFile) is kept instead, so older
+ * states cost only what changed from one capture to the next. Stepping back
+ * applies the newest difference to recover the state before it.
+ *
+ * Capturing and stepping back save and load emulator state, so the emulator's
+ * threads must be paused around them.
+ */
+class CRewindBuffer
+{
+public:
+  /*
+   * Init(maxStates, interval, maxBytes):
+   *
+   * Sets the size of the buffer and discards its contents.
+   *
+   * Parameters:
+   *    maxStates   Number of older states to keep. 0 disables rewinding.
+   *    interval    Frames between captures.
+   *    maxBytes    Limit on memory used for the older states.
+   */
+  void Init(unsigned maxStates, unsigned interval, size_t maxBytes);
+
+  /*
+   * Enabled(void):
+   *
+   * Returns:
+   *    True if states are being kept.
+   */
+  bool Enabled(void) const
+  {
+    return m_maxStates > 0;
+  }
+
+  /*
+   * CaptureDue(void):
+   *
+   * Counts a frame.
+   *
+   * Returns:
+   *    True if a state should be captured after this frame.
+   */
+  bool CaptureDue(void);
+
+  /*
+   * Capture(Model3):
+   *
+   * Saves the emulator state as the newest one, discarding the oldest if the
+   * buffer is full.
+   *
+   * Parameters:
+   *    Model3  Emulator.
+   */
+  void Capture(IEmulator *Model3);
+
+  /*
+   * StepBack(Model3):
+   *
+   * Loads the state captured before the newest one and drops the newest. If
+   * there is none, the oldest state is loaded again.
+   *
+   * Parameters:
+   *    Model3  Emulator.
+   *
+   * Returns:
+   *    OKAY if a state was loaded, FAIL if nothing has been captured.
+   */
+  bool StepBack(IEmulator *Model3);
+
+  /*
+   * Reset(void):
+   *
+   * Discards all states. Must be called whenever the emulator state changes
+   * by other means (resets, loading save states).
+   */
+  void Reset(void);
+
+  /*
+   * NumStates(void):
+   * HistoryBytes(void):
+   *
+   * Returns:
+   *    Number of states that can be stepped back to and the memory used to
+   *    keep them.
+   */
+  unsigned NumStates(void) const
+  {
+    return (unsigned) m_history.size();
+  }
+
+  size_t HistoryBytes(void) const
+  {
+    return m_historyBytes;
+  }
+
+  CRewindBuffer(void);
+
+private:
+  std::vector<uint8_t>              m_image;          // newest state (block file image)
+  std::vector<uint8_t>              m_delta;          // scratch for recording the newest difference
+  std::deque<std::vector<uint8_t>>  m_history;        // differences to each older state, oldest first
+  size_t                            m_historyBytes;
+  unsigned                          m_maxStates;
+  unsigned                          m_interval;
+  unsigned                          m_frameCount;
+  size_t                            m_maxBytes;
+};
+
+
+#endif  // INCLUDED_REWINDBUFFER_H
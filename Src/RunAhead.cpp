@@ -0,0 +1,147 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2021 Bart Trzynadlowski, Nik Henson, Ian Curtis,
+ **                     Harry Tuttle, and Spindizzi
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+/*
+ * RunAhead.cpp
+ *
+ * Implementation of the CRunAhead class.
+ */
+
+#include "RunAhead.h"
+
+#include "BlockFile.h"
+#include "Model3/IEmulator.h"
+#include "Supermodel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+// Model 3 frame rate
+static const double FRAME_BUDGET_MS = 1000.0 / 57.524160;
+
+static uint64_t MicrosecondsSince(std::chrono::steady_clock::time_point *start)
+{
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  uint64_t us = std::chrono::duration_cast<std::chrono::microseconds>(now - *start).count();
+  *start = now;
+  return us;
+}
+
+void CRunAhead::Init(unsigned frames)
+{
+  m_frames = frames;
+  m_image.clear();
+  m_last = Timings();
+  m_total = Timings();
+  m_numFrames = 0;
+}
+
+void CRunAhead::RunFrame(IEmulator *Model3)
+{
+  if (!Enabled())
+  {
+    Model3->RunFrame();
+    return;
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  // The frame that is kept. Its audio is output but its picture is stale.
+  Model3->SetFrameOutput(false, true);
+  Model3->RunFrame();
+  m_last.frameUs = MicrosecondsSince(&start);
+
+  // The buffer is reused, so after the first frame saving doesn't allocate
+  Model3->PauseThreads();
+  CBlockFile state;
+  state.Create(&m_image, "Supermodel Run-Ahead State", "Supermodel Version " SUPERMODEL_VERSION);
+  Model3->SaveState(&state);
+  state.Close();
+  Model3->ResumeThreads();
+  m_last.saveUs = MicrosecondsSince(&start);
+
+  // Frames that only get the game to the one that is shown. They are undone
+  // below, so they must not drive the cabinet.
+  Model3->SetFrameOutput(false, false);
+  Model3->SetFrameKept(false);
+  for (unsigned i = 1; i < m_frames; i++)
+    Model3->RunFrame();
+  m_last.hiddenUs = MicrosecondsSince(&start);
+
+  Model3->SetFrameOutput(true, false);
+  Model3->RunFrame();
+  m_last.finalUs = MicrosecondsSince(&start);
+
+  Model3->PauseThreads();
+  state.Load(m_image.data(), m_image.size());
+  Model3->LoadState(&state);
+  state.Close();
+  Model3->ResumeThreads();
+  Model3->SetFrameOutput(true, true);
+  Model3->SetFrameKept(true);
+  m_last.loadUs = MicrosecondsSince(&start);
+
+  m_total.frameUs += m_last.frameUs;
+  m_total.saveUs += m_last.saveUs;
+  m_total.hiddenUs += m_last.hiddenUs;
+  m_total.finalUs += m_last.finalUs;
+  m_total.loadUs += m_last.loadUs;
+  m_numFrames++;
+}
+
+void CRunAhead::DumpTimings(void) const
+{
+  if (!Enabled())
+    return;
+  uint64_t totalUs = m_last.frameUs + m_last.saveUs + m_last.hiddenUs + m_last.finalUs + m_last.loadUs;
+  printf("run-ahead %u: frame:%5.1fms save:%5.1fms hidden:%5.1fms shown:%5.1fms load:%5.1fms total:%5.1fms%c\n",
+    m_frames, m_last.frameUs / 1000.0, m_last.saveUs / 1000.0, m_last.hiddenUs / 1000.0, m_last.finalUs / 1000.0, m_last.loadUs / 1000.0,
+    totalUs / 1000.0, (totalUs / 1000.0 > FRAME_BUDGET_MS ? '!' : ' '));
+}
+
+void CRunAhead::LogTimings(void) const
+{
+  if (!Enabled() || m_numFrames == 0)
+    return;
+
+  // A frame without output costs about what the kept frame does less its audio,
+  // and each frame run ahead adds one of those
+  double frameMs = (double) m_total.frameUs / m_numFrames / 1000.0;
+  double saveMs = (double) m_total.saveUs / m_numFrames / 1000.0;
+  double loadMs = (double) m_total.loadUs / m_numFrames / 1000.0;
+  double hiddenMs = m_frames > 1 ? (double) m_total.hiddenUs / m_numFrames / (m_frames - 1) / 1000.0 : frameMs;
+  double shownMs = (double) m_total.finalUs / m_numFrames / 1000.0;
+  double totalMs = frameMs + saveMs + loadMs + hiddenMs * (m_frames - 1) + shownMs;
+  int affordable = (int) ((FRAME_BUDGET_MS - frameMs - saveMs - loadMs - shownMs) / std::max(hiddenMs, 0.001)) + 1;
+  InfoLog("Run-ahead (%u frames) over %llu frames: %.2f ms per frame (kept %.2f, save %.2f, hidden %.2f each, shown %.2f, load %.2f). About %d frames would fit in %.2f ms.",
+    m_frames, (unsigned long long) m_numFrames, totalMs, frameMs, saveMs, hiddenMs, shownMs, loadMs, std::max(affordable, 0), FRAME_BUDGET_MS);
+}
+
+CRunAhead::CRunAhead(void)
+  : m_frames(0),
+    m_last(),
+    m_total(),
+    m_numFrames(0)
+{
+}
@@ -0,0 +1,124 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2021 Bart Trzynadlowski, Nik Henson, Ian Curtis,
+ **                     Harry Tuttle, and Spindizzi
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+/*
+ * RunAhead.h
+ *
+ * Hides input lag by presenting frames from slightly in the future.
+ */
+
+#ifndef INCLUDED_RUNAHEAD_H
+#define INCLUDED_RUNAHEAD_H
+
+#include <cstdint>
+#include <vector>
+
+class IEmulator;
+
+/*
+ * CRunAhead:
+ *
+ * Games take a few frames to react to their inputs. Running ahead shows the
+ * reaction sooner: each frame is emulated with the new inputs and saved to
+ * memory, then the emulator runs on a few more frames without output and only
+ * the last of these is rendered, after which the saved state is reloaded. The
+ * audio comes from the first frame, so it stays continuous, and only that
+ * frame drives force feedback and the other outputs. A machine linked to
+ * others through the net board can't run ahead, as they would see frames that
+ * are then undone.
+ *
+ * Every displayed frame costs 1 + frames emulated frames plus saving and
+ * loading the state, so whether a given game can afford it (and how many
+ * frames) depends on the host. The costs are measured as it runs.
+ *
+ * The sound board must be running in step with the frames (see CModel3, which
+ * arranges this when the RunAhead setting is non-zero).
+ */
+class CRunAhead
+{
+public:
+  /*
+   * Init(frames):
+   *
+   * Parameters:
+   *    frames  Number of frames to run ahead. 0 disables running ahead.
+   */
+  void Init(unsigned frames);
+
+  /*
+   * Enabled(void):
+   *
+   * Returns:
+   *    True if running ahead.
+   */
+  bool Enabled(void) const
+  {
+    return m_frames > 0;
+  }
+
+  /*
+   * RunFrame(Model3):
+   *
+   * Runs the emulator for a frame, ahead if enabled.
+   *
+   * Parameters:
+   *    Model3  Emulator.
+   */
+  void RunFrame(IEmulator *Model3);
+
+  /*
+   * DumpTimings(void):
+   *
+   * Prints the cost of the last frame to stdout.
+   */
+  void DumpTimings(void) const;
+
+  /*
+   * LogTimings(void):
+   *
+   * Writes the average cost of a frame to the info log, with an estimate of
+   * how many frames could be run ahead at full speed.
+   */
+  void LogTimings(void) const;
+
+  CRunAhead(void);
+
+private:
+  struct Timings
+  {
+    uint64_t frameUs;   // frame that is kept (with audio)
+    uint64_t saveUs;
+    uint64_t hiddenUs;  // frames that are thrown away, all together
+    uint64_t finalUs;   // frame that is shown
+    uint64_t loadUs;
+  };
+
+  std::vector<uint8_t>  m_image;      // state saved after the kept frame
+  unsigned              m_frames;
+  Timings               m_last;
+  Timings               m_total;
+  uint64_t              m_numFrames;
+};
+
+
+#endif  // INCLUDED_RUNAHEAD_H
@@ -0,0 +1,289 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2021 Bart Trzynadlowski, Nik Henson, Ian Curtis,
+ **                     Harry Tuttle, and Spindizzi
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * Resampler.cpp
+ *
+ * Audio ring buffer and polyphase resampler used by the OSD audio back ends.
+ *
+ * Each output frame is a dot product of the TAPS input frames around it with
+ * one phase of a Kaiser-windowed sinc filter. The filter is tabulated at
+ * PHASES fractional positions per input frame and the two phases bracketing
+ * the exact position are linearly interpolated, so any ratio (including one
+ * that changes continuously under rate control) is handled the same way. The
+ * cutoff sits just below the lower of the two Nyquist frequencies.
+ */
+
+#include "Resampler.h"
+
+#include "Supermodel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define RESAMPLER_SSE
+#include <xmmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+#define RESAMPLER_NEON
+#include <arm_neon.h>
+#endif
+
+
+/******************************************************************************
+ Audio Ring Buffer
+******************************************************************************/
+
+void CAudioRing::Init(unsigned frames, unsigned channels)
+{
+	unsigned capacity = 1;
+	while (capacity < frames)
+		capacity <<= 1;
+	m_buffer.assign(capacity * channels, 0);
+	m_mask = capacity - 1;
+	m_channels = channels;
+	m_writeCount.store(0, std::memory_order_relaxed);
+	m_readCount.store(0, std::memory_order_relaxed);
+}
+
+unsigned CAudioRing::Write(const INT16 *frames, unsigned numFrames)
+{
+	unsigned write = m_writeCount.load(std::memory_order_relaxed);
+	unsigned read = m_readCount.load(std::memory_order_acquire);
+	numFrames = std::min(numFrames, Capacity() - (write - read));
+
+	unsigned start = write & m_mask;
+	unsigned first = std::min(numFrames, Capacity() - start);
+	memcpy(&m_buffer[start * m_channels], frames, first * m_channels * sizeof(INT16));
+	memcpy(&m_buffer[0], frames + first * m_channels, (numFrames - first) * m_channels * sizeof(INT16));
+
+	m_writeCount.store(write + numFrames, std::memory_order_release);
+	return numFrames;
+}
+
+unsigned CAudioRing::Read(INT16 *frames, unsigned numFrames)
+{
+	unsigned read = m_readCount.load(std::memory_order_relaxed);
+	unsigned write = m_writeCount.load(std::memory_order_acquire);
+	numFrames = std::min(numFrames, write - read);
+
+	unsigned start = read & m_mask;
+	unsigned first = std::min(numFrames, Capacity() - start);
+	memcpy(frames, &m_buffer[start * m_channels], first * m_channels * sizeof(INT16));
+	memcpy(frames + first * m_channels, &m_buffer[0], (numFrames - first) * m_channels * sizeof(INT16));
+
+	m_readCount.store(read + numFrames, std::memory_order_release);
+	return numFrames;
+}
+
+CAudioRing::CAudioRing()
+	: m_mask(0),
+	  m_channels(1),
+	  m_writeCount(0),
+	  m_readCount(0)
+{
+}
+
+
+/******************************************************************************
+ Resampler
+******************************************************************************/
+
+// Zeroth order modified Bessel function of the first kind, for the window
+static double BesselI0(double x)
+{
+	double sum = 1.0, term = 1.0;
+	for (int k = 1; k < 32; k++)
+	{
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum += term;
+	}
+	return sum;
+}
+
+bool CResampler::Init(int inRate, int outRate, int channels)
+{
+	if (inRate <= 0 || outRate <= 0 || channels < 1 || channels > 4)
+		return ErrorLog("Unsupported resampler configuration: %d Hz -> %d Hz, %d channels.", inRate, outRate, channels);
+
+	m_channels = channels;
+	m_nominalStep = (double)inRate / (double)outRate;
+
+	// Cutoff in cycles per input frame, with room for the transition band
+	const double cutoff = 0.5 * 0.9 * std::min(1.0, (double)outRate / (double)inRate);
+	const double beta = 8.0;
+	const double pi = 3.14159265358979323846;
+	m_coeffs.resize((PHASES + 1) * TAPS);
+	for (int p = 0; p <= PHASES; p++)
+	{
+		float *coeffs = &m_coeffs[p * TAPS];
+		double sum = 0.0;
+		for (int k = 0; k < TAPS; k++)
+		{
+			// Distance of tap k from the output position, which lies p/PHASES past tap TAPS/2-1
+			double x = (double)(k - (TAPS / 2 - 1)) - (double)p / PHASES;
+			double t = x / (TAPS / 2);
+			double window = std::fabs(t) < 1.0 ? BesselI0(beta * std::sqrt(1.0 - t * t)) / BesselI0(beta) : 0.0;
+			double sinc = x == 0.0 ? 1.0 : std::sin(2.0 * pi * cutoff * x) / (2.0 * pi * cutoff * x);
+			coeffs[k] = (float)(sinc * window);
+			sum += coeffs[k];
+		}
+		for (int k = 0; k < TAPS; k++)	// unity gain at DC for every phase
+			coeffs[k] = (float)(coeffs[k] / sum);
+	}
+
+	Reset();
+	return OKAY;
+}
+
+void CResampler::Reset(void)
+{
+	// Start with half a filter of silence so the first output frame lines up with the first input frame
+	for (int ch = 0; ch < m_channels; ch++)
+		m_history[ch].assign(TAPS / 2, 0.0f);
+	m_historyFrames = TAPS / 2;
+	m_pos = 0.0;
+	m_step = m_nominalStep;
+	m_bufferLevel = -1.0;
+	m_rateBias = 0.0;
+}
+
+void CResampler::UpdateBufferLevel(unsigned queuedFrames, unsigned targetFrames)
+{
+	if (targetFrames == 0)
+		return;
+
+	// The device drains the buffer in bursts, so smooth the level over several calls
+	if (m_bufferLevel < 0.0)
+		m_bufferLevel = targetFrames;
+	m_bufferLevel += 0.05 * ((double)queuedFrames - m_bufferLevel);
+
+	// Above target: consume input faster (fewer output frames), below: slower
+	double error = (m_bufferLevel - targetFrames) / targetFrames;
+	error = std::max(-1.0, std::min(1.0, error));
+
+	// The proportional term alone settles wherever the error cancels the clock
+	// mismatch, so also integrate the error into a slow estimate of it
+	m_rateBias += RATE_BIAS_GAIN * error;
+	m_rateBias = std::max(-1.0, std::min(1.0, m_rateBias));
+	double correction = std::max(-1.0, std::min(1.0, error + m_rateBias));
+	m_step = m_nominalStep * (1.0 + MAX_RATE_DEVIATION * correction);
+}
+
+int CResampler::MaxOutputFrames(int inFrames) const
+{
+	return (int)((double)(inFrames + TAPS) / (m_nominalStep * (1.0 - MAX_RATE_DEVIATION))) + 2;
+}
+
+float CResampler::Filter(const float *history, const float *coeffs0, const float *coeffs1, float mu)
+{
+#if defined(RESAMPLER_SSE)
+	__m128 acc0 = _mm_setzero_ps();
+	__m128 acc1 = _mm_setzero_ps();
+	for (int k = 0; k < TAPS; k += 4)
+	{
+		__m128 h = _mm_loadu_ps(&history[k]);
+		acc0 = _mm_add_ps(acc0, _mm_mul_ps(h, _mm_loadu_ps(&coeffs0[k])));
+		acc1 = _mm_add_ps(acc1, _mm_mul_ps(h, _mm_loadu_ps(&coeffs1[k])));
+	}
+	__m128 acc = _mm_add_ps(acc0, _mm_mul_ps(_mm_set1_ps(mu), _mm_sub_ps(acc1, acc0)));
+	acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+	acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+	return _mm_cvtss_f32(acc);
+#elif defined(RESAMPLER_NEON)
+	float32x4_t acc0 = vdupq_n_f32(0.0f);
+	float32x4_t acc1 = vdupq_n_f32(0.0f);
+	for (int k = 0; k < TAPS; k += 4)
+	{
+		float32x4_t h = vld1q_f32(&history[k]);
+		acc0 = vmlaq_f32(acc0, h, vld1q_f32(&coeffs0[k]));
+		acc1 = vmlaq_f32(acc1, h, vld1q_f32(&coeffs1[k]));
+	}
+	float32x4_t acc = vmlaq_n_f32(acc0, vsubq_f32(acc1, acc0), mu);
+	float32x2_t sum = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+	return vget_lane_f32(vpadd_f32(sum, sum), 0);
+#else
+	float acc0 = 0.0f, acc1 = 0.0f;
+	for (int k = 0; k < TAPS; k++)
+	{
+		acc0 += history[k] * coeffs0[k];
+		acc1 += history[k] * coeffs1[k];
+	}
+	return acc0 + mu * (acc1 - acc0);
+#endif
+}
+
+int CResampler::Process(INT16 *out, const INT16 *in, int inFrames)
+{
+	// Append input, deinterleaved
+	for (int ch = 0; ch < m_channels; ch++)
+	{
+		std::vector<float> &history = m_history[ch];
+		history.resize(m_historyFrames + inFrames);
+		float *dest = &history[m_historyFrames];
+		for (int i = 0; i < inFrames; i++)
+			dest[i] = (float)in[i * m_channels + ch];
+	}
+	m_historyFrames += inFrames;
+
+	// Generate every output frame whose filter window is complete
+	int outFrames = 0;
+	while ((int)m_pos + TAPS <= m_historyFrames)
+	{
+		int pos = (int)m_pos;
+		float phase = (float)(m_pos - pos) * PHASES;
+		int p = std::min((int)phase, PHASES - 1);
+		const float *coeffs0 = &m_coeffs[p * TAPS];
+		const float *coeffs1 = coeffs0 + TAPS;
+		float mu = phase - p;
+		for (int ch = 0; ch < m_channels; ch++)
+		{
+			long s = lrintf(Filter(&m_history[ch][pos], coeffs0, coeffs1, mu));
+			*out++ = (INT16)std::max(-32768L, std::min(32767L, s));
+		}
+		outFrames++;
+		m_pos += m_step;
+	}
+
+	// Keep only the frames future output still needs
+	int consumed = std::min((int)m_pos, m_historyFrames);
+	for (int ch = 0; ch < m_channels; ch++)
+	{
+		std::vector<float> &history = m_history[ch];
+		std::copy(history.begin() + consumed, history.begin() + m_historyFrames, history.begin());
+	}
+	m_historyFrames -= consumed;
+	m_pos -= consumed;
+	return outFrames;
+}
+
+CResampler::CResampler(void)
+	: m_channels(1),
+	  m_nominalStep(1.0),
+	  m_step(1.0),
+	  m_pos(0.0),
+	  m_bufferLevel(-1.0),
+	  m_rateBias(0.0),
+	  m_historyFrames(0)
+{
+}
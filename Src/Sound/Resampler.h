@@ -0,0 +1,184 @@
+/**
+ ** Supermodel
+ ** A Sega Model 3 Arcade Emulator.
+ ** Copyright 2011-2021 Bart Trzynadlowski, Nik Henson, Ian Curtis,
+ **                     Harry Tuttle, and Spindizzi
+ **
+ ** This file is part of Supermodel.
+ **
+ ** Supermodel is free software: you can redistribute it and/or modify it under
+ ** the terms of the GNU General Public License as published by the Free
+ ** Software Foundation, either version 3 of the License, or (at your option)
+ ** any later version.
+ **
+ ** Supermodel is distributed in the hope that it will be useful, but WITHOUT
+ ** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ ** FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ ** more details.
+ **
+ ** You should have received a copy of the GNU General Public License along
+ ** with Supermodel.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+/*
+ * Resampler.h
+ *
+ * Sample rate conversion and buffering between the emulated sound hardware
+ * (44.1 KHz) and the host audio device, which usually runs at its own native
+ * rate. Used by the OSD audio back ends.
+ */
+
+#ifndef INCLUDED_RESAMPLER_H
+#define INCLUDED_RESAMPLER_H
+
+#include "Types.h"
+#include <atomic>
+#include <vector>
+
+
+/******************************************************************************
+ Audio Ring Buffer
+******************************************************************************/
+
+/*
+ * CAudioRing:
+ *
+ * Lock-free ring buffer of interleaved 16-bit sample frames for exactly one
+ * producer (the emulation thread) and one consumer (the audio callback).
+ * Neither side ever blocks: the producer drops what doesn't fit and the
+ * consumer gets fewer frames than it asked for.
+ */
+class CAudioRing
+{
+public:
+	/*
+	 * Init(frames, channels):
+	 *
+	 * Allocates the buffer (rounded up to a power of two frames) and empties
+	 * it. Must not be called while either side is using the ring.
+	 */
+	void Init(unsigned frames, unsigned channels);
+
+	// Frames that can be read right now
+	unsigned Available() const
+	{
+		return m_writeCount.load(std::memory_order_acquire) - m_readCount.load(std::memory_order_acquire);
+	}
+
+	unsigned Capacity() const
+	{
+		return m_mask + 1;
+	}
+
+	// Producer side. Returns number of frames actually written.
+	unsigned Write(const INT16 *frames, unsigned numFrames);
+
+	// Consumer side. Returns number of frames actually read.
+	unsigned Read(INT16 *frames, unsigned numFrames);
+
+	CAudioRing();
+
+private:
+	std::vector<INT16>		m_buffer;
+	unsigned				m_mask;
+	unsigned				m_channels;
+	std::atomic<unsigned>	m_writeCount;	// free running frame counters, only ever advanced by their own side
+	std::atomic<unsigned>	m_readCount;
+};
+
+
+/******************************************************************************
+ Resampler
+******************************************************************************/
+
+/*
+ * CResampler:
+ *
+ * Polyphase windowed-sinc resampler for interleaved 16-bit audio with 1 to 4
+ * channels. Input is accepted in chunks of any size and filter history is
+ * carried over between them.
+ *
+ * Dynamic rate control: the emulation and the audio device run off different
+ * clocks, so a buffer between them slowly fills up or drains. If the buffer
+ * level is reported with UpdateBufferLevel(), the conversion ratio is nudged
+ * by at most MAX_RATE_DEVIATION (an inaudible pitch change) to hold it at the
+ * target, which keeps the buffer small without under-runs. The error is also
+ * integrated, so a constant clock mismatch is trimmed out instead of leaving
+ * the level offset from the target.
+ */
+class CResampler
+{
+public:
+	static const int	TAPS = 32;							// filter length, must be a multiple of 4
+	static const int	PHASES = 256;						// filter phases per input sample
+	static constexpr double	MAX_RATE_DEVIATION = 0.005;
+	static constexpr double	RATE_BIAS_GAIN = 0.002;				// integral gain per UpdateBufferLevel() call
+
+	/*
+	 * Init(inRate, outRate, channels):
+	 *
+	 * Sets up conversion between the given rates and resets state.
+	 *
+	 * Returns:
+	 *		OKAY, or FAIL if the parameters are not supported.
+	 */
+	bool Init(int inRate, int outRate, int channels);
+
+	/*
+	 * Reset():
+	 *
+	 * Clears filter history and rate control state.
+	 */
+	void Reset(void);
+
+	/*
+	 * UpdateBufferLevel(queuedFrames, targetFrames):
+	 *
+	 * Reports how much output is currently buffered ahead of the audio device
+	 * and how much should be. Call once per chunk of input.
+	 */
+	void UpdateBufferLevel(unsigned queuedFrames, unsigned targetFrames);
+
+	/*
+	 * MaxOutputFrames(inFrames):
+	 *
+	 * Returns:
+	 *		An upper bound on the frames Process() produces for inFrames of
+	 *		input.
+	 */
+	int MaxOutputFrames(int inFrames) const;
+
+	/*
+	 * Process(out, in, inFrames):
+	 *
+	 * Converts a chunk of interleaved input frames.
+	 *
+	 * Parameters:
+	 *		out			Output, interleaved. Must have room for
+	 *					MaxOutputFrames(inFrames) frames.
+	 *		in			Input, interleaved.
+	 *		inFrames	Number of input frames.
+	 *
+	 * Returns:
+	 *		Number of output frames written.
+	 */
+	int Process(INT16 *out, const INT16 *in, int inFrames);
+
+	CResampler(void);
+
+private:
+	static float	Filter(const float *history, const float *coeffs0, const float *coeffs1, float mu);
+
+	int					m_channels;
+	double				m_nominalStep;		// input frames per output frame
+	double				m_step;				// after rate control
+	double				m_pos;				// position of next output frame in m_history
+	double				m_bufferLevel;		// smoothed buffer level (frames)
+	double				m_rateBias;			// integrated error, estimates the clock mismatch (in units of MAX_RATE_DEVIATION)
+	int					m_historyFrames;	// valid frames in m_history
+	std::vector<float>	m_coeffs;			// (PHASES + 1) * TAPS
+	std::vector<float>	m_history[4];		// planar input, filter history followed by new input
+};
+
+
+#endif	// INCLUDED_RESAMPLER_H
@@ -79,6 +79,7 @@ Anyways credit to R. Belmont and ElSemi for the code, and for being awesome emul
 static const Util::Config::Node *s_config = 0;
 static bool s_multiThreaded = false;
 bool legacySound; // For LegacySound (SCSP DSP) config option. 
+static float masterBalance = 1.0f, slaveBalance = 1.0f;	// from the Balance config option, set in SCSP_Init()
 
 #define USEDSP
 //#define RB_VOLUME
@@ -163,6 +164,7 @@ static int RPANTABLE[0x10000];
 
 static int TimPris[3];
 static int TimCnt[3];
+static int lastdiff;	// 68K cycles overrun by the previous sample
 
 #define SHIFT	12
 #define FIX(v)	((UINT32) ((float) (1<<SHIFT)*(v)))
@@ -614,6 +616,22 @@ bool SCSP_Init(const Util::Config::Node &config, int n)
 		s_multiThreaded = false;
 	}
 	legacySound = config["LegacySoundDSP"].ValueAs<bool>();
+
+	/*
+	 * Compute relative master/slave SCSP balance (note: master is often used
+	 * for the front speakers). Equal balance is a 1.0 scale factor for both.
+	 * When one SCSP is fully attenuated, the other's samples will be multiplied
+	 * by 2.
+	 */
+	float balance = (float)config["Balance"].ValueAs<float>();
+	if (balance < -100.0f)
+		balance = -100.0f;
+	else if (balance > 100.0f)
+		balance = 100.0f;
+	balance /= 100.0f;
+	masterBalance = 1.0f + balance;
+	slaveBalance = 1.0f - balance;
+
 	SoundClock = Freq;
 
 	if(n==2)
@@ -799,6 +817,7 @@ bool SCSP_Init(const Util::Config::Node &config, int n)
 	TimCnt[0] = 0xffff;
 	TimCnt[1] = 0xffff;
 	TimCnt[2] = 0xffff;
+	lastdiff = 0;
 	
 	// MIDI FIFO mutex
 	MIDILock = CThread::CreateMutex();
@@ -1553,22 +1572,7 @@ void SCSP_CpuRunScanline()
 void SCSP_DoMasterSamples(int nsamples)
 {
 	int slice = (int)(12000000 / (SoundClock*nsamples));	// 68K cycles/sample
-	static int lastdiff = 0;
 
-	/*
-	 * Compute relative master/slave SCSP balance (note: master is often used
-	 * for the front speakers). Equal balance is a 1.0 scale factor for both.
-	 * When one SCSP is fully attenuated, the other's samples will be multiplied
-	 * by 2.
-	 */
-	float balance = (float)s_config->Get("Balance").ValueAs<float>();
-	if (balance < -100.0f)
-		balance = -100.0f;
-	else if (balance > 100.0f)
-		balance = 100.0f;
-	balance /= 100.0f;
-	float masterBalance = 1.0f + balance;
-	float slaveBalance = 1.0f - balance;
 	signed short* buffl, * buffr;
 	signed short* bufrl, * bufrr;
 
@@ -1587,6 +1591,14 @@ void SCSP_DoMasterSamples(int nsamples)
 		signed int smpfl = 0, smpfr = 0;
 		signed int smprl = 0, smprr = 0;
 
+		/*
+		 * Slots are generated one at a time, in order. A slot may read the
+		 * ring buffer entries written by the slots before it in the same
+		 * sample (FM), and its sample data, LFOs and envelope table are all
+		 * per-slot lookups. Generating four slots at a time in SSE2/NEON
+		 * lanes, with the state kept in structure-of-arrays form, gave the
+		 * same output but was slower than this loop.
+		 */
 		for (sl = 0; sl < 32; ++sl)
 		{
 #if FM_DELAY
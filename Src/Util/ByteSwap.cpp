@@ -1,50 +1,77 @@
 #include "Util/ByteSwap.h"
-#ifdef _MSC_VER
-#include <intrin.h>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BYTESWAP_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define BYTESWAP_NEON
 #endif
 
 namespace Util
 {
+  /*
+   * Swaps the bytes of each 16-bit word in place. Used on whole ROM regions,
+   * so like CopyFlipEndian32() it handles 16 bytes at a time with SIMD where
+   * available.
+   */
   void FlipEndian16(uint8_t * const buffer, const size_t size)
   {
-#ifdef _MSC_VER
-    uint16_t * const buffer16 = (uint16_t*)buffer;
-    for (size_t i = 0; i < size/2; i++)
-      buffer16[i] = _byteswap_ushort(buffer16[i]);
-#elif defined(__GNUC__)
-    uint16_t * const buffer16 = (uint16_t*)buffer;
-    for (size_t i = 0; i < size/2; i++)
-      buffer16[i] = __builtin_bswap16(buffer16[i]);
-#else
-    for (size_t i = 0; i < (size & ~1); i += 2)
+    size_t i = 0;
+#if defined(BYTESWAP_SSE2)
+    for (; i + 16 <= size; i += 16)
+    {
+      __m128i v = _mm_loadu_si128((const __m128i *) &buffer[i]);
+      _mm_storeu_si128((__m128i *) &buffer[i], _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+    }
+#elif defined(BYTESWAP_NEON)
+    for (; i + 16 <= size; i += 16)
+      vst1q_u8(&buffer[i], vrev16q_u8(vld1q_u8(&buffer[i])));
+#endif
+    for (; i + 2 <= size; i += 2)
     {
       uint8_t tmp = buffer[i + 0];
       buffer[i + 0] = buffer[i + 1];
       buffer[i + 1] = tmp;
     }
-#endif
   }
 
   void FlipEndian32(uint8_t * const buffer, const size_t size)
   {
-#ifdef _MSC_VER
-    uint32_t * const buffer32 = (uint32_t*)buffer;
-    for (size_t i = 0; i < size/4; i++)
-      buffer32[i] = _byteswap_ulong(buffer32[i]);
-#elif defined(__GNUC__)
-    uint32_t * const buffer32 = (uint32_t*)buffer;
-    for (size_t i = 0; i < size/4; i++)
-      buffer32[i] = __builtin_bswap32(buffer32[i]);
-#else
-    for (size_t i = 0; i < (size & ~3); i += 4)
+    CopyFlipEndian32(buffer, buffer, size);
+  }
+
+  /*
+   * Copies 32-bit words, reversing the bytes of each one. Used for bulk DMA
+   * and ROM loading, so the main loop handles 16 bytes at a time with SIMD
+   * where available. dest may equal src (in-place) but must not otherwise
+   * overlap it.
+   */
+  void CopyFlipEndian32(uint8_t * const dest, const uint8_t * const src, const size_t size)
+  {
+    size_t i = 0;
+#if defined(BYTESWAP_SSE2)
+    for (; i + 16 <= size; i += 16)
     {
-      uint8_t tmp1 = buffer[i+0];
-      uint8_t tmp2 = buffer[i+1];
-      buffer[i+0] = buffer[i+3];
-      buffer[i+1] = buffer[i+2];
-      buffer[i+2] = tmp2;
-      buffer[i+3] = tmp1;
+      __m128i v = _mm_loadu_si128((const __m128i *) &src[i]);
+      v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));  // swap bytes within each half-word
+      v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));          // then swap the half-words
+      v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+      _mm_storeu_si128((__m128i *) &dest[i], v);
     }
+#elif defined(BYTESWAP_NEON)
+    for (; i + 16 <= size; i += 16)
+      vst1q_u8(&dest[i], vrev32q_u8(vld1q_u8(&src[i])));
 #endif
+    for (; i + 4 <= size; i += 4)
+    {
+      uint8_t b0 = src[i+0];
+      uint8_t b1 = src[i+1];
+      uint8_t b2 = src[i+2];
+      uint8_t b3 = src[i+3];
+      dest[i+0] = b3;
+      dest[i+1] = b2;
+      dest[i+2] = b1;
+      dest[i+3] = b0;
+    }
   }
 } // Util
@@ -8,6 +8,7 @@ namespace Util
 {
   void FlipEndian16(uint8_t *buffer, size_t size);
   void FlipEndian32(uint8_t *buffer, size_t size);
+  void CopyFlipEndian32(uint8_t *dest, const uint8_t *src, size_t size);
 } // Util
 
 #endif  // INCLUDED_BYTESWAP_H
@@ -0,0 +1,100 @@
+#include "Util/MappedFile.h"
+#include <cstdio>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Util
+{
+  bool MappedFile::Open(const std::string &filename)
+  {
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+      return false;
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    {
+      HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+      if (mapping != NULL)
+      {
+        // The view keeps the file open
+        m_data = (const uint8_t *) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        m_size = (size_t) size.QuadPart;
+        CloseHandle(mapping);
+      }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+      return false;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0)
+    {
+      void *data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED)
+      {
+        // Callers read most of the file straight away, so have it read in now
+        madvise(data, info.st_size, MADV_WILLNEED);
+        m_data = (const uint8_t *) data;
+        m_size = info.st_size;
+      }
+    }
+    close(fd);
+#endif
+
+    if (m_data != nullptr)
+    {
+      m_mapped = true;
+      m_open = true;
+      return true;
+    }
+
+    // Empty or can't be mapped: read a copy instead
+    m_size = 0;
+    FILE *fp = fopen(filename.c_str(), "rb");
+    if (NULL == fp)
+      return false;
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    m_copy.resize(size > 0 ? size : 0);
+    m_copy.resize(fread(m_copy.data(), sizeof(uint8_t), m_copy.size(), fp));
+    fclose(fp);
+    m_data = m_copy.data();
+    m_size = m_copy.size();
+    m_open = true;
+    return true;
+  }
+
+  void MappedFile::Close()
+  {
+    if (m_mapped)
+    {
+#ifdef _WIN32
+      UnmapViewOfFile(m_data);
+#else
+      munmap((void *) m_data, m_size);
+#endif
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_open = false;
+    m_copy.clear();
+    m_copy.shrink_to_fit();
+  }
+
+  MappedFile::~MappedFile()
+  {
+    Close();
+  }
+} // Util
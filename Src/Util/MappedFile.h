@@ -0,0 +1,49 @@
+#ifndef INCLUDED_MAPPEDFILE_H
+#define INCLUDED_MAPPEDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Util
+{
+  // Read-only view of a whole file, memory mapped where possible. If the file
+  // can't be mapped (or is empty), it is read into memory instead, so callers
+  // need not care which happened.
+  class MappedFile
+  {
+  public:
+    bool Open(const std::string &filename);   // returns true if successful
+    void Close();
+
+    const uint8_t *Data() const
+    {
+      return m_data;
+    }
+
+    size_t Size() const
+    {
+      return m_size;
+    }
+
+    bool IsOpen() const
+    {
+      return m_open;
+    }
+
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    ~MappedFile();
+
+  private:
+    const uint8_t *m_data = nullptr;
+    size_t m_size = 0;
+    bool m_mapped = false;
+    bool m_open = false;
+    std::vector<uint8_t> m_copy;
+  };
+} // Util
+
+#endif  // INCLUDED_MAPPEDFILE_H
@@ -160,6 +160,28 @@ namespace Util
         throw std::logic_error(Util::Format() << "Node \"" << m_key << "\" has no value" );
     }
 
+    void Node::NotifyObservers() const
+    {
+      if (m_observers.empty())
+        return;
+      // Drop observers that no longer exist as we go
+      size_t live = 0;
+      for (size_t i = 0; i < m_observers.size(); i++)
+      {
+        std::shared_ptr<Observer> observer = m_observers[i].lock();
+        if (!observer)
+          continue;
+        m_observers[live++] = m_observers[i];
+        observer->OnChange(*this);
+      }
+      m_observers.resize(live);
+    }
+
+    void Node::Subscribe(const std::shared_ptr<Observer> &observer) const
+    {
+      m_observers.push_back(observer);
+    }
+
     const Node &Node::MissingNode(const std::string &key) const
     {
       auto it = m_missing_nodes.find(key);
@@ -2,15 +2,29 @@
 #define INCLUDED_UTIL_CONFIG_H
 
 #include "Util/GenericValue.h"
+#include <atomic>
 #include <map>
 #include <memory>
 #include <iterator>
 #include <exception>
+#include <type_traits>
+#include <vector>
 
 namespace Util
 {
   namespace Config
   {
+    class Node;
+
+    // Receives a call whenever the value of a node it is subscribed to is set
+    class Observer
+    {
+    public:
+      virtual void OnChange(const Node &node) = 0;
+      virtual ~Observer()
+      {}
+    };
+
     class Node
     {
     private:
@@ -23,6 +37,7 @@ namespace Util
       ptr_t m_last_child;
       std::map<std::string, ptr_t> m_children;
       mutable std::map<std::string, Node> m_missing_nodes;  // missing nodes from failed queries (must also be empty)
+      mutable std::vector<std::weak_ptr<Observer>> m_observers; // belong to this node object, not copied with it
       bool m_missing = false;
 
       void Destroy()
@@ -35,6 +50,7 @@ namespace Util
       }
 
       void CheckEmptyOrMissing() const;
+      void NotifyObservers() const;
       const Node &MissingNode(const std::string &key) const;
       void AddChild(Node &parent, ptr_t &node);
       void DeepCopy(const Node &that);
@@ -171,6 +187,7 @@ namespace Util
       inline void SetValue(const std::shared_ptr<GenericValue> &value)
       {
         m_value = value;
+        NotifyObservers();
       }
 
       template <typename T>
@@ -205,6 +222,7 @@ namespace Util
             m_value->Set(value);
           else
             m_value = std::make_shared<ValueInstance<T>>(value);
+          NotifyObservers();
         }
         else
           throw std::range_error(Util::Format() << "Node \"" << m_key << "\" does not exist");
@@ -266,6 +284,12 @@ namespace Util
           Add(key, value);
       }
 
+      // Calls observer->OnChange() every time this node's value is set from
+      // now on, on the thread that sets it. Only a weak reference is kept, so
+      // destroying the observer is all it takes to unsubscribe. Must be called
+      // on the thread that sets values.
+      void Subscribe(const std::shared_ptr<Observer> &observer) const;
+
       // True if value is empty (does not exist)
       inline bool Empty() const
       {
@@ -312,6 +336,54 @@ namespace Util
       Node(Node&& that) noexcept;
       ~Node();
     };
+
+    // A setting looked up once and then kept up to date by the node it came
+    // from, for code that reads it too often to look it up by key each time
+    // (every frame or every audio batch). Reads are a relaxed atomic load and
+    // can be made from any thread. If the node is missing, the default value
+    // is used throughout.
+    template <typename T>
+    class Binding
+    {
+      static_assert(std::is_trivially_copyable<T>::value, "Binding requires a type that fits in std::atomic");
+
+    public:
+      inline T Get() const
+      {
+        return m_state->value.load(std::memory_order_relaxed);
+      }
+
+      inline operator T() const
+      {
+        return Get();
+      }
+
+      Binding(const Node &node, const T &default_value)
+        : m_state(std::make_shared<State>(default_value))
+      {
+        m_state->OnChange(node);
+        node.Subscribe(m_state);
+      }
+
+    private:
+      struct State: public Observer
+      {
+        std::atomic<T> value;
+        const T default_value;
+
+        void OnChange(const Node &node) override
+        {
+          value.store(node.ValueAsDefault<T>(default_value), std::memory_order_relaxed);
+        }
+
+        State(const T &default_value_)
+          : value(default_value_),
+            default_value(default_value_)
+        {}
+      };
+
+      std::shared_ptr<State> m_state;
+    };
   } // Config
 } // Util
 
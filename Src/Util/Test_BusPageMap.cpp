@@ -0,0 +1,134 @@
+#include "CPU/Bus.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+/*
+ * Microbenchmark: PowerPC-style memory accesses through the virtual IBus
+ * handlers versus the page map fast path used by the PowerPC core (BusRead32
+ * and BusWrite32). The bus below decodes addresses the same way CModel3 does
+ * (RAM first, then a switch on the upper address bits).
+ */
+
+static const UINT32 RAM_SIZE = 0x800000;
+static const UINT32 ROM_SIZE = 0x800000;
+
+class CTestBus final: public IBus
+{
+public:
+  UINT32 Read32(UINT32 addr)
+  {
+    if (addr < RAM_SIZE)
+      return *(UINT32 *) &ram[addr];
+    switch ((addr >> 24))
+    {
+    case 0xFF:
+      if (addr >= 0xFF800000)
+        return *(UINT32 *) &rom[addr & 0x7FFFFF];
+      break;
+    case 0xF0:
+      switch ((addr >> 16) & 0xFF)
+      {
+      case 0x10:
+        return 0;
+      default:
+        break;
+      }
+      break;
+    default:
+      break;
+    }
+    return 0xFFFFFFFF;
+  }
+
+  void Write32(UINT32 addr, UINT32 data)
+  {
+    if (addr < RAM_SIZE)
+      *(UINT32 *) &ram[addr] = data;
+  }
+
+  const BusPageMap *GetPageMap(void)
+  {
+    return &pageMap;
+  }
+
+  CTestBus()
+    : ram(RAM_SIZE), rom(ROM_SIZE)
+  {
+    for (UINT32 i = 0; i < RAM_SIZE; i += 4)
+      *(UINT32 *) &ram[i] = i * 2654435761u;
+    for (UINT32 i = 0; i < ROM_SIZE; i += 4)
+      *(UINT32 *) &rom[i] = ~i;
+    pageMap.Clear();
+    pageMap.Map(0x00000000, RAM_SIZE, ram.data(), true);
+    pageMap.Map(0xFF800000, ROM_SIZE, rom.data(), false);
+  }
+
+private:
+  std::vector<UINT8> ram;
+  std::vector<UINT8> rom;
+  BusPageMap pageMap;
+};
+
+int main(int argc, char **argv)
+{
+  CTestBus *testBus = new CTestBus();
+  IBus *bus = testBus;
+  const BusPageMap *map = bus->GetPageMap();
+
+  // Access pattern: mostly RAM, some ROM, occasional I/O
+  std::vector<UINT32> addrs;
+  UINT32 seed = 1;
+  for (int i = 0; i < 1 << 20; i++)
+  {
+    seed = seed * 1664525 + 1013904223;
+    UINT32 kind = seed >> 28;
+    UINT32 offset = (seed >> 2) & 0x1FFFFC;
+    if (kind < 12)
+      addrs.push_back(offset);
+    else if (kind < 15)
+      addrs.push_back(0xFF800000 | offset);
+    else
+      addrs.push_back(0xF0100000 | (offset & 0x3C));
+  }
+
+  const int passes = 64;
+  UINT32 sumBus = 0, sumDirect = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int p = 0; p < passes; p++)
+  {
+    for (UINT32 addr: addrs)
+    {
+      UINT32 data = bus->Read32(addr);
+      sumBus += data;
+      bus->Write32(addr & 0x7FFFFC, data + 1);
+    }
+  }
+  double busTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  delete testBus;
+  testBus = new CTestBus();
+  bus = testBus;
+  map = bus->GetPageMap();
+
+  start = std::chrono::steady_clock::now();
+  for (int p = 0; p < passes; p++)
+  {
+    for (UINT32 addr: addrs)
+    {
+      UINT32 data = BusRead32(map, bus, addr);
+      sumDirect += data;
+      BusWrite32(map, bus, addr & 0x7FFFFC, data + 1);
+    }
+  }
+  double directTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  delete testBus;
+
+  double accesses = 2.0 * passes * addrs.size();
+  std::cout << "IBus handlers: " << busTime * 1e9 / accesses << " ns/access" << std::endl;
+  std::cout << "Page map:      " << directTime * 1e9 / accesses << " ns/access" << std::endl;
+  std::cout << "Results " << (sumBus == sumDirect ? "match" : "DIFFER") << std::endl;
+  return sumBus == sumDirect ? 0 : 1;
+}
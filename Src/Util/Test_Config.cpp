@@ -1,5 +1,6 @@
 #include "Util/NewConfig.h"
 #include "Util/ConfigBuilders.h"
+#include <chrono>
 #include <iostream>
 
 static void PrintTestResults(std::vector<std::pair<std::string, bool>> results)
@@ -202,6 +203,89 @@ int main()
     test_results.push_back({ "Duplicate leaf nodes", config.ToString() == expected_config });
   }
 
+  // Bindings follow their node whether it is set with the same type, another
+  // type, or through its parent, and use the default for missing nodes
+  {
+    Util::Config::Node config("global");
+    config.Set("PowerPCFrequency", "50");
+    config.Set("Throttle", true);
+    Util::Config::Binding<unsigned> frequency(config["PowerPCFrequency"], 0);
+    Util::Config::Binding<bool> throttle(config["Throttle"], false);
+    Util::Config::Binding<int> missing(config["Missing"], 42);
+    bool initial = frequency.Get() == 50 && throttle.Get() && missing.Get() == 42;
+    config.Get("PowerPCFrequency").SetValue<unsigned>(66);
+    bool changed_type = frequency.Get() == 66;
+    config.Set("PowerPCFrequency", "100");
+    config.Get("Throttle").SetValue(false);
+    bool changed_value = frequency.Get() == 100 && !throttle.Get();
+    test_results.push_back({ "Binding", initial && changed_type && changed_value && missing.Get() == 42 });
+
+    // Nodes only keep weak references, so bindings can go away first
+    {
+      Util::Config::Binding<unsigned> temporary(config["PowerPCFrequency"], 0);
+    }
+    config.Set("PowerPCFrequency", "75");
+    test_results.push_back({ "Binding outlived by node", frequency.Get() == 75 });
+  }
+
+  // Per-frame cost of the settings read every frame, in a tree the size of
+  // the real runtime config
+  {
+    Util::Config::Node config("Global");
+    for (int i = 0; i < 120; i++)
+      config.Set("Setting" + std::to_string(i), std::to_string(i));
+    config.Set("PowerPCFrequency", "50");
+    config.Set("EmulateSound", true);
+    config.Set("SoundVolume", "100");
+    config.Set("FlipStereo", false);
+    config.Set("EmulateDSB", true);
+    config.Set("MusicVolume", "100");
+    config.Set("Throttle", true);
+    config.Set("ShowFrameRate", false);
+
+    const int frames = 100000;
+    unsigned sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+      sum += config["PowerPCFrequency"].ValueAs<unsigned>();
+      sum += config["EmulateSound"].ValueAs<bool>();
+      sum += config["SoundVolume"].ValueAs<int>();
+      sum += config["FlipStereo"].ValueAs<bool>();
+      sum += config["EmulateDSB"].ValueAs<bool>();
+      sum += config["MusicVolume"].ValueAs<int>();
+      sum += config["Throttle"].ValueAs<bool>();
+      sum += config["ShowFrameRate"].ValueAs<bool>();
+    }
+    double lookup_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / frames;
+
+    Util::Config::Binding<unsigned> frequency(config["PowerPCFrequency"], 0);
+    Util::Config::Binding<bool> emulate_sound(config["EmulateSound"], false);
+    Util::Config::Binding<int> sound_volume(config["SoundVolume"], 0);
+    Util::Config::Binding<bool> flip_stereo(config["FlipStereo"], false);
+    Util::Config::Binding<bool> emulate_dsb(config["EmulateDSB"], false);
+    Util::Config::Binding<int> music_volume(config["MusicVolume"], 0);
+    Util::Config::Binding<bool> throttle(config["Throttle"], false);
+    Util::Config::Binding<bool> show_frame_rate(config["ShowFrameRate"], false);
+    unsigned bound_sum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+      bound_sum += frequency.Get();
+      bound_sum += emulate_sound.Get();
+      bound_sum += sound_volume.Get();
+      bound_sum += flip_stereo.Get();
+      bound_sum += emulate_dsb.Get();
+      bound_sum += music_volume.Get();
+      bound_sum += throttle.Get();
+      bound_sum += show_frame_rate.Get();
+    }
+    double binding_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / frames;
+
+    std::cout << "Per-frame settings: " << lookup_ns << " ns looked up by key, " << binding_ns << " ns through bindings" << std::endl << std::endl;
+    test_results.push_back({ "Bindings read the same values", sum == bound_sum });
+  }
+
   PrintTestResults(test_results);
   return 0;
 }
@@ -0,0 +1,219 @@
+#include "Sound/SCSP.h"
+#include "Util/NewConfig.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * Golden output test for the SCSP sample generator: a fixed, pseudo-random
+ * register trace (slot programming, key on/off, FM, LFO, DSP sends, DSP
+ * microcode) is rendered in both DSP modes at several balance settings and
+ * each output must hash to what the original mixer produced. Also reports how
+ * long a frame takes.
+ */
+
+static const int SAMPLES_PER_FRAME = 44100 / 60;
+static const int NUM_FRAMES = 120;
+static const size_t RAM_SIZE = 0x180000;  // slots can read up to SA (20 bits) + 512 KB, keep all of it ours
+
+static uint32_t s_seed;
+static int s_sampleNum;
+static int s_nextEvent;
+
+static uint32_t Random()
+{
+  s_seed = s_seed * 1664525 + 1013904223;
+  return (s_seed >> 16) | (s_seed << 16);
+}
+
+static void WriteSlot(int scsp, int slot, int reg, uint16_t value)
+{
+  unsigned addr = slot * 0x20 + reg * 2;
+  if (scsp == 0)
+    SCSP_Master_w16(addr, value);
+  else
+    SCSP_Slave_w16(addr, value);
+}
+
+static void KeyOn(int scsp, int slot)
+{
+  bool pcm8 = (Random() & 1) != 0;
+  uint32_t sa = Random() & (pcm8 ? 0x3FFFF : 0x1FFFE);
+  uint16_t lsa = Random() & 0x3FFF;
+  uint16_t lea = lsa + 1 + (Random() & 0x3FFF);
+  uint16_t key = 0x0800 | (pcm8 ? 0x10 : 0) | ((Random() & 3) << 5) | (sa >> 16);  // KYONB, PCM8B, LPCTL, SA
+  WriteSlot(scsp, slot, 0x0, key);
+  WriteSlot(scsp, slot, 0x1, sa & 0xFFFF);
+  WriteSlot(scsp, slot, 0x2, lsa);
+  WriteSlot(scsp, slot, 0x3, lea);
+  WriteSlot(scsp, slot, 0x4, (Random() & 0xFFC0) | 0x18 | (Random() & 7));     // D2R, D1R, EGHOLD, AR
+  WriteSlot(scsp, slot, 0x5, Random() & 0x7FFF);                                // LPSLNK, KRS, DL, RR
+  WriteSlot(scsp, slot, 0x6, (Random() & 0x0300) | (0x20 + (Random() & 0x5F))); // STWINH, SDIR, TL (quiet enough not to clip)
+  WriteSlot(scsp, slot, 0x7, (Random() % 3) ? 0 : Random() & 0xFFFF);          // MDL, MDXSL, MDYSL
+  WriteSlot(scsp, slot, 0x8, (((Random() % 6) + 13) & 0xF) << 11 | (Random() & 0x3FF));  // OCT -3..+2, FNS
+  WriteSlot(scsp, slot, 0x9, (Random() & 1) ? 0 : Random() & 0xFEFF);          // LFO (with bit 8, PLFOS() indexes past the PLFO tables)
+  WriteSlot(scsp, slot, 0xA, Random() & 0x7F);                                  // ISEL, IMXL
+  WriteSlot(scsp, slot, 0xB, Random() & 0xFFFF);                                // DISDL, DIPAN, EFSDL, EFPAN
+  WriteSlot(scsp, slot, 0x0, key | 0x1000);                                     // KYONEX
+}
+
+static void KeyOff(int scsp, int slot)
+{
+  WriteSlot(scsp, slot, 0x0, 0x1000);
+}
+
+static int Run68K(int cycles)
+{
+  // Stands in for the sound program: the SCSP calls this once per sample
+  if (++s_sampleNum >= s_nextEvent)
+  {
+    int scsp = Random() & 1;
+    int slot = Random() & 31;
+    if (Random() % 4)
+      KeyOn(scsp, slot);
+    else
+      KeyOff(scsp, slot);
+    s_nextEvent = s_sampleNum + 1 + (Random() & 127);
+  }
+  return 0;
+}
+
+static void Int68K(int irq)
+{
+}
+
+struct Output
+{
+  std::vector<INT16> fl, fr, rl, rr;
+
+  Output()
+    : fl(SAMPLES_PER_FRAME * NUM_FRAMES), fr(SAMPLES_PER_FRAME * NUM_FRAMES), rl(SAMPLES_PER_FRAME * NUM_FRAMES), rr(SAMPLES_PER_FRAME * NUM_FRAMES)
+  {
+  }
+};
+
+static Output Render(const Util::Config::Node &config, double *frameTime = nullptr)
+{
+  std::vector<UINT8> ram1(RAM_SIZE), ram2(RAM_SIZE);
+  s_seed = 1;
+  for (auto &b: ram1)
+    b = Random();
+  for (auto &b: ram2)
+    b = Random();
+
+  Output out;
+  SCSP_SetBuffers(out.fl.data(), out.fr.data(), out.rl.data(), out.rr.data(), SAMPLES_PER_FRAME);
+  SCSP_SetCB(Run68K, Int68K);
+  srand(1);  // LFO noise waveforms are generated with rand()
+  SCSP_Init(config, 2);
+  SCSP_SetRAM(0, ram1.data());
+  SCSP_SetRAM(1, ram2.data());
+
+  // Random DSP coefficients and a short random program on both SCSPs
+  for (int scsp = 0; scsp < 2; scsp++)
+  {
+    auto write = scsp == 0 ? SCSP_Master_w16 : SCSP_Slave_w16;
+    write(0x402, Random() & 0x7F);  // RBL, RBP
+    for (unsigned addr = 0x700; addr < 0x800; addr += 2)
+      write(addr, Random());
+    for (unsigned addr = 0x800; addr < 0x800 + 32 * 8; addr += 2)
+    {
+      uint16_t value = Random();
+      if ((addr & 7) == 2)  // keep IRA on an input that exists, the DSP stops at any other
+        value = (value & ~0x0FC0) | ((Random() % 0x32) << 6);
+      write(addr, value);
+    }
+    write(0xBF0, 0);
+  }
+
+  s_sampleNum = 0;
+  s_nextEvent = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < NUM_FRAMES; frame++)
+  {
+    int offset = frame * SAMPLES_PER_FRAME;
+    SCSP_SetBuffers(&out.fl[offset], &out.fr[offset], &out.rl[offset], &out.rr[offset], SAMPLES_PER_FRAME);
+    SCSP_Update();
+  }
+  if (frameTime)
+    *frameTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / NUM_FRAMES;
+  SCSP_Deinit();
+  return out;
+}
+
+static uint64_t Hash(const Output &out)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (auto channel: { &out.fl, &out.fr, &out.rl, &out.rr })
+  {
+    for (INT16 sample: *channel)
+    {
+      hash = (hash ^ (uint8_t) sample) * 0x100000001b3ULL;
+      hash = (hash ^ (uint8_t) (sample >> 8)) * 0x100000001b3ULL;
+    }
+  }
+  return hash;
+}
+
+int main(int argc, char **argv)
+{
+  std::vector<std::pair<std::string, bool>> results;
+
+  // Output of the mixer before the balance was cached in SCSP_Init()
+  static const struct
+  {
+    bool legacyDSP;
+    const char *balance;
+    uint64_t hash;
+  } golden[] =
+  {
+    { false,  "0",    0xaa5ee1e7fa79ae12ULL },
+    { false,  "35",   0x8262d3a10a57f762ULL },
+    { false,  "-100", 0xe66915216acca8acULL },
+    { true,   "0",    0xcc07171b4f0ad193ULL },
+    { true,   "35",   0x2c7de7c9fb19bdc8ULL },
+    { true,   "-100", 0x42f94a8a48b31a6bULL }
+  };
+
+  // Rendered twice so that anything SCSP_Init() fails to reset shows up too
+  for (int pass = 0; pass < 2; pass++)
+  {
+    for (auto &g: golden)
+    {
+      Util::Config::Node config("Global");
+      config.Set("MultiThreaded", "false");
+      config.Set("LegacySoundDSP", g.legacyDSP ? "true" : "false");
+      config.Set("Balance", g.balance);
+
+      uint64_t hash = Hash(Render(config));
+      std::string description = std::string(g.legacyDSP ? "legacy DSP" : "DSP") + ", balance " + g.balance + (pass ? ", rendered again" : "");
+      if (hash != g.hash)
+        std::cout << description << ": output hash " << std::hex << std::setfill('0') << std::setw(16) << hash << " != " << std::setw(16) << g.hash << std::dec << std::endl;
+      results.push_back({ "Output matches original mixer (" + description + ")", hash == g.hash });
+    }
+  }
+
+  // Timing
+  Util::Config::Node config("Global");
+  config.Set("MultiThreaded", "false");
+  config.Set("LegacySoundDSP", "false");
+  config.Set("Balance", "35");
+  double frameTime;
+  Render(config, &frameTime);
+  std::cout << "Mixer: " << frameTime * 1e6 << " us/frame" << std::endl;
+
+  std::cout << "TEST RESULTS" << std::endl;
+  std::cout << "------------" << std::endl;
+  bool allPassed = true;
+  for (auto v: results)
+  {
+    std::cout << v.first << ": " << (v.second ? "passed" : "FAILED") << std::endl;
+    allPassed &= v.second;
+  }
+  return allPassed ? 0 : 1;
+}
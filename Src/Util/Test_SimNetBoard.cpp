@@ -0,0 +1,207 @@
+#include "Supermodel.h"
+#include "Network/SimNetBoard.h"
+#include "Util/NewConfig.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Loopback test for the simulated net board: 2 to 8 instances in one process,
+ * linked in a ring over TCP on 127.0.0.1, each driven from its own thread the
+ * way a type 1 game drives it. Every machine must get the right index and
+ * count from the handshake and then see fresh data from every other machine
+ * each frame. A second run stalls one machine and checks that the others keep
+ * going at the deadline instead of waiting for it.
+ */
+
+static const int BASE_PORT = 19700;
+static const int NUM_FRAMES = 300;
+static const int TAIL_FRAMES = 2;   // unchecked, for machines that finish first and stop sending
+static const unsigned SEGMENT_SIZE = 0x40;
+
+// Segments start with the sending machine and its frame number, followed by
+// bytes derived from both
+static void WriteSegment(CSimNetBoard *board, uint8_t machine, uint32_t frame)
+{
+  board->WriteCommRAM8(0x100, machine);
+  for (unsigned i = 0; i < 4; i++)
+    board->WriteCommRAM8(0x101 + i, uint8_t(frame >> (i * 8)));
+  for (unsigned i = 5; i < SEGMENT_SIZE; i++)
+    board->WriteCommRAM8(0x100 + i, uint8_t(machine * 31 + frame * 7 + i));
+}
+
+static bool ReadSegment(CSimNetBoard *board, unsigned slot, uint8_t *machine, uint32_t *frame)
+{
+  unsigned base = 0x100 + slot * SEGMENT_SIZE;
+  *machine = board->ReadCommRAM8(base);
+  *frame = 0;
+  for (unsigned i = 0; i < 4; i++)
+    *frame |= uint32_t(board->ReadCommRAM8(base + 1 + i)) << (i * 8);
+  for (unsigned i = 5; i < SEGMENT_SIZE; i++)
+  {
+    if (board->ReadCommRAM8(base + i) != uint8_t(*machine * 31 + *frame * 7 + i))
+      return false;
+  }
+  return true;
+}
+
+struct Machine
+{
+  Util::Config::Node config;
+  std::vector<uint8_t> ram;
+  std::vector<uint8_t> buffer;
+  std::unique_ptr<CSimNetBoard> board;
+  std::string error;
+  double maxFrameMS = 0;
+
+  Machine()
+    : config("Global"),
+      ram(0x10000),
+      buffer(0x20000)
+  {
+  }
+};
+
+static void RunMachine(Machine *m, int index, int numMachines, int stallFrame, bool strict)
+{
+  CSimNetBoard *board = m->board.get();
+
+  // Type 1 initialization: master flag and segment size in net RAM, then the
+  // main board writes 0xf000 to the status register
+  uint16_t master = index == 0 ? 0 : 1;
+  uint16_t segmentSize = SEGMENT_SIZE;
+  uint16_t ringSize = 0x800;
+  memcpy(&m->ram[0x400], &master, 2);
+  memcpy(&m->ram[0x402], &ringSize, 2);
+  memcpy(&m->ram[0x404], &segmentSize, 2);
+  board->WriteIORegister(0xc0, 1);
+  board->RunFrame();
+  board->WriteIORegister(0x88, 0xf000);
+  board->RunFrame();
+
+  auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (board->ReadIORegister(0x8a) == 0)
+  {
+    if (std::chrono::steady_clock::now() > timeout)
+    {
+      m->error = "handshake timed out";
+      return;
+    }
+    board->RunFrame();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  uint16_t expectedStatus = 0x2021 + (numMachines - 1) * 0x20 + index;
+  if (board->ReadIORegister(0x8a) != expectedStatus)
+  {
+    m->error = "wrong status after handshake: " + std::to_string(board->ReadIORegister(0x8a));
+    return;
+  }
+
+  std::vector<uint32_t> lastFrame(numMachines + 1, 0);
+  for (uint32_t frame = 1; frame <= NUM_FRAMES + TAIL_FRAMES; frame++)
+  {
+    if (int(frame) == stallFrame)
+      std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    WriteSegment(board, uint8_t(index), frame);
+    auto start = std::chrono::steady_clock::now();
+    board->RunFrame();
+    double frameMS = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    m->maxFrameMS = std::max(m->maxFrameMS, frameMS);
+
+    // The segment sent this frame was written before the previous one, so
+    // nothing has gone around yet after the first frame
+    if (frame < 3 || frame > NUM_FRAMES)
+      continue;
+    for (int slot = 1; slot <= numMachines; slot++)
+    {
+      uint8_t machine;
+      uint32_t segmentFrame;
+      uint8_t expectedMachine = uint8_t((index - slot + numMachines * 2) % numMachines);
+      if (!ReadSegment(board, slot, &machine, &segmentFrame) || machine != expectedMachine)
+      {
+        m->error = "corrupt segment " + std::to_string(slot) + " in frame " + std::to_string(frame);
+        return;
+      }
+      if (segmentFrame < lastFrame[slot] || (strict && segmentFrame == lastFrame[slot]))
+      {
+        m->error = "stale segment " + std::to_string(slot) + " in frame " + std::to_string(frame);
+        return;
+      }
+      lastFrame[slot] = segmentFrame;
+    }
+  }
+}
+
+static bool RunRing(int numMachines, int port, unsigned deadlineMS, int stallMachine, double *maxFrameMS)
+{
+  Game game;
+  game.name = "scud";
+  game.netboard_present = true;
+
+  std::vector<Machine> machines(numMachines);
+  for (int i = 0; i < numMachines; i++)
+  {
+    Machine &m = machines[i];
+    m.config.Set("Network", true);
+    m.config.Set("PortIn", unsigned(port + i));
+    m.config.Set("PortOut", unsigned(port + (i + 1) % numMachines));
+    m.config.Set("AddressOut", "127.0.0.1");
+    m.config.Set("NetFrameDeadline", deadlineMS);
+    m.board.reset(new CSimNetBoard(m.config));
+    m.board->GetGame(game);
+    m.board->Init(m.ram.data(), m.buffer.data());
+  }
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < numMachines; i++)
+    threads.emplace_back(RunMachine, &machines[i], i, numMachines, i == stallMachine ? NUM_FRAMES / 2 : -1, stallMachine < 0);
+  for (auto &thread: threads)
+    thread.join();
+
+  bool passed = true;
+  *maxFrameMS = 0;
+  for (int i = 0; i < numMachines; i++)
+  {
+    if (!machines[i].error.empty())
+    {
+      std::cout << numMachines << " machines: machine " << i << ": " << machines[i].error << std::endl;
+      passed = false;
+    }
+    if (i != stallMachine)
+      *maxFrameMS = std::max(*maxFrameMS, machines[i].maxFrameMS);
+  }
+  return passed;
+}
+
+int main(int argc, char **argv)
+{
+  std::vector<std::pair<std::string, bool>> results;
+
+  for (int numMachines = 2; numMachines <= 8; numMachines++)
+  {
+    double maxFrameMS;
+    bool passed = RunRing(numMachines, BASE_PORT + numMachines * 10, 500, -1, &maxFrameMS);
+    results.push_back({ std::to_string(numMachines) + " linked machines", passed });
+  }
+
+  // One machine stops for 300 ms; the rest must not wait much past the deadline
+  const unsigned deadlineMS = 20;
+  double maxFrameMS;
+  bool passed = RunRing(3, BASE_PORT + 100, deadlineMS, 2, &maxFrameMS);
+  std::cout << "Longest frame while a machine stalled: " << maxFrameMS << " ms" << std::endl;
+  results.push_back({ "Stalled machine doesn't block the others", passed && maxFrameMS < deadlineMS + 100 });
+
+  std::cout << "TEST RESULTS" << std::endl;
+  std::cout << "------------" << std::endl;
+  bool allPassed = true;
+  for (auto v: results)
+  {
+    std::cout << v.first << ": " << (v.second ? "passed" : "FAILED") << std::endl;
+    allPassed &= v.second;
+  }
+  return allPassed ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+#include "Graphics/TileRaster.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * Golden image test: every tilemap layer configuration is drawn with the
+ * scalar kernel and then with each vector kernel this CPU supports, and the
+ * surfaces must match exactly. Also reports how long a full layer takes with
+ * each kernel.
+ */
+
+static const int WIDTH = 496;
+static const int HEIGHT = 384;
+
+static uint32_t s_seed = 1;
+
+static uint32_t Random()
+{
+  s_seed = s_seed * 1664525 + 1013904223;
+  return (s_seed >> 16) | (s_seed << 16);
+}
+
+struct TileGenState
+{
+  std::vector<uint32_t> vram;
+  std::vector<uint32_t> palette;
+  uint32_t regs[0x100 / 4];
+
+  TileGenState()
+    : vram(0x100000 / 4), palette(0x8000)
+  {
+    for (auto &word: vram)
+      word = Random();
+    for (auto &color: palette)
+      color = (Random() & 3) ? Random() : (Random() & 0x00FFFFFF);  // 1 in 4 transparent
+
+    // Mask table: mostly random, with some lines fully shown and fully hidden
+    uint32_t *maskTable = &vram[0xF7000 / 4];
+    for (int y = 0; y < HEIGHT; y++)
+    {
+      if (y % 16 == 0)
+        maskTable[y] = 0xFFFFFFFF;
+      else if (y % 16 == 1)
+        maskTable[y] = 0;
+    }
+
+    memset(regs, 0, sizeof(regs));
+  }
+};
+
+static std::vector<uint32_t> Draw(TileRaster::Kernel kernel, const TileGenState &state, int layerNum, bool is4Bit, bool alphaTest, bool argb)
+{
+  // Background for the alpha-tested layers to be drawn over
+  std::vector<uint32_t> surface(WIDTH * HEIGHT);
+  uint32_t seed = 12345;
+  for (auto &pixel: surface)
+  {
+    seed = seed * 1664525 + 1013904223;
+    pixel = seed;
+  }
+  TileRaster::SetKernel(kernel);
+  TileRaster::DrawLayer(surface.data(), layerNum, is4Bit, alphaTest, argb, state.vram.data(), state.regs, state.palette.data());
+  return surface;
+}
+
+int main(int argc, char **argv)
+{
+  using TileRaster::Kernel;
+
+  TileGenState state;
+  std::vector<Kernel> kernels;
+  for (Kernel kernel: { Kernel::SSE41, Kernel::AVX2, Kernel::NEON })
+  {
+    if (TileRaster::SetKernel(kernel))
+      kernels.push_back(kernel);
+  }
+  std::cout << "Best kernel: " << TileRaster::GetKernelName(TileRaster::GetBestKernel()) << std::endl;
+
+  // Scroll settings: none, fine scroll, wrap-around, and line scroll mode
+  // with a random horizontal scroll value for every line
+  static const uint32_t scrolls[] = { 0x00000000, 0x00030005, 0x01FF01FF, 0x00120000 | 0x8000 };
+  uint16_t *hScrollTables = (uint16_t *) &state.vram[0xF6000 / 4];
+  for (int i = 0; i < 4 * 0x400 / 2; i++)
+    hScrollTables[i] = Random() & 0x1FF;
+
+  std::vector<std::pair<std::string, bool>> results;
+  int mismatches = 0;
+  for (Kernel kernel: kernels)
+  {
+    bool passed = true;
+    for (int layerNum = 0; layerNum < 4; layerNum++)
+    {
+      for (uint32_t scroll: scrolls)
+      {
+        state.regs[0x60 / 4 + layerNum] = 0x80000000 | scroll;
+        for (int config = 0; config < 8; config++)
+        {
+          bool is4Bit = (config & 1) != 0;
+          bool alphaTest = (config & 2) != 0;
+          bool argb = (config & 4) != 0;
+          std::vector<uint32_t> golden = Draw(Kernel::Scalar, state, layerNum, is4Bit, alphaTest, argb);
+          std::vector<uint32_t> test = Draw(kernel, state, layerNum, is4Bit, alphaTest, argb);
+          for (int i = 0; i < WIDTH * HEIGHT; i++)
+          {
+            if (golden[i] != test[i])
+            {
+              if (mismatches++ < 10)
+                std::cout << TileRaster::GetKernelName(kernel) << ": layer " << layerNum << (is4Bit ? " 4-bit" : " 8-bit") << (alphaTest ? " alpha" : "") << (argb ? " ARGB" : "")
+                          << " scroll " << std::hex << scroll << " pixel (" << std::dec << (i % WIDTH) << ", " << (i / WIDTH) << "): "
+                          << std::hex << golden[i] << " != " << test[i] << std::dec << std::endl;
+              passed = false;
+              break;
+            }
+          }
+        }
+      }
+    }
+    results.push_back({ std::string(TileRaster::GetKernelName(kernel)) + " matches scalar", passed });
+  }
+
+  // Timing
+  const int passes = 200;
+  std::vector<uint32_t> surface(WIDTH * HEIGHT);
+  state.regs[0x60 / 4] = 0x80000000 | scrolls[1];
+  kernels.insert(kernels.begin(), Kernel::Scalar);
+  for (Kernel kernel: kernels)
+  {
+    TileRaster::SetKernel(kernel);
+    auto start = std::chrono::steady_clock::now();
+    for (int p = 0; p < passes; p++)
+      TileRaster::DrawLayer(surface.data(), 0, p & 1, true, false, state.vram.data(), state.regs, state.palette.data());
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << TileRaster::GetKernelName(kernel) << ": " << time * 1e6 / passes << " us/layer" << std::endl;
+  }
+
+  std::cout << "TEST RESULTS" << std::endl;
+  std::cout << "------------" << std::endl;
+  bool allPassed = true;
+  for (auto v: results)
+  {
+    std::cout << v.first << ": " << (v.second ? "passed" : "FAILED") << std::endl;
+    allPassed &= v.second;
+  }
+  return allPassed ? 0 : 1;
+}
@@ -5,19 +5,19 @@
 /* ======================================================================== */
 
 
-void m68k_op_1010(void)
+void m68k_op_1010(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_exception_1010();
 }
 
 
-void m68k_op_1111(void)
+void m68k_op_1111(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_exception_1111();
 }
 
 
-void m68k_op_abcd_8_rr(void)
+void m68k_op_abcd_8_rr(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = DY;
@@ -43,7 +43,7 @@ void m68k_op_abcd_8_rr(void)
 }
 
 
-void m68k_op_abcd_8_mm_ax7(void)
+void m68k_op_abcd_8_mm_ax7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_A7_PD_8();
@@ -69,7 +69,7 @@ void m68k_op_abcd_8_mm_ax7(void)
 }
 
 
-void m68k_op_abcd_8_mm_ay7(void)
+void m68k_op_abcd_8_mm_ay7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_AX_PD_8();
@@ -95,7 +95,7 @@ void m68k_op_abcd_8_mm_ay7(void)
 }
 
 
-void m68k_op_abcd_8_mm_axy7(void)
+void m68k_op_abcd_8_mm_axy7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_A7_PD_8();
@@ -121,7 +121,7 @@ void m68k_op_abcd_8_mm_axy7(void)
 }
 
 
-void m68k_op_abcd_8_mm(void)
+void m68k_op_abcd_8_mm(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_AX_PD_8();
@@ -147,7 +147,7 @@ void m68k_op_abcd_8_mm(void)
 }
 
 
-void m68k_op_add_8_er_d(void)
+void m68k_op_add_8_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_8(DY);
@@ -163,7 +163,7 @@ void m68k_op_add_8_er_d(void)
 }
 
 
-void m68k_op_add_8_er_ai(void)
+void m68k_op_add_8_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_AI_8();
@@ -179,7 +179,7 @@ void m68k_op_add_8_er_ai(void)
 }
 
 
-void m68k_op_add_8_er_pi(void)
+void m68k_op_add_8_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PI_8();
@@ -195,7 +195,7 @@ void m68k_op_add_8_er_pi(void)
 }
 
 
-void m68k_op_add_8_er_pi7(void)
+void m68k_op_add_8_er_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_A7_PI_8();
@@ -211,7 +211,7 @@ void m68k_op_add_8_er_pi7(void)
 }
 
 
-void m68k_op_add_8_er_pd(void)
+void m68k_op_add_8_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PD_8();
@@ -227,7 +227,7 @@ void m68k_op_add_8_er_pd(void)
 }
 
 
-void m68k_op_add_8_er_pd7(void)
+void m68k_op_add_8_er_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_A7_PD_8();
@@ -243,7 +243,7 @@ void m68k_op_add_8_er_pd7(void)
 }
 
 
-void m68k_op_add_8_er_di(void)
+void m68k_op_add_8_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_DI_8();
@@ -259,7 +259,7 @@ void m68k_op_add_8_er_di(void)
 }
 
 
-void m68k_op_add_8_er_ix(void)
+void m68k_op_add_8_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_IX_8();
@@ -275,7 +275,7 @@ void m68k_op_add_8_er_ix(void)
 }
 
 
-void m68k_op_add_8_er_aw(void)
+void m68k_op_add_8_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AW_8();
@@ -291,7 +291,7 @@ void m68k_op_add_8_er_aw(void)
 }
 
 
-void m68k_op_add_8_er_al(void)
+void m68k_op_add_8_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AL_8();
@@ -307,7 +307,7 @@ void m68k_op_add_8_er_al(void)
 }
 
 
-void m68k_op_add_8_er_pcdi(void)
+void m68k_op_add_8_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCDI_8();
@@ -323,7 +323,7 @@ void m68k_op_add_8_er_pcdi(void)
 }
 
 
-void m68k_op_add_8_er_pcix(void)
+void m68k_op_add_8_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCIX_8();
@@ -339,7 +339,7 @@ void m68k_op_add_8_er_pcix(void)
 }
 
 
-void m68k_op_add_8_er_i(void)
+void m68k_op_add_8_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_I_8();
@@ -355,7 +355,7 @@ void m68k_op_add_8_er_i(void)
 }
 
 
-void m68k_op_add_16_er_d(void)
+void m68k_op_add_16_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(DY);
@@ -371,7 +371,7 @@ void m68k_op_add_16_er_d(void)
 }
 
 
-void m68k_op_add_16_er_a(void)
+void m68k_op_add_16_er_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(AY);
@@ -387,7 +387,7 @@ void m68k_op_add_16_er_a(void)
 }
 
 
-void m68k_op_add_16_er_ai(void)
+void m68k_op_add_16_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_AI_16();
@@ -403,7 +403,7 @@ void m68k_op_add_16_er_ai(void)
 }
 
 
-void m68k_op_add_16_er_pi(void)
+void m68k_op_add_16_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PI_16();
@@ -419,7 +419,7 @@ void m68k_op_add_16_er_pi(void)
 }
 
 
-void m68k_op_add_16_er_pd(void)
+void m68k_op_add_16_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PD_16();
@@ -435,7 +435,7 @@ void m68k_op_add_16_er_pd(void)
 }
 
 
-void m68k_op_add_16_er_di(void)
+void m68k_op_add_16_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_DI_16();
@@ -451,7 +451,7 @@ void m68k_op_add_16_er_di(void)
 }
 
 
-void m68k_op_add_16_er_ix(void)
+void m68k_op_add_16_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_IX_16();
@@ -467,7 +467,7 @@ void m68k_op_add_16_er_ix(void)
 }
 
 
-void m68k_op_add_16_er_aw(void)
+void m68k_op_add_16_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AW_16();
@@ -483,7 +483,7 @@ void m68k_op_add_16_er_aw(void)
 }
 
 
-void m68k_op_add_16_er_al(void)
+void m68k_op_add_16_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AL_16();
@@ -499,7 +499,7 @@ void m68k_op_add_16_er_al(void)
 }
 
 
-void m68k_op_add_16_er_pcdi(void)
+void m68k_op_add_16_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCDI_16();
@@ -515,7 +515,7 @@ void m68k_op_add_16_er_pcdi(void)
 }
 
 
-void m68k_op_add_16_er_pcix(void)
+void m68k_op_add_16_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCIX_16();
@@ -531,7 +531,7 @@ void m68k_op_add_16_er_pcix(void)
 }
 
 
-void m68k_op_add_16_er_i(void)
+void m68k_op_add_16_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_I_16();
@@ -547,7 +547,7 @@ void m68k_op_add_16_er_i(void)
 }
 
 
-void m68k_op_add_32_er_d(void)
+void m68k_op_add_32_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = DY;
@@ -563,7 +563,7 @@ void m68k_op_add_32_er_d(void)
 }
 
 
-void m68k_op_add_32_er_a(void)
+void m68k_op_add_32_er_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = AY;
@@ -579,7 +579,7 @@ void m68k_op_add_32_er_a(void)
 }
 
 
-void m68k_op_add_32_er_ai(void)
+void m68k_op_add_32_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_AI_32();
@@ -595,7 +595,7 @@ void m68k_op_add_32_er_ai(void)
 }
 
 
-void m68k_op_add_32_er_pi(void)
+void m68k_op_add_32_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PI_32();
@@ -611,7 +611,7 @@ void m68k_op_add_32_er_pi(void)
 }
 
 
-void m68k_op_add_32_er_pd(void)
+void m68k_op_add_32_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PD_32();
@@ -627,7 +627,7 @@ void m68k_op_add_32_er_pd(void)
 }
 
 
-void m68k_op_add_32_er_di(void)
+void m68k_op_add_32_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_DI_32();
@@ -643,7 +643,7 @@ void m68k_op_add_32_er_di(void)
 }
 
 
-void m68k_op_add_32_er_ix(void)
+void m68k_op_add_32_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_IX_32();
@@ -659,7 +659,7 @@ void m68k_op_add_32_er_ix(void)
 }
 
 
-void m68k_op_add_32_er_aw(void)
+void m68k_op_add_32_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AW_32();
@@ -675,7 +675,7 @@ void m68k_op_add_32_er_aw(void)
 }
 
 
-void m68k_op_add_32_er_al(void)
+void m68k_op_add_32_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AL_32();
@@ -691,7 +691,7 @@ void m68k_op_add_32_er_al(void)
 }
 
 
-void m68k_op_add_32_er_pcdi(void)
+void m68k_op_add_32_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCDI_32();
@@ -707,7 +707,7 @@ void m68k_op_add_32_er_pcdi(void)
 }
 
 
-void m68k_op_add_32_er_pcix(void)
+void m68k_op_add_32_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCIX_32();
@@ -723,7 +723,7 @@ void m68k_op_add_32_er_pcix(void)
 }
 
 
-void m68k_op_add_32_er_i(void)
+void m68k_op_add_32_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_I_32();
@@ -739,7 +739,7 @@ void m68k_op_add_32_er_i(void)
 }
 
 
-void m68k_op_add_8_re_ai(void)
+void m68k_op_add_8_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -755,7 +755,7 @@ void m68k_op_add_8_re_ai(void)
 }
 
 
-void m68k_op_add_8_re_pi(void)
+void m68k_op_add_8_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -771,7 +771,7 @@ void m68k_op_add_8_re_pi(void)
 }
 
 
-void m68k_op_add_8_re_pi7(void)
+void m68k_op_add_8_re_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -787,7 +787,7 @@ void m68k_op_add_8_re_pi7(void)
 }
 
 
-void m68k_op_add_8_re_pd(void)
+void m68k_op_add_8_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -803,7 +803,7 @@ void m68k_op_add_8_re_pd(void)
 }
 
 
-void m68k_op_add_8_re_pd7(void)
+void m68k_op_add_8_re_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -819,7 +819,7 @@ void m68k_op_add_8_re_pd7(void)
 }
 
 
-void m68k_op_add_8_re_di(void)
+void m68k_op_add_8_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -835,7 +835,7 @@ void m68k_op_add_8_re_di(void)
 }
 
 
-void m68k_op_add_8_re_ix(void)
+void m68k_op_add_8_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -851,7 +851,7 @@ void m68k_op_add_8_re_ix(void)
 }
 
 
-void m68k_op_add_8_re_aw(void)
+void m68k_op_add_8_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -867,7 +867,7 @@ void m68k_op_add_8_re_aw(void)
 }
 
 
-void m68k_op_add_8_re_al(void)
+void m68k_op_add_8_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -883,7 +883,7 @@ void m68k_op_add_8_re_al(void)
 }
 
 
-void m68k_op_add_16_re_ai(void)
+void m68k_op_add_16_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -899,7 +899,7 @@ void m68k_op_add_16_re_ai(void)
 }
 
 
-void m68k_op_add_16_re_pi(void)
+void m68k_op_add_16_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -915,7 +915,7 @@ void m68k_op_add_16_re_pi(void)
 }
 
 
-void m68k_op_add_16_re_pd(void)
+void m68k_op_add_16_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -931,7 +931,7 @@ void m68k_op_add_16_re_pd(void)
 }
 
 
-void m68k_op_add_16_re_di(void)
+void m68k_op_add_16_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -947,7 +947,7 @@ void m68k_op_add_16_re_di(void)
 }
 
 
-void m68k_op_add_16_re_ix(void)
+void m68k_op_add_16_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -963,7 +963,7 @@ void m68k_op_add_16_re_ix(void)
 }
 
 
-void m68k_op_add_16_re_aw(void)
+void m68k_op_add_16_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -979,7 +979,7 @@ void m68k_op_add_16_re_aw(void)
 }
 
 
-void m68k_op_add_16_re_al(void)
+void m68k_op_add_16_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -995,7 +995,7 @@ void m68k_op_add_16_re_al(void)
 }
 
 
-void m68k_op_add_32_re_ai(void)
+void m68k_op_add_32_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_32();
 	uint src = DX;
@@ -1011,7 +1011,7 @@ void m68k_op_add_32_re_ai(void)
 }
 
 
-void m68k_op_add_32_re_pi(void)
+void m68k_op_add_32_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_32();
 	uint src = DX;
@@ -1027,7 +1027,7 @@ void m68k_op_add_32_re_pi(void)
 }
 
 
-void m68k_op_add_32_re_pd(void)
+void m68k_op_add_32_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_32();
 	uint src = DX;
@@ -1043,7 +1043,7 @@ void m68k_op_add_32_re_pd(void)
 }
 
 
-void m68k_op_add_32_re_di(void)
+void m68k_op_add_32_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_32();
 	uint src = DX;
@@ -1059,7 +1059,7 @@ void m68k_op_add_32_re_di(void)
 }
 
 
-void m68k_op_add_32_re_ix(void)
+void m68k_op_add_32_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_32();
 	uint src = DX;
@@ -1075,7 +1075,7 @@ void m68k_op_add_32_re_ix(void)
 }
 
 
-void m68k_op_add_32_re_aw(void)
+void m68k_op_add_32_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_32();
 	uint src = DX;
@@ -1091,7 +1091,7 @@ void m68k_op_add_32_re_aw(void)
 }
 
 
-void m68k_op_add_32_re_al(void)
+void m68k_op_add_32_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_32();
 	uint src = DX;
@@ -1107,7 +1107,7 @@ void m68k_op_add_32_re_al(void)
 }
 
 
-void m68k_op_adda_16_d(void)
+void m68k_op_adda_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 
@@ -1115,7 +1115,7 @@ void m68k_op_adda_16_d(void)
 }
 
 
-void m68k_op_adda_16_a(void)
+void m68k_op_adda_16_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 
@@ -1123,7 +1123,7 @@ void m68k_op_adda_16_a(void)
 }
 
 
-void m68k_op_adda_16_ai(void)
+void m68k_op_adda_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AY_AI_16());
@@ -1132,7 +1132,7 @@ void m68k_op_adda_16_ai(void)
 }
 
 
-void m68k_op_adda_16_pi(void)
+void m68k_op_adda_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AY_PI_16());
@@ -1141,7 +1141,7 @@ void m68k_op_adda_16_pi(void)
 }
 
 
-void m68k_op_adda_16_pd(void)
+void m68k_op_adda_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AY_PD_16());
@@ -1150,7 +1150,7 @@ void m68k_op_adda_16_pd(void)
 }
 
 
-void m68k_op_adda_16_di(void)
+void m68k_op_adda_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AY_DI_16());
@@ -1159,7 +1159,7 @@ void m68k_op_adda_16_di(void)
 }
 
 
-void m68k_op_adda_16_ix(void)
+void m68k_op_adda_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AY_IX_16());
@@ -1168,7 +1168,7 @@ void m68k_op_adda_16_ix(void)
 }
 
 
-void m68k_op_adda_16_aw(void)
+void m68k_op_adda_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AW_16());
@@ -1177,7 +1177,7 @@ void m68k_op_adda_16_aw(void)
 }
 
 
-void m68k_op_adda_16_al(void)
+void m68k_op_adda_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AL_16());
@@ -1186,7 +1186,7 @@ void m68k_op_adda_16_al(void)
 }
 
 
-void m68k_op_adda_16_pcdi(void)
+void m68k_op_adda_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_PCDI_16());
@@ -1195,7 +1195,7 @@ void m68k_op_adda_16_pcdi(void)
 }
 
 
-void m68k_op_adda_16_pcix(void)
+void m68k_op_adda_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_PCIX_16());
@@ -1204,7 +1204,7 @@ void m68k_op_adda_16_pcix(void)
 }
 
 
-void m68k_op_adda_16_i(void)
+void m68k_op_adda_16_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_I_16());
@@ -1213,7 +1213,7 @@ void m68k_op_adda_16_i(void)
 }
 
 
-void m68k_op_adda_32_d(void)
+void m68k_op_adda_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 
@@ -1221,7 +1221,7 @@ void m68k_op_adda_32_d(void)
 }
 
 
-void m68k_op_adda_32_a(void)
+void m68k_op_adda_32_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 
@@ -1229,7 +1229,7 @@ void m68k_op_adda_32_a(void)
 }
 
 
-void m68k_op_adda_32_ai(void)
+void m68k_op_adda_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_AI_32();
 	uint* r_dst = &AX;
@@ -1238,7 +1238,7 @@ void m68k_op_adda_32_ai(void)
 }
 
 
-void m68k_op_adda_32_pi(void)
+void m68k_op_adda_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PI_32();
 	uint* r_dst = &AX;
@@ -1247,7 +1247,7 @@ void m68k_op_adda_32_pi(void)
 }
 
 
-void m68k_op_adda_32_pd(void)
+void m68k_op_adda_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_32();
 	uint* r_dst = &AX;
@@ -1256,7 +1256,7 @@ void m68k_op_adda_32_pd(void)
 }
 
 
-void m68k_op_adda_32_di(void)
+void m68k_op_adda_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_DI_32();
 	uint* r_dst = &AX;
@@ -1265,7 +1265,7 @@ void m68k_op_adda_32_di(void)
 }
 
 
-void m68k_op_adda_32_ix(void)
+void m68k_op_adda_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_IX_32();
 	uint* r_dst = &AX;
@@ -1274,7 +1274,7 @@ void m68k_op_adda_32_ix(void)
 }
 
 
-void m68k_op_adda_32_aw(void)
+void m68k_op_adda_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AW_32();
 	uint* r_dst = &AX;
@@ -1283,7 +1283,7 @@ void m68k_op_adda_32_aw(void)
 }
 
 
-void m68k_op_adda_32_al(void)
+void m68k_op_adda_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AL_32();
 	uint* r_dst = &AX;
@@ -1292,7 +1292,7 @@ void m68k_op_adda_32_al(void)
 }
 
 
-void m68k_op_adda_32_pcdi(void)
+void m68k_op_adda_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCDI_32();
 	uint* r_dst = &AX;
@@ -1301,7 +1301,7 @@ void m68k_op_adda_32_pcdi(void)
 }
 
 
-void m68k_op_adda_32_pcix(void)
+void m68k_op_adda_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCIX_32();
 	uint* r_dst = &AX;
@@ -1310,7 +1310,7 @@ void m68k_op_adda_32_pcix(void)
 }
 
 
-void m68k_op_adda_32_i(void)
+void m68k_op_adda_32_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint* r_dst = &AX;
@@ -1319,7 +1319,7 @@ void m68k_op_adda_32_i(void)
 }
 
 
-void m68k_op_addi_8_d(void)
+void m68k_op_addi_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = OPER_I_8();
@@ -1335,7 +1335,7 @@ void m68k_op_addi_8_d(void)
 }
 
 
-void m68k_op_addi_8_ai(void)
+void m68k_op_addi_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_AI_8();
@@ -1351,7 +1351,7 @@ void m68k_op_addi_8_ai(void)
 }
 
 
-void m68k_op_addi_8_pi(void)
+void m68k_op_addi_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PI_8();
@@ -1367,7 +1367,7 @@ void m68k_op_addi_8_pi(void)
 }
 
 
-void m68k_op_addi_8_pi7(void)
+void m68k_op_addi_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PI_8();
@@ -1383,7 +1383,7 @@ void m68k_op_addi_8_pi7(void)
 }
 
 
-void m68k_op_addi_8_pd(void)
+void m68k_op_addi_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PD_8();
@@ -1399,7 +1399,7 @@ void m68k_op_addi_8_pd(void)
 }
 
 
-void m68k_op_addi_8_pd7(void)
+void m68k_op_addi_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PD_8();
@@ -1415,7 +1415,7 @@ void m68k_op_addi_8_pd7(void)
 }
 
 
-void m68k_op_addi_8_di(void)
+void m68k_op_addi_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_DI_8();
@@ -1431,7 +1431,7 @@ void m68k_op_addi_8_di(void)
 }
 
 
-void m68k_op_addi_8_ix(void)
+void m68k_op_addi_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_IX_8();
@@ -1447,7 +1447,7 @@ void m68k_op_addi_8_ix(void)
 }
 
 
-void m68k_op_addi_8_aw(void)
+void m68k_op_addi_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AW_8();
@@ -1463,7 +1463,7 @@ void m68k_op_addi_8_aw(void)
 }
 
 
-void m68k_op_addi_8_al(void)
+void m68k_op_addi_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AL_8();
@@ -1479,7 +1479,7 @@ void m68k_op_addi_8_al(void)
 }
 
 
-void m68k_op_addi_16_d(void)
+void m68k_op_addi_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = OPER_I_16();
@@ -1495,7 +1495,7 @@ void m68k_op_addi_16_d(void)
 }
 
 
-void m68k_op_addi_16_ai(void)
+void m68k_op_addi_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_AI_16();
@@ -1511,7 +1511,7 @@ void m68k_op_addi_16_ai(void)
 }
 
 
-void m68k_op_addi_16_pi(void)
+void m68k_op_addi_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PI_16();
@@ -1527,7 +1527,7 @@ void m68k_op_addi_16_pi(void)
 }
 
 
-void m68k_op_addi_16_pd(void)
+void m68k_op_addi_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PD_16();
@@ -1543,7 +1543,7 @@ void m68k_op_addi_16_pd(void)
 }
 
 
-void m68k_op_addi_16_di(void)
+void m68k_op_addi_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_DI_16();
@@ -1559,7 +1559,7 @@ void m68k_op_addi_16_di(void)
 }
 
 
-void m68k_op_addi_16_ix(void)
+void m68k_op_addi_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_IX_16();
@@ -1575,7 +1575,7 @@ void m68k_op_addi_16_ix(void)
 }
 
 
-void m68k_op_addi_16_aw(void)
+void m68k_op_addi_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AW_16();
@@ -1591,7 +1591,7 @@ void m68k_op_addi_16_aw(void)
 }
 
 
-void m68k_op_addi_16_al(void)
+void m68k_op_addi_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AL_16();
@@ -1607,7 +1607,7 @@ void m68k_op_addi_16_al(void)
 }
 
 
-void m68k_op_addi_32_d(void)
+void m68k_op_addi_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = OPER_I_32();
@@ -1623,7 +1623,7 @@ void m68k_op_addi_32_d(void)
 }
 
 
-void m68k_op_addi_32_ai(void)
+void m68k_op_addi_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_AI_32();
@@ -1639,7 +1639,7 @@ void m68k_op_addi_32_ai(void)
 }
 
 
-void m68k_op_addi_32_pi(void)
+void m68k_op_addi_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PI_32();
@@ -1655,7 +1655,7 @@ void m68k_op_addi_32_pi(void)
 }
 
 
-void m68k_op_addi_32_pd(void)
+void m68k_op_addi_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PD_32();
@@ -1671,7 +1671,7 @@ void m68k_op_addi_32_pd(void)
 }
 
 
-void m68k_op_addi_32_di(void)
+void m68k_op_addi_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_DI_32();
@@ -1687,7 +1687,7 @@ void m68k_op_addi_32_di(void)
 }
 
 
-void m68k_op_addi_32_ix(void)
+void m68k_op_addi_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_IX_32();
@@ -1703,7 +1703,7 @@ void m68k_op_addi_32_ix(void)
 }
 
 
-void m68k_op_addi_32_aw(void)
+void m68k_op_addi_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AW_32();
@@ -1719,7 +1719,7 @@ void m68k_op_addi_32_aw(void)
 }
 
 
-void m68k_op_addi_32_al(void)
+void m68k_op_addi_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AL_32();
@@ -1735,7 +1735,7 @@ void m68k_op_addi_32_al(void)
 }
 
 
-void m68k_op_addq_8_d(void)
+void m68k_op_addq_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -1751,7 +1751,7 @@ void m68k_op_addq_8_d(void)
 }
 
 
-void m68k_op_addq_8_ai(void)
+void m68k_op_addq_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_AI_8();
@@ -1767,7 +1767,7 @@ void m68k_op_addq_8_ai(void)
 }
 
 
-void m68k_op_addq_8_pi(void)
+void m68k_op_addq_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PI_8();
@@ -1783,7 +1783,7 @@ void m68k_op_addq_8_pi(void)
 }
 
 
-void m68k_op_addq_8_pi7(void)
+void m68k_op_addq_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_A7_PI_8();
@@ -1799,7 +1799,7 @@ void m68k_op_addq_8_pi7(void)
 }
 
 
-void m68k_op_addq_8_pd(void)
+void m68k_op_addq_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PD_8();
@@ -1815,7 +1815,7 @@ void m68k_op_addq_8_pd(void)
 }
 
 
-void m68k_op_addq_8_pd7(void)
+void m68k_op_addq_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_A7_PD_8();
@@ -1831,7 +1831,7 @@ void m68k_op_addq_8_pd7(void)
 }
 
 
-void m68k_op_addq_8_di(void)
+void m68k_op_addq_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_DI_8();
@@ -1847,7 +1847,7 @@ void m68k_op_addq_8_di(void)
 }
 
 
-void m68k_op_addq_8_ix(void)
+void m68k_op_addq_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_IX_8();
@@ -1863,7 +1863,7 @@ void m68k_op_addq_8_ix(void)
 }
 
 
-void m68k_op_addq_8_aw(void)
+void m68k_op_addq_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AW_8();
@@ -1879,7 +1879,7 @@ void m68k_op_addq_8_aw(void)
 }
 
 
-void m68k_op_addq_8_al(void)
+void m68k_op_addq_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AL_8();
@@ -1895,7 +1895,7 @@ void m68k_op_addq_8_al(void)
 }
 
 
-void m68k_op_addq_16_d(void)
+void m68k_op_addq_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -1911,7 +1911,7 @@ void m68k_op_addq_16_d(void)
 }
 
 
-void m68k_op_addq_16_a(void)
+void m68k_op_addq_16_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AY;
 
@@ -1919,7 +1919,7 @@ void m68k_op_addq_16_a(void)
 }
 
 
-void m68k_op_addq_16_ai(void)
+void m68k_op_addq_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_AI_16();
@@ -1935,7 +1935,7 @@ void m68k_op_addq_16_ai(void)
 }
 
 
-void m68k_op_addq_16_pi(void)
+void m68k_op_addq_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PI_16();
@@ -1951,7 +1951,7 @@ void m68k_op_addq_16_pi(void)
 }
 
 
-void m68k_op_addq_16_pd(void)
+void m68k_op_addq_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PD_16();
@@ -1967,7 +1967,7 @@ void m68k_op_addq_16_pd(void)
 }
 
 
-void m68k_op_addq_16_di(void)
+void m68k_op_addq_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_DI_16();
@@ -1983,7 +1983,7 @@ void m68k_op_addq_16_di(void)
 }
 
 
-void m68k_op_addq_16_ix(void)
+void m68k_op_addq_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_IX_16();
@@ -1999,7 +1999,7 @@ void m68k_op_addq_16_ix(void)
 }
 
 
-void m68k_op_addq_16_aw(void)
+void m68k_op_addq_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AW_16();
@@ -2015,7 +2015,7 @@ void m68k_op_addq_16_aw(void)
 }
 
 
-void m68k_op_addq_16_al(void)
+void m68k_op_addq_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AL_16();
@@ -2031,7 +2031,7 @@ void m68k_op_addq_16_al(void)
 }
 
 
-void m68k_op_addq_32_d(void)
+void m68k_op_addq_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -2047,7 +2047,7 @@ void m68k_op_addq_32_d(void)
 }
 
 
-void m68k_op_addq_32_a(void)
+void m68k_op_addq_32_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AY;
 
@@ -2055,7 +2055,7 @@ void m68k_op_addq_32_a(void)
 }
 
 
-void m68k_op_addq_32_ai(void)
+void m68k_op_addq_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_AI_32();
@@ -2072,7 +2072,7 @@ void m68k_op_addq_32_ai(void)
 }
 
 
-void m68k_op_addq_32_pi(void)
+void m68k_op_addq_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PI_32();
@@ -2089,7 +2089,7 @@ void m68k_op_addq_32_pi(void)
 }
 
 
-void m68k_op_addq_32_pd(void)
+void m68k_op_addq_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PD_32();
@@ -2106,7 +2106,7 @@ void m68k_op_addq_32_pd(void)
 }
 
 
-void m68k_op_addq_32_di(void)
+void m68k_op_addq_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_DI_32();
@@ -2123,7 +2123,7 @@ void m68k_op_addq_32_di(void)
 }
 
 
-void m68k_op_addq_32_ix(void)
+void m68k_op_addq_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_IX_32();
@@ -2140,7 +2140,7 @@ void m68k_op_addq_32_ix(void)
 }
 
 
-void m68k_op_addq_32_aw(void)
+void m68k_op_addq_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AW_32();
@@ -2157,7 +2157,7 @@ void m68k_op_addq_32_aw(void)
 }
 
 
-void m68k_op_addq_32_al(void)
+void m68k_op_addq_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AL_32();
@@ -2174,7 +2174,7 @@ void m68k_op_addq_32_al(void)
 }
 
 
-void m68k_op_addx_8_rr(void)
+void m68k_op_addx_8_rr(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_8(DY);
@@ -2192,7 +2192,7 @@ void m68k_op_addx_8_rr(void)
 }
 
 
-void m68k_op_addx_16_rr(void)
+void m68k_op_addx_16_rr(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(DY);
@@ -2210,7 +2210,7 @@ void m68k_op_addx_16_rr(void)
 }
 
 
-void m68k_op_addx_32_rr(void)
+void m68k_op_addx_32_rr(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = DY;
@@ -2228,7 +2228,7 @@ void m68k_op_addx_32_rr(void)
 }
 
 
-void m68k_op_addx_8_mm_ax7(void)
+void m68k_op_addx_8_mm_ax7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_A7_PD_8();
@@ -2246,7 +2246,7 @@ void m68k_op_addx_8_mm_ax7(void)
 }
 
 
-void m68k_op_addx_8_mm_ay7(void)
+void m68k_op_addx_8_mm_ay7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_AX_PD_8();
@@ -2264,7 +2264,7 @@ void m68k_op_addx_8_mm_ay7(void)
 }
 
 
-void m68k_op_addx_8_mm_axy7(void)
+void m68k_op_addx_8_mm_axy7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_A7_PD_8();
@@ -2282,7 +2282,7 @@ void m68k_op_addx_8_mm_axy7(void)
 }
 
 
-void m68k_op_addx_8_mm(void)
+void m68k_op_addx_8_mm(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_AX_PD_8();
@@ -2300,7 +2300,7 @@ void m68k_op_addx_8_mm(void)
 }
 
 
-void m68k_op_addx_16_mm(void)
+void m68k_op_addx_16_mm(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_16();
 	uint ea  = EA_AX_PD_16();
@@ -2318,7 +2318,7 @@ void m68k_op_addx_16_mm(void)
 }
 
 
-void m68k_op_addx_32_mm(void)
+void m68k_op_addx_32_mm(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_32();
 	uint ea  = EA_AX_PD_32();
@@ -2336,7 +2336,7 @@ void m68k_op_addx_32_mm(void)
 }
 
 
-void m68k_op_and_8_er_d(void)
+void m68k_op_and_8_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (DY | 0xffffff00));
 
@@ -2346,7 +2346,7 @@ void m68k_op_and_8_er_d(void)
 }
 
 
-void m68k_op_and_8_er_ai(void)
+void m68k_op_and_8_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_AI_8() | 0xffffff00));
 
@@ -2356,7 +2356,7 @@ void m68k_op_and_8_er_ai(void)
 }
 
 
-void m68k_op_and_8_er_pi(void)
+void m68k_op_and_8_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PI_8() | 0xffffff00));
 
@@ -2366,7 +2366,7 @@ void m68k_op_and_8_er_pi(void)
 }
 
 
-void m68k_op_and_8_er_pi7(void)
+void m68k_op_and_8_er_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PI_8() | 0xffffff00));
 
@@ -2376,7 +2376,7 @@ void m68k_op_and_8_er_pi7(void)
 }
 
 
-void m68k_op_and_8_er_pd(void)
+void m68k_op_and_8_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PD_8() | 0xffffff00));
 
@@ -2386,7 +2386,7 @@ void m68k_op_and_8_er_pd(void)
 }
 
 
-void m68k_op_and_8_er_pd7(void)
+void m68k_op_and_8_er_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PD_8() | 0xffffff00));
 
@@ -2396,7 +2396,7 @@ void m68k_op_and_8_er_pd7(void)
 }
 
 
-void m68k_op_and_8_er_di(void)
+void m68k_op_and_8_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_DI_8() | 0xffffff00));
 
@@ -2406,7 +2406,7 @@ void m68k_op_and_8_er_di(void)
 }
 
 
-void m68k_op_and_8_er_ix(void)
+void m68k_op_and_8_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_IX_8() | 0xffffff00));
 
@@ -2416,7 +2416,7 @@ void m68k_op_and_8_er_ix(void)
 }
 
 
-void m68k_op_and_8_er_aw(void)
+void m68k_op_and_8_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AW_8() | 0xffffff00));
 
@@ -2426,7 +2426,7 @@ void m68k_op_and_8_er_aw(void)
 }
 
 
-void m68k_op_and_8_er_al(void)
+void m68k_op_and_8_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AL_8() | 0xffffff00));
 
@@ -2436,7 +2436,7 @@ void m68k_op_and_8_er_al(void)
 }
 
 
-void m68k_op_and_8_er_pcdi(void)
+void m68k_op_and_8_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCDI_8() | 0xffffff00));
 
@@ -2446,7 +2446,7 @@ void m68k_op_and_8_er_pcdi(void)
 }
 
 
-void m68k_op_and_8_er_pcix(void)
+void m68k_op_and_8_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCIX_8() | 0xffffff00));
 
@@ -2456,7 +2456,7 @@ void m68k_op_and_8_er_pcix(void)
 }
 
 
-void m68k_op_and_8_er_i(void)
+void m68k_op_and_8_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_I_8() | 0xffffff00));
 
@@ -2466,7 +2466,7 @@ void m68k_op_and_8_er_i(void)
 }
 
 
-void m68k_op_and_16_er_d(void)
+void m68k_op_and_16_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (DY | 0xffff0000));
 
@@ -2476,7 +2476,7 @@ void m68k_op_and_16_er_d(void)
 }
 
 
-void m68k_op_and_16_er_ai(void)
+void m68k_op_and_16_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_AI_16() | 0xffff0000));
 
@@ -2486,7 +2486,7 @@ void m68k_op_and_16_er_ai(void)
 }
 
 
-void m68k_op_and_16_er_pi(void)
+void m68k_op_and_16_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PI_16() | 0xffff0000));
 
@@ -2496,7 +2496,7 @@ void m68k_op_and_16_er_pi(void)
 }
 
 
-void m68k_op_and_16_er_pd(void)
+void m68k_op_and_16_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PD_16() | 0xffff0000));
 
@@ -2506,7 +2506,7 @@ void m68k_op_and_16_er_pd(void)
 }
 
 
-void m68k_op_and_16_er_di(void)
+void m68k_op_and_16_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_DI_16() | 0xffff0000));
 
@@ -2516,7 +2516,7 @@ void m68k_op_and_16_er_di(void)
 }
 
 
-void m68k_op_and_16_er_ix(void)
+void m68k_op_and_16_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_IX_16() | 0xffff0000));
 
@@ -2526,7 +2526,7 @@ void m68k_op_and_16_er_ix(void)
 }
 
 
-void m68k_op_and_16_er_aw(void)
+void m68k_op_and_16_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AW_16() | 0xffff0000));
 
@@ -2536,7 +2536,7 @@ void m68k_op_and_16_er_aw(void)
 }
 
 
-void m68k_op_and_16_er_al(void)
+void m68k_op_and_16_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AL_16() | 0xffff0000));
 
@@ -2546,7 +2546,7 @@ void m68k_op_and_16_er_al(void)
 }
 
 
-void m68k_op_and_16_er_pcdi(void)
+void m68k_op_and_16_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCDI_16() | 0xffff0000));
 
@@ -2556,7 +2556,7 @@ void m68k_op_and_16_er_pcdi(void)
 }
 
 
-void m68k_op_and_16_er_pcix(void)
+void m68k_op_and_16_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCIX_16() | 0xffff0000));
 
@@ -2566,7 +2566,7 @@ void m68k_op_and_16_er_pcix(void)
 }
 
 
-void m68k_op_and_16_er_i(void)
+void m68k_op_and_16_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_I_16() | 0xffff0000));
 
@@ -2576,7 +2576,7 @@ void m68k_op_and_16_er_i(void)
 }
 
 
-void m68k_op_and_32_er_d(void)
+void m68k_op_and_32_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DX &= DY;
 
@@ -2586,7 +2586,7 @@ void m68k_op_and_32_er_d(void)
 }
 
 
-void m68k_op_and_32_er_ai(void)
+void m68k_op_and_32_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DX &= OPER_AY_AI_32();
 
@@ -2596,7 +2596,7 @@ void m68k_op_and_32_er_ai(void)
 }
 
 
-void m68k_op_and_32_er_pi(void)
+void m68k_op_and_32_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DX &= OPER_AY_PI_32();
 
@@ -2606,7 +2606,7 @@ void m68k_op_and_32_er_pi(void)
 }
 
 
-void m68k_op_and_32_er_pd(void)
+void m68k_op_and_32_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DX &= OPER_AY_PD_32();
 
@@ -2616,7 +2616,7 @@ void m68k_op_and_32_er_pd(void)
 }
 
 
-void m68k_op_and_32_er_di(void)
+void m68k_op_and_32_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DX &= OPER_AY_DI_32();
 
@@ -2626,7 +2626,7 @@ void m68k_op_and_32_er_di(void)
 }
 
 
-void m68k_op_and_32_er_ix(void)
+void m68k_op_and_32_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DX &= OPER_AY_IX_32();
 
@@ -2636,7 +2636,7 @@ void m68k_op_and_32_er_ix(void)
 }
 
 
-void m68k_op_and_32_er_aw(void)
+void m68k_op_and_32_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DX &= OPER_AW_32();
 
@@ -2646,7 +2646,7 @@ void m68k_op_and_32_er_aw(void)
 }
 
 
-void m68k_op_and_32_er_al(void)
+void m68k_op_and_32_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DX &= OPER_AL_32();
 
@@ -2656,7 +2656,7 @@ void m68k_op_and_32_er_al(void)
 }
 
 
-void m68k_op_and_32_er_pcdi(void)
+void m68k_op_and_32_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DX &= OPER_PCDI_32();
 
@@ -2666,7 +2666,7 @@ void m68k_op_and_32_er_pcdi(void)
 }
 
 
-void m68k_op_and_32_er_pcix(void)
+void m68k_op_and_32_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DX &= OPER_PCIX_32();
 
@@ -2676,7 +2676,7 @@ void m68k_op_and_32_er_pcix(void)
 }
 
 
-void m68k_op_and_32_er_i(void)
+void m68k_op_and_32_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DX &= OPER_I_32();
 
@@ -2686,7 +2686,7 @@ void m68k_op_and_32_er_i(void)
 }
 
 
-void m68k_op_and_8_re_ai(void)
+void m68k_op_and_8_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2700,7 +2700,7 @@ void m68k_op_and_8_re_ai(void)
 }
 
 
-void m68k_op_and_8_re_pi(void)
+void m68k_op_and_8_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2714,7 +2714,7 @@ void m68k_op_and_8_re_pi(void)
 }
 
 
-void m68k_op_and_8_re_pi7(void)
+void m68k_op_and_8_re_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2728,7 +2728,7 @@ void m68k_op_and_8_re_pi7(void)
 }
 
 
-void m68k_op_and_8_re_pd(void)
+void m68k_op_and_8_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2742,7 +2742,7 @@ void m68k_op_and_8_re_pd(void)
 }
 
 
-void m68k_op_and_8_re_pd7(void)
+void m68k_op_and_8_re_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2756,7 +2756,7 @@ void m68k_op_and_8_re_pd7(void)
 }
 
 
-void m68k_op_and_8_re_di(void)
+void m68k_op_and_8_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2770,7 +2770,7 @@ void m68k_op_and_8_re_di(void)
 }
 
 
-void m68k_op_and_8_re_ix(void)
+void m68k_op_and_8_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2784,7 +2784,7 @@ void m68k_op_and_8_re_ix(void)
 }
 
 
-void m68k_op_and_8_re_aw(void)
+void m68k_op_and_8_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2798,7 +2798,7 @@ void m68k_op_and_8_re_aw(void)
 }
 
 
-void m68k_op_and_8_re_al(void)
+void m68k_op_and_8_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint res = DX & m68ki_read_8(ea);
@@ -2812,7 +2812,7 @@ void m68k_op_and_8_re_al(void)
 }
 
 
-void m68k_op_and_16_re_ai(void)
+void m68k_op_and_16_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2826,7 +2826,7 @@ void m68k_op_and_16_re_ai(void)
 }
 
 
-void m68k_op_and_16_re_pi(void)
+void m68k_op_and_16_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2840,7 +2840,7 @@ void m68k_op_and_16_re_pi(void)
 }
 
 
-void m68k_op_and_16_re_pd(void)
+void m68k_op_and_16_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2854,7 +2854,7 @@ void m68k_op_and_16_re_pd(void)
 }
 
 
-void m68k_op_and_16_re_di(void)
+void m68k_op_and_16_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2868,7 +2868,7 @@ void m68k_op_and_16_re_di(void)
 }
 
 
-void m68k_op_and_16_re_ix(void)
+void m68k_op_and_16_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2882,7 +2882,7 @@ void m68k_op_and_16_re_ix(void)
 }
 
 
-void m68k_op_and_16_re_aw(void)
+void m68k_op_and_16_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2896,7 +2896,7 @@ void m68k_op_and_16_re_aw(void)
 }
 
 
-void m68k_op_and_16_re_al(void)
+void m68k_op_and_16_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint res = DX & m68ki_read_16(ea);
@@ -2910,7 +2910,7 @@ void m68k_op_and_16_re_al(void)
 }
 
 
-void m68k_op_and_32_re_ai(void)
+void m68k_op_and_32_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2924,7 +2924,7 @@ void m68k_op_and_32_re_ai(void)
 }
 
 
-void m68k_op_and_32_re_pi(void)
+void m68k_op_and_32_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2938,7 +2938,7 @@ void m68k_op_and_32_re_pi(void)
 }
 
 
-void m68k_op_and_32_re_pd(void)
+void m68k_op_and_32_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2952,7 +2952,7 @@ void m68k_op_and_32_re_pd(void)
 }
 
 
-void m68k_op_and_32_re_di(void)
+void m68k_op_and_32_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2966,7 +2966,7 @@ void m68k_op_and_32_re_di(void)
 }
 
 
-void m68k_op_and_32_re_ix(void)
+void m68k_op_and_32_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2980,7 +2980,7 @@ void m68k_op_and_32_re_ix(void)
 }
 
 
-void m68k_op_and_32_re_aw(void)
+void m68k_op_and_32_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -2994,7 +2994,7 @@ void m68k_op_and_32_re_aw(void)
 }
 
 
-void m68k_op_and_32_re_al(void)
+void m68k_op_and_32_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_32();
 	uint res = DX & m68ki_read_32(ea);
@@ -3008,7 +3008,7 @@ void m68k_op_and_32_re_al(void)
 }
 
 
-void m68k_op_andi_8_d(void)
+void m68k_op_andi_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_8(DY &= (OPER_I_8() | 0xffffff00));
 
@@ -3018,7 +3018,7 @@ void m68k_op_andi_8_d(void)
 }
 
 
-void m68k_op_andi_8_ai(void)
+void m68k_op_andi_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_AI_8();
@@ -3033,7 +3033,7 @@ void m68k_op_andi_8_ai(void)
 }
 
 
-void m68k_op_andi_8_pi(void)
+void m68k_op_andi_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PI_8();
@@ -3048,7 +3048,7 @@ void m68k_op_andi_8_pi(void)
 }
 
 
-void m68k_op_andi_8_pi7(void)
+void m68k_op_andi_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PI_8();
@@ -3063,7 +3063,7 @@ void m68k_op_andi_8_pi7(void)
 }
 
 
-void m68k_op_andi_8_pd(void)
+void m68k_op_andi_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PD_8();
@@ -3078,7 +3078,7 @@ void m68k_op_andi_8_pd(void)
 }
 
 
-void m68k_op_andi_8_pd7(void)
+void m68k_op_andi_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PD_8();
@@ -3093,7 +3093,7 @@ void m68k_op_andi_8_pd7(void)
 }
 
 
-void m68k_op_andi_8_di(void)
+void m68k_op_andi_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_DI_8();
@@ -3108,7 +3108,7 @@ void m68k_op_andi_8_di(void)
 }
 
 
-void m68k_op_andi_8_ix(void)
+void m68k_op_andi_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_IX_8();
@@ -3123,7 +3123,7 @@ void m68k_op_andi_8_ix(void)
 }
 
 
-void m68k_op_andi_8_aw(void)
+void m68k_op_andi_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AW_8();
@@ -3138,7 +3138,7 @@ void m68k_op_andi_8_aw(void)
 }
 
 
-void m68k_op_andi_8_al(void)
+void m68k_op_andi_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AL_8();
@@ -3153,7 +3153,7 @@ void m68k_op_andi_8_al(void)
 }
 
 
-void m68k_op_andi_16_d(void)
+void m68k_op_andi_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = MASK_OUT_ABOVE_16(DY &= (OPER_I_16() | 0xffff0000));
 
@@ -3163,7 +3163,7 @@ void m68k_op_andi_16_d(void)
 }
 
 
-void m68k_op_andi_16_ai(void)
+void m68k_op_andi_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_AI_16();
@@ -3178,7 +3178,7 @@ void m68k_op_andi_16_ai(void)
 }
 
 
-void m68k_op_andi_16_pi(void)
+void m68k_op_andi_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PI_16();
@@ -3193,7 +3193,7 @@ void m68k_op_andi_16_pi(void)
 }
 
 
-void m68k_op_andi_16_pd(void)
+void m68k_op_andi_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PD_16();
@@ -3208,7 +3208,7 @@ void m68k_op_andi_16_pd(void)
 }
 
 
-void m68k_op_andi_16_di(void)
+void m68k_op_andi_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_DI_16();
@@ -3223,7 +3223,7 @@ void m68k_op_andi_16_di(void)
 }
 
 
-void m68k_op_andi_16_ix(void)
+void m68k_op_andi_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_IX_16();
@@ -3238,7 +3238,7 @@ void m68k_op_andi_16_ix(void)
 }
 
 
-void m68k_op_andi_16_aw(void)
+void m68k_op_andi_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AW_16();
@@ -3253,7 +3253,7 @@ void m68k_op_andi_16_aw(void)
 }
 
 
-void m68k_op_andi_16_al(void)
+void m68k_op_andi_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AL_16();
@@ -3268,7 +3268,7 @@ void m68k_op_andi_16_al(void)
 }
 
 
-void m68k_op_andi_32_d(void)
+void m68k_op_andi_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DY &= (OPER_I_32());
 
@@ -3278,7 +3278,7 @@ void m68k_op_andi_32_d(void)
 }
 
 
-void m68k_op_andi_32_ai(void)
+void m68k_op_andi_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_AI_32();
@@ -3293,7 +3293,7 @@ void m68k_op_andi_32_ai(void)
 }
 
 
-void m68k_op_andi_32_pi(void)
+void m68k_op_andi_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PI_32();
@@ -3308,7 +3308,7 @@ void m68k_op_andi_32_pi(void)
 }
 
 
-void m68k_op_andi_32_pd(void)
+void m68k_op_andi_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PD_32();
@@ -3323,7 +3323,7 @@ void m68k_op_andi_32_pd(void)
 }
 
 
-void m68k_op_andi_32_di(void)
+void m68k_op_andi_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_DI_32();
@@ -3338,7 +3338,7 @@ void m68k_op_andi_32_di(void)
 }
 
 
-void m68k_op_andi_32_ix(void)
+void m68k_op_andi_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_IX_32();
@@ -3353,7 +3353,7 @@ void m68k_op_andi_32_ix(void)
 }
 
 
-void m68k_op_andi_32_aw(void)
+void m68k_op_andi_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AW_32();
@@ -3368,7 +3368,7 @@ void m68k_op_andi_32_aw(void)
 }
 
 
-void m68k_op_andi_32_al(void)
+void m68k_op_andi_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AL_32();
@@ -3383,13 +3383,13 @@ void m68k_op_andi_32_al(void)
 }
 
 
-void m68k_op_andi_16_toc(void)
+void m68k_op_andi_16_toc(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(m68ki_get_ccr() & OPER_I_8());
 }
 
 
-void m68k_op_andi_16_tos(void)
+void m68k_op_andi_16_tos(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -3402,7 +3402,7 @@ void m68k_op_andi_16_tos(void)
 }
 
 
-void m68k_op_asr_8_s(void)
+void m68k_op_asr_8_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3424,7 +3424,7 @@ void m68k_op_asr_8_s(void)
 }
 
 
-void m68k_op_asr_16_s(void)
+void m68k_op_asr_16_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3446,7 +3446,7 @@ void m68k_op_asr_16_s(void)
 }
 
 
-void m68k_op_asr_32_s(void)
+void m68k_op_asr_32_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3468,7 +3468,7 @@ void m68k_op_asr_32_s(void)
 }
 
 
-void m68k_op_asr_8_r(void)
+void m68k_op_asr_8_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3520,7 +3520,7 @@ void m68k_op_asr_8_r(void)
 }
 
 
-void m68k_op_asr_16_r(void)
+void m68k_op_asr_16_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3572,7 +3572,7 @@ void m68k_op_asr_16_r(void)
 }
 
 
-void m68k_op_asr_32_r(void)
+void m68k_op_asr_32_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3624,7 +3624,7 @@ void m68k_op_asr_32_r(void)
 }
 
 
-void m68k_op_asr_16_ai(void)
+void m68k_op_asr_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -3642,7 +3642,7 @@ void m68k_op_asr_16_ai(void)
 }
 
 
-void m68k_op_asr_16_pi(void)
+void m68k_op_asr_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -3660,7 +3660,7 @@ void m68k_op_asr_16_pi(void)
 }
 
 
-void m68k_op_asr_16_pd(void)
+void m68k_op_asr_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -3678,7 +3678,7 @@ void m68k_op_asr_16_pd(void)
 }
 
 
-void m68k_op_asr_16_di(void)
+void m68k_op_asr_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -3696,7 +3696,7 @@ void m68k_op_asr_16_di(void)
 }
 
 
-void m68k_op_asr_16_ix(void)
+void m68k_op_asr_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -3714,7 +3714,7 @@ void m68k_op_asr_16_ix(void)
 }
 
 
-void m68k_op_asr_16_aw(void)
+void m68k_op_asr_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -3732,7 +3732,7 @@ void m68k_op_asr_16_aw(void)
 }
 
 
-void m68k_op_asr_16_al(void)
+void m68k_op_asr_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -3750,7 +3750,7 @@ void m68k_op_asr_16_al(void)
 }
 
 
-void m68k_op_asl_8_s(void)
+void m68k_op_asl_8_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3770,7 +3770,7 @@ void m68k_op_asl_8_s(void)
 }
 
 
-void m68k_op_asl_16_s(void)
+void m68k_op_asl_16_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3790,7 +3790,7 @@ void m68k_op_asl_16_s(void)
 }
 
 
-void m68k_op_asl_32_s(void)
+void m68k_op_asl_32_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3810,7 +3810,7 @@ void m68k_op_asl_32_s(void)
 }
 
 
-void m68k_op_asl_8_r(void)
+void m68k_op_asl_8_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3847,7 +3847,7 @@ void m68k_op_asl_8_r(void)
 }
 
 
-void m68k_op_asl_16_r(void)
+void m68k_op_asl_16_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3884,7 +3884,7 @@ void m68k_op_asl_16_r(void)
 }
 
 
-void m68k_op_asl_32_r(void)
+void m68k_op_asl_32_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -3921,7 +3921,7 @@ void m68k_op_asl_32_r(void)
 }
 
 
-void m68k_op_asl_16_ai(void)
+void m68k_op_asl_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -3937,7 +3937,7 @@ void m68k_op_asl_16_ai(void)
 }
 
 
-void m68k_op_asl_16_pi(void)
+void m68k_op_asl_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -3953,7 +3953,7 @@ void m68k_op_asl_16_pi(void)
 }
 
 
-void m68k_op_asl_16_pd(void)
+void m68k_op_asl_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -3969,7 +3969,7 @@ void m68k_op_asl_16_pd(void)
 }
 
 
-void m68k_op_asl_16_di(void)
+void m68k_op_asl_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -3985,7 +3985,7 @@ void m68k_op_asl_16_di(void)
 }
 
 
-void m68k_op_asl_16_ix(void)
+void m68k_op_asl_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -4001,7 +4001,7 @@ void m68k_op_asl_16_ix(void)
 }
 
 
-void m68k_op_asl_16_aw(void)
+void m68k_op_asl_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -4017,7 +4017,7 @@ void m68k_op_asl_16_aw(void)
 }
 
 
-void m68k_op_asl_16_al(void)
+void m68k_op_asl_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -4033,7 +4033,7 @@ void m68k_op_asl_16_al(void)
 }
 
 
-void m68k_op_bhi_8(void)
+void m68k_op_bhi_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_HI())
 	{
@@ -4045,7 +4045,7 @@ void m68k_op_bhi_8(void)
 }
 
 
-void m68k_op_bls_8(void)
+void m68k_op_bls_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_LS())
 	{
@@ -4057,7 +4057,7 @@ void m68k_op_bls_8(void)
 }
 
 
-void m68k_op_bcc_8(void)
+void m68k_op_bcc_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_CC())
 	{
@@ -4069,7 +4069,7 @@ void m68k_op_bcc_8(void)
 }
 
 
-void m68k_op_bcs_8(void)
+void m68k_op_bcs_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_CS())
 	{
@@ -4081,7 +4081,7 @@ void m68k_op_bcs_8(void)
 }
 
 
-void m68k_op_bne_8(void)
+void m68k_op_bne_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NE())
 	{
@@ -4093,7 +4093,7 @@ void m68k_op_bne_8(void)
 }
 
 
-void m68k_op_beq_8(void)
+void m68k_op_beq_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_EQ())
 	{
@@ -4105,7 +4105,7 @@ void m68k_op_beq_8(void)
 }
 
 
-void m68k_op_bvc_8(void)
+void m68k_op_bvc_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_VC())
 	{
@@ -4117,7 +4117,7 @@ void m68k_op_bvc_8(void)
 }
 
 
-void m68k_op_bvs_8(void)
+void m68k_op_bvs_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_VS())
 	{
@@ -4129,7 +4129,7 @@ void m68k_op_bvs_8(void)
 }
 
 
-void m68k_op_bpl_8(void)
+void m68k_op_bpl_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_PL())
 	{
@@ -4141,7 +4141,7 @@ void m68k_op_bpl_8(void)
 }
 
 
-void m68k_op_bmi_8(void)
+void m68k_op_bmi_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_MI())
 	{
@@ -4153,7 +4153,7 @@ void m68k_op_bmi_8(void)
 }
 
 
-void m68k_op_bge_8(void)
+void m68k_op_bge_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_GE())
 	{
@@ -4165,7 +4165,7 @@ void m68k_op_bge_8(void)
 }
 
 
-void m68k_op_blt_8(void)
+void m68k_op_blt_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_LT())
 	{
@@ -4177,7 +4177,7 @@ void m68k_op_blt_8(void)
 }
 
 
-void m68k_op_bgt_8(void)
+void m68k_op_bgt_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_GT())
 	{
@@ -4189,7 +4189,7 @@ void m68k_op_bgt_8(void)
 }
 
 
-void m68k_op_ble_8(void)
+void m68k_op_ble_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_LE())
 	{
@@ -4201,7 +4201,7 @@ void m68k_op_ble_8(void)
 }
 
 
-void m68k_op_bhi_16(void)
+void m68k_op_bhi_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_HI())
 	{
@@ -4216,7 +4216,7 @@ void m68k_op_bhi_16(void)
 }
 
 
-void m68k_op_bls_16(void)
+void m68k_op_bls_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_LS())
 	{
@@ -4231,7 +4231,7 @@ void m68k_op_bls_16(void)
 }
 
 
-void m68k_op_bcc_16(void)
+void m68k_op_bcc_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_CC())
 	{
@@ -4246,7 +4246,7 @@ void m68k_op_bcc_16(void)
 }
 
 
-void m68k_op_bcs_16(void)
+void m68k_op_bcs_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_CS())
 	{
@@ -4261,7 +4261,7 @@ void m68k_op_bcs_16(void)
 }
 
 
-void m68k_op_bne_16(void)
+void m68k_op_bne_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NE())
 	{
@@ -4276,7 +4276,7 @@ void m68k_op_bne_16(void)
 }
 
 
-void m68k_op_beq_16(void)
+void m68k_op_beq_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_EQ())
 	{
@@ -4291,7 +4291,7 @@ void m68k_op_beq_16(void)
 }
 
 
-void m68k_op_bvc_16(void)
+void m68k_op_bvc_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_VC())
 	{
@@ -4306,7 +4306,7 @@ void m68k_op_bvc_16(void)
 }
 
 
-void m68k_op_bvs_16(void)
+void m68k_op_bvs_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_VS())
 	{
@@ -4321,7 +4321,7 @@ void m68k_op_bvs_16(void)
 }
 
 
-void m68k_op_bpl_16(void)
+void m68k_op_bpl_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_PL())
 	{
@@ -4336,7 +4336,7 @@ void m68k_op_bpl_16(void)
 }
 
 
-void m68k_op_bmi_16(void)
+void m68k_op_bmi_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_MI())
 	{
@@ -4351,7 +4351,7 @@ void m68k_op_bmi_16(void)
 }
 
 
-void m68k_op_bge_16(void)
+void m68k_op_bge_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_GE())
 	{
@@ -4366,7 +4366,7 @@ void m68k_op_bge_16(void)
 }
 
 
-void m68k_op_blt_16(void)
+void m68k_op_blt_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_LT())
 	{
@@ -4381,7 +4381,7 @@ void m68k_op_blt_16(void)
 }
 
 
-void m68k_op_bgt_16(void)
+void m68k_op_bgt_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_GT())
 	{
@@ -4396,7 +4396,7 @@ void m68k_op_bgt_16(void)
 }
 
 
-void m68k_op_ble_16(void)
+void m68k_op_ble_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_LE())
 	{
@@ -4411,7 +4411,7 @@ void m68k_op_ble_16(void)
 }
 
 
-void m68k_op_bhi_32(void)
+void m68k_op_bhi_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4430,7 +4430,7 @@ void m68k_op_bhi_32(void)
 }
 
 
-void m68k_op_bls_32(void)
+void m68k_op_bls_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4449,7 +4449,7 @@ void m68k_op_bls_32(void)
 }
 
 
-void m68k_op_bcc_32(void)
+void m68k_op_bcc_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4468,7 +4468,7 @@ void m68k_op_bcc_32(void)
 }
 
 
-void m68k_op_bcs_32(void)
+void m68k_op_bcs_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4487,7 +4487,7 @@ void m68k_op_bcs_32(void)
 }
 
 
-void m68k_op_bne_32(void)
+void m68k_op_bne_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4506,7 +4506,7 @@ void m68k_op_bne_32(void)
 }
 
 
-void m68k_op_beq_32(void)
+void m68k_op_beq_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4525,7 +4525,7 @@ void m68k_op_beq_32(void)
 }
 
 
-void m68k_op_bvc_32(void)
+void m68k_op_bvc_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4544,7 +4544,7 @@ void m68k_op_bvc_32(void)
 }
 
 
-void m68k_op_bvs_32(void)
+void m68k_op_bvs_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4563,7 +4563,7 @@ void m68k_op_bvs_32(void)
 }
 
 
-void m68k_op_bpl_32(void)
+void m68k_op_bpl_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4582,7 +4582,7 @@ void m68k_op_bpl_32(void)
 }
 
 
-void m68k_op_bmi_32(void)
+void m68k_op_bmi_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4601,7 +4601,7 @@ void m68k_op_bmi_32(void)
 }
 
 
-void m68k_op_bge_32(void)
+void m68k_op_bge_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4620,7 +4620,7 @@ void m68k_op_bge_32(void)
 }
 
 
-void m68k_op_blt_32(void)
+void m68k_op_blt_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4639,7 +4639,7 @@ void m68k_op_blt_32(void)
 }
 
 
-void m68k_op_bgt_32(void)
+void m68k_op_bgt_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4658,7 +4658,7 @@ void m68k_op_bgt_32(void)
 }
 
 
-void m68k_op_ble_32(void)
+void m68k_op_ble_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4677,7 +4677,7 @@ void m68k_op_ble_32(void)
 }
 
 
-void m68k_op_bchg_32_r_d(void)
+void m68k_op_bchg_32_r_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (DX & 0x1f);
@@ -4687,7 +4687,7 @@ void m68k_op_bchg_32_r_d(void)
 }
 
 
-void m68k_op_bchg_8_r_ai(void)
+void m68k_op_bchg_8_r_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint src = m68ki_read_8(ea);
@@ -4698,7 +4698,7 @@ void m68k_op_bchg_8_r_ai(void)
 }
 
 
-void m68k_op_bchg_8_r_pi(void)
+void m68k_op_bchg_8_r_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -4709,7 +4709,7 @@ void m68k_op_bchg_8_r_pi(void)
 }
 
 
-void m68k_op_bchg_8_r_pi7(void)
+void m68k_op_bchg_8_r_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -4720,7 +4720,7 @@ void m68k_op_bchg_8_r_pi7(void)
 }
 
 
-void m68k_op_bchg_8_r_pd(void)
+void m68k_op_bchg_8_r_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -4731,7 +4731,7 @@ void m68k_op_bchg_8_r_pd(void)
 }
 
 
-void m68k_op_bchg_8_r_pd7(void)
+void m68k_op_bchg_8_r_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -4742,7 +4742,7 @@ void m68k_op_bchg_8_r_pd7(void)
 }
 
 
-void m68k_op_bchg_8_r_di(void)
+void m68k_op_bchg_8_r_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint src = m68ki_read_8(ea);
@@ -4753,7 +4753,7 @@ void m68k_op_bchg_8_r_di(void)
 }
 
 
-void m68k_op_bchg_8_r_ix(void)
+void m68k_op_bchg_8_r_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint src = m68ki_read_8(ea);
@@ -4764,7 +4764,7 @@ void m68k_op_bchg_8_r_ix(void)
 }
 
 
-void m68k_op_bchg_8_r_aw(void)
+void m68k_op_bchg_8_r_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint src = m68ki_read_8(ea);
@@ -4775,7 +4775,7 @@ void m68k_op_bchg_8_r_aw(void)
 }
 
 
-void m68k_op_bchg_8_r_al(void)
+void m68k_op_bchg_8_r_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint src = m68ki_read_8(ea);
@@ -4786,7 +4786,7 @@ void m68k_op_bchg_8_r_al(void)
 }
 
 
-void m68k_op_bchg_32_s_d(void)
+void m68k_op_bchg_32_s_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (OPER_I_8() & 0x1f);
@@ -4796,7 +4796,7 @@ void m68k_op_bchg_32_s_d(void)
 }
 
 
-void m68k_op_bchg_8_s_ai(void)
+void m68k_op_bchg_8_s_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_AI_8();
@@ -4807,7 +4807,7 @@ void m68k_op_bchg_8_s_ai(void)
 }
 
 
-void m68k_op_bchg_8_s_pi(void)
+void m68k_op_bchg_8_s_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PI_8();
@@ -4818,7 +4818,7 @@ void m68k_op_bchg_8_s_pi(void)
 }
 
 
-void m68k_op_bchg_8_s_pi7(void)
+void m68k_op_bchg_8_s_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PI_8();
@@ -4829,7 +4829,7 @@ void m68k_op_bchg_8_s_pi7(void)
 }
 
 
-void m68k_op_bchg_8_s_pd(void)
+void m68k_op_bchg_8_s_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PD_8();
@@ -4840,7 +4840,7 @@ void m68k_op_bchg_8_s_pd(void)
 }
 
 
-void m68k_op_bchg_8_s_pd7(void)
+void m68k_op_bchg_8_s_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PD_8();
@@ -4851,7 +4851,7 @@ void m68k_op_bchg_8_s_pd7(void)
 }
 
 
-void m68k_op_bchg_8_s_di(void)
+void m68k_op_bchg_8_s_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_DI_8();
@@ -4862,7 +4862,7 @@ void m68k_op_bchg_8_s_di(void)
 }
 
 
-void m68k_op_bchg_8_s_ix(void)
+void m68k_op_bchg_8_s_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_IX_8();
@@ -4873,7 +4873,7 @@ void m68k_op_bchg_8_s_ix(void)
 }
 
 
-void m68k_op_bchg_8_s_aw(void)
+void m68k_op_bchg_8_s_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AW_8();
@@ -4884,7 +4884,7 @@ void m68k_op_bchg_8_s_aw(void)
 }
 
 
-void m68k_op_bchg_8_s_al(void)
+void m68k_op_bchg_8_s_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AL_8();
@@ -4895,7 +4895,7 @@ void m68k_op_bchg_8_s_al(void)
 }
 
 
-void m68k_op_bclr_32_r_d(void)
+void m68k_op_bclr_32_r_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (DX & 0x1f);
@@ -4905,7 +4905,7 @@ void m68k_op_bclr_32_r_d(void)
 }
 
 
-void m68k_op_bclr_8_r_ai(void)
+void m68k_op_bclr_8_r_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint src = m68ki_read_8(ea);
@@ -4916,7 +4916,7 @@ void m68k_op_bclr_8_r_ai(void)
 }
 
 
-void m68k_op_bclr_8_r_pi(void)
+void m68k_op_bclr_8_r_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -4927,7 +4927,7 @@ void m68k_op_bclr_8_r_pi(void)
 }
 
 
-void m68k_op_bclr_8_r_pi7(void)
+void m68k_op_bclr_8_r_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -4938,7 +4938,7 @@ void m68k_op_bclr_8_r_pi7(void)
 }
 
 
-void m68k_op_bclr_8_r_pd(void)
+void m68k_op_bclr_8_r_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -4949,7 +4949,7 @@ void m68k_op_bclr_8_r_pd(void)
 }
 
 
-void m68k_op_bclr_8_r_pd7(void)
+void m68k_op_bclr_8_r_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -4960,7 +4960,7 @@ void m68k_op_bclr_8_r_pd7(void)
 }
 
 
-void m68k_op_bclr_8_r_di(void)
+void m68k_op_bclr_8_r_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint src = m68ki_read_8(ea);
@@ -4971,7 +4971,7 @@ void m68k_op_bclr_8_r_di(void)
 }
 
 
-void m68k_op_bclr_8_r_ix(void)
+void m68k_op_bclr_8_r_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint src = m68ki_read_8(ea);
@@ -4982,7 +4982,7 @@ void m68k_op_bclr_8_r_ix(void)
 }
 
 
-void m68k_op_bclr_8_r_aw(void)
+void m68k_op_bclr_8_r_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint src = m68ki_read_8(ea);
@@ -4993,7 +4993,7 @@ void m68k_op_bclr_8_r_aw(void)
 }
 
 
-void m68k_op_bclr_8_r_al(void)
+void m68k_op_bclr_8_r_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint src = m68ki_read_8(ea);
@@ -5004,7 +5004,7 @@ void m68k_op_bclr_8_r_al(void)
 }
 
 
-void m68k_op_bclr_32_s_d(void)
+void m68k_op_bclr_32_s_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (OPER_I_8() & 0x1f);
@@ -5014,7 +5014,7 @@ void m68k_op_bclr_32_s_d(void)
 }
 
 
-void m68k_op_bclr_8_s_ai(void)
+void m68k_op_bclr_8_s_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_AI_8();
@@ -5025,7 +5025,7 @@ void m68k_op_bclr_8_s_ai(void)
 }
 
 
-void m68k_op_bclr_8_s_pi(void)
+void m68k_op_bclr_8_s_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PI_8();
@@ -5036,7 +5036,7 @@ void m68k_op_bclr_8_s_pi(void)
 }
 
 
-void m68k_op_bclr_8_s_pi7(void)
+void m68k_op_bclr_8_s_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PI_8();
@@ -5047,7 +5047,7 @@ void m68k_op_bclr_8_s_pi7(void)
 }
 
 
-void m68k_op_bclr_8_s_pd(void)
+void m68k_op_bclr_8_s_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PD_8();
@@ -5058,7 +5058,7 @@ void m68k_op_bclr_8_s_pd(void)
 }
 
 
-void m68k_op_bclr_8_s_pd7(void)
+void m68k_op_bclr_8_s_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PD_8();
@@ -5069,7 +5069,7 @@ void m68k_op_bclr_8_s_pd7(void)
 }
 
 
-void m68k_op_bclr_8_s_di(void)
+void m68k_op_bclr_8_s_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_DI_8();
@@ -5080,7 +5080,7 @@ void m68k_op_bclr_8_s_di(void)
 }
 
 
-void m68k_op_bclr_8_s_ix(void)
+void m68k_op_bclr_8_s_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_IX_8();
@@ -5091,7 +5091,7 @@ void m68k_op_bclr_8_s_ix(void)
 }
 
 
-void m68k_op_bclr_8_s_aw(void)
+void m68k_op_bclr_8_s_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AW_8();
@@ -5102,7 +5102,7 @@ void m68k_op_bclr_8_s_aw(void)
 }
 
 
-void m68k_op_bclr_8_s_al(void)
+void m68k_op_bclr_8_s_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AL_8();
@@ -5113,7 +5113,7 @@ void m68k_op_bclr_8_s_al(void)
 }
 
 
-void m68k_op_bfchg_32_d(void)
+void m68k_op_bfchg_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5148,7 +5148,7 @@ void m68k_op_bfchg_32_d(void)
 }
 
 
-void m68k_op_bfchg_32_ai(void)
+void m68k_op_bfchg_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5202,7 +5202,7 @@ void m68k_op_bfchg_32_ai(void)
 }
 
 
-void m68k_op_bfchg_32_di(void)
+void m68k_op_bfchg_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5256,7 +5256,7 @@ void m68k_op_bfchg_32_di(void)
 }
 
 
-void m68k_op_bfchg_32_ix(void)
+void m68k_op_bfchg_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5310,7 +5310,7 @@ void m68k_op_bfchg_32_ix(void)
 }
 
 
-void m68k_op_bfchg_32_aw(void)
+void m68k_op_bfchg_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5364,7 +5364,7 @@ void m68k_op_bfchg_32_aw(void)
 }
 
 
-void m68k_op_bfchg_32_al(void)
+void m68k_op_bfchg_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5418,7 +5418,7 @@ void m68k_op_bfchg_32_al(void)
 }
 
 
-void m68k_op_bfclr_32_d(void)
+void m68k_op_bfclr_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5455,7 +5455,7 @@ void m68k_op_bfclr_32_d(void)
 }
 
 
-void m68k_op_bfclr_32_ai(void)
+void m68k_op_bfclr_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5509,7 +5509,7 @@ void m68k_op_bfclr_32_ai(void)
 }
 
 
-void m68k_op_bfclr_32_di(void)
+void m68k_op_bfclr_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5563,7 +5563,7 @@ void m68k_op_bfclr_32_di(void)
 }
 
 
-void m68k_op_bfclr_32_ix(void)
+void m68k_op_bfclr_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5617,7 +5617,7 @@ void m68k_op_bfclr_32_ix(void)
 }
 
 
-void m68k_op_bfclr_32_aw(void)
+void m68k_op_bfclr_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5671,7 +5671,7 @@ void m68k_op_bfclr_32_aw(void)
 }
 
 
-void m68k_op_bfclr_32_al(void)
+void m68k_op_bfclr_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5725,7 +5725,7 @@ void m68k_op_bfclr_32_al(void)
 }
 
 
-void m68k_op_bfexts_32_d(void)
+void m68k_op_bfexts_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5759,7 +5759,7 @@ void m68k_op_bfexts_32_d(void)
 }
 
 
-void m68k_op_bfexts_32_ai(void)
+void m68k_op_bfexts_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5807,7 +5807,7 @@ void m68k_op_bfexts_32_ai(void)
 }
 
 
-void m68k_op_bfexts_32_di(void)
+void m68k_op_bfexts_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5855,7 +5855,7 @@ void m68k_op_bfexts_32_di(void)
 }
 
 
-void m68k_op_bfexts_32_ix(void)
+void m68k_op_bfexts_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5903,7 +5903,7 @@ void m68k_op_bfexts_32_ix(void)
 }
 
 
-void m68k_op_bfexts_32_aw(void)
+void m68k_op_bfexts_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5951,7 +5951,7 @@ void m68k_op_bfexts_32_aw(void)
 }
 
 
-void m68k_op_bfexts_32_al(void)
+void m68k_op_bfexts_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -5999,7 +5999,7 @@ void m68k_op_bfexts_32_al(void)
 }
 
 
-void m68k_op_bfexts_32_pcdi(void)
+void m68k_op_bfexts_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6047,7 +6047,7 @@ void m68k_op_bfexts_32_pcdi(void)
 }
 
 
-void m68k_op_bfexts_32_pcix(void)
+void m68k_op_bfexts_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6095,7 +6095,7 @@ void m68k_op_bfexts_32_pcix(void)
 }
 
 
-void m68k_op_bfextu_32_d(void)
+void m68k_op_bfextu_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6129,7 +6129,7 @@ void m68k_op_bfextu_32_d(void)
 }
 
 
-void m68k_op_bfextu_32_ai(void)
+void m68k_op_bfextu_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6176,7 +6176,7 @@ void m68k_op_bfextu_32_ai(void)
 }
 
 
-void m68k_op_bfextu_32_di(void)
+void m68k_op_bfextu_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6223,7 +6223,7 @@ void m68k_op_bfextu_32_di(void)
 }
 
 
-void m68k_op_bfextu_32_ix(void)
+void m68k_op_bfextu_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6270,7 +6270,7 @@ void m68k_op_bfextu_32_ix(void)
 }
 
 
-void m68k_op_bfextu_32_aw(void)
+void m68k_op_bfextu_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6317,7 +6317,7 @@ void m68k_op_bfextu_32_aw(void)
 }
 
 
-void m68k_op_bfextu_32_al(void)
+void m68k_op_bfextu_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6364,7 +6364,7 @@ void m68k_op_bfextu_32_al(void)
 }
 
 
-void m68k_op_bfextu_32_pcdi(void)
+void m68k_op_bfextu_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6411,7 +6411,7 @@ void m68k_op_bfextu_32_pcdi(void)
 }
 
 
-void m68k_op_bfextu_32_pcix(void)
+void m68k_op_bfextu_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6458,7 +6458,7 @@ void m68k_op_bfextu_32_pcix(void)
 }
 
 
-void m68k_op_bfffo_32_d(void)
+void m68k_op_bfffo_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6496,7 +6496,7 @@ void m68k_op_bfffo_32_d(void)
 }
 
 
-void m68k_op_bfffo_32_ai(void)
+void m68k_op_bfffo_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6548,7 +6548,7 @@ void m68k_op_bfffo_32_ai(void)
 }
 
 
-void m68k_op_bfffo_32_di(void)
+void m68k_op_bfffo_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6600,7 +6600,7 @@ void m68k_op_bfffo_32_di(void)
 }
 
 
-void m68k_op_bfffo_32_ix(void)
+void m68k_op_bfffo_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6652,7 +6652,7 @@ void m68k_op_bfffo_32_ix(void)
 }
 
 
-void m68k_op_bfffo_32_aw(void)
+void m68k_op_bfffo_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6704,7 +6704,7 @@ void m68k_op_bfffo_32_aw(void)
 }
 
 
-void m68k_op_bfffo_32_al(void)
+void m68k_op_bfffo_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6756,7 +6756,7 @@ void m68k_op_bfffo_32_al(void)
 }
 
 
-void m68k_op_bfffo_32_pcdi(void)
+void m68k_op_bfffo_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6808,7 +6808,7 @@ void m68k_op_bfffo_32_pcdi(void)
 }
 
 
-void m68k_op_bfffo_32_pcix(void)
+void m68k_op_bfffo_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6860,7 +6860,7 @@ void m68k_op_bfffo_32_pcix(void)
 }
 
 
-void m68k_op_bfins_32_d(void)
+void m68k_op_bfins_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6902,7 +6902,7 @@ void m68k_op_bfins_32_d(void)
 }
 
 
-void m68k_op_bfins_32_ai(void)
+void m68k_op_bfins_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -6963,7 +6963,7 @@ void m68k_op_bfins_32_ai(void)
 }
 
 
-void m68k_op_bfins_32_di(void)
+void m68k_op_bfins_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7024,7 +7024,7 @@ void m68k_op_bfins_32_di(void)
 }
 
 
-void m68k_op_bfins_32_ix(void)
+void m68k_op_bfins_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7085,7 +7085,7 @@ void m68k_op_bfins_32_ix(void)
 }
 
 
-void m68k_op_bfins_32_aw(void)
+void m68k_op_bfins_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7146,7 +7146,7 @@ void m68k_op_bfins_32_aw(void)
 }
 
 
-void m68k_op_bfins_32_al(void)
+void m68k_op_bfins_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7207,7 +7207,7 @@ void m68k_op_bfins_32_al(void)
 }
 
 
-void m68k_op_bfset_32_d(void)
+void m68k_op_bfset_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7244,7 +7244,7 @@ void m68k_op_bfset_32_d(void)
 }
 
 
-void m68k_op_bfset_32_ai(void)
+void m68k_op_bfset_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7299,7 +7299,7 @@ void m68k_op_bfset_32_ai(void)
 }
 
 
-void m68k_op_bfset_32_di(void)
+void m68k_op_bfset_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7354,7 +7354,7 @@ void m68k_op_bfset_32_di(void)
 }
 
 
-void m68k_op_bfset_32_ix(void)
+void m68k_op_bfset_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7409,7 +7409,7 @@ void m68k_op_bfset_32_ix(void)
 }
 
 
-void m68k_op_bfset_32_aw(void)
+void m68k_op_bfset_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7464,7 +7464,7 @@ void m68k_op_bfset_32_aw(void)
 }
 
 
-void m68k_op_bfset_32_al(void)
+void m68k_op_bfset_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7519,7 +7519,7 @@ void m68k_op_bfset_32_al(void)
 }
 
 
-void m68k_op_bftst_32_d(void)
+void m68k_op_bftst_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7554,7 +7554,7 @@ void m68k_op_bftst_32_d(void)
 }
 
 
-void m68k_op_bftst_32_ai(void)
+void m68k_op_bftst_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7605,7 +7605,7 @@ void m68k_op_bftst_32_ai(void)
 }
 
 
-void m68k_op_bftst_32_di(void)
+void m68k_op_bftst_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7656,7 +7656,7 @@ void m68k_op_bftst_32_di(void)
 }
 
 
-void m68k_op_bftst_32_ix(void)
+void m68k_op_bftst_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7707,7 +7707,7 @@ void m68k_op_bftst_32_ix(void)
 }
 
 
-void m68k_op_bftst_32_aw(void)
+void m68k_op_bftst_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7758,7 +7758,7 @@ void m68k_op_bftst_32_aw(void)
 }
 
 
-void m68k_op_bftst_32_al(void)
+void m68k_op_bftst_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7809,7 +7809,7 @@ void m68k_op_bftst_32_al(void)
 }
 
 
-void m68k_op_bftst_32_pcdi(void)
+void m68k_op_bftst_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7860,7 +7860,7 @@ void m68k_op_bftst_32_pcdi(void)
 }
 
 
-void m68k_op_bftst_32_pcix(void)
+void m68k_op_bftst_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7911,7 +7911,7 @@ void m68k_op_bftst_32_pcix(void)
 }
 
 
-void m68k_op_bkpt(void)
+void m68k_op_bkpt(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -7921,7 +7921,7 @@ void m68k_op_bkpt(void)
 }
 
 
-void m68k_op_bra_8(void)
+void m68k_op_bra_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 	m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
@@ -7930,7 +7930,7 @@ void m68k_op_bra_8(void)
 }
 
 
-void m68k_op_bra_16(void)
+void m68k_op_bra_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint offset = OPER_I_16();
 	REG_PC -= 2;
@@ -7941,7 +7941,7 @@ void m68k_op_bra_16(void)
 }
 
 
-void m68k_op_bra_32(void)
+void m68k_op_bra_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7957,7 +7957,7 @@ void m68k_op_bra_32(void)
 }
 
 
-void m68k_op_bset_32_r_d(void)
+void m68k_op_bset_32_r_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (DX & 0x1f);
@@ -7967,7 +7967,7 @@ void m68k_op_bset_32_r_d(void)
 }
 
 
-void m68k_op_bset_8_r_ai(void)
+void m68k_op_bset_8_r_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint src = m68ki_read_8(ea);
@@ -7978,7 +7978,7 @@ void m68k_op_bset_8_r_ai(void)
 }
 
 
-void m68k_op_bset_8_r_pi(void)
+void m68k_op_bset_8_r_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -7989,7 +7989,7 @@ void m68k_op_bset_8_r_pi(void)
 }
 
 
-void m68k_op_bset_8_r_pi7(void)
+void m68k_op_bset_8_r_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -8000,7 +8000,7 @@ void m68k_op_bset_8_r_pi7(void)
 }
 
 
-void m68k_op_bset_8_r_pd(void)
+void m68k_op_bset_8_r_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -8011,7 +8011,7 @@ void m68k_op_bset_8_r_pd(void)
 }
 
 
-void m68k_op_bset_8_r_pd7(void)
+void m68k_op_bset_8_r_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -8022,7 +8022,7 @@ void m68k_op_bset_8_r_pd7(void)
 }
 
 
-void m68k_op_bset_8_r_di(void)
+void m68k_op_bset_8_r_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint src = m68ki_read_8(ea);
@@ -8033,7 +8033,7 @@ void m68k_op_bset_8_r_di(void)
 }
 
 
-void m68k_op_bset_8_r_ix(void)
+void m68k_op_bset_8_r_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint src = m68ki_read_8(ea);
@@ -8044,7 +8044,7 @@ void m68k_op_bset_8_r_ix(void)
 }
 
 
-void m68k_op_bset_8_r_aw(void)
+void m68k_op_bset_8_r_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint src = m68ki_read_8(ea);
@@ -8055,7 +8055,7 @@ void m68k_op_bset_8_r_aw(void)
 }
 
 
-void m68k_op_bset_8_r_al(void)
+void m68k_op_bset_8_r_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint src = m68ki_read_8(ea);
@@ -8066,7 +8066,7 @@ void m68k_op_bset_8_r_al(void)
 }
 
 
-void m68k_op_bset_32_s_d(void)
+void m68k_op_bset_32_s_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint mask = 1 << (OPER_I_8() & 0x1f);
@@ -8076,7 +8076,7 @@ void m68k_op_bset_32_s_d(void)
 }
 
 
-void m68k_op_bset_8_s_ai(void)
+void m68k_op_bset_8_s_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_AI_8();
@@ -8087,7 +8087,7 @@ void m68k_op_bset_8_s_ai(void)
 }
 
 
-void m68k_op_bset_8_s_pi(void)
+void m68k_op_bset_8_s_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PI_8();
@@ -8098,7 +8098,7 @@ void m68k_op_bset_8_s_pi(void)
 }
 
 
-void m68k_op_bset_8_s_pi7(void)
+void m68k_op_bset_8_s_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PI_8();
@@ -8109,7 +8109,7 @@ void m68k_op_bset_8_s_pi7(void)
 }
 
 
-void m68k_op_bset_8_s_pd(void)
+void m68k_op_bset_8_s_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_PD_8();
@@ -8120,7 +8120,7 @@ void m68k_op_bset_8_s_pd(void)
 }
 
 
-void m68k_op_bset_8_s_pd7(void)
+void m68k_op_bset_8_s_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_A7_PD_8();
@@ -8131,7 +8131,7 @@ void m68k_op_bset_8_s_pd7(void)
 }
 
 
-void m68k_op_bset_8_s_di(void)
+void m68k_op_bset_8_s_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_DI_8();
@@ -8142,7 +8142,7 @@ void m68k_op_bset_8_s_di(void)
 }
 
 
-void m68k_op_bset_8_s_ix(void)
+void m68k_op_bset_8_s_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AY_IX_8();
@@ -8153,7 +8153,7 @@ void m68k_op_bset_8_s_ix(void)
 }
 
 
-void m68k_op_bset_8_s_aw(void)
+void m68k_op_bset_8_s_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AW_8();
@@ -8164,7 +8164,7 @@ void m68k_op_bset_8_s_aw(void)
 }
 
 
-void m68k_op_bset_8_s_al(void)
+void m68k_op_bset_8_s_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint mask = 1 << (OPER_I_8() & 7);
 	uint ea = EA_AL_8();
@@ -8175,7 +8175,7 @@ void m68k_op_bset_8_s_al(void)
 }
 
 
-void m68k_op_bsr_8(void)
+void m68k_op_bsr_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 	m68ki_push_32(REG_PC);
@@ -8183,7 +8183,7 @@ void m68k_op_bsr_8(void)
 }
 
 
-void m68k_op_bsr_16(void)
+void m68k_op_bsr_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint offset = OPER_I_16();
 	m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -8193,7 +8193,7 @@ void m68k_op_bsr_16(void)
 }
 
 
-void m68k_op_bsr_32(void)
+void m68k_op_bsr_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8208,91 +8208,91 @@ void m68k_op_bsr_32(void)
 }
 
 
-void m68k_op_btst_32_r_d(void)
+void m68k_op_btst_32_r_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DY & (1 << (DX & 0x1f));
 }
 
 
-void m68k_op_btst_8_r_ai(void)
+void m68k_op_btst_8_r_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_AY_AI_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pi(void)
+void m68k_op_btst_8_r_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_AY_PI_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pi7(void)
+void m68k_op_btst_8_r_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_A7_PI_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pd(void)
+void m68k_op_btst_8_r_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_AY_PD_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pd7(void)
+void m68k_op_btst_8_r_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_A7_PD_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_di(void)
+void m68k_op_btst_8_r_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_AY_DI_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_ix(void)
+void m68k_op_btst_8_r_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_AY_IX_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_aw(void)
+void m68k_op_btst_8_r_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_AW_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_al(void)
+void m68k_op_btst_8_r_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_AL_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pcdi(void)
+void m68k_op_btst_8_r_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_PCDI_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_pcix(void)
+void m68k_op_btst_8_r_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_PCIX_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_8_r_i(void)
+void m68k_op_btst_8_r_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = OPER_I_8() & (1 << (DX & 7));
 }
 
 
-void m68k_op_btst_32_s_d(void)
+void m68k_op_btst_32_s_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	FLAG_Z = DY & (1 << (OPER_I_8() & 0x1f));
 }
 
 
-void m68k_op_btst_8_s_ai(void)
+void m68k_op_btst_8_s_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint bit = OPER_I_8() & 7;
 
@@ -8300,7 +8300,7 @@ void m68k_op_btst_8_s_ai(void)
 }
 
 
-void m68k_op_btst_8_s_pi(void)
+void m68k_op_btst_8_s_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint bit = OPER_I_8() & 7;
 
@@ -8308,7 +8308,7 @@ void m68k_op_btst_8_s_pi(void)
 }
 
 
-void m68k_op_btst_8_s_pi7(void)
+void m68k_op_btst_8_s_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint bit = OPER_I_8() & 7;
 
@@ -8316,7 +8316,7 @@ void m68k_op_btst_8_s_pi7(void)
 }
 
 
-void m68k_op_btst_8_s_pd(void)
+void m68k_op_btst_8_s_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint bit = OPER_I_8() & 7;
 
@@ -8324,7 +8324,7 @@ void m68k_op_btst_8_s_pd(void)
 }
 
 
-void m68k_op_btst_8_s_pd7(void)
+void m68k_op_btst_8_s_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint bit = OPER_I_8() & 7;
 
@@ -8332,7 +8332,7 @@ void m68k_op_btst_8_s_pd7(void)
 }
 
 
-void m68k_op_btst_8_s_di(void)
+void m68k_op_btst_8_s_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint bit = OPER_I_8() & 7;
 
@@ -8340,7 +8340,7 @@ void m68k_op_btst_8_s_di(void)
 }
 
 
-void m68k_op_btst_8_s_ix(void)
+void m68k_op_btst_8_s_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint bit = OPER_I_8() & 7;
 
@@ -8348,7 +8348,7 @@ void m68k_op_btst_8_s_ix(void)
 }
 
 
-void m68k_op_btst_8_s_aw(void)
+void m68k_op_btst_8_s_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint bit = OPER_I_8() & 7;
 
@@ -8356,7 +8356,7 @@ void m68k_op_btst_8_s_aw(void)
 }
 
 
-void m68k_op_btst_8_s_al(void)
+void m68k_op_btst_8_s_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint bit = OPER_I_8() & 7;
 
@@ -8364,7 +8364,7 @@ void m68k_op_btst_8_s_al(void)
 }
 
 
-void m68k_op_btst_8_s_pcdi(void)
+void m68k_op_btst_8_s_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint bit = OPER_I_8() & 7;
 
@@ -8372,7 +8372,7 @@ void m68k_op_btst_8_s_pcdi(void)
 }
 
 
-void m68k_op_btst_8_s_pcix(void)
+void m68k_op_btst_8_s_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint bit = OPER_I_8() & 7;
 
@@ -8380,7 +8380,7 @@ void m68k_op_btst_8_s_pcix(void)
 }
 
 
-void m68k_op_callm_32_ai(void)
+void m68k_op_callm_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8399,7 +8399,7 @@ void m68k_op_callm_32_ai(void)
 }
 
 
-void m68k_op_callm_32_di(void)
+void m68k_op_callm_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8418,7 +8418,7 @@ void m68k_op_callm_32_di(void)
 }
 
 
-void m68k_op_callm_32_ix(void)
+void m68k_op_callm_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8437,7 +8437,7 @@ void m68k_op_callm_32_ix(void)
 }
 
 
-void m68k_op_callm_32_aw(void)
+void m68k_op_callm_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8456,7 +8456,7 @@ void m68k_op_callm_32_aw(void)
 }
 
 
-void m68k_op_callm_32_al(void)
+void m68k_op_callm_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8475,7 +8475,7 @@ void m68k_op_callm_32_al(void)
 }
 
 
-void m68k_op_callm_32_pcdi(void)
+void m68k_op_callm_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8494,7 +8494,7 @@ void m68k_op_callm_32_pcdi(void)
 }
 
 
-void m68k_op_callm_32_pcix(void)
+void m68k_op_callm_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	/* note: watch out for pcrelative modes */
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
@@ -8513,7 +8513,7 @@ void m68k_op_callm_32_pcix(void)
 }
 
 
-void m68k_op_cas_8_ai(void)
+void m68k_op_cas_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8542,7 +8542,7 @@ void m68k_op_cas_8_ai(void)
 }
 
 
-void m68k_op_cas_8_pi(void)
+void m68k_op_cas_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8571,7 +8571,7 @@ void m68k_op_cas_8_pi(void)
 }
 
 
-void m68k_op_cas_8_pi7(void)
+void m68k_op_cas_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8600,7 +8600,7 @@ void m68k_op_cas_8_pi7(void)
 }
 
 
-void m68k_op_cas_8_pd(void)
+void m68k_op_cas_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8629,7 +8629,7 @@ void m68k_op_cas_8_pd(void)
 }
 
 
-void m68k_op_cas_8_pd7(void)
+void m68k_op_cas_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8658,7 +8658,7 @@ void m68k_op_cas_8_pd7(void)
 }
 
 
-void m68k_op_cas_8_di(void)
+void m68k_op_cas_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8687,7 +8687,7 @@ void m68k_op_cas_8_di(void)
 }
 
 
-void m68k_op_cas_8_ix(void)
+void m68k_op_cas_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8716,7 +8716,7 @@ void m68k_op_cas_8_ix(void)
 }
 
 
-void m68k_op_cas_8_aw(void)
+void m68k_op_cas_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8745,7 +8745,7 @@ void m68k_op_cas_8_aw(void)
 }
 
 
-void m68k_op_cas_8_al(void)
+void m68k_op_cas_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8774,7 +8774,7 @@ void m68k_op_cas_8_al(void)
 }
 
 
-void m68k_op_cas_16_ai(void)
+void m68k_op_cas_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8803,7 +8803,7 @@ void m68k_op_cas_16_ai(void)
 }
 
 
-void m68k_op_cas_16_pi(void)
+void m68k_op_cas_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8832,7 +8832,7 @@ void m68k_op_cas_16_pi(void)
 }
 
 
-void m68k_op_cas_16_pd(void)
+void m68k_op_cas_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8861,7 +8861,7 @@ void m68k_op_cas_16_pd(void)
 }
 
 
-void m68k_op_cas_16_di(void)
+void m68k_op_cas_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8890,7 +8890,7 @@ void m68k_op_cas_16_di(void)
 }
 
 
-void m68k_op_cas_16_ix(void)
+void m68k_op_cas_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8919,7 +8919,7 @@ void m68k_op_cas_16_ix(void)
 }
 
 
-void m68k_op_cas_16_aw(void)
+void m68k_op_cas_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8948,7 +8948,7 @@ void m68k_op_cas_16_aw(void)
 }
 
 
-void m68k_op_cas_16_al(void)
+void m68k_op_cas_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8977,7 +8977,7 @@ void m68k_op_cas_16_al(void)
 }
 
 
-void m68k_op_cas_32_ai(void)
+void m68k_op_cas_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9006,7 +9006,7 @@ void m68k_op_cas_32_ai(void)
 }
 
 
-void m68k_op_cas_32_pi(void)
+void m68k_op_cas_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9035,7 +9035,7 @@ void m68k_op_cas_32_pi(void)
 }
 
 
-void m68k_op_cas_32_pd(void)
+void m68k_op_cas_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9064,7 +9064,7 @@ void m68k_op_cas_32_pd(void)
 }
 
 
-void m68k_op_cas_32_di(void)
+void m68k_op_cas_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9093,7 +9093,7 @@ void m68k_op_cas_32_di(void)
 }
 
 
-void m68k_op_cas_32_ix(void)
+void m68k_op_cas_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9122,7 +9122,7 @@ void m68k_op_cas_32_ix(void)
 }
 
 
-void m68k_op_cas_32_aw(void)
+void m68k_op_cas_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9151,7 +9151,7 @@ void m68k_op_cas_32_aw(void)
 }
 
 
-void m68k_op_cas_32_al(void)
+void m68k_op_cas_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9180,7 +9180,7 @@ void m68k_op_cas_32_al(void)
 }
 
 
-void m68k_op_cas2_16(void)
+void m68k_op_cas2_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9225,7 +9225,7 @@ void m68k_op_cas2_16(void)
 }
 
 
-void m68k_op_cas2_32(void)
+void m68k_op_cas2_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9270,7 +9270,7 @@ void m68k_op_cas2_32(void)
 }
 
 
-void m68k_op_chk_16_d(void)
+void m68k_op_chk_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(DY);
@@ -9288,7 +9288,7 @@ void m68k_op_chk_16_d(void)
 }
 
 
-void m68k_op_chk_16_ai(void)
+void m68k_op_chk_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AY_AI_16());
@@ -9306,7 +9306,7 @@ void m68k_op_chk_16_ai(void)
 }
 
 
-void m68k_op_chk_16_pi(void)
+void m68k_op_chk_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AY_PI_16());
@@ -9324,7 +9324,7 @@ void m68k_op_chk_16_pi(void)
 }
 
 
-void m68k_op_chk_16_pd(void)
+void m68k_op_chk_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AY_PD_16());
@@ -9342,7 +9342,7 @@ void m68k_op_chk_16_pd(void)
 }
 
 
-void m68k_op_chk_16_di(void)
+void m68k_op_chk_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AY_DI_16());
@@ -9360,7 +9360,7 @@ void m68k_op_chk_16_di(void)
 }
 
 
-void m68k_op_chk_16_ix(void)
+void m68k_op_chk_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AY_IX_16());
@@ -9378,7 +9378,7 @@ void m68k_op_chk_16_ix(void)
 }
 
 
-void m68k_op_chk_16_aw(void)
+void m68k_op_chk_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AW_16());
@@ -9396,7 +9396,7 @@ void m68k_op_chk_16_aw(void)
 }
 
 
-void m68k_op_chk_16_al(void)
+void m68k_op_chk_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AL_16());
@@ -9414,7 +9414,7 @@ void m68k_op_chk_16_al(void)
 }
 
 
-void m68k_op_chk_16_pcdi(void)
+void m68k_op_chk_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_PCDI_16());
@@ -9432,7 +9432,7 @@ void m68k_op_chk_16_pcdi(void)
 }
 
 
-void m68k_op_chk_16_pcix(void)
+void m68k_op_chk_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_PCIX_16());
@@ -9450,7 +9450,7 @@ void m68k_op_chk_16_pcix(void)
 }
 
 
-void m68k_op_chk_16_i(void)
+void m68k_op_chk_16_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_I_16());
@@ -9468,7 +9468,7 @@ void m68k_op_chk_16_i(void)
 }
 
 
-void m68k_op_chk_32_d(void)
+void m68k_op_chk_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9491,7 +9491,7 @@ void m68k_op_chk_32_d(void)
 }
 
 
-void m68k_op_chk_32_ai(void)
+void m68k_op_chk_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9514,7 +9514,7 @@ void m68k_op_chk_32_ai(void)
 }
 
 
-void m68k_op_chk_32_pi(void)
+void m68k_op_chk_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9537,7 +9537,7 @@ void m68k_op_chk_32_pi(void)
 }
 
 
-void m68k_op_chk_32_pd(void)
+void m68k_op_chk_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9560,7 +9560,7 @@ void m68k_op_chk_32_pd(void)
 }
 
 
-void m68k_op_chk_32_di(void)
+void m68k_op_chk_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9583,7 +9583,7 @@ void m68k_op_chk_32_di(void)
 }
 
 
-void m68k_op_chk_32_ix(void)
+void m68k_op_chk_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9606,7 +9606,7 @@ void m68k_op_chk_32_ix(void)
 }
 
 
-void m68k_op_chk_32_aw(void)
+void m68k_op_chk_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9629,7 +9629,7 @@ void m68k_op_chk_32_aw(void)
 }
 
 
-void m68k_op_chk_32_al(void)
+void m68k_op_chk_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9652,7 +9652,7 @@ void m68k_op_chk_32_al(void)
 }
 
 
-void m68k_op_chk_32_pcdi(void)
+void m68k_op_chk_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9675,7 +9675,7 @@ void m68k_op_chk_32_pcdi(void)
 }
 
 
-void m68k_op_chk_32_pcix(void)
+void m68k_op_chk_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9698,7 +9698,7 @@ void m68k_op_chk_32_pcix(void)
 }
 
 
-void m68k_op_chk_32_i(void)
+void m68k_op_chk_32_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9721,7 +9721,7 @@ void m68k_op_chk_32_i(void)
 }
 
 
-void m68k_op_chk2cmp2_8_pcdi(void)
+void m68k_op_chk2cmp2_8_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9746,7 +9746,7 @@ void m68k_op_chk2cmp2_8_pcdi(void)
 }
 
 
-void m68k_op_chk2cmp2_8_pcix(void)
+void m68k_op_chk2cmp2_8_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9770,7 +9770,7 @@ void m68k_op_chk2cmp2_8_pcix(void)
 }
 
 
-void m68k_op_chk2cmp2_8_ai(void)
+void m68k_op_chk2cmp2_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9795,7 +9795,7 @@ void m68k_op_chk2cmp2_8_ai(void)
 }
 
 
-void m68k_op_chk2cmp2_8_di(void)
+void m68k_op_chk2cmp2_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9820,7 +9820,7 @@ void m68k_op_chk2cmp2_8_di(void)
 }
 
 
-void m68k_op_chk2cmp2_8_ix(void)
+void m68k_op_chk2cmp2_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9845,7 +9845,7 @@ void m68k_op_chk2cmp2_8_ix(void)
 }
 
 
-void m68k_op_chk2cmp2_8_aw(void)
+void m68k_op_chk2cmp2_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9870,7 +9870,7 @@ void m68k_op_chk2cmp2_8_aw(void)
 }
 
 
-void m68k_op_chk2cmp2_8_al(void)
+void m68k_op_chk2cmp2_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9895,7 +9895,7 @@ void m68k_op_chk2cmp2_8_al(void)
 }
 
 
-void m68k_op_chk2cmp2_16_pcdi(void)
+void m68k_op_chk2cmp2_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9919,7 +9919,7 @@ void m68k_op_chk2cmp2_16_pcdi(void)
 }
 
 
-void m68k_op_chk2cmp2_16_pcix(void)
+void m68k_op_chk2cmp2_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9943,7 +9943,7 @@ void m68k_op_chk2cmp2_16_pcix(void)
 }
 
 
-void m68k_op_chk2cmp2_16_ai(void)
+void m68k_op_chk2cmp2_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9967,7 +9967,7 @@ void m68k_op_chk2cmp2_16_ai(void)
 }
 
 
-void m68k_op_chk2cmp2_16_di(void)
+void m68k_op_chk2cmp2_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -9991,7 +9991,7 @@ void m68k_op_chk2cmp2_16_di(void)
 }
 
 
-void m68k_op_chk2cmp2_16_ix(void)
+void m68k_op_chk2cmp2_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10015,7 +10015,7 @@ void m68k_op_chk2cmp2_16_ix(void)
 }
 
 
-void m68k_op_chk2cmp2_16_aw(void)
+void m68k_op_chk2cmp2_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10039,7 +10039,7 @@ void m68k_op_chk2cmp2_16_aw(void)
 }
 
 
-void m68k_op_chk2cmp2_16_al(void)
+void m68k_op_chk2cmp2_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10063,7 +10063,7 @@ void m68k_op_chk2cmp2_16_al(void)
 }
 
 
-void m68k_op_chk2cmp2_32_pcdi(void)
+void m68k_op_chk2cmp2_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10085,7 +10085,7 @@ void m68k_op_chk2cmp2_32_pcdi(void)
 }
 
 
-void m68k_op_chk2cmp2_32_pcix(void)
+void m68k_op_chk2cmp2_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10107,7 +10107,7 @@ void m68k_op_chk2cmp2_32_pcix(void)
 }
 
 
-void m68k_op_chk2cmp2_32_ai(void)
+void m68k_op_chk2cmp2_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10130,7 +10130,7 @@ void m68k_op_chk2cmp2_32_ai(void)
 }
 
 
-void m68k_op_chk2cmp2_32_di(void)
+void m68k_op_chk2cmp2_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10153,7 +10153,7 @@ void m68k_op_chk2cmp2_32_di(void)
 }
 
 
-void m68k_op_chk2cmp2_32_ix(void)
+void m68k_op_chk2cmp2_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10176,7 +10176,7 @@ void m68k_op_chk2cmp2_32_ix(void)
 }
 
 
-void m68k_op_chk2cmp2_32_aw(void)
+void m68k_op_chk2cmp2_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10199,7 +10199,7 @@ void m68k_op_chk2cmp2_32_aw(void)
 }
 
 
-void m68k_op_chk2cmp2_32_al(void)
+void m68k_op_chk2cmp2_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -10222,7 +10222,7 @@ void m68k_op_chk2cmp2_32_al(void)
 }
 
 
-void m68k_op_clr_8_d(void)
+void m68k_op_clr_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	DY &= 0xffffff00;
 
@@ -10233,7 +10233,7 @@ void m68k_op_clr_8_d(void)
 }
 
 
-void m68k_op_clr_8_ai(void)
+void m68k_op_clr_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), 0);
 
@@ -10244,7 +10244,7 @@ void m68k_op_clr_8_ai(void)
 }
 
 
-void m68k_op_clr_8_pi(void)
+void m68k_op_clr_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), 0);
 
@@ -10255,7 +10255,7 @@ void m68k_op_clr_8_pi(void)
 }
 
 
-void m68k_op_clr_8_pi7(void)
+void m68k_op_clr_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), 0);
 
@@ -10266,7 +10266,7 @@ void m68k_op_clr_8_pi7(void)
 }
 
 
-void m68k_op_clr_8_pd(void)
+void m68k_op_clr_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), 0);
 
@@ -10277,7 +10277,7 @@ void m68k_op_clr_8_pd(void)
 }
 
 
-void m68k_op_clr_8_pd7(void)
+void m68k_op_clr_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), 0);
 
@@ -10288,7 +10288,7 @@ void m68k_op_clr_8_pd7(void)
 }
 
 
-void m68k_op_clr_8_di(void)
+void m68k_op_clr_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), 0);
 
@@ -10299,7 +10299,7 @@ void m68k_op_clr_8_di(void)
 }
 
 
-void m68k_op_clr_8_ix(void)
+void m68k_op_clr_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), 0);
 
@@ -10310,7 +10310,7 @@ void m68k_op_clr_8_ix(void)
 }
 
 
-void m68k_op_clr_8_aw(void)
+void m68k_op_clr_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), 0);
 
@@ -10321,7 +10321,7 @@ void m68k_op_clr_8_aw(void)
 }
 
 
-void m68k_op_clr_8_al(void)
+void m68k_op_clr_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), 0);
 
@@ -10332,7 +10332,7 @@ void m68k_op_clr_8_al(void)
 }
 
 
-void m68k_op_clr_16_d(void)
+void m68k_op_clr_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	DY &= 0xffff0000;
 
@@ -10343,7 +10343,7 @@ void m68k_op_clr_16_d(void)
 }
 
 
-void m68k_op_clr_16_ai(void)
+void m68k_op_clr_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_16(EA_AY_AI_16(), 0);
 
@@ -10354,7 +10354,7 @@ void m68k_op_clr_16_ai(void)
 }
 
 
-void m68k_op_clr_16_pi(void)
+void m68k_op_clr_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_16(EA_AY_PI_16(), 0);
 
@@ -10365,7 +10365,7 @@ void m68k_op_clr_16_pi(void)
 }
 
 
-void m68k_op_clr_16_pd(void)
+void m68k_op_clr_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_16(EA_AY_PD_16(), 0);
 
@@ -10376,7 +10376,7 @@ void m68k_op_clr_16_pd(void)
 }
 
 
-void m68k_op_clr_16_di(void)
+void m68k_op_clr_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_16(EA_AY_DI_16(), 0);
 
@@ -10387,7 +10387,7 @@ void m68k_op_clr_16_di(void)
 }
 
 
-void m68k_op_clr_16_ix(void)
+void m68k_op_clr_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_16(EA_AY_IX_16(), 0);
 
@@ -10398,7 +10398,7 @@ void m68k_op_clr_16_ix(void)
 }
 
 
-void m68k_op_clr_16_aw(void)
+void m68k_op_clr_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_16(EA_AW_16(), 0);
 
@@ -10409,7 +10409,7 @@ void m68k_op_clr_16_aw(void)
 }
 
 
-void m68k_op_clr_16_al(void)
+void m68k_op_clr_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_16(EA_AL_16(), 0);
 
@@ -10420,7 +10420,7 @@ void m68k_op_clr_16_al(void)
 }
 
 
-void m68k_op_clr_32_d(void)
+void m68k_op_clr_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	DY = 0;
 
@@ -10431,7 +10431,7 @@ void m68k_op_clr_32_d(void)
 }
 
 
-void m68k_op_clr_32_ai(void)
+void m68k_op_clr_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_32(EA_AY_AI_32(), 0);
 
@@ -10442,7 +10442,7 @@ void m68k_op_clr_32_ai(void)
 }
 
 
-void m68k_op_clr_32_pi(void)
+void m68k_op_clr_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_32(EA_AY_PI_32(), 0);
 
@@ -10453,7 +10453,7 @@ void m68k_op_clr_32_pi(void)
 }
 
 
-void m68k_op_clr_32_pd(void)
+void m68k_op_clr_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_32(EA_AY_PD_32(), 0);
 
@@ -10464,7 +10464,7 @@ void m68k_op_clr_32_pd(void)
 }
 
 
-void m68k_op_clr_32_di(void)
+void m68k_op_clr_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_32(EA_AY_DI_32(), 0);
 
@@ -10475,7 +10475,7 @@ void m68k_op_clr_32_di(void)
 }
 
 
-void m68k_op_clr_32_ix(void)
+void m68k_op_clr_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_32(EA_AY_IX_32(), 0);
 
@@ -10486,7 +10486,7 @@ void m68k_op_clr_32_ix(void)
 }
 
 
-void m68k_op_clr_32_aw(void)
+void m68k_op_clr_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_32(EA_AW_32(), 0);
 
@@ -10497,7 +10497,7 @@ void m68k_op_clr_32_aw(void)
 }
 
 
-void m68k_op_clr_32_al(void)
+void m68k_op_clr_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_32(EA_AL_32(), 0);
 
@@ -10508,7 +10508,7 @@ void m68k_op_clr_32_al(void)
 }
 
 
-void m68k_op_cmp_8_d(void)
+void m68k_op_cmp_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MASK_OUT_ABOVE_8(DY);
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10521,7 +10521,7 @@ void m68k_op_cmp_8_d(void)
 }
 
 
-void m68k_op_cmp_8_ai(void)
+void m68k_op_cmp_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_AI_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10534,7 +10534,7 @@ void m68k_op_cmp_8_ai(void)
 }
 
 
-void m68k_op_cmp_8_pi(void)
+void m68k_op_cmp_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PI_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10547,7 +10547,7 @@ void m68k_op_cmp_8_pi(void)
 }
 
 
-void m68k_op_cmp_8_pi7(void)
+void m68k_op_cmp_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PI_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10560,7 +10560,7 @@ void m68k_op_cmp_8_pi7(void)
 }
 
 
-void m68k_op_cmp_8_pd(void)
+void m68k_op_cmp_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10573,7 +10573,7 @@ void m68k_op_cmp_8_pd(void)
 }
 
 
-void m68k_op_cmp_8_pd7(void)
+void m68k_op_cmp_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PD_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10586,7 +10586,7 @@ void m68k_op_cmp_8_pd7(void)
 }
 
 
-void m68k_op_cmp_8_di(void)
+void m68k_op_cmp_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_DI_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10599,7 +10599,7 @@ void m68k_op_cmp_8_di(void)
 }
 
 
-void m68k_op_cmp_8_ix(void)
+void m68k_op_cmp_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_IX_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10612,7 +10612,7 @@ void m68k_op_cmp_8_ix(void)
 }
 
 
-void m68k_op_cmp_8_aw(void)
+void m68k_op_cmp_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AW_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10625,7 +10625,7 @@ void m68k_op_cmp_8_aw(void)
 }
 
 
-void m68k_op_cmp_8_al(void)
+void m68k_op_cmp_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AL_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10638,7 +10638,7 @@ void m68k_op_cmp_8_al(void)
 }
 
 
-void m68k_op_cmp_8_pcdi(void)
+void m68k_op_cmp_8_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCDI_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10651,7 +10651,7 @@ void m68k_op_cmp_8_pcdi(void)
 }
 
 
-void m68k_op_cmp_8_pcix(void)
+void m68k_op_cmp_8_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCIX_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10664,7 +10664,7 @@ void m68k_op_cmp_8_pcix(void)
 }
 
 
-void m68k_op_cmp_8_i(void)
+void m68k_op_cmp_8_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
@@ -10677,7 +10677,7 @@ void m68k_op_cmp_8_i(void)
 }
 
 
-void m68k_op_cmp_16_d(void)
+void m68k_op_cmp_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MASK_OUT_ABOVE_16(DY);
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10690,7 +10690,7 @@ void m68k_op_cmp_16_d(void)
 }
 
 
-void m68k_op_cmp_16_a(void)
+void m68k_op_cmp_16_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MASK_OUT_ABOVE_16(AY);
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10703,7 +10703,7 @@ void m68k_op_cmp_16_a(void)
 }
 
 
-void m68k_op_cmp_16_ai(void)
+void m68k_op_cmp_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_AI_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10716,7 +10716,7 @@ void m68k_op_cmp_16_ai(void)
 }
 
 
-void m68k_op_cmp_16_pi(void)
+void m68k_op_cmp_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PI_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10729,7 +10729,7 @@ void m68k_op_cmp_16_pi(void)
 }
 
 
-void m68k_op_cmp_16_pd(void)
+void m68k_op_cmp_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10742,7 +10742,7 @@ void m68k_op_cmp_16_pd(void)
 }
 
 
-void m68k_op_cmp_16_di(void)
+void m68k_op_cmp_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_DI_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10755,7 +10755,7 @@ void m68k_op_cmp_16_di(void)
 }
 
 
-void m68k_op_cmp_16_ix(void)
+void m68k_op_cmp_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_IX_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10768,7 +10768,7 @@ void m68k_op_cmp_16_ix(void)
 }
 
 
-void m68k_op_cmp_16_aw(void)
+void m68k_op_cmp_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AW_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10781,7 +10781,7 @@ void m68k_op_cmp_16_aw(void)
 }
 
 
-void m68k_op_cmp_16_al(void)
+void m68k_op_cmp_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AL_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10794,7 +10794,7 @@ void m68k_op_cmp_16_al(void)
 }
 
 
-void m68k_op_cmp_16_pcdi(void)
+void m68k_op_cmp_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCDI_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10807,7 +10807,7 @@ void m68k_op_cmp_16_pcdi(void)
 }
 
 
-void m68k_op_cmp_16_pcix(void)
+void m68k_op_cmp_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCIX_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10820,7 +10820,7 @@ void m68k_op_cmp_16_pcix(void)
 }
 
 
-void m68k_op_cmp_16_i(void)
+void m68k_op_cmp_16_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
@@ -10833,7 +10833,7 @@ void m68k_op_cmp_16_i(void)
 }
 
 
-void m68k_op_cmp_32_d(void)
+void m68k_op_cmp_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = DY;
 	uint dst = DX;
@@ -10846,7 +10846,7 @@ void m68k_op_cmp_32_d(void)
 }
 
 
-void m68k_op_cmp_32_a(void)
+void m68k_op_cmp_32_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = AY;
 	uint dst = DX;
@@ -10859,7 +10859,7 @@ void m68k_op_cmp_32_a(void)
 }
 
 
-void m68k_op_cmp_32_ai(void)
+void m68k_op_cmp_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_AI_32();
 	uint dst = DX;
@@ -10872,7 +10872,7 @@ void m68k_op_cmp_32_ai(void)
 }
 
 
-void m68k_op_cmp_32_pi(void)
+void m68k_op_cmp_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PI_32();
 	uint dst = DX;
@@ -10885,7 +10885,7 @@ void m68k_op_cmp_32_pi(void)
 }
 
 
-void m68k_op_cmp_32_pd(void)
+void m68k_op_cmp_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_32();
 	uint dst = DX;
@@ -10898,7 +10898,7 @@ void m68k_op_cmp_32_pd(void)
 }
 
 
-void m68k_op_cmp_32_di(void)
+void m68k_op_cmp_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_DI_32();
 	uint dst = DX;
@@ -10911,7 +10911,7 @@ void m68k_op_cmp_32_di(void)
 }
 
 
-void m68k_op_cmp_32_ix(void)
+void m68k_op_cmp_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_IX_32();
 	uint dst = DX;
@@ -10924,7 +10924,7 @@ void m68k_op_cmp_32_ix(void)
 }
 
 
-void m68k_op_cmp_32_aw(void)
+void m68k_op_cmp_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AW_32();
 	uint dst = DX;
@@ -10937,7 +10937,7 @@ void m68k_op_cmp_32_aw(void)
 }
 
 
-void m68k_op_cmp_32_al(void)
+void m68k_op_cmp_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AL_32();
 	uint dst = DX;
@@ -10950,7 +10950,7 @@ void m68k_op_cmp_32_al(void)
 }
 
 
-void m68k_op_cmp_32_pcdi(void)
+void m68k_op_cmp_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCDI_32();
 	uint dst = DX;
@@ -10963,7 +10963,7 @@ void m68k_op_cmp_32_pcdi(void)
 }
 
 
-void m68k_op_cmp_32_pcix(void)
+void m68k_op_cmp_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCIX_32();
 	uint dst = DX;
@@ -10976,7 +10976,7 @@ void m68k_op_cmp_32_pcix(void)
 }
 
 
-void m68k_op_cmp_32_i(void)
+void m68k_op_cmp_32_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint dst = DX;
@@ -10989,7 +10989,7 @@ void m68k_op_cmp_32_i(void)
 }
 
 
-void m68k_op_cmpa_16_d(void)
+void m68k_op_cmpa_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(DY);
 	uint dst = AX;
@@ -11002,7 +11002,7 @@ void m68k_op_cmpa_16_d(void)
 }
 
 
-void m68k_op_cmpa_16_a(void)
+void m68k_op_cmpa_16_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(AY);
 	uint dst = AX;
@@ -11015,7 +11015,7 @@ void m68k_op_cmpa_16_a(void)
 }
 
 
-void m68k_op_cmpa_16_ai(void)
+void m68k_op_cmpa_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(OPER_AY_AI_16());
 	uint dst = AX;
@@ -11028,7 +11028,7 @@ void m68k_op_cmpa_16_ai(void)
 }
 
 
-void m68k_op_cmpa_16_pi(void)
+void m68k_op_cmpa_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(OPER_AY_PI_16());
 	uint dst = AX;
@@ -11041,7 +11041,7 @@ void m68k_op_cmpa_16_pi(void)
 }
 
 
-void m68k_op_cmpa_16_pd(void)
+void m68k_op_cmpa_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(OPER_AY_PD_16());
 	uint dst = AX;
@@ -11054,7 +11054,7 @@ void m68k_op_cmpa_16_pd(void)
 }
 
 
-void m68k_op_cmpa_16_di(void)
+void m68k_op_cmpa_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(OPER_AY_DI_16());
 	uint dst = AX;
@@ -11067,7 +11067,7 @@ void m68k_op_cmpa_16_di(void)
 }
 
 
-void m68k_op_cmpa_16_ix(void)
+void m68k_op_cmpa_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(OPER_AY_IX_16());
 	uint dst = AX;
@@ -11080,7 +11080,7 @@ void m68k_op_cmpa_16_ix(void)
 }
 
 
-void m68k_op_cmpa_16_aw(void)
+void m68k_op_cmpa_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(OPER_AW_16());
 	uint dst = AX;
@@ -11093,7 +11093,7 @@ void m68k_op_cmpa_16_aw(void)
 }
 
 
-void m68k_op_cmpa_16_al(void)
+void m68k_op_cmpa_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(OPER_AL_16());
 	uint dst = AX;
@@ -11106,7 +11106,7 @@ void m68k_op_cmpa_16_al(void)
 }
 
 
-void m68k_op_cmpa_16_pcdi(void)
+void m68k_op_cmpa_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(OPER_PCDI_16());
 	uint dst = AX;
@@ -11119,7 +11119,7 @@ void m68k_op_cmpa_16_pcdi(void)
 }
 
 
-void m68k_op_cmpa_16_pcix(void)
+void m68k_op_cmpa_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(OPER_PCIX_16());
 	uint dst = AX;
@@ -11132,7 +11132,7 @@ void m68k_op_cmpa_16_pcix(void)
 }
 
 
-void m68k_op_cmpa_16_i(void)
+void m68k_op_cmpa_16_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = MAKE_INT_16(OPER_I_16());
 	uint dst = AX;
@@ -11145,7 +11145,7 @@ void m68k_op_cmpa_16_i(void)
 }
 
 
-void m68k_op_cmpa_32_d(void)
+void m68k_op_cmpa_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = DY;
 	uint dst = AX;
@@ -11158,7 +11158,7 @@ void m68k_op_cmpa_32_d(void)
 }
 
 
-void m68k_op_cmpa_32_a(void)
+void m68k_op_cmpa_32_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = AY;
 	uint dst = AX;
@@ -11171,7 +11171,7 @@ void m68k_op_cmpa_32_a(void)
 }
 
 
-void m68k_op_cmpa_32_ai(void)
+void m68k_op_cmpa_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_AI_32();
 	uint dst = AX;
@@ -11184,7 +11184,7 @@ void m68k_op_cmpa_32_ai(void)
 }
 
 
-void m68k_op_cmpa_32_pi(void)
+void m68k_op_cmpa_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PI_32();
 	uint dst = AX;
@@ -11197,7 +11197,7 @@ void m68k_op_cmpa_32_pi(void)
 }
 
 
-void m68k_op_cmpa_32_pd(void)
+void m68k_op_cmpa_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_32();
 	uint dst = AX;
@@ -11210,7 +11210,7 @@ void m68k_op_cmpa_32_pd(void)
 }
 
 
-void m68k_op_cmpa_32_di(void)
+void m68k_op_cmpa_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_DI_32();
 	uint dst = AX;
@@ -11223,7 +11223,7 @@ void m68k_op_cmpa_32_di(void)
 }
 
 
-void m68k_op_cmpa_32_ix(void)
+void m68k_op_cmpa_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_IX_32();
 	uint dst = AX;
@@ -11236,7 +11236,7 @@ void m68k_op_cmpa_32_ix(void)
 }
 
 
-void m68k_op_cmpa_32_aw(void)
+void m68k_op_cmpa_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AW_32();
 	uint dst = AX;
@@ -11249,7 +11249,7 @@ void m68k_op_cmpa_32_aw(void)
 }
 
 
-void m68k_op_cmpa_32_al(void)
+void m68k_op_cmpa_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AL_32();
 	uint dst = AX;
@@ -11262,7 +11262,7 @@ void m68k_op_cmpa_32_al(void)
 }
 
 
-void m68k_op_cmpa_32_pcdi(void)
+void m68k_op_cmpa_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCDI_32();
 	uint dst = AX;
@@ -11275,7 +11275,7 @@ void m68k_op_cmpa_32_pcdi(void)
 }
 
 
-void m68k_op_cmpa_32_pcix(void)
+void m68k_op_cmpa_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCIX_32();
 	uint dst = AX;
@@ -11288,7 +11288,7 @@ void m68k_op_cmpa_32_pcix(void)
 }
 
 
-void m68k_op_cmpa_32_i(void)
+void m68k_op_cmpa_32_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint dst = AX;
@@ -11301,7 +11301,7 @@ void m68k_op_cmpa_32_i(void)
 }
 
 
-void m68k_op_cmpi_8_d(void)
+void m68k_op_cmpi_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint dst = MASK_OUT_ABOVE_8(DY);
@@ -11314,7 +11314,7 @@ void m68k_op_cmpi_8_d(void)
 }
 
 
-void m68k_op_cmpi_8_ai(void)
+void m68k_op_cmpi_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint dst = OPER_AY_AI_8();
@@ -11327,7 +11327,7 @@ void m68k_op_cmpi_8_ai(void)
 }
 
 
-void m68k_op_cmpi_8_pi(void)
+void m68k_op_cmpi_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint dst = OPER_AY_PI_8();
@@ -11340,7 +11340,7 @@ void m68k_op_cmpi_8_pi(void)
 }
 
 
-void m68k_op_cmpi_8_pi7(void)
+void m68k_op_cmpi_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint dst = OPER_A7_PI_8();
@@ -11353,7 +11353,7 @@ void m68k_op_cmpi_8_pi7(void)
 }
 
 
-void m68k_op_cmpi_8_pd(void)
+void m68k_op_cmpi_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint dst = OPER_AY_PD_8();
@@ -11366,7 +11366,7 @@ void m68k_op_cmpi_8_pd(void)
 }
 
 
-void m68k_op_cmpi_8_pd7(void)
+void m68k_op_cmpi_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint dst = OPER_A7_PD_8();
@@ -11379,7 +11379,7 @@ void m68k_op_cmpi_8_pd7(void)
 }
 
 
-void m68k_op_cmpi_8_di(void)
+void m68k_op_cmpi_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint dst = OPER_AY_DI_8();
@@ -11392,7 +11392,7 @@ void m68k_op_cmpi_8_di(void)
 }
 
 
-void m68k_op_cmpi_8_ix(void)
+void m68k_op_cmpi_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint dst = OPER_AY_IX_8();
@@ -11405,7 +11405,7 @@ void m68k_op_cmpi_8_ix(void)
 }
 
 
-void m68k_op_cmpi_8_aw(void)
+void m68k_op_cmpi_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint dst = OPER_AW_8();
@@ -11418,7 +11418,7 @@ void m68k_op_cmpi_8_aw(void)
 }
 
 
-void m68k_op_cmpi_8_al(void)
+void m68k_op_cmpi_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint dst = OPER_AL_8();
@@ -11431,7 +11431,7 @@ void m68k_op_cmpi_8_al(void)
 }
 
 
-void m68k_op_cmpi_8_pcdi(void)
+void m68k_op_cmpi_8_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11449,7 +11449,7 @@ void m68k_op_cmpi_8_pcdi(void)
 }
 
 
-void m68k_op_cmpi_8_pcix(void)
+void m68k_op_cmpi_8_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11467,7 +11467,7 @@ void m68k_op_cmpi_8_pcix(void)
 }
 
 
-void m68k_op_cmpi_16_d(void)
+void m68k_op_cmpi_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint dst = MASK_OUT_ABOVE_16(DY);
@@ -11480,7 +11480,7 @@ void m68k_op_cmpi_16_d(void)
 }
 
 
-void m68k_op_cmpi_16_ai(void)
+void m68k_op_cmpi_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint dst = OPER_AY_AI_16();
@@ -11493,7 +11493,7 @@ void m68k_op_cmpi_16_ai(void)
 }
 
 
-void m68k_op_cmpi_16_pi(void)
+void m68k_op_cmpi_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint dst = OPER_AY_PI_16();
@@ -11506,7 +11506,7 @@ void m68k_op_cmpi_16_pi(void)
 }
 
 
-void m68k_op_cmpi_16_pd(void)
+void m68k_op_cmpi_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint dst = OPER_AY_PD_16();
@@ -11519,7 +11519,7 @@ void m68k_op_cmpi_16_pd(void)
 }
 
 
-void m68k_op_cmpi_16_di(void)
+void m68k_op_cmpi_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint dst = OPER_AY_DI_16();
@@ -11532,7 +11532,7 @@ void m68k_op_cmpi_16_di(void)
 }
 
 
-void m68k_op_cmpi_16_ix(void)
+void m68k_op_cmpi_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint dst = OPER_AY_IX_16();
@@ -11545,7 +11545,7 @@ void m68k_op_cmpi_16_ix(void)
 }
 
 
-void m68k_op_cmpi_16_aw(void)
+void m68k_op_cmpi_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint dst = OPER_AW_16();
@@ -11558,7 +11558,7 @@ void m68k_op_cmpi_16_aw(void)
 }
 
 
-void m68k_op_cmpi_16_al(void)
+void m68k_op_cmpi_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint dst = OPER_AL_16();
@@ -11571,7 +11571,7 @@ void m68k_op_cmpi_16_al(void)
 }
 
 
-void m68k_op_cmpi_16_pcdi(void)
+void m68k_op_cmpi_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11589,7 +11589,7 @@ void m68k_op_cmpi_16_pcdi(void)
 }
 
 
-void m68k_op_cmpi_16_pcix(void)
+void m68k_op_cmpi_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11607,7 +11607,7 @@ void m68k_op_cmpi_16_pcix(void)
 }
 
 
-void m68k_op_cmpi_32_d(void)
+void m68k_op_cmpi_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint dst = DY;
@@ -11622,7 +11622,7 @@ void m68k_op_cmpi_32_d(void)
 }
 
 
-void m68k_op_cmpi_32_ai(void)
+void m68k_op_cmpi_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint dst = OPER_AY_AI_32();
@@ -11635,7 +11635,7 @@ void m68k_op_cmpi_32_ai(void)
 }
 
 
-void m68k_op_cmpi_32_pi(void)
+void m68k_op_cmpi_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint dst = OPER_AY_PI_32();
@@ -11648,7 +11648,7 @@ void m68k_op_cmpi_32_pi(void)
 }
 
 
-void m68k_op_cmpi_32_pd(void)
+void m68k_op_cmpi_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint dst = OPER_AY_PD_32();
@@ -11661,7 +11661,7 @@ void m68k_op_cmpi_32_pd(void)
 }
 
 
-void m68k_op_cmpi_32_di(void)
+void m68k_op_cmpi_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint dst = OPER_AY_DI_32();
@@ -11674,7 +11674,7 @@ void m68k_op_cmpi_32_di(void)
 }
 
 
-void m68k_op_cmpi_32_ix(void)
+void m68k_op_cmpi_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint dst = OPER_AY_IX_32();
@@ -11687,7 +11687,7 @@ void m68k_op_cmpi_32_ix(void)
 }
 
 
-void m68k_op_cmpi_32_aw(void)
+void m68k_op_cmpi_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint dst = OPER_AW_32();
@@ -11700,7 +11700,7 @@ void m68k_op_cmpi_32_aw(void)
 }
 
 
-void m68k_op_cmpi_32_al(void)
+void m68k_op_cmpi_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint dst = OPER_AL_32();
@@ -11713,7 +11713,7 @@ void m68k_op_cmpi_32_al(void)
 }
 
 
-void m68k_op_cmpi_32_pcdi(void)
+void m68k_op_cmpi_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11731,7 +11731,7 @@ void m68k_op_cmpi_32_pcdi(void)
 }
 
 
-void m68k_op_cmpi_32_pcix(void)
+void m68k_op_cmpi_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11749,7 +11749,7 @@ void m68k_op_cmpi_32_pcix(void)
 }
 
 
-void m68k_op_cmpm_8_ax7(void)
+void m68k_op_cmpm_8_ax7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PI_8();
 	uint dst = OPER_A7_PI_8();
@@ -11762,7 +11762,7 @@ void m68k_op_cmpm_8_ax7(void)
 }
 
 
-void m68k_op_cmpm_8_ay7(void)
+void m68k_op_cmpm_8_ay7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PI_8();
 	uint dst = OPER_AX_PI_8();
@@ -11775,7 +11775,7 @@ void m68k_op_cmpm_8_ay7(void)
 }
 
 
-void m68k_op_cmpm_8_axy7(void)
+void m68k_op_cmpm_8_axy7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PI_8();
 	uint dst = OPER_A7_PI_8();
@@ -11788,7 +11788,7 @@ void m68k_op_cmpm_8_axy7(void)
 }
 
 
-void m68k_op_cmpm_8(void)
+void m68k_op_cmpm_8(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PI_8();
 	uint dst = OPER_AX_PI_8();
@@ -11801,7 +11801,7 @@ void m68k_op_cmpm_8(void)
 }
 
 
-void m68k_op_cmpm_16(void)
+void m68k_op_cmpm_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PI_16();
 	uint dst = OPER_AX_PI_16();
@@ -11814,7 +11814,7 @@ void m68k_op_cmpm_16(void)
 }
 
 
-void m68k_op_cmpm_32(void)
+void m68k_op_cmpm_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PI_32();
 	uint dst = OPER_AX_PI_32();
@@ -11827,7 +11827,7 @@ void m68k_op_cmpm_32(void)
 }
 
 
-void m68k_op_cpbcc_32(void)
+void m68k_op_cpbcc_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11840,7 +11840,7 @@ void m68k_op_cpbcc_32(void)
 }
 
 
-void m68k_op_cpdbcc_32(void)
+void m68k_op_cpdbcc_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11853,7 +11853,7 @@ void m68k_op_cpdbcc_32(void)
 }
 
 
-void m68k_op_cpgen_32(void)
+void m68k_op_cpgen_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11866,7 +11866,7 @@ void m68k_op_cpgen_32(void)
 }
 
 
-void m68k_op_cpscc_32(void)
+void m68k_op_cpscc_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -11879,7 +11879,7 @@ void m68k_op_cpscc_32(void)
 }
 
 
-void m68k_op_cptrapcc_32(void)
+void m68k_op_cptrapcc_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
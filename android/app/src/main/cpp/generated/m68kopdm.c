@@ -5,13 +5,13 @@
 /* ======================================================================== */
 
 
-void m68k_op_dbt_16(void)
+void m68k_op_dbt_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	REG_PC += 2;
 }
 
 
-void m68k_op_dbf_16(void)
+void m68k_op_dbf_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
@@ -31,7 +31,7 @@ void m68k_op_dbf_16(void)
 }
 
 
-void m68k_op_dbhi_16(void)
+void m68k_op_dbhi_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_HI())
 	{
@@ -56,7 +56,7 @@ void m68k_op_dbhi_16(void)
 }
 
 
-void m68k_op_dbls_16(void)
+void m68k_op_dbls_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_LS())
 	{
@@ -81,7 +81,7 @@ void m68k_op_dbls_16(void)
 }
 
 
-void m68k_op_dbcc_16(void)
+void m68k_op_dbcc_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_CC())
 	{
@@ -106,7 +106,7 @@ void m68k_op_dbcc_16(void)
 }
 
 
-void m68k_op_dbcs_16(void)
+void m68k_op_dbcs_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_CS())
 	{
@@ -131,7 +131,7 @@ void m68k_op_dbcs_16(void)
 }
 
 
-void m68k_op_dbne_16(void)
+void m68k_op_dbne_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_NE())
 	{
@@ -156,7 +156,7 @@ void m68k_op_dbne_16(void)
 }
 
 
-void m68k_op_dbeq_16(void)
+void m68k_op_dbeq_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_EQ())
 	{
@@ -181,7 +181,7 @@ void m68k_op_dbeq_16(void)
 }
 
 
-void m68k_op_dbvc_16(void)
+void m68k_op_dbvc_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_VC())
 	{
@@ -206,7 +206,7 @@ void m68k_op_dbvc_16(void)
 }
 
 
-void m68k_op_dbvs_16(void)
+void m68k_op_dbvs_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_VS())
 	{
@@ -231,7 +231,7 @@ void m68k_op_dbvs_16(void)
 }
 
 
-void m68k_op_dbpl_16(void)
+void m68k_op_dbpl_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_PL())
 	{
@@ -256,7 +256,7 @@ void m68k_op_dbpl_16(void)
 }
 
 
-void m68k_op_dbmi_16(void)
+void m68k_op_dbmi_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_MI())
 	{
@@ -281,7 +281,7 @@ void m68k_op_dbmi_16(void)
 }
 
 
-void m68k_op_dbge_16(void)
+void m68k_op_dbge_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_GE())
 	{
@@ -306,7 +306,7 @@ void m68k_op_dbge_16(void)
 }
 
 
-void m68k_op_dblt_16(void)
+void m68k_op_dblt_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_LT())
 	{
@@ -331,7 +331,7 @@ void m68k_op_dblt_16(void)
 }
 
 
-void m68k_op_dbgt_16(void)
+void m68k_op_dbgt_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_GT())
 	{
@@ -356,7 +356,7 @@ void m68k_op_dbgt_16(void)
 }
 
 
-void m68k_op_dble_16(void)
+void m68k_op_dble_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NOT_LE())
 	{
@@ -381,7 +381,7 @@ void m68k_op_dble_16(void)
 }
 
 
-void m68k_op_divs_16_d(void)
+void m68k_op_divs_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(DY);
@@ -419,7 +419,7 @@ void m68k_op_divs_16_d(void)
 }
 
 
-void m68k_op_divs_16_ai(void)
+void m68k_op_divs_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AY_AI_16());
@@ -457,7 +457,7 @@ void m68k_op_divs_16_ai(void)
 }
 
 
-void m68k_op_divs_16_pi(void)
+void m68k_op_divs_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AY_PI_16());
@@ -495,7 +495,7 @@ void m68k_op_divs_16_pi(void)
 }
 
 
-void m68k_op_divs_16_pd(void)
+void m68k_op_divs_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AY_PD_16());
@@ -533,7 +533,7 @@ void m68k_op_divs_16_pd(void)
 }
 
 
-void m68k_op_divs_16_di(void)
+void m68k_op_divs_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AY_DI_16());
@@ -571,7 +571,7 @@ void m68k_op_divs_16_di(void)
 }
 
 
-void m68k_op_divs_16_ix(void)
+void m68k_op_divs_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AY_IX_16());
@@ -609,7 +609,7 @@ void m68k_op_divs_16_ix(void)
 }
 
 
-void m68k_op_divs_16_aw(void)
+void m68k_op_divs_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AW_16());
@@ -647,7 +647,7 @@ void m68k_op_divs_16_aw(void)
 }
 
 
-void m68k_op_divs_16_al(void)
+void m68k_op_divs_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AL_16());
@@ -685,7 +685,7 @@ void m68k_op_divs_16_al(void)
 }
 
 
-void m68k_op_divs_16_pcdi(void)
+void m68k_op_divs_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_PCDI_16());
@@ -723,7 +723,7 @@ void m68k_op_divs_16_pcdi(void)
 }
 
 
-void m68k_op_divs_16_pcix(void)
+void m68k_op_divs_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_PCIX_16());
@@ -761,7 +761,7 @@ void m68k_op_divs_16_pcix(void)
 }
 
 
-void m68k_op_divs_16_i(void)
+void m68k_op_divs_16_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_I_16());
@@ -799,7 +799,7 @@ void m68k_op_divs_16_i(void)
 }
 
 
-void m68k_op_divu_16_d(void)
+void m68k_op_divu_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(DY);
@@ -825,7 +825,7 @@ void m68k_op_divu_16_d(void)
 }
 
 
-void m68k_op_divu_16_ai(void)
+void m68k_op_divu_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_AI_16();
@@ -851,7 +851,7 @@ void m68k_op_divu_16_ai(void)
 }
 
 
-void m68k_op_divu_16_pi(void)
+void m68k_op_divu_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PI_16();
@@ -877,7 +877,7 @@ void m68k_op_divu_16_pi(void)
 }
 
 
-void m68k_op_divu_16_pd(void)
+void m68k_op_divu_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PD_16();
@@ -903,7 +903,7 @@ void m68k_op_divu_16_pd(void)
 }
 
 
-void m68k_op_divu_16_di(void)
+void m68k_op_divu_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_DI_16();
@@ -929,7 +929,7 @@ void m68k_op_divu_16_di(void)
 }
 
 
-void m68k_op_divu_16_ix(void)
+void m68k_op_divu_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_IX_16();
@@ -955,7 +955,7 @@ void m68k_op_divu_16_ix(void)
 }
 
 
-void m68k_op_divu_16_aw(void)
+void m68k_op_divu_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AW_16();
@@ -981,7 +981,7 @@ void m68k_op_divu_16_aw(void)
 }
 
 
-void m68k_op_divu_16_al(void)
+void m68k_op_divu_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AL_16();
@@ -1007,7 +1007,7 @@ void m68k_op_divu_16_al(void)
 }
 
 
-void m68k_op_divu_16_pcdi(void)
+void m68k_op_divu_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCDI_16();
@@ -1033,7 +1033,7 @@ void m68k_op_divu_16_pcdi(void)
 }
 
 
-void m68k_op_divu_16_pcix(void)
+void m68k_op_divu_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCIX_16();
@@ -1059,7 +1059,7 @@ void m68k_op_divu_16_pcix(void)
 }
 
 
-void m68k_op_divu_16_i(void)
+void m68k_op_divu_16_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_I_16();
@@ -1085,7 +1085,7 @@ void m68k_op_divu_16_i(void)
 }
 
 
-void m68k_op_divl_32_d(void)
+void m68k_op_divl_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -1296,7 +1296,7 @@ void m68k_op_divl_32_d(void)
 }
 
 
-void m68k_op_divl_32_ai(void)
+void m68k_op_divl_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -1507,7 +1507,7 @@ void m68k_op_divl_32_ai(void)
 }
 
 
-void m68k_op_divl_32_pi(void)
+void m68k_op_divl_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -1718,7 +1718,7 @@ void m68k_op_divl_32_pi(void)
 }
 
 
-void m68k_op_divl_32_pd(void)
+void m68k_op_divl_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -1929,7 +1929,7 @@ void m68k_op_divl_32_pd(void)
 }
 
 
-void m68k_op_divl_32_di(void)
+void m68k_op_divl_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -2140,7 +2140,7 @@ void m68k_op_divl_32_di(void)
 }
 
 
-void m68k_op_divl_32_ix(void)
+void m68k_op_divl_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -2351,7 +2351,7 @@ void m68k_op_divl_32_ix(void)
 }
 
 
-void m68k_op_divl_32_aw(void)
+void m68k_op_divl_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -2562,7 +2562,7 @@ void m68k_op_divl_32_aw(void)
 }
 
 
-void m68k_op_divl_32_al(void)
+void m68k_op_divl_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -2773,7 +2773,7 @@ void m68k_op_divl_32_al(void)
 }
 
 
-void m68k_op_divl_32_pcdi(void)
+void m68k_op_divl_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -2984,7 +2984,7 @@ void m68k_op_divl_32_pcdi(void)
 }
 
 
-void m68k_op_divl_32_pcix(void)
+void m68k_op_divl_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -3195,7 +3195,7 @@ void m68k_op_divl_32_pcix(void)
 }
 
 
-void m68k_op_divl_32_i(void)
+void m68k_op_divl_32_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -3406,7 +3406,7 @@ void m68k_op_divl_32_i(void)
 }
 
 
-void m68k_op_eor_8_d(void)
+void m68k_op_eor_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY ^= MASK_OUT_ABOVE_8(DX));
 
@@ -3417,7 +3417,7 @@ void m68k_op_eor_8_d(void)
 }
 
 
-void m68k_op_eor_8_ai(void)
+void m68k_op_eor_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
@@ -3431,7 +3431,7 @@ void m68k_op_eor_8_ai(void)
 }
 
 
-void m68k_op_eor_8_pi(void)
+void m68k_op_eor_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
@@ -3445,7 +3445,7 @@ void m68k_op_eor_8_pi(void)
 }
 
 
-void m68k_op_eor_8_pi7(void)
+void m68k_op_eor_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
@@ -3459,7 +3459,7 @@ void m68k_op_eor_8_pi7(void)
 }
 
 
-void m68k_op_eor_8_pd(void)
+void m68k_op_eor_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
@@ -3473,7 +3473,7 @@ void m68k_op_eor_8_pd(void)
 }
 
 
-void m68k_op_eor_8_pd7(void)
+void m68k_op_eor_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
@@ -3487,7 +3487,7 @@ void m68k_op_eor_8_pd7(void)
 }
 
 
-void m68k_op_eor_8_di(void)
+void m68k_op_eor_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
@@ -3501,7 +3501,7 @@ void m68k_op_eor_8_di(void)
 }
 
 
-void m68k_op_eor_8_ix(void)
+void m68k_op_eor_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
@@ -3515,7 +3515,7 @@ void m68k_op_eor_8_ix(void)
 }
 
 
-void m68k_op_eor_8_aw(void)
+void m68k_op_eor_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
@@ -3529,7 +3529,7 @@ void m68k_op_eor_8_aw(void)
 }
 
 
-void m68k_op_eor_8_al(void)
+void m68k_op_eor_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(ea));
@@ -3543,7 +3543,7 @@ void m68k_op_eor_8_al(void)
 }
 
 
-void m68k_op_eor_16_d(void)
+void m68k_op_eor_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY ^= MASK_OUT_ABOVE_16(DX));
 
@@ -3554,7 +3554,7 @@ void m68k_op_eor_16_d(void)
 }
 
 
-void m68k_op_eor_16_ai(void)
+void m68k_op_eor_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
@@ -3568,7 +3568,7 @@ void m68k_op_eor_16_ai(void)
 }
 
 
-void m68k_op_eor_16_pi(void)
+void m68k_op_eor_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
@@ -3582,7 +3582,7 @@ void m68k_op_eor_16_pi(void)
 }
 
 
-void m68k_op_eor_16_pd(void)
+void m68k_op_eor_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
@@ -3596,7 +3596,7 @@ void m68k_op_eor_16_pd(void)
 }
 
 
-void m68k_op_eor_16_di(void)
+void m68k_op_eor_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
@@ -3610,7 +3610,7 @@ void m68k_op_eor_16_di(void)
 }
 
 
-void m68k_op_eor_16_ix(void)
+void m68k_op_eor_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
@@ -3624,7 +3624,7 @@ void m68k_op_eor_16_ix(void)
 }
 
 
-void m68k_op_eor_16_aw(void)
+void m68k_op_eor_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
@@ -3638,7 +3638,7 @@ void m68k_op_eor_16_aw(void)
 }
 
 
-void m68k_op_eor_16_al(void)
+void m68k_op_eor_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(ea));
@@ -3652,7 +3652,7 @@ void m68k_op_eor_16_al(void)
 }
 
 
-void m68k_op_eor_32_d(void)
+void m68k_op_eor_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY ^= DX;
 
@@ -3663,7 +3663,7 @@ void m68k_op_eor_32_d(void)
 }
 
 
-void m68k_op_eor_32_ai(void)
+void m68k_op_eor_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_32();
 	uint res = DX ^ m68ki_read_32(ea);
@@ -3677,7 +3677,7 @@ void m68k_op_eor_32_ai(void)
 }
 
 
-void m68k_op_eor_32_pi(void)
+void m68k_op_eor_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_32();
 	uint res = DX ^ m68ki_read_32(ea);
@@ -3691,7 +3691,7 @@ void m68k_op_eor_32_pi(void)
 }
 
 
-void m68k_op_eor_32_pd(void)
+void m68k_op_eor_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_32();
 	uint res = DX ^ m68ki_read_32(ea);
@@ -3705,7 +3705,7 @@ void m68k_op_eor_32_pd(void)
 }
 
 
-void m68k_op_eor_32_di(void)
+void m68k_op_eor_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_32();
 	uint res = DX ^ m68ki_read_32(ea);
@@ -3719,7 +3719,7 @@ void m68k_op_eor_32_di(void)
 }
 
 
-void m68k_op_eor_32_ix(void)
+void m68k_op_eor_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_32();
 	uint res = DX ^ m68ki_read_32(ea);
@@ -3733,7 +3733,7 @@ void m68k_op_eor_32_ix(void)
 }
 
 
-void m68k_op_eor_32_aw(void)
+void m68k_op_eor_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_32();
 	uint res = DX ^ m68ki_read_32(ea);
@@ -3747,7 +3747,7 @@ void m68k_op_eor_32_aw(void)
 }
 
 
-void m68k_op_eor_32_al(void)
+void m68k_op_eor_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_32();
 	uint res = DX ^ m68ki_read_32(ea);
@@ -3761,7 +3761,7 @@ void m68k_op_eor_32_al(void)
 }
 
 
-void m68k_op_eori_8_d(void)
+void m68k_op_eori_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY ^= OPER_I_8());
 
@@ -3772,7 +3772,7 @@ void m68k_op_eori_8_d(void)
 }
 
 
-void m68k_op_eori_8_ai(void)
+void m68k_op_eori_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_AI_8();
@@ -3787,7 +3787,7 @@ void m68k_op_eori_8_ai(void)
 }
 
 
-void m68k_op_eori_8_pi(void)
+void m68k_op_eori_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PI_8();
@@ -3802,7 +3802,7 @@ void m68k_op_eori_8_pi(void)
 }
 
 
-void m68k_op_eori_8_pi7(void)
+void m68k_op_eori_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PI_8();
@@ -3817,7 +3817,7 @@ void m68k_op_eori_8_pi7(void)
 }
 
 
-void m68k_op_eori_8_pd(void)
+void m68k_op_eori_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PD_8();
@@ -3832,7 +3832,7 @@ void m68k_op_eori_8_pd(void)
 }
 
 
-void m68k_op_eori_8_pd7(void)
+void m68k_op_eori_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PD_8();
@@ -3847,7 +3847,7 @@ void m68k_op_eori_8_pd7(void)
 }
 
 
-void m68k_op_eori_8_di(void)
+void m68k_op_eori_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_DI_8();
@@ -3862,7 +3862,7 @@ void m68k_op_eori_8_di(void)
 }
 
 
-void m68k_op_eori_8_ix(void)
+void m68k_op_eori_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_IX_8();
@@ -3877,7 +3877,7 @@ void m68k_op_eori_8_ix(void)
 }
 
 
-void m68k_op_eori_8_aw(void)
+void m68k_op_eori_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AW_8();
@@ -3892,7 +3892,7 @@ void m68k_op_eori_8_aw(void)
 }
 
 
-void m68k_op_eori_8_al(void)
+void m68k_op_eori_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AL_8();
@@ -3907,7 +3907,7 @@ void m68k_op_eori_8_al(void)
 }
 
 
-void m68k_op_eori_16_d(void)
+void m68k_op_eori_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY ^= OPER_I_16());
 
@@ -3918,7 +3918,7 @@ void m68k_op_eori_16_d(void)
 }
 
 
-void m68k_op_eori_16_ai(void)
+void m68k_op_eori_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_AI_16();
@@ -3933,7 +3933,7 @@ void m68k_op_eori_16_ai(void)
 }
 
 
-void m68k_op_eori_16_pi(void)
+void m68k_op_eori_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PI_16();
@@ -3948,7 +3948,7 @@ void m68k_op_eori_16_pi(void)
 }
 
 
-void m68k_op_eori_16_pd(void)
+void m68k_op_eori_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PD_16();
@@ -3963,7 +3963,7 @@ void m68k_op_eori_16_pd(void)
 }
 
 
-void m68k_op_eori_16_di(void)
+void m68k_op_eori_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_DI_16();
@@ -3978,7 +3978,7 @@ void m68k_op_eori_16_di(void)
 }
 
 
-void m68k_op_eori_16_ix(void)
+void m68k_op_eori_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_IX_16();
@@ -3993,7 +3993,7 @@ void m68k_op_eori_16_ix(void)
 }
 
 
-void m68k_op_eori_16_aw(void)
+void m68k_op_eori_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AW_16();
@@ -4008,7 +4008,7 @@ void m68k_op_eori_16_aw(void)
 }
 
 
-void m68k_op_eori_16_al(void)
+void m68k_op_eori_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AL_16();
@@ -4023,7 +4023,7 @@ void m68k_op_eori_16_al(void)
 }
 
 
-void m68k_op_eori_32_d(void)
+void m68k_op_eori_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY ^= OPER_I_32();
 
@@ -4034,7 +4034,7 @@ void m68k_op_eori_32_d(void)
 }
 
 
-void m68k_op_eori_32_ai(void)
+void m68k_op_eori_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_AI_32();
@@ -4049,7 +4049,7 @@ void m68k_op_eori_32_ai(void)
 }
 
 
-void m68k_op_eori_32_pi(void)
+void m68k_op_eori_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PI_32();
@@ -4064,7 +4064,7 @@ void m68k_op_eori_32_pi(void)
 }
 
 
-void m68k_op_eori_32_pd(void)
+void m68k_op_eori_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PD_32();
@@ -4079,7 +4079,7 @@ void m68k_op_eori_32_pd(void)
 }
 
 
-void m68k_op_eori_32_di(void)
+void m68k_op_eori_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_DI_32();
@@ -4094,7 +4094,7 @@ void m68k_op_eori_32_di(void)
 }
 
 
-void m68k_op_eori_32_ix(void)
+void m68k_op_eori_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_IX_32();
@@ -4109,7 +4109,7 @@ void m68k_op_eori_32_ix(void)
 }
 
 
-void m68k_op_eori_32_aw(void)
+void m68k_op_eori_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AW_32();
@@ -4124,7 +4124,7 @@ void m68k_op_eori_32_aw(void)
 }
 
 
-void m68k_op_eori_32_al(void)
+void m68k_op_eori_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AL_32();
@@ -4139,13 +4139,13 @@ void m68k_op_eori_32_al(void)
 }
 
 
-void m68k_op_eori_16_toc(void)
+void m68k_op_eori_16_toc(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(m68ki_get_ccr() ^ OPER_I_8());
 }
 
 
-void m68k_op_eori_16_tos(void)
+void m68k_op_eori_16_tos(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -4158,7 +4158,7 @@ void m68k_op_eori_16_tos(void)
 }
 
 
-void m68k_op_exg_32_dd(void)
+void m68k_op_exg_32_dd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* reg_a = &DX;
 	uint* reg_b = &DY;
@@ -4168,7 +4168,7 @@ void m68k_op_exg_32_dd(void)
 }
 
 
-void m68k_op_exg_32_aa(void)
+void m68k_op_exg_32_aa(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* reg_a = &AX;
 	uint* reg_b = &AY;
@@ -4178,7 +4178,7 @@ void m68k_op_exg_32_aa(void)
 }
 
 
-void m68k_op_exg_32_da(void)
+void m68k_op_exg_32_da(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* reg_a = &DX;
 	uint* reg_b = &AY;
@@ -4188,7 +4188,7 @@ void m68k_op_exg_32_da(void)
 }
 
 
-void m68k_op_ext_16(void)
+void m68k_op_ext_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 
@@ -4201,7 +4201,7 @@ void m68k_op_ext_16(void)
 }
 
 
-void m68k_op_ext_32(void)
+void m68k_op_ext_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 
@@ -4214,7 +4214,7 @@ void m68k_op_ext_32(void)
 }
 
 
-void m68k_op_extb_32(void)
+void m68k_op_extb_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4232,13 +4232,13 @@ void m68k_op_extb_32(void)
 }
 
 
-void m68k_op_illegal(void)
+void m68k_op_illegal(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_exception_illegal();
 }
 
 
-void m68k_op_jmp_32_ai(void)
+void m68k_op_jmp_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_jump(EA_AY_AI_32());
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4247,7 +4247,7 @@ void m68k_op_jmp_32_ai(void)
 }
 
 
-void m68k_op_jmp_32_di(void)
+void m68k_op_jmp_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_jump(EA_AY_DI_32());
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4256,7 +4256,7 @@ void m68k_op_jmp_32_di(void)
 }
 
 
-void m68k_op_jmp_32_ix(void)
+void m68k_op_jmp_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_jump(EA_AY_IX_32());
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4265,7 +4265,7 @@ void m68k_op_jmp_32_ix(void)
 }
 
 
-void m68k_op_jmp_32_aw(void)
+void m68k_op_jmp_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_jump(EA_AW_32());
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4274,7 +4274,7 @@ void m68k_op_jmp_32_aw(void)
 }
 
 
-void m68k_op_jmp_32_al(void)
+void m68k_op_jmp_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_jump(EA_AL_32());
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4283,7 +4283,7 @@ void m68k_op_jmp_32_al(void)
 }
 
 
-void m68k_op_jmp_32_pcdi(void)
+void m68k_op_jmp_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_jump(EA_PCDI_32());
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4292,7 +4292,7 @@ void m68k_op_jmp_32_pcdi(void)
 }
 
 
-void m68k_op_jmp_32_pcix(void)
+void m68k_op_jmp_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_jump(EA_PCIX_32());
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4301,7 +4301,7 @@ void m68k_op_jmp_32_pcix(void)
 }
 
 
-void m68k_op_jsr_32_ai(void)
+void m68k_op_jsr_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_32();
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4310,7 +4310,7 @@ void m68k_op_jsr_32_ai(void)
 }
 
 
-void m68k_op_jsr_32_di(void)
+void m68k_op_jsr_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_32();
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4319,7 +4319,7 @@ void m68k_op_jsr_32_di(void)
 }
 
 
-void m68k_op_jsr_32_ix(void)
+void m68k_op_jsr_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_32();
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4328,7 +4328,7 @@ void m68k_op_jsr_32_ix(void)
 }
 
 
-void m68k_op_jsr_32_aw(void)
+void m68k_op_jsr_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_32();
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4337,7 +4337,7 @@ void m68k_op_jsr_32_aw(void)
 }
 
 
-void m68k_op_jsr_32_al(void)
+void m68k_op_jsr_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_32();
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4346,7 +4346,7 @@ void m68k_op_jsr_32_al(void)
 }
 
 
-void m68k_op_jsr_32_pcdi(void)
+void m68k_op_jsr_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_PCDI_32();
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4355,7 +4355,7 @@ void m68k_op_jsr_32_pcdi(void)
 }
 
 
-void m68k_op_jsr_32_pcix(void)
+void m68k_op_jsr_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_PCIX_32();
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
@@ -4364,49 +4364,49 @@ void m68k_op_jsr_32_pcix(void)
 }
 
 
-void m68k_op_lea_32_ai(void)
+void m68k_op_lea_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = EA_AY_AI_32();
 }
 
 
-void m68k_op_lea_32_di(void)
+void m68k_op_lea_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = EA_AY_DI_32();
 }
 
 
-void m68k_op_lea_32_ix(void)
+void m68k_op_lea_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = EA_AY_IX_32();
 }
 
 
-void m68k_op_lea_32_aw(void)
+void m68k_op_lea_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = EA_AW_32();
 }
 
 
-void m68k_op_lea_32_al(void)
+void m68k_op_lea_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = EA_AL_32();
 }
 
 
-void m68k_op_lea_32_pcdi(void)
+void m68k_op_lea_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = EA_PCDI_32();
 }
 
 
-void m68k_op_lea_32_pcix(void)
+void m68k_op_lea_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = EA_PCIX_32();
 }
 
 
-void m68k_op_link_16_a7(void)
+void m68k_op_link_16_a7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	REG_A[7] -= 4;
 	m68ki_write_32(REG_A[7], REG_A[7]);
@@ -4414,7 +4414,7 @@ void m68k_op_link_16_a7(void)
 }
 
 
-void m68k_op_link_16(void)
+void m68k_op_link_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AY;
 
@@ -4424,7 +4424,7 @@ void m68k_op_link_16(void)
 }
 
 
-void m68k_op_link_32_a7(void)
+void m68k_op_link_32_a7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4437,7 +4437,7 @@ void m68k_op_link_32_a7(void)
 }
 
 
-void m68k_op_link_32(void)
+void m68k_op_link_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -4452,7 +4452,7 @@ void m68k_op_link_32(void)
 }
 
 
-void m68k_op_lsr_8_s(void)
+void m68k_op_lsr_8_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -4471,7 +4471,7 @@ void m68k_op_lsr_8_s(void)
 }
 
 
-void m68k_op_lsr_16_s(void)
+void m68k_op_lsr_16_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -4490,7 +4490,7 @@ void m68k_op_lsr_16_s(void)
 }
 
 
-void m68k_op_lsr_32_s(void)
+void m68k_op_lsr_32_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -4509,7 +4509,7 @@ void m68k_op_lsr_32_s(void)
 }
 
 
-void m68k_op_lsr_8_r(void)
+void m68k_op_lsr_8_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -4546,7 +4546,7 @@ void m68k_op_lsr_8_r(void)
 }
 
 
-void m68k_op_lsr_16_r(void)
+void m68k_op_lsr_16_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -4583,7 +4583,7 @@ void m68k_op_lsr_16_r(void)
 }
 
 
-void m68k_op_lsr_32_r(void)
+void m68k_op_lsr_32_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -4619,7 +4619,7 @@ void m68k_op_lsr_32_r(void)
 }
 
 
-void m68k_op_lsr_16_ai(void)
+void m68k_op_lsr_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -4634,7 +4634,7 @@ void m68k_op_lsr_16_ai(void)
 }
 
 
-void m68k_op_lsr_16_pi(void)
+void m68k_op_lsr_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -4649,7 +4649,7 @@ void m68k_op_lsr_16_pi(void)
 }
 
 
-void m68k_op_lsr_16_pd(void)
+void m68k_op_lsr_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -4664,7 +4664,7 @@ void m68k_op_lsr_16_pd(void)
 }
 
 
-void m68k_op_lsr_16_di(void)
+void m68k_op_lsr_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -4679,7 +4679,7 @@ void m68k_op_lsr_16_di(void)
 }
 
 
-void m68k_op_lsr_16_ix(void)
+void m68k_op_lsr_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -4694,7 +4694,7 @@ void m68k_op_lsr_16_ix(void)
 }
 
 
-void m68k_op_lsr_16_aw(void)
+void m68k_op_lsr_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -4709,7 +4709,7 @@ void m68k_op_lsr_16_aw(void)
 }
 
 
-void m68k_op_lsr_16_al(void)
+void m68k_op_lsr_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -4724,7 +4724,7 @@ void m68k_op_lsr_16_al(void)
 }
 
 
-void m68k_op_lsl_8_s(void)
+void m68k_op_lsl_8_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -4743,7 +4743,7 @@ void m68k_op_lsl_8_s(void)
 }
 
 
-void m68k_op_lsl_16_s(void)
+void m68k_op_lsl_16_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -4762,7 +4762,7 @@ void m68k_op_lsl_16_s(void)
 }
 
 
-void m68k_op_lsl_32_s(void)
+void m68k_op_lsl_32_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -4781,7 +4781,7 @@ void m68k_op_lsl_32_s(void)
 }
 
 
-void m68k_op_lsl_8_r(void)
+void m68k_op_lsl_8_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -4818,7 +4818,7 @@ void m68k_op_lsl_8_r(void)
 }
 
 
-void m68k_op_lsl_16_r(void)
+void m68k_op_lsl_16_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -4855,7 +4855,7 @@ void m68k_op_lsl_16_r(void)
 }
 
 
-void m68k_op_lsl_32_r(void)
+void m68k_op_lsl_32_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
@@ -4891,7 +4891,7 @@ void m68k_op_lsl_32_r(void)
 }
 
 
-void m68k_op_lsl_16_ai(void)
+void m68k_op_lsl_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -4906,7 +4906,7 @@ void m68k_op_lsl_16_ai(void)
 }
 
 
-void m68k_op_lsl_16_pi(void)
+void m68k_op_lsl_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -4921,7 +4921,7 @@ void m68k_op_lsl_16_pi(void)
 }
 
 
-void m68k_op_lsl_16_pd(void)
+void m68k_op_lsl_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -4936,7 +4936,7 @@ void m68k_op_lsl_16_pd(void)
 }
 
 
-void m68k_op_lsl_16_di(void)
+void m68k_op_lsl_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -4951,7 +4951,7 @@ void m68k_op_lsl_16_di(void)
 }
 
 
-void m68k_op_lsl_16_ix(void)
+void m68k_op_lsl_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -4966,7 +4966,7 @@ void m68k_op_lsl_16_ix(void)
 }
 
 
-void m68k_op_lsl_16_aw(void)
+void m68k_op_lsl_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -4981,7 +4981,7 @@ void m68k_op_lsl_16_aw(void)
 }
 
 
-void m68k_op_lsl_16_al(void)
+void m68k_op_lsl_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -4996,7 +4996,7 @@ void m68k_op_lsl_16_al(void)
 }
 
 
-void m68k_op_move_8_d_d(void)
+void m68k_op_move_8_d_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 	uint* r_dst = &DX;
@@ -5010,7 +5010,7 @@ void m68k_op_move_8_d_d(void)
 }
 
 
-void m68k_op_move_8_d_ai(void)
+void m68k_op_move_8_d_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_8();
 	uint* r_dst = &DX;
@@ -5024,7 +5024,7 @@ void m68k_op_move_8_d_ai(void)
 }
 
 
-void m68k_op_move_8_d_pi(void)
+void m68k_op_move_8_d_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_8();
 	uint* r_dst = &DX;
@@ -5038,7 +5038,7 @@ void m68k_op_move_8_d_pi(void)
 }
 
 
-void m68k_op_move_8_d_pi7(void)
+void m68k_op_move_8_d_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PI_8();
 	uint* r_dst = &DX;
@@ -5052,7 +5052,7 @@ void m68k_op_move_8_d_pi7(void)
 }
 
 
-void m68k_op_move_8_d_pd(void)
+void m68k_op_move_8_d_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_8();
 	uint* r_dst = &DX;
@@ -5066,7 +5066,7 @@ void m68k_op_move_8_d_pd(void)
 }
 
 
-void m68k_op_move_8_d_pd7(void)
+void m68k_op_move_8_d_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PD_8();
 	uint* r_dst = &DX;
@@ -5080,7 +5080,7 @@ void m68k_op_move_8_d_pd7(void)
 }
 
 
-void m68k_op_move_8_d_di(void)
+void m68k_op_move_8_d_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_8();
 	uint* r_dst = &DX;
@@ -5094,7 +5094,7 @@ void m68k_op_move_8_d_di(void)
 }
 
 
-void m68k_op_move_8_d_ix(void)
+void m68k_op_move_8_d_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_8();
 	uint* r_dst = &DX;
@@ -5108,7 +5108,7 @@ void m68k_op_move_8_d_ix(void)
 }
 
 
-void m68k_op_move_8_d_aw(void)
+void m68k_op_move_8_d_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_8();
 	uint* r_dst = &DX;
@@ -5122,7 +5122,7 @@ void m68k_op_move_8_d_aw(void)
 }
 
 
-void m68k_op_move_8_d_al(void)
+void m68k_op_move_8_d_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_8();
 	uint* r_dst = &DX;
@@ -5136,7 +5136,7 @@ void m68k_op_move_8_d_al(void)
 }
 
 
-void m68k_op_move_8_d_pcdi(void)
+void m68k_op_move_8_d_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_8();
 	uint* r_dst = &DX;
@@ -5150,7 +5150,7 @@ void m68k_op_move_8_d_pcdi(void)
 }
 
 
-void m68k_op_move_8_d_pcix(void)
+void m68k_op_move_8_d_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_8();
 	uint* r_dst = &DX;
@@ -5164,7 +5164,7 @@ void m68k_op_move_8_d_pcix(void)
 }
 
 
-void m68k_op_move_8_d_i(void)
+void m68k_op_move_8_d_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_8();
 	uint* r_dst = &DX;
@@ -5178,7 +5178,7 @@ void m68k_op_move_8_d_i(void)
 }
 
 
-void m68k_op_move_8_ai_d(void)
+void m68k_op_move_8_ai_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 	uint ea = EA_AX_AI_8();
@@ -5192,7 +5192,7 @@ void m68k_op_move_8_ai_d(void)
 }
 
 
-void m68k_op_move_8_ai_ai(void)
+void m68k_op_move_8_ai_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_8();
 	uint ea = EA_AX_AI_8();
@@ -5206,7 +5206,7 @@ void m68k_op_move_8_ai_ai(void)
 }
 
 
-void m68k_op_move_8_ai_pi(void)
+void m68k_op_move_8_ai_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_8();
 	uint ea = EA_AX_AI_8();
@@ -5220,7 +5220,7 @@ void m68k_op_move_8_ai_pi(void)
 }
 
 
-void m68k_op_move_8_ai_pi7(void)
+void m68k_op_move_8_ai_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PI_8();
 	uint ea = EA_AX_AI_8();
@@ -5234,7 +5234,7 @@ void m68k_op_move_8_ai_pi7(void)
 }
 
 
-void m68k_op_move_8_ai_pd(void)
+void m68k_op_move_8_ai_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_8();
 	uint ea = EA_AX_AI_8();
@@ -5248,7 +5248,7 @@ void m68k_op_move_8_ai_pd(void)
 }
 
 
-void m68k_op_move_8_ai_pd7(void)
+void m68k_op_move_8_ai_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PD_8();
 	uint ea = EA_AX_AI_8();
@@ -5262,7 +5262,7 @@ void m68k_op_move_8_ai_pd7(void)
 }
 
 
-void m68k_op_move_8_ai_di(void)
+void m68k_op_move_8_ai_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_8();
 	uint ea = EA_AX_AI_8();
@@ -5276,7 +5276,7 @@ void m68k_op_move_8_ai_di(void)
 }
 
 
-void m68k_op_move_8_ai_ix(void)
+void m68k_op_move_8_ai_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_8();
 	uint ea = EA_AX_AI_8();
@@ -5290,7 +5290,7 @@ void m68k_op_move_8_ai_ix(void)
 }
 
 
-void m68k_op_move_8_ai_aw(void)
+void m68k_op_move_8_ai_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_8();
 	uint ea = EA_AX_AI_8();
@@ -5304,7 +5304,7 @@ void m68k_op_move_8_ai_aw(void)
 }
 
 
-void m68k_op_move_8_ai_al(void)
+void m68k_op_move_8_ai_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_8();
 	uint ea = EA_AX_AI_8();
@@ -5318,7 +5318,7 @@ void m68k_op_move_8_ai_al(void)
 }
 
 
-void m68k_op_move_8_ai_pcdi(void)
+void m68k_op_move_8_ai_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_8();
 	uint ea = EA_AX_AI_8();
@@ -5332,7 +5332,7 @@ void m68k_op_move_8_ai_pcdi(void)
 }
 
 
-void m68k_op_move_8_ai_pcix(void)
+void m68k_op_move_8_ai_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_8();
 	uint ea = EA_AX_AI_8();
@@ -5346,7 +5346,7 @@ void m68k_op_move_8_ai_pcix(void)
 }
 
 
-void m68k_op_move_8_ai_i(void)
+void m68k_op_move_8_ai_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_8();
 	uint ea = EA_AX_AI_8();
@@ -5360,7 +5360,7 @@ void m68k_op_move_8_ai_i(void)
 }
 
 
-void m68k_op_move_8_pi7_d(void)
+void m68k_op_move_8_pi7_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 	uint ea = EA_A7_PI_8();
@@ -5374,7 +5374,7 @@ void m68k_op_move_8_pi7_d(void)
 }
 
 
-void m68k_op_move_8_pi_d(void)
+void m68k_op_move_8_pi_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 	uint ea = EA_AX_PI_8();
@@ -5388,7 +5388,7 @@ void m68k_op_move_8_pi_d(void)
 }
 
 
-void m68k_op_move_8_pi7_ai(void)
+void m68k_op_move_8_pi7_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_8();
 	uint ea = EA_A7_PI_8();
@@ -5402,7 +5402,7 @@ void m68k_op_move_8_pi7_ai(void)
 }
 
 
-void m68k_op_move_8_pi7_pi(void)
+void m68k_op_move_8_pi7_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_8();
 	uint ea = EA_A7_PI_8();
@@ -5416,7 +5416,7 @@ void m68k_op_move_8_pi7_pi(void)
 }
 
 
-void m68k_op_move_8_pi7_pi7(void)
+void m68k_op_move_8_pi7_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PI_8();
 	uint ea = EA_A7_PI_8();
@@ -5430,7 +5430,7 @@ void m68k_op_move_8_pi7_pi7(void)
 }
 
 
-void m68k_op_move_8_pi7_pd(void)
+void m68k_op_move_8_pi7_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_8();
 	uint ea = EA_A7_PI_8();
@@ -5444,7 +5444,7 @@ void m68k_op_move_8_pi7_pd(void)
 }
 
 
-void m68k_op_move_8_pi7_pd7(void)
+void m68k_op_move_8_pi7_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PD_8();
 	uint ea = EA_A7_PI_8();
@@ -5458,7 +5458,7 @@ void m68k_op_move_8_pi7_pd7(void)
 }
 
 
-void m68k_op_move_8_pi7_di(void)
+void m68k_op_move_8_pi7_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_8();
 	uint ea = EA_A7_PI_8();
@@ -5472,7 +5472,7 @@ void m68k_op_move_8_pi7_di(void)
 }
 
 
-void m68k_op_move_8_pi7_ix(void)
+void m68k_op_move_8_pi7_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_8();
 	uint ea = EA_A7_PI_8();
@@ -5486,7 +5486,7 @@ void m68k_op_move_8_pi7_ix(void)
 }
 
 
-void m68k_op_move_8_pi7_aw(void)
+void m68k_op_move_8_pi7_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_8();
 	uint ea = EA_A7_PI_8();
@@ -5500,7 +5500,7 @@ void m68k_op_move_8_pi7_aw(void)
 }
 
 
-void m68k_op_move_8_pi7_al(void)
+void m68k_op_move_8_pi7_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_8();
 	uint ea = EA_A7_PI_8();
@@ -5514,7 +5514,7 @@ void m68k_op_move_8_pi7_al(void)
 }
 
 
-void m68k_op_move_8_pi7_pcdi(void)
+void m68k_op_move_8_pi7_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_8();
 	uint ea = EA_A7_PI_8();
@@ -5528,7 +5528,7 @@ void m68k_op_move_8_pi7_pcdi(void)
 }
 
 
-void m68k_op_move_8_pi7_pcix(void)
+void m68k_op_move_8_pi7_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_8();
 	uint ea = EA_A7_PI_8();
@@ -5542,7 +5542,7 @@ void m68k_op_move_8_pi7_pcix(void)
 }
 
 
-void m68k_op_move_8_pi7_i(void)
+void m68k_op_move_8_pi7_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_8();
 	uint ea = EA_A7_PI_8();
@@ -5556,7 +5556,7 @@ void m68k_op_move_8_pi7_i(void)
 }
 
 
-void m68k_op_move_8_pi_ai(void)
+void m68k_op_move_8_pi_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_8();
 	uint ea = EA_AX_PI_8();
@@ -5570,7 +5570,7 @@ void m68k_op_move_8_pi_ai(void)
 }
 
 
-void m68k_op_move_8_pi_pi(void)
+void m68k_op_move_8_pi_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_8();
 	uint ea = EA_AX_PI_8();
@@ -5584,7 +5584,7 @@ void m68k_op_move_8_pi_pi(void)
 }
 
 
-void m68k_op_move_8_pi_pi7(void)
+void m68k_op_move_8_pi_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PI_8();
 	uint ea = EA_AX_PI_8();
@@ -5598,7 +5598,7 @@ void m68k_op_move_8_pi_pi7(void)
 }
 
 
-void m68k_op_move_8_pi_pd(void)
+void m68k_op_move_8_pi_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_8();
 	uint ea = EA_AX_PI_8();
@@ -5612,7 +5612,7 @@ void m68k_op_move_8_pi_pd(void)
 }
 
 
-void m68k_op_move_8_pi_pd7(void)
+void m68k_op_move_8_pi_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PD_8();
 	uint ea = EA_AX_PI_8();
@@ -5626,7 +5626,7 @@ void m68k_op_move_8_pi_pd7(void)
 }
 
 
-void m68k_op_move_8_pi_di(void)
+void m68k_op_move_8_pi_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_8();
 	uint ea = EA_AX_PI_8();
@@ -5640,7 +5640,7 @@ void m68k_op_move_8_pi_di(void)
 }
 
 
-void m68k_op_move_8_pi_ix(void)
+void m68k_op_move_8_pi_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_8();
 	uint ea = EA_AX_PI_8();
@@ -5654,7 +5654,7 @@ void m68k_op_move_8_pi_ix(void)
 }
 
 
-void m68k_op_move_8_pi_aw(void)
+void m68k_op_move_8_pi_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_8();
 	uint ea = EA_AX_PI_8();
@@ -5668,7 +5668,7 @@ void m68k_op_move_8_pi_aw(void)
 }
 
 
-void m68k_op_move_8_pi_al(void)
+void m68k_op_move_8_pi_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_8();
 	uint ea = EA_AX_PI_8();
@@ -5682,7 +5682,7 @@ void m68k_op_move_8_pi_al(void)
 }
 
 
-void m68k_op_move_8_pi_pcdi(void)
+void m68k_op_move_8_pi_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_8();
 	uint ea = EA_AX_PI_8();
@@ -5696,7 +5696,7 @@ void m68k_op_move_8_pi_pcdi(void)
 }
 
 
-void m68k_op_move_8_pi_pcix(void)
+void m68k_op_move_8_pi_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_8();
 	uint ea = EA_AX_PI_8();
@@ -5710,7 +5710,7 @@ void m68k_op_move_8_pi_pcix(void)
 }
 
 
-void m68k_op_move_8_pi_i(void)
+void m68k_op_move_8_pi_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_8();
 	uint ea = EA_AX_PI_8();
@@ -5724,7 +5724,7 @@ void m68k_op_move_8_pi_i(void)
 }
 
 
-void m68k_op_move_8_pd7_d(void)
+void m68k_op_move_8_pd7_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 	uint ea = EA_A7_PD_8();
@@ -5738,7 +5738,7 @@ void m68k_op_move_8_pd7_d(void)
 }
 
 
-void m68k_op_move_8_pd_d(void)
+void m68k_op_move_8_pd_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 	uint ea = EA_AX_PD_8();
@@ -5752,7 +5752,7 @@ void m68k_op_move_8_pd_d(void)
 }
 
 
-void m68k_op_move_8_pd7_ai(void)
+void m68k_op_move_8_pd7_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_8();
 	uint ea = EA_A7_PD_8();
@@ -5766,7 +5766,7 @@ void m68k_op_move_8_pd7_ai(void)
 }
 
 
-void m68k_op_move_8_pd7_pi(void)
+void m68k_op_move_8_pd7_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_8();
 	uint ea = EA_A7_PD_8();
@@ -5780,7 +5780,7 @@ void m68k_op_move_8_pd7_pi(void)
 }
 
 
-void m68k_op_move_8_pd7_pi7(void)
+void m68k_op_move_8_pd7_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PI_8();
 	uint ea = EA_A7_PD_8();
@@ -5794,7 +5794,7 @@ void m68k_op_move_8_pd7_pi7(void)
 }
 
 
-void m68k_op_move_8_pd7_pd(void)
+void m68k_op_move_8_pd7_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_8();
 	uint ea = EA_A7_PD_8();
@@ -5808,7 +5808,7 @@ void m68k_op_move_8_pd7_pd(void)
 }
 
 
-void m68k_op_move_8_pd7_pd7(void)
+void m68k_op_move_8_pd7_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PD_8();
 	uint ea = EA_A7_PD_8();
@@ -5822,7 +5822,7 @@ void m68k_op_move_8_pd7_pd7(void)
 }
 
 
-void m68k_op_move_8_pd7_di(void)
+void m68k_op_move_8_pd7_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_8();
 	uint ea = EA_A7_PD_8();
@@ -5836,7 +5836,7 @@ void m68k_op_move_8_pd7_di(void)
 }
 
 
-void m68k_op_move_8_pd7_ix(void)
+void m68k_op_move_8_pd7_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_8();
 	uint ea = EA_A7_PD_8();
@@ -5850,7 +5850,7 @@ void m68k_op_move_8_pd7_ix(void)
 }
 
 
-void m68k_op_move_8_pd7_aw(void)
+void m68k_op_move_8_pd7_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_8();
 	uint ea = EA_A7_PD_8();
@@ -5864,7 +5864,7 @@ void m68k_op_move_8_pd7_aw(void)
 }
 
 
-void m68k_op_move_8_pd7_al(void)
+void m68k_op_move_8_pd7_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_8();
 	uint ea = EA_A7_PD_8();
@@ -5878,7 +5878,7 @@ void m68k_op_move_8_pd7_al(void)
 }
 
 
-void m68k_op_move_8_pd7_pcdi(void)
+void m68k_op_move_8_pd7_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_8();
 	uint ea = EA_A7_PD_8();
@@ -5892,7 +5892,7 @@ void m68k_op_move_8_pd7_pcdi(void)
 }
 
 
-void m68k_op_move_8_pd7_pcix(void)
+void m68k_op_move_8_pd7_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_8();
 	uint ea = EA_A7_PD_8();
@@ -5906,7 +5906,7 @@ void m68k_op_move_8_pd7_pcix(void)
 }
 
 
-void m68k_op_move_8_pd7_i(void)
+void m68k_op_move_8_pd7_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_8();
 	uint ea = EA_A7_PD_8();
@@ -5920,7 +5920,7 @@ void m68k_op_move_8_pd7_i(void)
 }
 
 
-void m68k_op_move_8_pd_ai(void)
+void m68k_op_move_8_pd_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_8();
 	uint ea = EA_AX_PD_8();
@@ -5934,7 +5934,7 @@ void m68k_op_move_8_pd_ai(void)
 }
 
 
-void m68k_op_move_8_pd_pi(void)
+void m68k_op_move_8_pd_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_8();
 	uint ea = EA_AX_PD_8();
@@ -5948,7 +5948,7 @@ void m68k_op_move_8_pd_pi(void)
 }
 
 
-void m68k_op_move_8_pd_pi7(void)
+void m68k_op_move_8_pd_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PI_8();
 	uint ea = EA_AX_PD_8();
@@ -5962,7 +5962,7 @@ void m68k_op_move_8_pd_pi7(void)
 }
 
 
-void m68k_op_move_8_pd_pd(void)
+void m68k_op_move_8_pd_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_8();
 	uint ea = EA_AX_PD_8();
@@ -5976,7 +5976,7 @@ void m68k_op_move_8_pd_pd(void)
 }
 
 
-void m68k_op_move_8_pd_pd7(void)
+void m68k_op_move_8_pd_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PD_8();
 	uint ea = EA_AX_PD_8();
@@ -5990,7 +5990,7 @@ void m68k_op_move_8_pd_pd7(void)
 }
 
 
-void m68k_op_move_8_pd_di(void)
+void m68k_op_move_8_pd_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_8();
 	uint ea = EA_AX_PD_8();
@@ -6004,7 +6004,7 @@ void m68k_op_move_8_pd_di(void)
 }
 
 
-void m68k_op_move_8_pd_ix(void)
+void m68k_op_move_8_pd_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_8();
 	uint ea = EA_AX_PD_8();
@@ -6018,7 +6018,7 @@ void m68k_op_move_8_pd_ix(void)
 }
 
 
-void m68k_op_move_8_pd_aw(void)
+void m68k_op_move_8_pd_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_8();
 	uint ea = EA_AX_PD_8();
@@ -6032,7 +6032,7 @@ void m68k_op_move_8_pd_aw(void)
 }
 
 
-void m68k_op_move_8_pd_al(void)
+void m68k_op_move_8_pd_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_8();
 	uint ea = EA_AX_PD_8();
@@ -6046,7 +6046,7 @@ void m68k_op_move_8_pd_al(void)
 }
 
 
-void m68k_op_move_8_pd_pcdi(void)
+void m68k_op_move_8_pd_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_8();
 	uint ea = EA_AX_PD_8();
@@ -6060,7 +6060,7 @@ void m68k_op_move_8_pd_pcdi(void)
 }
 
 
-void m68k_op_move_8_pd_pcix(void)
+void m68k_op_move_8_pd_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_8();
 	uint ea = EA_AX_PD_8();
@@ -6074,7 +6074,7 @@ void m68k_op_move_8_pd_pcix(void)
 }
 
 
-void m68k_op_move_8_pd_i(void)
+void m68k_op_move_8_pd_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_8();
 	uint ea = EA_AX_PD_8();
@@ -6088,7 +6088,7 @@ void m68k_op_move_8_pd_i(void)
 }
 
 
-void m68k_op_move_8_di_d(void)
+void m68k_op_move_8_di_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 	uint ea = EA_AX_DI_8();
@@ -6102,7 +6102,7 @@ void m68k_op_move_8_di_d(void)
 }
 
 
-void m68k_op_move_8_di_ai(void)
+void m68k_op_move_8_di_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_8();
 	uint ea = EA_AX_DI_8();
@@ -6116,7 +6116,7 @@ void m68k_op_move_8_di_ai(void)
 }
 
 
-void m68k_op_move_8_di_pi(void)
+void m68k_op_move_8_di_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_8();
 	uint ea = EA_AX_DI_8();
@@ -6130,7 +6130,7 @@ void m68k_op_move_8_di_pi(void)
 }
 
 
-void m68k_op_move_8_di_pi7(void)
+void m68k_op_move_8_di_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PI_8();
 	uint ea = EA_AX_DI_8();
@@ -6144,7 +6144,7 @@ void m68k_op_move_8_di_pi7(void)
 }
 
 
-void m68k_op_move_8_di_pd(void)
+void m68k_op_move_8_di_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_8();
 	uint ea = EA_AX_DI_8();
@@ -6158,7 +6158,7 @@ void m68k_op_move_8_di_pd(void)
 }
 
 
-void m68k_op_move_8_di_pd7(void)
+void m68k_op_move_8_di_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PD_8();
 	uint ea = EA_AX_DI_8();
@@ -6172,7 +6172,7 @@ void m68k_op_move_8_di_pd7(void)
 }
 
 
-void m68k_op_move_8_di_di(void)
+void m68k_op_move_8_di_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_8();
 	uint ea = EA_AX_DI_8();
@@ -6186,7 +6186,7 @@ void m68k_op_move_8_di_di(void)
 }
 
 
-void m68k_op_move_8_di_ix(void)
+void m68k_op_move_8_di_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_8();
 	uint ea = EA_AX_DI_8();
@@ -6200,7 +6200,7 @@ void m68k_op_move_8_di_ix(void)
 }
 
 
-void m68k_op_move_8_di_aw(void)
+void m68k_op_move_8_di_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_8();
 	uint ea = EA_AX_DI_8();
@@ -6214,7 +6214,7 @@ void m68k_op_move_8_di_aw(void)
 }
 
 
-void m68k_op_move_8_di_al(void)
+void m68k_op_move_8_di_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_8();
 	uint ea = EA_AX_DI_8();
@@ -6228,7 +6228,7 @@ void m68k_op_move_8_di_al(void)
 }
 
 
-void m68k_op_move_8_di_pcdi(void)
+void m68k_op_move_8_di_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_8();
 	uint ea = EA_AX_DI_8();
@@ -6242,7 +6242,7 @@ void m68k_op_move_8_di_pcdi(void)
 }
 
 
-void m68k_op_move_8_di_pcix(void)
+void m68k_op_move_8_di_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_8();
 	uint ea = EA_AX_DI_8();
@@ -6256,7 +6256,7 @@ void m68k_op_move_8_di_pcix(void)
 }
 
 
-void m68k_op_move_8_di_i(void)
+void m68k_op_move_8_di_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_8();
 	uint ea = EA_AX_DI_8();
@@ -6270,7 +6270,7 @@ void m68k_op_move_8_di_i(void)
 }
 
 
-void m68k_op_move_8_ix_d(void)
+void m68k_op_move_8_ix_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 	uint ea = EA_AX_IX_8();
@@ -6284,7 +6284,7 @@ void m68k_op_move_8_ix_d(void)
 }
 
 
-void m68k_op_move_8_ix_ai(void)
+void m68k_op_move_8_ix_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_8();
 	uint ea = EA_AX_IX_8();
@@ -6298,7 +6298,7 @@ void m68k_op_move_8_ix_ai(void)
 }
 
 
-void m68k_op_move_8_ix_pi(void)
+void m68k_op_move_8_ix_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_8();
 	uint ea = EA_AX_IX_8();
@@ -6312,7 +6312,7 @@ void m68k_op_move_8_ix_pi(void)
 }
 
 
-void m68k_op_move_8_ix_pi7(void)
+void m68k_op_move_8_ix_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PI_8();
 	uint ea = EA_AX_IX_8();
@@ -6326,7 +6326,7 @@ void m68k_op_move_8_ix_pi7(void)
 }
 
 
-void m68k_op_move_8_ix_pd(void)
+void m68k_op_move_8_ix_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_8();
 	uint ea = EA_AX_IX_8();
@@ -6340,7 +6340,7 @@ void m68k_op_move_8_ix_pd(void)
 }
 
 
-void m68k_op_move_8_ix_pd7(void)
+void m68k_op_move_8_ix_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PD_8();
 	uint ea = EA_AX_IX_8();
@@ -6354,7 +6354,7 @@ void m68k_op_move_8_ix_pd7(void)
 }
 
 
-void m68k_op_move_8_ix_di(void)
+void m68k_op_move_8_ix_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_8();
 	uint ea = EA_AX_IX_8();
@@ -6368,7 +6368,7 @@ void m68k_op_move_8_ix_di(void)
 }
 
 
-void m68k_op_move_8_ix_ix(void)
+void m68k_op_move_8_ix_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_8();
 	uint ea = EA_AX_IX_8();
@@ -6382,7 +6382,7 @@ void m68k_op_move_8_ix_ix(void)
 }
 
 
-void m68k_op_move_8_ix_aw(void)
+void m68k_op_move_8_ix_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_8();
 	uint ea = EA_AX_IX_8();
@@ -6396,7 +6396,7 @@ void m68k_op_move_8_ix_aw(void)
 }
 
 
-void m68k_op_move_8_ix_al(void)
+void m68k_op_move_8_ix_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_8();
 	uint ea = EA_AX_IX_8();
@@ -6410,7 +6410,7 @@ void m68k_op_move_8_ix_al(void)
 }
 
 
-void m68k_op_move_8_ix_pcdi(void)
+void m68k_op_move_8_ix_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_8();
 	uint ea = EA_AX_IX_8();
@@ -6424,7 +6424,7 @@ void m68k_op_move_8_ix_pcdi(void)
 }
 
 
-void m68k_op_move_8_ix_pcix(void)
+void m68k_op_move_8_ix_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_8();
 	uint ea = EA_AX_IX_8();
@@ -6438,7 +6438,7 @@ void m68k_op_move_8_ix_pcix(void)
 }
 
 
-void m68k_op_move_8_ix_i(void)
+void m68k_op_move_8_ix_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_8();
 	uint ea = EA_AX_IX_8();
@@ -6452,7 +6452,7 @@ void m68k_op_move_8_ix_i(void)
 }
 
 
-void m68k_op_move_8_aw_d(void)
+void m68k_op_move_8_aw_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 	uint ea = EA_AW_8();
@@ -6466,7 +6466,7 @@ void m68k_op_move_8_aw_d(void)
 }
 
 
-void m68k_op_move_8_aw_ai(void)
+void m68k_op_move_8_aw_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_8();
 	uint ea = EA_AW_8();
@@ -6480,7 +6480,7 @@ void m68k_op_move_8_aw_ai(void)
 }
 
 
-void m68k_op_move_8_aw_pi(void)
+void m68k_op_move_8_aw_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_8();
 	uint ea = EA_AW_8();
@@ -6494,7 +6494,7 @@ void m68k_op_move_8_aw_pi(void)
 }
 
 
-void m68k_op_move_8_aw_pi7(void)
+void m68k_op_move_8_aw_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PI_8();
 	uint ea = EA_AW_8();
@@ -6508,7 +6508,7 @@ void m68k_op_move_8_aw_pi7(void)
 }
 
 
-void m68k_op_move_8_aw_pd(void)
+void m68k_op_move_8_aw_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_8();
 	uint ea = EA_AW_8();
@@ -6522,7 +6522,7 @@ void m68k_op_move_8_aw_pd(void)
 }
 
 
-void m68k_op_move_8_aw_pd7(void)
+void m68k_op_move_8_aw_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PD_8();
 	uint ea = EA_AW_8();
@@ -6536,7 +6536,7 @@ void m68k_op_move_8_aw_pd7(void)
 }
 
 
-void m68k_op_move_8_aw_di(void)
+void m68k_op_move_8_aw_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_8();
 	uint ea = EA_AW_8();
@@ -6550,7 +6550,7 @@ void m68k_op_move_8_aw_di(void)
 }
 
 
-void m68k_op_move_8_aw_ix(void)
+void m68k_op_move_8_aw_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_8();
 	uint ea = EA_AW_8();
@@ -6564,7 +6564,7 @@ void m68k_op_move_8_aw_ix(void)
 }
 
 
-void m68k_op_move_8_aw_aw(void)
+void m68k_op_move_8_aw_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_8();
 	uint ea = EA_AW_8();
@@ -6578,7 +6578,7 @@ void m68k_op_move_8_aw_aw(void)
 }
 
 
-void m68k_op_move_8_aw_al(void)
+void m68k_op_move_8_aw_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_8();
 	uint ea = EA_AW_8();
@@ -6592,7 +6592,7 @@ void m68k_op_move_8_aw_al(void)
 }
 
 
-void m68k_op_move_8_aw_pcdi(void)
+void m68k_op_move_8_aw_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_8();
 	uint ea = EA_AW_8();
@@ -6606,7 +6606,7 @@ void m68k_op_move_8_aw_pcdi(void)
 }
 
 
-void m68k_op_move_8_aw_pcix(void)
+void m68k_op_move_8_aw_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_8();
 	uint ea = EA_AW_8();
@@ -6620,7 +6620,7 @@ void m68k_op_move_8_aw_pcix(void)
 }
 
 
-void m68k_op_move_8_aw_i(void)
+void m68k_op_move_8_aw_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_8();
 	uint ea = EA_AW_8();
@@ -6634,7 +6634,7 @@ void m68k_op_move_8_aw_i(void)
 }
 
 
-void m68k_op_move_8_al_d(void)
+void m68k_op_move_8_al_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 	uint ea = EA_AL_8();
@@ -6648,7 +6648,7 @@ void m68k_op_move_8_al_d(void)
 }
 
 
-void m68k_op_move_8_al_ai(void)
+void m68k_op_move_8_al_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_8();
 	uint ea = EA_AL_8();
@@ -6662,7 +6662,7 @@ void m68k_op_move_8_al_ai(void)
 }
 
 
-void m68k_op_move_8_al_pi(void)
+void m68k_op_move_8_al_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_8();
 	uint ea = EA_AL_8();
@@ -6676,7 +6676,7 @@ void m68k_op_move_8_al_pi(void)
 }
 
 
-void m68k_op_move_8_al_pi7(void)
+void m68k_op_move_8_al_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PI_8();
 	uint ea = EA_AL_8();
@@ -6690,7 +6690,7 @@ void m68k_op_move_8_al_pi7(void)
 }
 
 
-void m68k_op_move_8_al_pd(void)
+void m68k_op_move_8_al_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_8();
 	uint ea = EA_AL_8();
@@ -6704,7 +6704,7 @@ void m68k_op_move_8_al_pd(void)
 }
 
 
-void m68k_op_move_8_al_pd7(void)
+void m68k_op_move_8_al_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PD_8();
 	uint ea = EA_AL_8();
@@ -6718,7 +6718,7 @@ void m68k_op_move_8_al_pd7(void)
 }
 
 
-void m68k_op_move_8_al_di(void)
+void m68k_op_move_8_al_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_8();
 	uint ea = EA_AL_8();
@@ -6732,7 +6732,7 @@ void m68k_op_move_8_al_di(void)
 }
 
 
-void m68k_op_move_8_al_ix(void)
+void m68k_op_move_8_al_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_8();
 	uint ea = EA_AL_8();
@@ -6746,7 +6746,7 @@ void m68k_op_move_8_al_ix(void)
 }
 
 
-void m68k_op_move_8_al_aw(void)
+void m68k_op_move_8_al_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_8();
 	uint ea = EA_AL_8();
@@ -6760,7 +6760,7 @@ void m68k_op_move_8_al_aw(void)
 }
 
 
-void m68k_op_move_8_al_al(void)
+void m68k_op_move_8_al_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_8();
 	uint ea = EA_AL_8();
@@ -6774,7 +6774,7 @@ void m68k_op_move_8_al_al(void)
 }
 
 
-void m68k_op_move_8_al_pcdi(void)
+void m68k_op_move_8_al_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_8();
 	uint ea = EA_AL_8();
@@ -6788,7 +6788,7 @@ void m68k_op_move_8_al_pcdi(void)
 }
 
 
-void m68k_op_move_8_al_pcix(void)
+void m68k_op_move_8_al_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_8();
 	uint ea = EA_AL_8();
@@ -6802,7 +6802,7 @@ void m68k_op_move_8_al_pcix(void)
 }
 
 
-void m68k_op_move_8_al_i(void)
+void m68k_op_move_8_al_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_8();
 	uint ea = EA_AL_8();
@@ -6816,7 +6816,7 @@ void m68k_op_move_8_al_i(void)
 }
 
 
-void m68k_op_move_16_d_d(void)
+void m68k_op_move_16_d_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY);
 	uint* r_dst = &DX;
@@ -6830,7 +6830,7 @@ void m68k_op_move_16_d_d(void)
 }
 
 
-void m68k_op_move_16_d_a(void)
+void m68k_op_move_16_d_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(AY);
 	uint* r_dst = &DX;
@@ -6844,7 +6844,7 @@ void m68k_op_move_16_d_a(void)
 }
 
 
-void m68k_op_move_16_d_ai(void)
+void m68k_op_move_16_d_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_16();
 	uint* r_dst = &DX;
@@ -6858,7 +6858,7 @@ void m68k_op_move_16_d_ai(void)
 }
 
 
-void m68k_op_move_16_d_pi(void)
+void m68k_op_move_16_d_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_16();
 	uint* r_dst = &DX;
@@ -6872,7 +6872,7 @@ void m68k_op_move_16_d_pi(void)
 }
 
 
-void m68k_op_move_16_d_pd(void)
+void m68k_op_move_16_d_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_16();
 	uint* r_dst = &DX;
@@ -6886,7 +6886,7 @@ void m68k_op_move_16_d_pd(void)
 }
 
 
-void m68k_op_move_16_d_di(void)
+void m68k_op_move_16_d_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_16();
 	uint* r_dst = &DX;
@@ -6900,7 +6900,7 @@ void m68k_op_move_16_d_di(void)
 }
 
 
-void m68k_op_move_16_d_ix(void)
+void m68k_op_move_16_d_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_16();
 	uint* r_dst = &DX;
@@ -6914,7 +6914,7 @@ void m68k_op_move_16_d_ix(void)
 }
 
 
-void m68k_op_move_16_d_aw(void)
+void m68k_op_move_16_d_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_16();
 	uint* r_dst = &DX;
@@ -6928,7 +6928,7 @@ void m68k_op_move_16_d_aw(void)
 }
 
 
-void m68k_op_move_16_d_al(void)
+void m68k_op_move_16_d_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_16();
 	uint* r_dst = &DX;
@@ -6942,7 +6942,7 @@ void m68k_op_move_16_d_al(void)
 }
 
 
-void m68k_op_move_16_d_pcdi(void)
+void m68k_op_move_16_d_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_16();
 	uint* r_dst = &DX;
@@ -6956,7 +6956,7 @@ void m68k_op_move_16_d_pcdi(void)
 }
 
 
-void m68k_op_move_16_d_pcix(void)
+void m68k_op_move_16_d_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_16();
 	uint* r_dst = &DX;
@@ -6970,7 +6970,7 @@ void m68k_op_move_16_d_pcix(void)
 }
 
 
-void m68k_op_move_16_d_i(void)
+void m68k_op_move_16_d_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_16();
 	uint* r_dst = &DX;
@@ -6984,7 +6984,7 @@ void m68k_op_move_16_d_i(void)
 }
 
 
-void m68k_op_move_16_ai_d(void)
+void m68k_op_move_16_ai_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY);
 	uint ea = EA_AX_AI_16();
@@ -6998,7 +6998,7 @@ void m68k_op_move_16_ai_d(void)
 }
 
 
-void m68k_op_move_16_ai_a(void)
+void m68k_op_move_16_ai_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(AY);
 	uint ea = EA_AX_AI_16();
@@ -7012,7 +7012,7 @@ void m68k_op_move_16_ai_a(void)
 }
 
 
-void m68k_op_move_16_ai_ai(void)
+void m68k_op_move_16_ai_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_16();
 	uint ea = EA_AX_AI_16();
@@ -7026,7 +7026,7 @@ void m68k_op_move_16_ai_ai(void)
 }
 
 
-void m68k_op_move_16_ai_pi(void)
+void m68k_op_move_16_ai_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_16();
 	uint ea = EA_AX_AI_16();
@@ -7040,7 +7040,7 @@ void m68k_op_move_16_ai_pi(void)
 }
 
 
-void m68k_op_move_16_ai_pd(void)
+void m68k_op_move_16_ai_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_16();
 	uint ea = EA_AX_AI_16();
@@ -7054,7 +7054,7 @@ void m68k_op_move_16_ai_pd(void)
 }
 
 
-void m68k_op_move_16_ai_di(void)
+void m68k_op_move_16_ai_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_16();
 	uint ea = EA_AX_AI_16();
@@ -7068,7 +7068,7 @@ void m68k_op_move_16_ai_di(void)
 }
 
 
-void m68k_op_move_16_ai_ix(void)
+void m68k_op_move_16_ai_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_16();
 	uint ea = EA_AX_AI_16();
@@ -7082,7 +7082,7 @@ void m68k_op_move_16_ai_ix(void)
 }
 
 
-void m68k_op_move_16_ai_aw(void)
+void m68k_op_move_16_ai_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_16();
 	uint ea = EA_AX_AI_16();
@@ -7096,7 +7096,7 @@ void m68k_op_move_16_ai_aw(void)
 }
 
 
-void m68k_op_move_16_ai_al(void)
+void m68k_op_move_16_ai_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_16();
 	uint ea = EA_AX_AI_16();
@@ -7110,7 +7110,7 @@ void m68k_op_move_16_ai_al(void)
 }
 
 
-void m68k_op_move_16_ai_pcdi(void)
+void m68k_op_move_16_ai_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_16();
 	uint ea = EA_AX_AI_16();
@@ -7124,7 +7124,7 @@ void m68k_op_move_16_ai_pcdi(void)
 }
 
 
-void m68k_op_move_16_ai_pcix(void)
+void m68k_op_move_16_ai_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_16();
 	uint ea = EA_AX_AI_16();
@@ -7138,7 +7138,7 @@ void m68k_op_move_16_ai_pcix(void)
 }
 
 
-void m68k_op_move_16_ai_i(void)
+void m68k_op_move_16_ai_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_16();
 	uint ea = EA_AX_AI_16();
@@ -7152,7 +7152,7 @@ void m68k_op_move_16_ai_i(void)
 }
 
 
-void m68k_op_move_16_pi_d(void)
+void m68k_op_move_16_pi_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY);
 	uint ea = EA_AX_PI_16();
@@ -7166,7 +7166,7 @@ void m68k_op_move_16_pi_d(void)
 }
 
 
-void m68k_op_move_16_pi_a(void)
+void m68k_op_move_16_pi_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(AY);
 	uint ea = EA_AX_PI_16();
@@ -7180,7 +7180,7 @@ void m68k_op_move_16_pi_a(void)
 }
 
 
-void m68k_op_move_16_pi_ai(void)
+void m68k_op_move_16_pi_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_16();
 	uint ea = EA_AX_PI_16();
@@ -7194,7 +7194,7 @@ void m68k_op_move_16_pi_ai(void)
 }
 
 
-void m68k_op_move_16_pi_pi(void)
+void m68k_op_move_16_pi_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_16();
 	uint ea = EA_AX_PI_16();
@@ -7208,7 +7208,7 @@ void m68k_op_move_16_pi_pi(void)
 }
 
 
-void m68k_op_move_16_pi_pd(void)
+void m68k_op_move_16_pi_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_16();
 	uint ea = EA_AX_PI_16();
@@ -7222,7 +7222,7 @@ void m68k_op_move_16_pi_pd(void)
 }
 
 
-void m68k_op_move_16_pi_di(void)
+void m68k_op_move_16_pi_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_16();
 	uint ea = EA_AX_PI_16();
@@ -7236,7 +7236,7 @@ void m68k_op_move_16_pi_di(void)
 }
 
 
-void m68k_op_move_16_pi_ix(void)
+void m68k_op_move_16_pi_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_16();
 	uint ea = EA_AX_PI_16();
@@ -7250,7 +7250,7 @@ void m68k_op_move_16_pi_ix(void)
 }
 
 
-void m68k_op_move_16_pi_aw(void)
+void m68k_op_move_16_pi_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_16();
 	uint ea = EA_AX_PI_16();
@@ -7264,7 +7264,7 @@ void m68k_op_move_16_pi_aw(void)
 }
 
 
-void m68k_op_move_16_pi_al(void)
+void m68k_op_move_16_pi_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_16();
 	uint ea = EA_AX_PI_16();
@@ -7278,7 +7278,7 @@ void m68k_op_move_16_pi_al(void)
 }
 
 
-void m68k_op_move_16_pi_pcdi(void)
+void m68k_op_move_16_pi_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_16();
 	uint ea = EA_AX_PI_16();
@@ -7292,7 +7292,7 @@ void m68k_op_move_16_pi_pcdi(void)
 }
 
 
-void m68k_op_move_16_pi_pcix(void)
+void m68k_op_move_16_pi_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_16();
 	uint ea = EA_AX_PI_16();
@@ -7306,7 +7306,7 @@ void m68k_op_move_16_pi_pcix(void)
 }
 
 
-void m68k_op_move_16_pi_i(void)
+void m68k_op_move_16_pi_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_16();
 	uint ea = EA_AX_PI_16();
@@ -7320,7 +7320,7 @@ void m68k_op_move_16_pi_i(void)
 }
 
 
-void m68k_op_move_16_pd_d(void)
+void m68k_op_move_16_pd_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY);
 	uint ea = EA_AX_PD_16();
@@ -7334,7 +7334,7 @@ void m68k_op_move_16_pd_d(void)
 }
 
 
-void m68k_op_move_16_pd_a(void)
+void m68k_op_move_16_pd_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(AY);
 	uint ea = EA_AX_PD_16();
@@ -7348,7 +7348,7 @@ void m68k_op_move_16_pd_a(void)
 }
 
 
-void m68k_op_move_16_pd_ai(void)
+void m68k_op_move_16_pd_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_16();
 	uint ea = EA_AX_PD_16();
@@ -7362,7 +7362,7 @@ void m68k_op_move_16_pd_ai(void)
 }
 
 
-void m68k_op_move_16_pd_pi(void)
+void m68k_op_move_16_pd_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_16();
 	uint ea = EA_AX_PD_16();
@@ -7376,7 +7376,7 @@ void m68k_op_move_16_pd_pi(void)
 }
 
 
-void m68k_op_move_16_pd_pd(void)
+void m68k_op_move_16_pd_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_16();
 	uint ea = EA_AX_PD_16();
@@ -7390,7 +7390,7 @@ void m68k_op_move_16_pd_pd(void)
 }
 
 
-void m68k_op_move_16_pd_di(void)
+void m68k_op_move_16_pd_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_16();
 	uint ea = EA_AX_PD_16();
@@ -7404,7 +7404,7 @@ void m68k_op_move_16_pd_di(void)
 }
 
 
-void m68k_op_move_16_pd_ix(void)
+void m68k_op_move_16_pd_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_16();
 	uint ea = EA_AX_PD_16();
@@ -7418,7 +7418,7 @@ void m68k_op_move_16_pd_ix(void)
 }
 
 
-void m68k_op_move_16_pd_aw(void)
+void m68k_op_move_16_pd_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_16();
 	uint ea = EA_AX_PD_16();
@@ -7432,7 +7432,7 @@ void m68k_op_move_16_pd_aw(void)
 }
 
 
-void m68k_op_move_16_pd_al(void)
+void m68k_op_move_16_pd_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_16();
 	uint ea = EA_AX_PD_16();
@@ -7446,7 +7446,7 @@ void m68k_op_move_16_pd_al(void)
 }
 
 
-void m68k_op_move_16_pd_pcdi(void)
+void m68k_op_move_16_pd_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_16();
 	uint ea = EA_AX_PD_16();
@@ -7460,7 +7460,7 @@ void m68k_op_move_16_pd_pcdi(void)
 }
 
 
-void m68k_op_move_16_pd_pcix(void)
+void m68k_op_move_16_pd_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_16();
 	uint ea = EA_AX_PD_16();
@@ -7474,7 +7474,7 @@ void m68k_op_move_16_pd_pcix(void)
 }
 
 
-void m68k_op_move_16_pd_i(void)
+void m68k_op_move_16_pd_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_16();
 	uint ea = EA_AX_PD_16();
@@ -7488,7 +7488,7 @@ void m68k_op_move_16_pd_i(void)
 }
 
 
-void m68k_op_move_16_di_d(void)
+void m68k_op_move_16_di_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY);
 	uint ea = EA_AX_DI_16();
@@ -7502,7 +7502,7 @@ void m68k_op_move_16_di_d(void)
 }
 
 
-void m68k_op_move_16_di_a(void)
+void m68k_op_move_16_di_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(AY);
 	uint ea = EA_AX_DI_16();
@@ -7516,7 +7516,7 @@ void m68k_op_move_16_di_a(void)
 }
 
 
-void m68k_op_move_16_di_ai(void)
+void m68k_op_move_16_di_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_16();
 	uint ea = EA_AX_DI_16();
@@ -7530,7 +7530,7 @@ void m68k_op_move_16_di_ai(void)
 }
 
 
-void m68k_op_move_16_di_pi(void)
+void m68k_op_move_16_di_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_16();
 	uint ea = EA_AX_DI_16();
@@ -7544,7 +7544,7 @@ void m68k_op_move_16_di_pi(void)
 }
 
 
-void m68k_op_move_16_di_pd(void)
+void m68k_op_move_16_di_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_16();
 	uint ea = EA_AX_DI_16();
@@ -7558,7 +7558,7 @@ void m68k_op_move_16_di_pd(void)
 }
 
 
-void m68k_op_move_16_di_di(void)
+void m68k_op_move_16_di_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_16();
 	uint ea = EA_AX_DI_16();
@@ -7572,7 +7572,7 @@ void m68k_op_move_16_di_di(void)
 }
 
 
-void m68k_op_move_16_di_ix(void)
+void m68k_op_move_16_di_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_16();
 	uint ea = EA_AX_DI_16();
@@ -7586,7 +7586,7 @@ void m68k_op_move_16_di_ix(void)
 }
 
 
-void m68k_op_move_16_di_aw(void)
+void m68k_op_move_16_di_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_16();
 	uint ea = EA_AX_DI_16();
@@ -7600,7 +7600,7 @@ void m68k_op_move_16_di_aw(void)
 }
 
 
-void m68k_op_move_16_di_al(void)
+void m68k_op_move_16_di_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_16();
 	uint ea = EA_AX_DI_16();
@@ -7614,7 +7614,7 @@ void m68k_op_move_16_di_al(void)
 }
 
 
-void m68k_op_move_16_di_pcdi(void)
+void m68k_op_move_16_di_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_16();
 	uint ea = EA_AX_DI_16();
@@ -7628,7 +7628,7 @@ void m68k_op_move_16_di_pcdi(void)
 }
 
 
-void m68k_op_move_16_di_pcix(void)
+void m68k_op_move_16_di_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_16();
 	uint ea = EA_AX_DI_16();
@@ -7642,7 +7642,7 @@ void m68k_op_move_16_di_pcix(void)
 }
 
 
-void m68k_op_move_16_di_i(void)
+void m68k_op_move_16_di_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_16();
 	uint ea = EA_AX_DI_16();
@@ -7656,7 +7656,7 @@ void m68k_op_move_16_di_i(void)
 }
 
 
-void m68k_op_move_16_ix_d(void)
+void m68k_op_move_16_ix_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY);
 	uint ea = EA_AX_IX_16();
@@ -7670,7 +7670,7 @@ void m68k_op_move_16_ix_d(void)
 }
 
 
-void m68k_op_move_16_ix_a(void)
+void m68k_op_move_16_ix_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(AY);
 	uint ea = EA_AX_IX_16();
@@ -7684,7 +7684,7 @@ void m68k_op_move_16_ix_a(void)
 }
 
 
-void m68k_op_move_16_ix_ai(void)
+void m68k_op_move_16_ix_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_16();
 	uint ea = EA_AX_IX_16();
@@ -7698,7 +7698,7 @@ void m68k_op_move_16_ix_ai(void)
 }
 
 
-void m68k_op_move_16_ix_pi(void)
+void m68k_op_move_16_ix_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_16();
 	uint ea = EA_AX_IX_16();
@@ -7712,7 +7712,7 @@ void m68k_op_move_16_ix_pi(void)
 }
 
 
-void m68k_op_move_16_ix_pd(void)
+void m68k_op_move_16_ix_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_16();
 	uint ea = EA_AX_IX_16();
@@ -7726,7 +7726,7 @@ void m68k_op_move_16_ix_pd(void)
 }
 
 
-void m68k_op_move_16_ix_di(void)
+void m68k_op_move_16_ix_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_16();
 	uint ea = EA_AX_IX_16();
@@ -7740,7 +7740,7 @@ void m68k_op_move_16_ix_di(void)
 }
 
 
-void m68k_op_move_16_ix_ix(void)
+void m68k_op_move_16_ix_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_16();
 	uint ea = EA_AX_IX_16();
@@ -7754,7 +7754,7 @@ void m68k_op_move_16_ix_ix(void)
 }
 
 
-void m68k_op_move_16_ix_aw(void)
+void m68k_op_move_16_ix_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_16();
 	uint ea = EA_AX_IX_16();
@@ -7768,7 +7768,7 @@ void m68k_op_move_16_ix_aw(void)
 }
 
 
-void m68k_op_move_16_ix_al(void)
+void m68k_op_move_16_ix_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_16();
 	uint ea = EA_AX_IX_16();
@@ -7782,7 +7782,7 @@ void m68k_op_move_16_ix_al(void)
 }
 
 
-void m68k_op_move_16_ix_pcdi(void)
+void m68k_op_move_16_ix_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_16();
 	uint ea = EA_AX_IX_16();
@@ -7796,7 +7796,7 @@ void m68k_op_move_16_ix_pcdi(void)
 }
 
 
-void m68k_op_move_16_ix_pcix(void)
+void m68k_op_move_16_ix_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_16();
 	uint ea = EA_AX_IX_16();
@@ -7810,7 +7810,7 @@ void m68k_op_move_16_ix_pcix(void)
 }
 
 
-void m68k_op_move_16_ix_i(void)
+void m68k_op_move_16_ix_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_16();
 	uint ea = EA_AX_IX_16();
@@ -7824,7 +7824,7 @@ void m68k_op_move_16_ix_i(void)
 }
 
 
-void m68k_op_move_16_aw_d(void)
+void m68k_op_move_16_aw_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY);
 	uint ea = EA_AW_16();
@@ -7838,7 +7838,7 @@ void m68k_op_move_16_aw_d(void)
 }
 
 
-void m68k_op_move_16_aw_a(void)
+void m68k_op_move_16_aw_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(AY);
 	uint ea = EA_AW_16();
@@ -7852,7 +7852,7 @@ void m68k_op_move_16_aw_a(void)
 }
 
 
-void m68k_op_move_16_aw_ai(void)
+void m68k_op_move_16_aw_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_16();
 	uint ea = EA_AW_16();
@@ -7866,7 +7866,7 @@ void m68k_op_move_16_aw_ai(void)
 }
 
 
-void m68k_op_move_16_aw_pi(void)
+void m68k_op_move_16_aw_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_16();
 	uint ea = EA_AW_16();
@@ -7880,7 +7880,7 @@ void m68k_op_move_16_aw_pi(void)
 }
 
 
-void m68k_op_move_16_aw_pd(void)
+void m68k_op_move_16_aw_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_16();
 	uint ea = EA_AW_16();
@@ -7894,7 +7894,7 @@ void m68k_op_move_16_aw_pd(void)
 }
 
 
-void m68k_op_move_16_aw_di(void)
+void m68k_op_move_16_aw_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_16();
 	uint ea = EA_AW_16();
@@ -7908,7 +7908,7 @@ void m68k_op_move_16_aw_di(void)
 }
 
 
-void m68k_op_move_16_aw_ix(void)
+void m68k_op_move_16_aw_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_16();
 	uint ea = EA_AW_16();
@@ -7922,7 +7922,7 @@ void m68k_op_move_16_aw_ix(void)
 }
 
 
-void m68k_op_move_16_aw_aw(void)
+void m68k_op_move_16_aw_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_16();
 	uint ea = EA_AW_16();
@@ -7936,7 +7936,7 @@ void m68k_op_move_16_aw_aw(void)
 }
 
 
-void m68k_op_move_16_aw_al(void)
+void m68k_op_move_16_aw_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_16();
 	uint ea = EA_AW_16();
@@ -7950,7 +7950,7 @@ void m68k_op_move_16_aw_al(void)
 }
 
 
-void m68k_op_move_16_aw_pcdi(void)
+void m68k_op_move_16_aw_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_16();
 	uint ea = EA_AW_16();
@@ -7964,7 +7964,7 @@ void m68k_op_move_16_aw_pcdi(void)
 }
 
 
-void m68k_op_move_16_aw_pcix(void)
+void m68k_op_move_16_aw_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_16();
 	uint ea = EA_AW_16();
@@ -7978,7 +7978,7 @@ void m68k_op_move_16_aw_pcix(void)
 }
 
 
-void m68k_op_move_16_aw_i(void)
+void m68k_op_move_16_aw_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_16();
 	uint ea = EA_AW_16();
@@ -7992,7 +7992,7 @@ void m68k_op_move_16_aw_i(void)
 }
 
 
-void m68k_op_move_16_al_d(void)
+void m68k_op_move_16_al_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY);
 	uint ea = EA_AL_16();
@@ -8006,7 +8006,7 @@ void m68k_op_move_16_al_d(void)
 }
 
 
-void m68k_op_move_16_al_a(void)
+void m68k_op_move_16_al_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(AY);
 	uint ea = EA_AL_16();
@@ -8020,7 +8020,7 @@ void m68k_op_move_16_al_a(void)
 }
 
 
-void m68k_op_move_16_al_ai(void)
+void m68k_op_move_16_al_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_16();
 	uint ea = EA_AL_16();
@@ -8034,7 +8034,7 @@ void m68k_op_move_16_al_ai(void)
 }
 
 
-void m68k_op_move_16_al_pi(void)
+void m68k_op_move_16_al_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_16();
 	uint ea = EA_AL_16();
@@ -8048,7 +8048,7 @@ void m68k_op_move_16_al_pi(void)
 }
 
 
-void m68k_op_move_16_al_pd(void)
+void m68k_op_move_16_al_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_16();
 	uint ea = EA_AL_16();
@@ -8062,7 +8062,7 @@ void m68k_op_move_16_al_pd(void)
 }
 
 
-void m68k_op_move_16_al_di(void)
+void m68k_op_move_16_al_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_16();
 	uint ea = EA_AL_16();
@@ -8076,7 +8076,7 @@ void m68k_op_move_16_al_di(void)
 }
 
 
-void m68k_op_move_16_al_ix(void)
+void m68k_op_move_16_al_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_16();
 	uint ea = EA_AL_16();
@@ -8090,7 +8090,7 @@ void m68k_op_move_16_al_ix(void)
 }
 
 
-void m68k_op_move_16_al_aw(void)
+void m68k_op_move_16_al_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_16();
 	uint ea = EA_AL_16();
@@ -8104,7 +8104,7 @@ void m68k_op_move_16_al_aw(void)
 }
 
 
-void m68k_op_move_16_al_al(void)
+void m68k_op_move_16_al_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_16();
 	uint ea = EA_AL_16();
@@ -8118,7 +8118,7 @@ void m68k_op_move_16_al_al(void)
 }
 
 
-void m68k_op_move_16_al_pcdi(void)
+void m68k_op_move_16_al_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_16();
 	uint ea = EA_AL_16();
@@ -8132,7 +8132,7 @@ void m68k_op_move_16_al_pcdi(void)
 }
 
 
-void m68k_op_move_16_al_pcix(void)
+void m68k_op_move_16_al_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_16();
 	uint ea = EA_AL_16();
@@ -8146,7 +8146,7 @@ void m68k_op_move_16_al_pcix(void)
 }
 
 
-void m68k_op_move_16_al_i(void)
+void m68k_op_move_16_al_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_16();
 	uint ea = EA_AL_16();
@@ -8160,7 +8160,7 @@ void m68k_op_move_16_al_i(void)
 }
 
 
-void m68k_op_move_32_d_d(void)
+void m68k_op_move_32_d_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY;
 	uint* r_dst = &DX;
@@ -8174,7 +8174,7 @@ void m68k_op_move_32_d_d(void)
 }
 
 
-void m68k_op_move_32_d_a(void)
+void m68k_op_move_32_d_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = AY;
 	uint* r_dst = &DX;
@@ -8188,7 +8188,7 @@ void m68k_op_move_32_d_a(void)
 }
 
 
-void m68k_op_move_32_d_ai(void)
+void m68k_op_move_32_d_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_32();
 	uint* r_dst = &DX;
@@ -8202,7 +8202,7 @@ void m68k_op_move_32_d_ai(void)
 }
 
 
-void m68k_op_move_32_d_pi(void)
+void m68k_op_move_32_d_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_32();
 	uint* r_dst = &DX;
@@ -8216,7 +8216,7 @@ void m68k_op_move_32_d_pi(void)
 }
 
 
-void m68k_op_move_32_d_pd(void)
+void m68k_op_move_32_d_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_32();
 	uint* r_dst = &DX;
@@ -8230,7 +8230,7 @@ void m68k_op_move_32_d_pd(void)
 }
 
 
-void m68k_op_move_32_d_di(void)
+void m68k_op_move_32_d_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_32();
 	uint* r_dst = &DX;
@@ -8244,7 +8244,7 @@ void m68k_op_move_32_d_di(void)
 }
 
 
-void m68k_op_move_32_d_ix(void)
+void m68k_op_move_32_d_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_32();
 	uint* r_dst = &DX;
@@ -8258,7 +8258,7 @@ void m68k_op_move_32_d_ix(void)
 }
 
 
-void m68k_op_move_32_d_aw(void)
+void m68k_op_move_32_d_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_32();
 	uint* r_dst = &DX;
@@ -8272,7 +8272,7 @@ void m68k_op_move_32_d_aw(void)
 }
 
 
-void m68k_op_move_32_d_al(void)
+void m68k_op_move_32_d_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_32();
 	uint* r_dst = &DX;
@@ -8286,7 +8286,7 @@ void m68k_op_move_32_d_al(void)
 }
 
 
-void m68k_op_move_32_d_pcdi(void)
+void m68k_op_move_32_d_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_32();
 	uint* r_dst = &DX;
@@ -8300,7 +8300,7 @@ void m68k_op_move_32_d_pcdi(void)
 }
 
 
-void m68k_op_move_32_d_pcix(void)
+void m68k_op_move_32_d_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_32();
 	uint* r_dst = &DX;
@@ -8314,7 +8314,7 @@ void m68k_op_move_32_d_pcix(void)
 }
 
 
-void m68k_op_move_32_d_i(void)
+void m68k_op_move_32_d_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_32();
 	uint* r_dst = &DX;
@@ -8328,7 +8328,7 @@ void m68k_op_move_32_d_i(void)
 }
 
 
-void m68k_op_move_32_ai_d(void)
+void m68k_op_move_32_ai_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY;
 	uint ea = EA_AX_AI_32();
@@ -8342,7 +8342,7 @@ void m68k_op_move_32_ai_d(void)
 }
 
 
-void m68k_op_move_32_ai_a(void)
+void m68k_op_move_32_ai_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = AY;
 	uint ea = EA_AX_AI_32();
@@ -8356,7 +8356,7 @@ void m68k_op_move_32_ai_a(void)
 }
 
 
-void m68k_op_move_32_ai_ai(void)
+void m68k_op_move_32_ai_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_32();
 	uint ea = EA_AX_AI_32();
@@ -8370,7 +8370,7 @@ void m68k_op_move_32_ai_ai(void)
 }
 
 
-void m68k_op_move_32_ai_pi(void)
+void m68k_op_move_32_ai_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_32();
 	uint ea = EA_AX_AI_32();
@@ -8384,7 +8384,7 @@ void m68k_op_move_32_ai_pi(void)
 }
 
 
-void m68k_op_move_32_ai_pd(void)
+void m68k_op_move_32_ai_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_32();
 	uint ea = EA_AX_AI_32();
@@ -8398,7 +8398,7 @@ void m68k_op_move_32_ai_pd(void)
 }
 
 
-void m68k_op_move_32_ai_di(void)
+void m68k_op_move_32_ai_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_32();
 	uint ea = EA_AX_AI_32();
@@ -8412,7 +8412,7 @@ void m68k_op_move_32_ai_di(void)
 }
 
 
-void m68k_op_move_32_ai_ix(void)
+void m68k_op_move_32_ai_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_32();
 	uint ea = EA_AX_AI_32();
@@ -8426,7 +8426,7 @@ void m68k_op_move_32_ai_ix(void)
 }
 
 
-void m68k_op_move_32_ai_aw(void)
+void m68k_op_move_32_ai_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_32();
 	uint ea = EA_AX_AI_32();
@@ -8440,7 +8440,7 @@ void m68k_op_move_32_ai_aw(void)
 }
 
 
-void m68k_op_move_32_ai_al(void)
+void m68k_op_move_32_ai_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_32();
 	uint ea = EA_AX_AI_32();
@@ -8454,7 +8454,7 @@ void m68k_op_move_32_ai_al(void)
 }
 
 
-void m68k_op_move_32_ai_pcdi(void)
+void m68k_op_move_32_ai_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_32();
 	uint ea = EA_AX_AI_32();
@@ -8468,7 +8468,7 @@ void m68k_op_move_32_ai_pcdi(void)
 }
 
 
-void m68k_op_move_32_ai_pcix(void)
+void m68k_op_move_32_ai_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_32();
 	uint ea = EA_AX_AI_32();
@@ -8482,7 +8482,7 @@ void m68k_op_move_32_ai_pcix(void)
 }
 
 
-void m68k_op_move_32_ai_i(void)
+void m68k_op_move_32_ai_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_32();
 	uint ea = EA_AX_AI_32();
@@ -8496,7 +8496,7 @@ void m68k_op_move_32_ai_i(void)
 }
 
 
-void m68k_op_move_32_pi_d(void)
+void m68k_op_move_32_pi_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY;
 	uint ea = EA_AX_PI_32();
@@ -8510,7 +8510,7 @@ void m68k_op_move_32_pi_d(void)
 }
 
 
-void m68k_op_move_32_pi_a(void)
+void m68k_op_move_32_pi_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = AY;
 	uint ea = EA_AX_PI_32();
@@ -8524,7 +8524,7 @@ void m68k_op_move_32_pi_a(void)
 }
 
 
-void m68k_op_move_32_pi_ai(void)
+void m68k_op_move_32_pi_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_32();
 	uint ea = EA_AX_PI_32();
@@ -8538,7 +8538,7 @@ void m68k_op_move_32_pi_ai(void)
 }
 
 
-void m68k_op_move_32_pi_pi(void)
+void m68k_op_move_32_pi_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_32();
 	uint ea = EA_AX_PI_32();
@@ -8552,7 +8552,7 @@ void m68k_op_move_32_pi_pi(void)
 }
 
 
-void m68k_op_move_32_pi_pd(void)
+void m68k_op_move_32_pi_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_32();
 	uint ea = EA_AX_PI_32();
@@ -8566,7 +8566,7 @@ void m68k_op_move_32_pi_pd(void)
 }
 
 
-void m68k_op_move_32_pi_di(void)
+void m68k_op_move_32_pi_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_32();
 	uint ea = EA_AX_PI_32();
@@ -8580,7 +8580,7 @@ void m68k_op_move_32_pi_di(void)
 }
 
 
-void m68k_op_move_32_pi_ix(void)
+void m68k_op_move_32_pi_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_32();
 	uint ea = EA_AX_PI_32();
@@ -8594,7 +8594,7 @@ void m68k_op_move_32_pi_ix(void)
 }
 
 
-void m68k_op_move_32_pi_aw(void)
+void m68k_op_move_32_pi_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_32();
 	uint ea = EA_AX_PI_32();
@@ -8608,7 +8608,7 @@ void m68k_op_move_32_pi_aw(void)
 }
 
 
-void m68k_op_move_32_pi_al(void)
+void m68k_op_move_32_pi_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_32();
 	uint ea = EA_AX_PI_32();
@@ -8622,7 +8622,7 @@ void m68k_op_move_32_pi_al(void)
 }
 
 
-void m68k_op_move_32_pi_pcdi(void)
+void m68k_op_move_32_pi_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_32();
 	uint ea = EA_AX_PI_32();
@@ -8636,7 +8636,7 @@ void m68k_op_move_32_pi_pcdi(void)
 }
 
 
-void m68k_op_move_32_pi_pcix(void)
+void m68k_op_move_32_pi_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_32();
 	uint ea = EA_AX_PI_32();
@@ -8650,7 +8650,7 @@ void m68k_op_move_32_pi_pcix(void)
 }
 
 
-void m68k_op_move_32_pi_i(void)
+void m68k_op_move_32_pi_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_32();
 	uint ea = EA_AX_PI_32();
@@ -8664,7 +8664,7 @@ void m68k_op_move_32_pi_i(void)
 }
 
 
-void m68k_op_move_32_pd_d(void)
+void m68k_op_move_32_pd_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY;
 	uint ea = EA_AX_PD_32();
@@ -8679,7 +8679,7 @@ void m68k_op_move_32_pd_d(void)
 }
 
 
-void m68k_op_move_32_pd_a(void)
+void m68k_op_move_32_pd_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = AY;
 	uint ea = EA_AX_PD_32();
@@ -8694,7 +8694,7 @@ void m68k_op_move_32_pd_a(void)
 }
 
 
-void m68k_op_move_32_pd_ai(void)
+void m68k_op_move_32_pd_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_32();
 	uint ea = EA_AX_PD_32();
@@ -8709,7 +8709,7 @@ void m68k_op_move_32_pd_ai(void)
 }
 
 
-void m68k_op_move_32_pd_pi(void)
+void m68k_op_move_32_pd_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_32();
 	uint ea = EA_AX_PD_32();
@@ -8724,7 +8724,7 @@ void m68k_op_move_32_pd_pi(void)
 }
 
 
-void m68k_op_move_32_pd_pd(void)
+void m68k_op_move_32_pd_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_32();
 	uint ea = EA_AX_PD_32();
@@ -8739,7 +8739,7 @@ void m68k_op_move_32_pd_pd(void)
 }
 
 
-void m68k_op_move_32_pd_di(void)
+void m68k_op_move_32_pd_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_32();
 	uint ea = EA_AX_PD_32();
@@ -8754,7 +8754,7 @@ void m68k_op_move_32_pd_di(void)
 }
 
 
-void m68k_op_move_32_pd_ix(void)
+void m68k_op_move_32_pd_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_32();
 	uint ea = EA_AX_PD_32();
@@ -8769,7 +8769,7 @@ void m68k_op_move_32_pd_ix(void)
 }
 
 
-void m68k_op_move_32_pd_aw(void)
+void m68k_op_move_32_pd_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_32();
 	uint ea = EA_AX_PD_32();
@@ -8784,7 +8784,7 @@ void m68k_op_move_32_pd_aw(void)
 }
 
 
-void m68k_op_move_32_pd_al(void)
+void m68k_op_move_32_pd_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_32();
 	uint ea = EA_AX_PD_32();
@@ -8799,7 +8799,7 @@ void m68k_op_move_32_pd_al(void)
 }
 
 
-void m68k_op_move_32_pd_pcdi(void)
+void m68k_op_move_32_pd_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_32();
 	uint ea = EA_AX_PD_32();
@@ -8814,7 +8814,7 @@ void m68k_op_move_32_pd_pcdi(void)
 }
 
 
-void m68k_op_move_32_pd_pcix(void)
+void m68k_op_move_32_pd_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_32();
 	uint ea = EA_AX_PD_32();
@@ -8829,7 +8829,7 @@ void m68k_op_move_32_pd_pcix(void)
 }
 
 
-void m68k_op_move_32_pd_i(void)
+void m68k_op_move_32_pd_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_32();
 	uint ea = EA_AX_PD_32();
@@ -8844,7 +8844,7 @@ void m68k_op_move_32_pd_i(void)
 }
 
 
-void m68k_op_move_32_di_d(void)
+void m68k_op_move_32_di_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY;
 	uint ea = EA_AX_DI_32();
@@ -8858,7 +8858,7 @@ void m68k_op_move_32_di_d(void)
 }
 
 
-void m68k_op_move_32_di_a(void)
+void m68k_op_move_32_di_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = AY;
 	uint ea = EA_AX_DI_32();
@@ -8872,7 +8872,7 @@ void m68k_op_move_32_di_a(void)
 }
 
 
-void m68k_op_move_32_di_ai(void)
+void m68k_op_move_32_di_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_32();
 	uint ea = EA_AX_DI_32();
@@ -8886,7 +8886,7 @@ void m68k_op_move_32_di_ai(void)
 }
 
 
-void m68k_op_move_32_di_pi(void)
+void m68k_op_move_32_di_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_32();
 	uint ea = EA_AX_DI_32();
@@ -8900,7 +8900,7 @@ void m68k_op_move_32_di_pi(void)
 }
 
 
-void m68k_op_move_32_di_pd(void)
+void m68k_op_move_32_di_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_32();
 	uint ea = EA_AX_DI_32();
@@ -8914,7 +8914,7 @@ void m68k_op_move_32_di_pd(void)
 }
 
 
-void m68k_op_move_32_di_di(void)
+void m68k_op_move_32_di_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_32();
 	uint ea = EA_AX_DI_32();
@@ -8928,7 +8928,7 @@ void m68k_op_move_32_di_di(void)
 }
 
 
-void m68k_op_move_32_di_ix(void)
+void m68k_op_move_32_di_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_32();
 	uint ea = EA_AX_DI_32();
@@ -8942,7 +8942,7 @@ void m68k_op_move_32_di_ix(void)
 }
 
 
-void m68k_op_move_32_di_aw(void)
+void m68k_op_move_32_di_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_32();
 	uint ea = EA_AX_DI_32();
@@ -8956,7 +8956,7 @@ void m68k_op_move_32_di_aw(void)
 }
 
 
-void m68k_op_move_32_di_al(void)
+void m68k_op_move_32_di_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_32();
 	uint ea = EA_AX_DI_32();
@@ -8970,7 +8970,7 @@ void m68k_op_move_32_di_al(void)
 }
 
 
-void m68k_op_move_32_di_pcdi(void)
+void m68k_op_move_32_di_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_32();
 	uint ea = EA_AX_DI_32();
@@ -8984,7 +8984,7 @@ void m68k_op_move_32_di_pcdi(void)
 }
 
 
-void m68k_op_move_32_di_pcix(void)
+void m68k_op_move_32_di_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_32();
 	uint ea = EA_AX_DI_32();
@@ -8998,7 +8998,7 @@ void m68k_op_move_32_di_pcix(void)
 }
 
 
-void m68k_op_move_32_di_i(void)
+void m68k_op_move_32_di_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_32();
 	uint ea = EA_AX_DI_32();
@@ -9012,7 +9012,7 @@ void m68k_op_move_32_di_i(void)
 }
 
 
-void m68k_op_move_32_ix_d(void)
+void m68k_op_move_32_ix_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY;
 	uint ea = EA_AX_IX_32();
@@ -9026,7 +9026,7 @@ void m68k_op_move_32_ix_d(void)
 }
 
 
-void m68k_op_move_32_ix_a(void)
+void m68k_op_move_32_ix_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = AY;
 	uint ea = EA_AX_IX_32();
@@ -9040,7 +9040,7 @@ void m68k_op_move_32_ix_a(void)
 }
 
 
-void m68k_op_move_32_ix_ai(void)
+void m68k_op_move_32_ix_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_32();
 	uint ea = EA_AX_IX_32();
@@ -9054,7 +9054,7 @@ void m68k_op_move_32_ix_ai(void)
 }
 
 
-void m68k_op_move_32_ix_pi(void)
+void m68k_op_move_32_ix_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_32();
 	uint ea = EA_AX_IX_32();
@@ -9068,7 +9068,7 @@ void m68k_op_move_32_ix_pi(void)
 }
 
 
-void m68k_op_move_32_ix_pd(void)
+void m68k_op_move_32_ix_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_32();
 	uint ea = EA_AX_IX_32();
@@ -9082,7 +9082,7 @@ void m68k_op_move_32_ix_pd(void)
 }
 
 
-void m68k_op_move_32_ix_di(void)
+void m68k_op_move_32_ix_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_32();
 	uint ea = EA_AX_IX_32();
@@ -9096,7 +9096,7 @@ void m68k_op_move_32_ix_di(void)
 }
 
 
-void m68k_op_move_32_ix_ix(void)
+void m68k_op_move_32_ix_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_32();
 	uint ea = EA_AX_IX_32();
@@ -9110,7 +9110,7 @@ void m68k_op_move_32_ix_ix(void)
 }
 
 
-void m68k_op_move_32_ix_aw(void)
+void m68k_op_move_32_ix_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_32();
 	uint ea = EA_AX_IX_32();
@@ -9124,7 +9124,7 @@ void m68k_op_move_32_ix_aw(void)
 }
 
 
-void m68k_op_move_32_ix_al(void)
+void m68k_op_move_32_ix_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_32();
 	uint ea = EA_AX_IX_32();
@@ -9138,7 +9138,7 @@ void m68k_op_move_32_ix_al(void)
 }
 
 
-void m68k_op_move_32_ix_pcdi(void)
+void m68k_op_move_32_ix_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_32();
 	uint ea = EA_AX_IX_32();
@@ -9152,7 +9152,7 @@ void m68k_op_move_32_ix_pcdi(void)
 }
 
 
-void m68k_op_move_32_ix_pcix(void)
+void m68k_op_move_32_ix_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_32();
 	uint ea = EA_AX_IX_32();
@@ -9166,7 +9166,7 @@ void m68k_op_move_32_ix_pcix(void)
 }
 
 
-void m68k_op_move_32_ix_i(void)
+void m68k_op_move_32_ix_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_32();
 	uint ea = EA_AX_IX_32();
@@ -9180,7 +9180,7 @@ void m68k_op_move_32_ix_i(void)
 }
 
 
-void m68k_op_move_32_aw_d(void)
+void m68k_op_move_32_aw_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY;
 	uint ea = EA_AW_32();
@@ -9194,7 +9194,7 @@ void m68k_op_move_32_aw_d(void)
 }
 
 
-void m68k_op_move_32_aw_a(void)
+void m68k_op_move_32_aw_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = AY;
 	uint ea = EA_AW_32();
@@ -9208,7 +9208,7 @@ void m68k_op_move_32_aw_a(void)
 }
 
 
-void m68k_op_move_32_aw_ai(void)
+void m68k_op_move_32_aw_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_32();
 	uint ea = EA_AW_32();
@@ -9222,7 +9222,7 @@ void m68k_op_move_32_aw_ai(void)
 }
 
 
-void m68k_op_move_32_aw_pi(void)
+void m68k_op_move_32_aw_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_32();
 	uint ea = EA_AW_32();
@@ -9236,7 +9236,7 @@ void m68k_op_move_32_aw_pi(void)
 }
 
 
-void m68k_op_move_32_aw_pd(void)
+void m68k_op_move_32_aw_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_32();
 	uint ea = EA_AW_32();
@@ -9250,7 +9250,7 @@ void m68k_op_move_32_aw_pd(void)
 }
 
 
-void m68k_op_move_32_aw_di(void)
+void m68k_op_move_32_aw_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_32();
 	uint ea = EA_AW_32();
@@ -9264,7 +9264,7 @@ void m68k_op_move_32_aw_di(void)
 }
 
 
-void m68k_op_move_32_aw_ix(void)
+void m68k_op_move_32_aw_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_32();
 	uint ea = EA_AW_32();
@@ -9278,7 +9278,7 @@ void m68k_op_move_32_aw_ix(void)
 }
 
 
-void m68k_op_move_32_aw_aw(void)
+void m68k_op_move_32_aw_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_32();
 	uint ea = EA_AW_32();
@@ -9292,7 +9292,7 @@ void m68k_op_move_32_aw_aw(void)
 }
 
 
-void m68k_op_move_32_aw_al(void)
+void m68k_op_move_32_aw_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_32();
 	uint ea = EA_AW_32();
@@ -9306,7 +9306,7 @@ void m68k_op_move_32_aw_al(void)
 }
 
 
-void m68k_op_move_32_aw_pcdi(void)
+void m68k_op_move_32_aw_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_32();
 	uint ea = EA_AW_32();
@@ -9320,7 +9320,7 @@ void m68k_op_move_32_aw_pcdi(void)
 }
 
 
-void m68k_op_move_32_aw_pcix(void)
+void m68k_op_move_32_aw_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_32();
 	uint ea = EA_AW_32();
@@ -9334,7 +9334,7 @@ void m68k_op_move_32_aw_pcix(void)
 }
 
 
-void m68k_op_move_32_aw_i(void)
+void m68k_op_move_32_aw_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_32();
 	uint ea = EA_AW_32();
@@ -9348,7 +9348,7 @@ void m68k_op_move_32_aw_i(void)
 }
 
 
-void m68k_op_move_32_al_d(void)
+void m68k_op_move_32_al_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY;
 	uint ea = EA_AL_32();
@@ -9362,7 +9362,7 @@ void m68k_op_move_32_al_d(void)
 }
 
 
-void m68k_op_move_32_al_a(void)
+void m68k_op_move_32_al_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = AY;
 	uint ea = EA_AL_32();
@@ -9376,7 +9376,7 @@ void m68k_op_move_32_al_a(void)
 }
 
 
-void m68k_op_move_32_al_ai(void)
+void m68k_op_move_32_al_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_32();
 	uint ea = EA_AL_32();
@@ -9390,7 +9390,7 @@ void m68k_op_move_32_al_ai(void)
 }
 
 
-void m68k_op_move_32_al_pi(void)
+void m68k_op_move_32_al_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_32();
 	uint ea = EA_AL_32();
@@ -9404,7 +9404,7 @@ void m68k_op_move_32_al_pi(void)
 }
 
 
-void m68k_op_move_32_al_pd(void)
+void m68k_op_move_32_al_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_32();
 	uint ea = EA_AL_32();
@@ -9418,7 +9418,7 @@ void m68k_op_move_32_al_pd(void)
 }
 
 
-void m68k_op_move_32_al_di(void)
+void m68k_op_move_32_al_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_32();
 	uint ea = EA_AL_32();
@@ -9432,7 +9432,7 @@ void m68k_op_move_32_al_di(void)
 }
 
 
-void m68k_op_move_32_al_ix(void)
+void m68k_op_move_32_al_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_32();
 	uint ea = EA_AL_32();
@@ -9446,7 +9446,7 @@ void m68k_op_move_32_al_ix(void)
 }
 
 
-void m68k_op_move_32_al_aw(void)
+void m68k_op_move_32_al_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_32();
 	uint ea = EA_AL_32();
@@ -9460,7 +9460,7 @@ void m68k_op_move_32_al_aw(void)
 }
 
 
-void m68k_op_move_32_al_al(void)
+void m68k_op_move_32_al_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_32();
 	uint ea = EA_AL_32();
@@ -9474,7 +9474,7 @@ void m68k_op_move_32_al_al(void)
 }
 
 
-void m68k_op_move_32_al_pcdi(void)
+void m68k_op_move_32_al_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCDI_32();
 	uint ea = EA_AL_32();
@@ -9488,7 +9488,7 @@ void m68k_op_move_32_al_pcdi(void)
 }
 
 
-void m68k_op_move_32_al_pcix(void)
+void m68k_op_move_32_al_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_PCIX_32();
 	uint ea = EA_AL_32();
@@ -9502,7 +9502,7 @@ void m68k_op_move_32_al_pcix(void)
 }
 
 
-void m68k_op_move_32_al_i(void)
+void m68k_op_move_32_al_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_I_32();
 	uint ea = EA_AL_32();
@@ -9516,151 +9516,151 @@ void m68k_op_move_32_al_i(void)
 }
 
 
-void m68k_op_movea_16_d(void)
+void m68k_op_movea_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(DY);
 }
 
 
-void m68k_op_movea_16_a(void)
+void m68k_op_movea_16_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(AY);
 }
 
 
-void m68k_op_movea_16_ai(void)
+void m68k_op_movea_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(OPER_AY_AI_16());
 }
 
 
-void m68k_op_movea_16_pi(void)
+void m68k_op_movea_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(OPER_AY_PI_16());
 }
 
 
-void m68k_op_movea_16_pd(void)
+void m68k_op_movea_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(OPER_AY_PD_16());
 }
 
 
-void m68k_op_movea_16_di(void)
+void m68k_op_movea_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(OPER_AY_DI_16());
 }
 
 
-void m68k_op_movea_16_ix(void)
+void m68k_op_movea_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(OPER_AY_IX_16());
 }
 
 
-void m68k_op_movea_16_aw(void)
+void m68k_op_movea_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(OPER_AW_16());
 }
 
 
-void m68k_op_movea_16_al(void)
+void m68k_op_movea_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(OPER_AL_16());
 }
 
 
-void m68k_op_movea_16_pcdi(void)
+void m68k_op_movea_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(OPER_PCDI_16());
 }
 
 
-void m68k_op_movea_16_pcix(void)
+void m68k_op_movea_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(OPER_PCIX_16());
 }
 
 
-void m68k_op_movea_16_i(void)
+void m68k_op_movea_16_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = MAKE_INT_16(OPER_I_16());
 }
 
 
-void m68k_op_movea_32_d(void)
+void m68k_op_movea_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = DY;
 }
 
 
-void m68k_op_movea_32_a(void)
+void m68k_op_movea_32_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = AY;
 }
 
 
-void m68k_op_movea_32_ai(void)
+void m68k_op_movea_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = OPER_AY_AI_32();
 }
 
 
-void m68k_op_movea_32_pi(void)
+void m68k_op_movea_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = OPER_AY_PI_32();
 }
 
 
-void m68k_op_movea_32_pd(void)
+void m68k_op_movea_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = OPER_AY_PD_32();
 }
 
 
-void m68k_op_movea_32_di(void)
+void m68k_op_movea_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = OPER_AY_DI_32();
 }
 
 
-void m68k_op_movea_32_ix(void)
+void m68k_op_movea_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = OPER_AY_IX_32();
 }
 
 
-void m68k_op_movea_32_aw(void)
+void m68k_op_movea_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = OPER_AW_32();
 }
 
 
-void m68k_op_movea_32_al(void)
+void m68k_op_movea_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = OPER_AL_32();
 }
 
 
-void m68k_op_movea_32_pcdi(void)
+void m68k_op_movea_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = OPER_PCDI_32();
 }
 
 
-void m68k_op_movea_32_pcix(void)
+void m68k_op_movea_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = OPER_PCIX_32();
 }
 
 
-void m68k_op_movea_32_i(void)
+void m68k_op_movea_32_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	AX = OPER_I_32();
 }
 
 
-void m68k_op_move_16_frc_d(void)
+void m68k_op_move_16_frc_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -9671,7 +9671,7 @@ void m68k_op_move_16_frc_d(void)
 }
 
 
-void m68k_op_move_16_frc_ai(void)
+void m68k_op_move_16_frc_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -9682,7 +9682,7 @@ void m68k_op_move_16_frc_ai(void)
 }
 
 
-void m68k_op_move_16_frc_pi(void)
+void m68k_op_move_16_frc_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -9693,7 +9693,7 @@ void m68k_op_move_16_frc_pi(void)
 }
 
 
-void m68k_op_move_16_frc_pd(void)
+void m68k_op_move_16_frc_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -9704,7 +9704,7 @@ void m68k_op_move_16_frc_pd(void)
 }
 
 
-void m68k_op_move_16_frc_di(void)
+void m68k_op_move_16_frc_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -9715,7 +9715,7 @@ void m68k_op_move_16_frc_di(void)
 }
 
 
-void m68k_op_move_16_frc_ix(void)
+void m68k_op_move_16_frc_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -9726,7 +9726,7 @@ void m68k_op_move_16_frc_ix(void)
 }
 
 
-void m68k_op_move_16_frc_aw(void)
+void m68k_op_move_16_frc_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -9737,7 +9737,7 @@ void m68k_op_move_16_frc_aw(void)
 }
 
 
-void m68k_op_move_16_frc_al(void)
+void m68k_op_move_16_frc_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -9748,73 +9748,73 @@ void m68k_op_move_16_frc_al(void)
 }
 
 
-void m68k_op_move_16_toc_d(void)
+void m68k_op_move_16_toc_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(DY);
 }
 
 
-void m68k_op_move_16_toc_ai(void)
+void m68k_op_move_16_toc_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(OPER_AY_AI_16());
 }
 
 
-void m68k_op_move_16_toc_pi(void)
+void m68k_op_move_16_toc_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(OPER_AY_PI_16());
 }
 
 
-void m68k_op_move_16_toc_pd(void)
+void m68k_op_move_16_toc_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(OPER_AY_PD_16());
 }
 
 
-void m68k_op_move_16_toc_di(void)
+void m68k_op_move_16_toc_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(OPER_AY_DI_16());
 }
 
 
-void m68k_op_move_16_toc_ix(void)
+void m68k_op_move_16_toc_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(OPER_AY_IX_16());
 }
 
 
-void m68k_op_move_16_toc_aw(void)
+void m68k_op_move_16_toc_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(OPER_AW_16());
 }
 
 
-void m68k_op_move_16_toc_al(void)
+void m68k_op_move_16_toc_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(OPER_AL_16());
 }
 
 
-void m68k_op_move_16_toc_pcdi(void)
+void m68k_op_move_16_toc_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(OPER_PCDI_16());
 }
 
 
-void m68k_op_move_16_toc_pcix(void)
+void m68k_op_move_16_toc_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(OPER_PCIX_16());
 }
 
 
-void m68k_op_move_16_toc_i(void)
+void m68k_op_move_16_toc_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(OPER_I_16());
 }
 
 
-void m68k_op_move_16_frs_d(void)
+void m68k_op_move_16_frs_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
@@ -9825,7 +9825,7 @@ void m68k_op_move_16_frs_d(void)
 }
 
 
-void m68k_op_move_16_frs_ai(void)
+void m68k_op_move_16_frs_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
@@ -9837,7 +9837,7 @@ void m68k_op_move_16_frs_ai(void)
 }
 
 
-void m68k_op_move_16_frs_pi(void)
+void m68k_op_move_16_frs_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
@@ -9849,7 +9849,7 @@ void m68k_op_move_16_frs_pi(void)
 }
 
 
-void m68k_op_move_16_frs_pd(void)
+void m68k_op_move_16_frs_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
@@ -9861,7 +9861,7 @@ void m68k_op_move_16_frs_pd(void)
 }
 
 
-void m68k_op_move_16_frs_di(void)
+void m68k_op_move_16_frs_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
@@ -9873,7 +9873,7 @@ void m68k_op_move_16_frs_di(void)
 }
 
 
-void m68k_op_move_16_frs_ix(void)
+void m68k_op_move_16_frs_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
@@ -9885,7 +9885,7 @@ void m68k_op_move_16_frs_ix(void)
 }
 
 
-void m68k_op_move_16_frs_aw(void)
+void m68k_op_move_16_frs_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
@@ -9897,7 +9897,7 @@ void m68k_op_move_16_frs_aw(void)
 }
 
 
-void m68k_op_move_16_frs_al(void)
+void m68k_op_move_16_frs_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
@@ -9909,7 +9909,7 @@ void m68k_op_move_16_frs_al(void)
 }
 
 
-void m68k_op_move_16_tos_d(void)
+void m68k_op_move_16_tos_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -9920,7 +9920,7 @@ void m68k_op_move_16_tos_d(void)
 }
 
 
-void m68k_op_move_16_tos_ai(void)
+void m68k_op_move_16_tos_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -9933,7 +9933,7 @@ void m68k_op_move_16_tos_ai(void)
 }
 
 
-void m68k_op_move_16_tos_pi(void)
+void m68k_op_move_16_tos_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -9946,7 +9946,7 @@ void m68k_op_move_16_tos_pi(void)
 }
 
 
-void m68k_op_move_16_tos_pd(void)
+void m68k_op_move_16_tos_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -9959,7 +9959,7 @@ void m68k_op_move_16_tos_pd(void)
 }
 
 
-void m68k_op_move_16_tos_di(void)
+void m68k_op_move_16_tos_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -9972,7 +9972,7 @@ void m68k_op_move_16_tos_di(void)
 }
 
 
-void m68k_op_move_16_tos_ix(void)
+void m68k_op_move_16_tos_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -9985,7 +9985,7 @@ void m68k_op_move_16_tos_ix(void)
 }
 
 
-void m68k_op_move_16_tos_aw(void)
+void m68k_op_move_16_tos_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -9998,7 +9998,7 @@ void m68k_op_move_16_tos_aw(void)
 }
 
 
-void m68k_op_move_16_tos_al(void)
+void m68k_op_move_16_tos_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -10011,7 +10011,7 @@ void m68k_op_move_16_tos_al(void)
 }
 
 
-void m68k_op_move_16_tos_pcdi(void)
+void m68k_op_move_16_tos_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -10024,7 +10024,7 @@ void m68k_op_move_16_tos_pcdi(void)
 }
 
 
-void m68k_op_move_16_tos_pcix(void)
+void m68k_op_move_16_tos_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -10037,7 +10037,7 @@ void m68k_op_move_16_tos_pcix(void)
 }
 
 
-void m68k_op_move_16_tos_i(void)
+void m68k_op_move_16_tos_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -10050,7 +10050,7 @@ void m68k_op_move_16_tos_i(void)
 }
 
 
-void m68k_op_move_32_fru(void)
+void m68k_op_move_32_fru(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -10061,7 +10061,7 @@ void m68k_op_move_32_fru(void)
 }
 
 
-void m68k_op_move_32_tou(void)
+void m68k_op_move_32_tou(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -10073,7 +10073,7 @@ void m68k_op_move_32_tou(void)
 }
 
 
-void m68k_op_movec_32_cr(void)
+void m68k_op_movec_32_cr(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -10139,7 +10139,7 @@ void m68k_op_movec_32_cr(void)
 }
 
 
-void m68k_op_movec_32_rc(void)
+void m68k_op_movec_32_rc(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -10218,7 +10218,7 @@ void m68k_op_movec_32_rc(void)
 }
 
 
-void m68k_op_movem_16_re_pd(void)
+void m68k_op_movem_16_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10238,7 +10238,7 @@ void m68k_op_movem_16_re_pd(void)
 }
 
 
-void m68k_op_movem_16_re_ai(void)
+void m68k_op_movem_16_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10257,7 +10257,7 @@ void m68k_op_movem_16_re_ai(void)
 }
 
 
-void m68k_op_movem_16_re_di(void)
+void m68k_op_movem_16_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10276,7 +10276,7 @@ void m68k_op_movem_16_re_di(void)
 }
 
 
-void m68k_op_movem_16_re_ix(void)
+void m68k_op_movem_16_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10295,7 +10295,7 @@ void m68k_op_movem_16_re_ix(void)
 }
 
 
-void m68k_op_movem_16_re_aw(void)
+void m68k_op_movem_16_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10314,7 +10314,7 @@ void m68k_op_movem_16_re_aw(void)
 }
 
 
-void m68k_op_movem_16_re_al(void)
+void m68k_op_movem_16_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10333,7 +10333,7 @@ void m68k_op_movem_16_re_al(void)
 }
 
 
-void m68k_op_movem_32_re_pd(void)
+void m68k_op_movem_32_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10354,7 +10354,7 @@ void m68k_op_movem_32_re_pd(void)
 }
 
 
-void m68k_op_movem_32_re_ai(void)
+void m68k_op_movem_32_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10373,7 +10373,7 @@ void m68k_op_movem_32_re_ai(void)
 }
 
 
-void m68k_op_movem_32_re_di(void)
+void m68k_op_movem_32_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10392,7 +10392,7 @@ void m68k_op_movem_32_re_di(void)
 }
 
 
-void m68k_op_movem_32_re_ix(void)
+void m68k_op_movem_32_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10411,7 +10411,7 @@ void m68k_op_movem_32_re_ix(void)
 }
 
 
-void m68k_op_movem_32_re_aw(void)
+void m68k_op_movem_32_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10430,7 +10430,7 @@ void m68k_op_movem_32_re_aw(void)
 }
 
 
-void m68k_op_movem_32_re_al(void)
+void m68k_op_movem_32_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10449,7 +10449,7 @@ void m68k_op_movem_32_re_al(void)
 }
 
 
-void m68k_op_movem_16_er_pi(void)
+void m68k_op_movem_16_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10469,7 +10469,7 @@ void m68k_op_movem_16_er_pi(void)
 }
 
 
-void m68k_op_movem_16_er_pcdi(void)
+void m68k_op_movem_16_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10488,7 +10488,7 @@ void m68k_op_movem_16_er_pcdi(void)
 }
 
 
-void m68k_op_movem_16_er_pcix(void)
+void m68k_op_movem_16_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10507,7 +10507,7 @@ void m68k_op_movem_16_er_pcix(void)
 }
 
 
-void m68k_op_movem_16_er_ai(void)
+void m68k_op_movem_16_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10526,7 +10526,7 @@ void m68k_op_movem_16_er_ai(void)
 }
 
 
-void m68k_op_movem_16_er_di(void)
+void m68k_op_movem_16_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10545,7 +10545,7 @@ void m68k_op_movem_16_er_di(void)
 }
 
 
-void m68k_op_movem_16_er_ix(void)
+void m68k_op_movem_16_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10564,7 +10564,7 @@ void m68k_op_movem_16_er_ix(void)
 }
 
 
-void m68k_op_movem_16_er_aw(void)
+void m68k_op_movem_16_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10583,7 +10583,7 @@ void m68k_op_movem_16_er_aw(void)
 }
 
 
-void m68k_op_movem_16_er_al(void)
+void m68k_op_movem_16_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10602,7 +10602,7 @@ void m68k_op_movem_16_er_al(void)
 }
 
 
-void m68k_op_movem_32_er_pi(void)
+void m68k_op_movem_32_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10622,7 +10622,7 @@ void m68k_op_movem_32_er_pi(void)
 }
 
 
-void m68k_op_movem_32_er_pcdi(void)
+void m68k_op_movem_32_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10641,7 +10641,7 @@ void m68k_op_movem_32_er_pcdi(void)
 }
 
 
-void m68k_op_movem_32_er_pcix(void)
+void m68k_op_movem_32_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10660,7 +10660,7 @@ void m68k_op_movem_32_er_pcix(void)
 }
 
 
-void m68k_op_movem_32_er_ai(void)
+void m68k_op_movem_32_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10679,7 +10679,7 @@ void m68k_op_movem_32_er_ai(void)
 }
 
 
-void m68k_op_movem_32_er_di(void)
+void m68k_op_movem_32_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10698,7 +10698,7 @@ void m68k_op_movem_32_er_di(void)
 }
 
 
-void m68k_op_movem_32_er_ix(void)
+void m68k_op_movem_32_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10717,7 +10717,7 @@ void m68k_op_movem_32_er_ix(void)
 }
 
 
-void m68k_op_movem_32_er_aw(void)
+void m68k_op_movem_32_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10736,7 +10736,7 @@ void m68k_op_movem_32_er_aw(void)
 }
 
 
-void m68k_op_movem_32_er_al(void)
+void m68k_op_movem_32_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint i = 0;
 	uint register_list = OPER_I_16();
@@ -10755,7 +10755,7 @@ void m68k_op_movem_32_er_al(void)
 }
 
 
-void m68k_op_movep_16_re(void)
+void m68k_op_movep_16_re(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = DX;
@@ -10765,7 +10765,7 @@ void m68k_op_movep_16_re(void)
 }
 
 
-void m68k_op_movep_32_re(void)
+void m68k_op_movep_32_re(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_32();
 	uint src = DX;
@@ -10777,7 +10777,7 @@ void m68k_op_movep_32_re(void)
 }
 
 
-void m68k_op_movep_16_er(void)
+void m68k_op_movep_16_er(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint* r_dst = &DX;
@@ -10786,7 +10786,7 @@ void m68k_op_movep_16_er(void)
 }
 
 
-void m68k_op_movep_32_er(void)
+void m68k_op_movep_32_er(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_32();
 
@@ -10795,7 +10795,7 @@ void m68k_op_movep_32_er(void)
 }
 
 
-void m68k_op_moves_8_ai(void)
+void m68k_op_moves_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -10830,7 +10830,7 @@ void m68k_op_moves_8_ai(void)
 }
 
 
-void m68k_op_moves_8_pi(void)
+void m68k_op_moves_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -10865,7 +10865,7 @@ void m68k_op_moves_8_pi(void)
 }
 
 
-void m68k_op_moves_8_pi7(void)
+void m68k_op_moves_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -10900,7 +10900,7 @@ void m68k_op_moves_8_pi7(void)
 }
 
 
-void m68k_op_moves_8_pd(void)
+void m68k_op_moves_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -10935,7 +10935,7 @@ void m68k_op_moves_8_pd(void)
 }
 
 
-void m68k_op_moves_8_pd7(void)
+void m68k_op_moves_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -10970,7 +10970,7 @@ void m68k_op_moves_8_pd7(void)
 }
 
 
-void m68k_op_moves_8_di(void)
+void m68k_op_moves_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11005,7 +11005,7 @@ void m68k_op_moves_8_di(void)
 }
 
 
-void m68k_op_moves_8_ix(void)
+void m68k_op_moves_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11040,7 +11040,7 @@ void m68k_op_moves_8_ix(void)
 }
 
 
-void m68k_op_moves_8_aw(void)
+void m68k_op_moves_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11075,7 +11075,7 @@ void m68k_op_moves_8_aw(void)
 }
 
 
-void m68k_op_moves_8_al(void)
+void m68k_op_moves_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11110,7 +11110,7 @@ void m68k_op_moves_8_al(void)
 }
 
 
-void m68k_op_moves_16_ai(void)
+void m68k_op_moves_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11145,7 +11145,7 @@ void m68k_op_moves_16_ai(void)
 }
 
 
-void m68k_op_moves_16_pi(void)
+void m68k_op_moves_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11180,7 +11180,7 @@ void m68k_op_moves_16_pi(void)
 }
 
 
-void m68k_op_moves_16_pd(void)
+void m68k_op_moves_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11215,7 +11215,7 @@ void m68k_op_moves_16_pd(void)
 }
 
 
-void m68k_op_moves_16_di(void)
+void m68k_op_moves_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11250,7 +11250,7 @@ void m68k_op_moves_16_di(void)
 }
 
 
-void m68k_op_moves_16_ix(void)
+void m68k_op_moves_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11285,7 +11285,7 @@ void m68k_op_moves_16_ix(void)
 }
 
 
-void m68k_op_moves_16_aw(void)
+void m68k_op_moves_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11320,7 +11320,7 @@ void m68k_op_moves_16_aw(void)
 }
 
 
-void m68k_op_moves_16_al(void)
+void m68k_op_moves_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11355,7 +11355,7 @@ void m68k_op_moves_16_al(void)
 }
 
 
-void m68k_op_moves_32_ai(void)
+void m68k_op_moves_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11385,7 +11385,7 @@ void m68k_op_moves_32_ai(void)
 }
 
 
-void m68k_op_moves_32_pi(void)
+void m68k_op_moves_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11415,7 +11415,7 @@ void m68k_op_moves_32_pi(void)
 }
 
 
-void m68k_op_moves_32_pd(void)
+void m68k_op_moves_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11445,7 +11445,7 @@ void m68k_op_moves_32_pd(void)
 }
 
 
-void m68k_op_moves_32_di(void)
+void m68k_op_moves_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11475,7 +11475,7 @@ void m68k_op_moves_32_di(void)
 }
 
 
-void m68k_op_moves_32_ix(void)
+void m68k_op_moves_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11505,7 +11505,7 @@ void m68k_op_moves_32_ix(void)
 }
 
 
-void m68k_op_moves_32_aw(void)
+void m68k_op_moves_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11535,7 +11535,7 @@ void m68k_op_moves_32_aw(void)
 }
 
 
-void m68k_op_moves_32_al(void)
+void m68k_op_moves_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -11565,7 +11565,7 @@ void m68k_op_moves_32_al(void)
 }
 
 
-void m68k_op_moveq_32(void)
+void m68k_op_moveq_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX = MAKE_INT_8(MASK_OUT_ABOVE_8(REG_IR));
 
@@ -11576,7 +11576,7 @@ void m68k_op_moveq_32(void)
 }
 
 
-void m68k_op_muls_16_d(void)
+void m68k_op_muls_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(DY) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
@@ -11590,7 +11590,7 @@ void m68k_op_muls_16_d(void)
 }
 
 
-void m68k_op_muls_16_ai(void)
+void m68k_op_muls_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_AI_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
@@ -11604,7 +11604,7 @@ void m68k_op_muls_16_ai(void)
 }
 
 
-void m68k_op_muls_16_pi(void)
+void m68k_op_muls_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_PI_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
@@ -11618,7 +11618,7 @@ void m68k_op_muls_16_pi(void)
 }
 
 
-void m68k_op_muls_16_pd(void)
+void m68k_op_muls_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_PD_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
@@ -11632,7 +11632,7 @@ void m68k_op_muls_16_pd(void)
 }
 
 
-void m68k_op_muls_16_di(void)
+void m68k_op_muls_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_DI_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
@@ -11646,7 +11646,7 @@ void m68k_op_muls_16_di(void)
 }
 
 
-void m68k_op_muls_16_ix(void)
+void m68k_op_muls_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_IX_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
@@ -11660,7 +11660,7 @@ void m68k_op_muls_16_ix(void)
 }
 
 
-void m68k_op_muls_16_aw(void)
+void m68k_op_muls_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AW_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
@@ -11674,7 +11674,7 @@ void m68k_op_muls_16_aw(void)
 }
 
 
-void m68k_op_muls_16_al(void)
+void m68k_op_muls_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AL_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
@@ -11688,7 +11688,7 @@ void m68k_op_muls_16_al(void)
 }
 
 
-void m68k_op_muls_16_pcdi(void)
+void m68k_op_muls_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_PCDI_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
@@ -11702,7 +11702,7 @@ void m68k_op_muls_16_pcdi(void)
 }
 
 
-void m68k_op_muls_16_pcix(void)
+void m68k_op_muls_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_PCIX_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
@@ -11716,7 +11716,7 @@ void m68k_op_muls_16_pcix(void)
 }
 
 
-void m68k_op_muls_16_i(void)
+void m68k_op_muls_16_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_I_16()) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
@@ -11730,7 +11730,7 @@ void m68k_op_muls_16_i(void)
 }
 
 
-void m68k_op_mulu_16_d(void)
+void m68k_op_mulu_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = MASK_OUT_ABOVE_16(DY) * MASK_OUT_ABOVE_16(*r_dst);
@@ -11744,7 +11744,7 @@ void m68k_op_mulu_16_d(void)
 }
 
 
-void m68k_op_mulu_16_ai(void)
+void m68k_op_mulu_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = OPER_AY_AI_16() * MASK_OUT_ABOVE_16(*r_dst);
@@ -11758,7 +11758,7 @@ void m68k_op_mulu_16_ai(void)
 }
 
 
-void m68k_op_mulu_16_pi(void)
+void m68k_op_mulu_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = OPER_AY_PI_16() * MASK_OUT_ABOVE_16(*r_dst);
@@ -11772,7 +11772,7 @@ void m68k_op_mulu_16_pi(void)
 }
 
 
-void m68k_op_mulu_16_pd(void)
+void m68k_op_mulu_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = OPER_AY_PD_16() * MASK_OUT_ABOVE_16(*r_dst);
@@ -11786,7 +11786,7 @@ void m68k_op_mulu_16_pd(void)
 }
 
 
-void m68k_op_mulu_16_di(void)
+void m68k_op_mulu_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = OPER_AY_DI_16() * MASK_OUT_ABOVE_16(*r_dst);
@@ -11800,7 +11800,7 @@ void m68k_op_mulu_16_di(void)
 }
 
 
-void m68k_op_mulu_16_ix(void)
+void m68k_op_mulu_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = OPER_AY_IX_16() * MASK_OUT_ABOVE_16(*r_dst);
@@ -11814,7 +11814,7 @@ void m68k_op_mulu_16_ix(void)
 }
 
 
-void m68k_op_mulu_16_aw(void)
+void m68k_op_mulu_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = OPER_AW_16() * MASK_OUT_ABOVE_16(*r_dst);
@@ -11828,7 +11828,7 @@ void m68k_op_mulu_16_aw(void)
 }
 
 
-void m68k_op_mulu_16_al(void)
+void m68k_op_mulu_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = OPER_AL_16() * MASK_OUT_ABOVE_16(*r_dst);
@@ -11842,7 +11842,7 @@ void m68k_op_mulu_16_al(void)
 }
 
 
-void m68k_op_mulu_16_pcdi(void)
+void m68k_op_mulu_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = OPER_PCDI_16() * MASK_OUT_ABOVE_16(*r_dst);
@@ -11856,7 +11856,7 @@ void m68k_op_mulu_16_pcdi(void)
 }
 
 
-void m68k_op_mulu_16_pcix(void)
+void m68k_op_mulu_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = OPER_PCIX_16() * MASK_OUT_ABOVE_16(*r_dst);
@@ -11870,7 +11870,7 @@ void m68k_op_mulu_16_pcix(void)
 }
 
 
-void m68k_op_mulu_16_i(void)
+void m68k_op_mulu_16_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint res = OPER_I_16() * MASK_OUT_ABOVE_16(*r_dst);
@@ -11884,7 +11884,7 @@ void m68k_op_mulu_16_i(void)
 }
 
 
-void m68k_op_mull_32_d(void)
+void m68k_op_mull_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -12008,7 +12008,7 @@ void m68k_op_mull_32_d(void)
 }
 
 
-void m68k_op_mull_32_ai(void)
+void m68k_op_mull_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -12132,7 +12132,7 @@ void m68k_op_mull_32_ai(void)
 }
 
 
-void m68k_op_mull_32_pi(void)
+void m68k_op_mull_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -12256,7 +12256,7 @@ void m68k_op_mull_32_pi(void)
 }
 
 
-void m68k_op_mull_32_pd(void)
+void m68k_op_mull_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -12380,7 +12380,7 @@ void m68k_op_mull_32_pd(void)
 }
 
 
-void m68k_op_mull_32_di(void)
+void m68k_op_mull_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -12504,7 +12504,7 @@ void m68k_op_mull_32_di(void)
 }
 
 
-void m68k_op_mull_32_ix(void)
+void m68k_op_mull_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -12628,7 +12628,7 @@ void m68k_op_mull_32_ix(void)
 }
 
 
-void m68k_op_mull_32_aw(void)
+void m68k_op_mull_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -12752,7 +12752,7 @@ void m68k_op_mull_32_aw(void)
 }
 
 
-void m68k_op_mull_32_al(void)
+void m68k_op_mull_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -12876,7 +12876,7 @@ void m68k_op_mull_32_al(void)
 }
 
 
-void m68k_op_mull_32_pcdi(void)
+void m68k_op_mull_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -13000,7 +13000,7 @@ void m68k_op_mull_32_pcdi(void)
 }
 
 
-void m68k_op_mull_32_pcix(void)
+void m68k_op_mull_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -13124,7 +13124,7 @@ void m68k_op_mull_32_pcix(void)
 }
 
 
-void m68k_op_mull_32_i(void)
+void m68k_op_mull_32_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -5,7 +5,7 @@
 /* ======================================================================== */
 
 
-void m68k_op_nbcd_8_d(void)
+void m68k_op_nbcd_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint dst = *r_dst;
@@ -38,7 +38,7 @@ void m68k_op_nbcd_8_d(void)
 }
 
 
-void m68k_op_nbcd_8_ai(void)
+void m68k_op_nbcd_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint dst = m68ki_read_8(ea);
@@ -71,7 +71,7 @@ void m68k_op_nbcd_8_ai(void)
 }
 
 
-void m68k_op_nbcd_8_pi(void)
+void m68k_op_nbcd_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint dst = m68ki_read_8(ea);
@@ -104,7 +104,7 @@ void m68k_op_nbcd_8_pi(void)
 }
 
 
-void m68k_op_nbcd_8_pi7(void)
+void m68k_op_nbcd_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint dst = m68ki_read_8(ea);
@@ -137,7 +137,7 @@ void m68k_op_nbcd_8_pi7(void)
 }
 
 
-void m68k_op_nbcd_8_pd(void)
+void m68k_op_nbcd_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -170,7 +170,7 @@ void m68k_op_nbcd_8_pd(void)
 }
 
 
-void m68k_op_nbcd_8_pd7(void)
+void m68k_op_nbcd_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -203,7 +203,7 @@ void m68k_op_nbcd_8_pd7(void)
 }
 
 
-void m68k_op_nbcd_8_di(void)
+void m68k_op_nbcd_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint dst = m68ki_read_8(ea);
@@ -236,7 +236,7 @@ void m68k_op_nbcd_8_di(void)
 }
 
 
-void m68k_op_nbcd_8_ix(void)
+void m68k_op_nbcd_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint dst = m68ki_read_8(ea);
@@ -269,7 +269,7 @@ void m68k_op_nbcd_8_ix(void)
 }
 
 
-void m68k_op_nbcd_8_aw(void)
+void m68k_op_nbcd_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint dst = m68ki_read_8(ea);
@@ -302,7 +302,7 @@ void m68k_op_nbcd_8_aw(void)
 }
 
 
-void m68k_op_nbcd_8_al(void)
+void m68k_op_nbcd_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint dst = m68ki_read_8(ea);
@@ -335,7 +335,7 @@ void m68k_op_nbcd_8_al(void)
 }
 
 
-void m68k_op_neg_8_d(void)
+void m68k_op_neg_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint res = 0 - MASK_OUT_ABOVE_8(*r_dst);
@@ -349,7 +349,7 @@ void m68k_op_neg_8_d(void)
 }
 
 
-void m68k_op_neg_8_ai(void)
+void m68k_op_neg_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint src = m68ki_read_8(ea);
@@ -364,7 +364,7 @@ void m68k_op_neg_8_ai(void)
 }
 
 
-void m68k_op_neg_8_pi(void)
+void m68k_op_neg_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -379,7 +379,7 @@ void m68k_op_neg_8_pi(void)
 }
 
 
-void m68k_op_neg_8_pi7(void)
+void m68k_op_neg_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -394,7 +394,7 @@ void m68k_op_neg_8_pi7(void)
 }
 
 
-void m68k_op_neg_8_pd(void)
+void m68k_op_neg_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -409,7 +409,7 @@ void m68k_op_neg_8_pd(void)
 }
 
 
-void m68k_op_neg_8_pd7(void)
+void m68k_op_neg_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -424,7 +424,7 @@ void m68k_op_neg_8_pd7(void)
 }
 
 
-void m68k_op_neg_8_di(void)
+void m68k_op_neg_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint src = m68ki_read_8(ea);
@@ -439,7 +439,7 @@ void m68k_op_neg_8_di(void)
 }
 
 
-void m68k_op_neg_8_ix(void)
+void m68k_op_neg_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint src = m68ki_read_8(ea);
@@ -454,7 +454,7 @@ void m68k_op_neg_8_ix(void)
 }
 
 
-void m68k_op_neg_8_aw(void)
+void m68k_op_neg_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint src = m68ki_read_8(ea);
@@ -469,7 +469,7 @@ void m68k_op_neg_8_aw(void)
 }
 
 
-void m68k_op_neg_8_al(void)
+void m68k_op_neg_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint src = m68ki_read_8(ea);
@@ -484,7 +484,7 @@ void m68k_op_neg_8_al(void)
 }
 
 
-void m68k_op_neg_16_d(void)
+void m68k_op_neg_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint res = 0 - MASK_OUT_ABOVE_16(*r_dst);
@@ -498,7 +498,7 @@ void m68k_op_neg_16_d(void)
 }
 
 
-void m68k_op_neg_16_ai(void)
+void m68k_op_neg_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -513,7 +513,7 @@ void m68k_op_neg_16_ai(void)
 }
 
 
-void m68k_op_neg_16_pi(void)
+void m68k_op_neg_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -528,7 +528,7 @@ void m68k_op_neg_16_pi(void)
 }
 
 
-void m68k_op_neg_16_pd(void)
+void m68k_op_neg_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -543,7 +543,7 @@ void m68k_op_neg_16_pd(void)
 }
 
 
-void m68k_op_neg_16_di(void)
+void m68k_op_neg_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -558,7 +558,7 @@ void m68k_op_neg_16_di(void)
 }
 
 
-void m68k_op_neg_16_ix(void)
+void m68k_op_neg_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -573,7 +573,7 @@ void m68k_op_neg_16_ix(void)
 }
 
 
-void m68k_op_neg_16_aw(void)
+void m68k_op_neg_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -588,7 +588,7 @@ void m68k_op_neg_16_aw(void)
 }
 
 
-void m68k_op_neg_16_al(void)
+void m68k_op_neg_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -603,7 +603,7 @@ void m68k_op_neg_16_al(void)
 }
 
 
-void m68k_op_neg_32_d(void)
+void m68k_op_neg_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint res = 0 - *r_dst;
@@ -617,7 +617,7 @@ void m68k_op_neg_32_d(void)
 }
 
 
-void m68k_op_neg_32_ai(void)
+void m68k_op_neg_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_32();
 	uint src = m68ki_read_32(ea);
@@ -632,7 +632,7 @@ void m68k_op_neg_32_ai(void)
 }
 
 
-void m68k_op_neg_32_pi(void)
+void m68k_op_neg_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_32();
 	uint src = m68ki_read_32(ea);
@@ -647,7 +647,7 @@ void m68k_op_neg_32_pi(void)
 }
 
 
-void m68k_op_neg_32_pd(void)
+void m68k_op_neg_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_32();
 	uint src = m68ki_read_32(ea);
@@ -662,7 +662,7 @@ void m68k_op_neg_32_pd(void)
 }
 
 
-void m68k_op_neg_32_di(void)
+void m68k_op_neg_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_32();
 	uint src = m68ki_read_32(ea);
@@ -677,7 +677,7 @@ void m68k_op_neg_32_di(void)
 }
 
 
-void m68k_op_neg_32_ix(void)
+void m68k_op_neg_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_32();
 	uint src = m68ki_read_32(ea);
@@ -692,7 +692,7 @@ void m68k_op_neg_32_ix(void)
 }
 
 
-void m68k_op_neg_32_aw(void)
+void m68k_op_neg_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_32();
 	uint src = m68ki_read_32(ea);
@@ -707,7 +707,7 @@ void m68k_op_neg_32_aw(void)
 }
 
 
-void m68k_op_neg_32_al(void)
+void m68k_op_neg_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_32();
 	uint src = m68ki_read_32(ea);
@@ -722,7 +722,7 @@ void m68k_op_neg_32_al(void)
 }
 
 
-void m68k_op_negx_8_d(void)
+void m68k_op_negx_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint res = 0 - MASK_OUT_ABOVE_8(*r_dst) - XFLAG_AS_1();
@@ -738,7 +738,7 @@ void m68k_op_negx_8_d(void)
 }
 
 
-void m68k_op_negx_8_ai(void)
+void m68k_op_negx_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint src = m68ki_read_8(ea);
@@ -755,7 +755,7 @@ void m68k_op_negx_8_ai(void)
 }
 
 
-void m68k_op_negx_8_pi(void)
+void m68k_op_negx_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -772,7 +772,7 @@ void m68k_op_negx_8_pi(void)
 }
 
 
-void m68k_op_negx_8_pi7(void)
+void m68k_op_negx_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint src = m68ki_read_8(ea);
@@ -789,7 +789,7 @@ void m68k_op_negx_8_pi7(void)
 }
 
 
-void m68k_op_negx_8_pd(void)
+void m68k_op_negx_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -806,7 +806,7 @@ void m68k_op_negx_8_pd(void)
 }
 
 
-void m68k_op_negx_8_pd7(void)
+void m68k_op_negx_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint src = m68ki_read_8(ea);
@@ -823,7 +823,7 @@ void m68k_op_negx_8_pd7(void)
 }
 
 
-void m68k_op_negx_8_di(void)
+void m68k_op_negx_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint src = m68ki_read_8(ea);
@@ -840,7 +840,7 @@ void m68k_op_negx_8_di(void)
 }
 
 
-void m68k_op_negx_8_ix(void)
+void m68k_op_negx_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint src = m68ki_read_8(ea);
@@ -857,7 +857,7 @@ void m68k_op_negx_8_ix(void)
 }
 
 
-void m68k_op_negx_8_aw(void)
+void m68k_op_negx_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint src = m68ki_read_8(ea);
@@ -874,7 +874,7 @@ void m68k_op_negx_8_aw(void)
 }
 
 
-void m68k_op_negx_8_al(void)
+void m68k_op_negx_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint src = m68ki_read_8(ea);
@@ -891,7 +891,7 @@ void m68k_op_negx_8_al(void)
 }
 
 
-void m68k_op_negx_16_d(void)
+void m68k_op_negx_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint res = 0 - MASK_OUT_ABOVE_16(*r_dst) - XFLAG_AS_1();
@@ -907,7 +907,7 @@ void m68k_op_negx_16_d(void)
 }
 
 
-void m68k_op_negx_16_ai(void)
+void m68k_op_negx_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -924,7 +924,7 @@ void m68k_op_negx_16_ai(void)
 }
 
 
-void m68k_op_negx_16_pi(void)
+void m68k_op_negx_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -941,7 +941,7 @@ void m68k_op_negx_16_pi(void)
 }
 
 
-void m68k_op_negx_16_pd(void)
+void m68k_op_negx_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -958,7 +958,7 @@ void m68k_op_negx_16_pd(void)
 }
 
 
-void m68k_op_negx_16_di(void)
+void m68k_op_negx_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -975,7 +975,7 @@ void m68k_op_negx_16_di(void)
 }
 
 
-void m68k_op_negx_16_ix(void)
+void m68k_op_negx_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -992,7 +992,7 @@ void m68k_op_negx_16_ix(void)
 }
 
 
-void m68k_op_negx_16_aw(void)
+void m68k_op_negx_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -1009,7 +1009,7 @@ void m68k_op_negx_16_aw(void)
 }
 
 
-void m68k_op_negx_16_al(void)
+void m68k_op_negx_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -1026,7 +1026,7 @@ void m68k_op_negx_16_al(void)
 }
 
 
-void m68k_op_negx_32_d(void)
+void m68k_op_negx_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint res = 0 - MASK_OUT_ABOVE_32(*r_dst) - XFLAG_AS_1();
@@ -1042,7 +1042,7 @@ void m68k_op_negx_32_d(void)
 }
 
 
-void m68k_op_negx_32_ai(void)
+void m68k_op_negx_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AY_AI_32();
 	uint src = m68ki_read_32(ea);
@@ -1059,7 +1059,7 @@ void m68k_op_negx_32_ai(void)
 }
 
 
-void m68k_op_negx_32_pi(void)
+void m68k_op_negx_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AY_PI_32();
 	uint src = m68ki_read_32(ea);
@@ -1076,7 +1076,7 @@ void m68k_op_negx_32_pi(void)
 }
 
 
-void m68k_op_negx_32_pd(void)
+void m68k_op_negx_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AY_PD_32();
 	uint src = m68ki_read_32(ea);
@@ -1093,7 +1093,7 @@ void m68k_op_negx_32_pd(void)
 }
 
 
-void m68k_op_negx_32_di(void)
+void m68k_op_negx_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AY_DI_32();
 	uint src = m68ki_read_32(ea);
@@ -1110,7 +1110,7 @@ void m68k_op_negx_32_di(void)
 }
 
 
-void m68k_op_negx_32_ix(void)
+void m68k_op_negx_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AY_IX_32();
 	uint src = m68ki_read_32(ea);
@@ -1127,7 +1127,7 @@ void m68k_op_negx_32_ix(void)
 }
 
 
-void m68k_op_negx_32_aw(void)
+void m68k_op_negx_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AW_32();
 	uint src = m68ki_read_32(ea);
@@ -1144,7 +1144,7 @@ void m68k_op_negx_32_aw(void)
 }
 
 
-void m68k_op_negx_32_al(void)
+void m68k_op_negx_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea  = EA_AL_32();
 	uint src = m68ki_read_32(ea);
@@ -1161,13 +1161,13 @@ void m68k_op_negx_32_al(void)
 }
 
 
-void m68k_op_nop(void)
+void m68k_op_nop(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 }
 
 
-void m68k_op_not_8_d(void)
+void m68k_op_not_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint res = MASK_OUT_ABOVE_8(~*r_dst);
@@ -1181,7 +1181,7 @@ void m68k_op_not_8_d(void)
 }
 
 
-void m68k_op_not_8_ai(void)
+void m68k_op_not_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
@@ -1195,7 +1195,7 @@ void m68k_op_not_8_ai(void)
 }
 
 
-void m68k_op_not_8_pi(void)
+void m68k_op_not_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
@@ -1209,7 +1209,7 @@ void m68k_op_not_8_pi(void)
 }
 
 
-void m68k_op_not_8_pi7(void)
+void m68k_op_not_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
@@ -1223,7 +1223,7 @@ void m68k_op_not_8_pi7(void)
 }
 
 
-void m68k_op_not_8_pd(void)
+void m68k_op_not_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
@@ -1237,7 +1237,7 @@ void m68k_op_not_8_pd(void)
 }
 
 
-void m68k_op_not_8_pd7(void)
+void m68k_op_not_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
@@ -1251,7 +1251,7 @@ void m68k_op_not_8_pd7(void)
 }
 
 
-void m68k_op_not_8_di(void)
+void m68k_op_not_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
@@ -1265,7 +1265,7 @@ void m68k_op_not_8_di(void)
 }
 
 
-void m68k_op_not_8_ix(void)
+void m68k_op_not_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
@@ -1279,7 +1279,7 @@ void m68k_op_not_8_ix(void)
 }
 
 
-void m68k_op_not_8_aw(void)
+void m68k_op_not_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
@@ -1293,7 +1293,7 @@ void m68k_op_not_8_aw(void)
 }
 
 
-void m68k_op_not_8_al(void)
+void m68k_op_not_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(ea));
@@ -1307,7 +1307,7 @@ void m68k_op_not_8_al(void)
 }
 
 
-void m68k_op_not_16_d(void)
+void m68k_op_not_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint res = MASK_OUT_ABOVE_16(~*r_dst);
@@ -1321,7 +1321,7 @@ void m68k_op_not_16_d(void)
 }
 
 
-void m68k_op_not_16_ai(void)
+void m68k_op_not_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
@@ -1335,7 +1335,7 @@ void m68k_op_not_16_ai(void)
 }
 
 
-void m68k_op_not_16_pi(void)
+void m68k_op_not_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
@@ -1349,7 +1349,7 @@ void m68k_op_not_16_pi(void)
 }
 
 
-void m68k_op_not_16_pd(void)
+void m68k_op_not_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
@@ -1363,7 +1363,7 @@ void m68k_op_not_16_pd(void)
 }
 
 
-void m68k_op_not_16_di(void)
+void m68k_op_not_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
@@ -1377,7 +1377,7 @@ void m68k_op_not_16_di(void)
 }
 
 
-void m68k_op_not_16_ix(void)
+void m68k_op_not_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
@@ -1391,7 +1391,7 @@ void m68k_op_not_16_ix(void)
 }
 
 
-void m68k_op_not_16_aw(void)
+void m68k_op_not_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
@@ -1405,7 +1405,7 @@ void m68k_op_not_16_aw(void)
 }
 
 
-void m68k_op_not_16_al(void)
+void m68k_op_not_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(ea));
@@ -1419,7 +1419,7 @@ void m68k_op_not_16_al(void)
 }
 
 
-void m68k_op_not_32_d(void)
+void m68k_op_not_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint res = *r_dst = MASK_OUT_ABOVE_32(~*r_dst);
@@ -1431,7 +1431,7 @@ void m68k_op_not_32_d(void)
 }
 
 
-void m68k_op_not_32_ai(void)
+void m68k_op_not_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_32();
 	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
@@ -1445,7 +1445,7 @@ void m68k_op_not_32_ai(void)
 }
 
 
-void m68k_op_not_32_pi(void)
+void m68k_op_not_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_32();
 	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
@@ -1459,7 +1459,7 @@ void m68k_op_not_32_pi(void)
 }
 
 
-void m68k_op_not_32_pd(void)
+void m68k_op_not_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_32();
 	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
@@ -1473,7 +1473,7 @@ void m68k_op_not_32_pd(void)
 }
 
 
-void m68k_op_not_32_di(void)
+void m68k_op_not_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_32();
 	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
@@ -1487,7 +1487,7 @@ void m68k_op_not_32_di(void)
 }
 
 
-void m68k_op_not_32_ix(void)
+void m68k_op_not_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_32();
 	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
@@ -1501,7 +1501,7 @@ void m68k_op_not_32_ix(void)
 }
 
 
-void m68k_op_not_32_aw(void)
+void m68k_op_not_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_32();
 	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
@@ -1515,7 +1515,7 @@ void m68k_op_not_32_aw(void)
 }
 
 
-void m68k_op_not_32_al(void)
+void m68k_op_not_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_32();
 	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(ea));
@@ -1529,7 +1529,7 @@ void m68k_op_not_32_al(void)
 }
 
 
-void m68k_op_or_8_er_d(void)
+void m68k_op_or_8_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= MASK_OUT_ABOVE_8(DY)));
 
@@ -1540,7 +1540,7 @@ void m68k_op_or_8_er_d(void)
 }
 
 
-void m68k_op_or_8_er_ai(void)
+void m68k_op_or_8_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_AI_8()));
 
@@ -1551,7 +1551,7 @@ void m68k_op_or_8_er_ai(void)
 }
 
 
-void m68k_op_or_8_er_pi(void)
+void m68k_op_or_8_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_PI_8()));
 
@@ -1562,7 +1562,7 @@ void m68k_op_or_8_er_pi(void)
 }
 
 
-void m68k_op_or_8_er_pi7(void)
+void m68k_op_or_8_er_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_A7_PI_8()));
 
@@ -1573,7 +1573,7 @@ void m68k_op_or_8_er_pi7(void)
 }
 
 
-void m68k_op_or_8_er_pd(void)
+void m68k_op_or_8_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_PD_8()));
 
@@ -1584,7 +1584,7 @@ void m68k_op_or_8_er_pd(void)
 }
 
 
-void m68k_op_or_8_er_pd7(void)
+void m68k_op_or_8_er_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_A7_PD_8()));
 
@@ -1595,7 +1595,7 @@ void m68k_op_or_8_er_pd7(void)
 }
 
 
-void m68k_op_or_8_er_di(void)
+void m68k_op_or_8_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_DI_8()));
 
@@ -1606,7 +1606,7 @@ void m68k_op_or_8_er_di(void)
 }
 
 
-void m68k_op_or_8_er_ix(void)
+void m68k_op_or_8_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_IX_8()));
 
@@ -1617,7 +1617,7 @@ void m68k_op_or_8_er_ix(void)
 }
 
 
-void m68k_op_or_8_er_aw(void)
+void m68k_op_or_8_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AW_8()));
 
@@ -1628,7 +1628,7 @@ void m68k_op_or_8_er_aw(void)
 }
 
 
-void m68k_op_or_8_er_al(void)
+void m68k_op_or_8_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AL_8()));
 
@@ -1639,7 +1639,7 @@ void m68k_op_or_8_er_al(void)
 }
 
 
-void m68k_op_or_8_er_pcdi(void)
+void m68k_op_or_8_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_PCDI_8()));
 
@@ -1650,7 +1650,7 @@ void m68k_op_or_8_er_pcdi(void)
 }
 
 
-void m68k_op_or_8_er_pcix(void)
+void m68k_op_or_8_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_PCIX_8()));
 
@@ -1661,7 +1661,7 @@ void m68k_op_or_8_er_pcix(void)
 }
 
 
-void m68k_op_or_8_er_i(void)
+void m68k_op_or_8_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DX |= OPER_I_8()));
 
@@ -1672,7 +1672,7 @@ void m68k_op_or_8_er_i(void)
 }
 
 
-void m68k_op_or_16_er_d(void)
+void m68k_op_or_16_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= MASK_OUT_ABOVE_16(DY)));
 
@@ -1683,7 +1683,7 @@ void m68k_op_or_16_er_d(void)
 }
 
 
-void m68k_op_or_16_er_ai(void)
+void m68k_op_or_16_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_AI_16()));
 
@@ -1694,7 +1694,7 @@ void m68k_op_or_16_er_ai(void)
 }
 
 
-void m68k_op_or_16_er_pi(void)
+void m68k_op_or_16_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_PI_16()));
 
@@ -1705,7 +1705,7 @@ void m68k_op_or_16_er_pi(void)
 }
 
 
-void m68k_op_or_16_er_pd(void)
+void m68k_op_or_16_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_PD_16()));
 
@@ -1716,7 +1716,7 @@ void m68k_op_or_16_er_pd(void)
 }
 
 
-void m68k_op_or_16_er_di(void)
+void m68k_op_or_16_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_DI_16()));
 
@@ -1727,7 +1727,7 @@ void m68k_op_or_16_er_di(void)
 }
 
 
-void m68k_op_or_16_er_ix(void)
+void m68k_op_or_16_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_IX_16()));
 
@@ -1738,7 +1738,7 @@ void m68k_op_or_16_er_ix(void)
 }
 
 
-void m68k_op_or_16_er_aw(void)
+void m68k_op_or_16_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AW_16()));
 
@@ -1749,7 +1749,7 @@ void m68k_op_or_16_er_aw(void)
 }
 
 
-void m68k_op_or_16_er_al(void)
+void m68k_op_or_16_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AL_16()));
 
@@ -1760,7 +1760,7 @@ void m68k_op_or_16_er_al(void)
 }
 
 
-void m68k_op_or_16_er_pcdi(void)
+void m68k_op_or_16_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= OPER_PCDI_16()));
 
@@ -1771,7 +1771,7 @@ void m68k_op_or_16_er_pcdi(void)
 }
 
 
-void m68k_op_or_16_er_pcix(void)
+void m68k_op_or_16_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= OPER_PCIX_16()));
 
@@ -1782,7 +1782,7 @@ void m68k_op_or_16_er_pcix(void)
 }
 
 
-void m68k_op_or_16_er_i(void)
+void m68k_op_or_16_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16((DX |= OPER_I_16()));
 
@@ -1793,7 +1793,7 @@ void m68k_op_or_16_er_i(void)
 }
 
 
-void m68k_op_or_32_er_d(void)
+void m68k_op_or_32_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX |= DY;
 
@@ -1804,7 +1804,7 @@ void m68k_op_or_32_er_d(void)
 }
 
 
-void m68k_op_or_32_er_ai(void)
+void m68k_op_or_32_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX |= OPER_AY_AI_32();
 
@@ -1815,7 +1815,7 @@ void m68k_op_or_32_er_ai(void)
 }
 
 
-void m68k_op_or_32_er_pi(void)
+void m68k_op_or_32_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX |= OPER_AY_PI_32();
 
@@ -1826,7 +1826,7 @@ void m68k_op_or_32_er_pi(void)
 }
 
 
-void m68k_op_or_32_er_pd(void)
+void m68k_op_or_32_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX |= OPER_AY_PD_32();
 
@@ -1837,7 +1837,7 @@ void m68k_op_or_32_er_pd(void)
 }
 
 
-void m68k_op_or_32_er_di(void)
+void m68k_op_or_32_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX |= OPER_AY_DI_32();
 
@@ -1848,7 +1848,7 @@ void m68k_op_or_32_er_di(void)
 }
 
 
-void m68k_op_or_32_er_ix(void)
+void m68k_op_or_32_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX |= OPER_AY_IX_32();
 
@@ -1859,7 +1859,7 @@ void m68k_op_or_32_er_ix(void)
 }
 
 
-void m68k_op_or_32_er_aw(void)
+void m68k_op_or_32_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX |= OPER_AW_32();
 
@@ -1870,7 +1870,7 @@ void m68k_op_or_32_er_aw(void)
 }
 
 
-void m68k_op_or_32_er_al(void)
+void m68k_op_or_32_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX |= OPER_AL_32();
 
@@ -1881,7 +1881,7 @@ void m68k_op_or_32_er_al(void)
 }
 
 
-void m68k_op_or_32_er_pcdi(void)
+void m68k_op_or_32_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX |= OPER_PCDI_32();
 
@@ -1892,7 +1892,7 @@ void m68k_op_or_32_er_pcdi(void)
 }
 
 
-void m68k_op_or_32_er_pcix(void)
+void m68k_op_or_32_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX |= OPER_PCIX_32();
 
@@ -1903,7 +1903,7 @@ void m68k_op_or_32_er_pcix(void)
 }
 
 
-void m68k_op_or_32_er_i(void)
+void m68k_op_or_32_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DX |= OPER_I_32();
 
@@ -1914,7 +1914,7 @@ void m68k_op_or_32_er_i(void)
 }
 
 
-void m68k_op_or_8_re_ai(void)
+void m68k_op_or_8_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
@@ -1928,7 +1928,7 @@ void m68k_op_or_8_re_ai(void)
 }
 
 
-void m68k_op_or_8_re_pi(void)
+void m68k_op_or_8_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
@@ -1942,7 +1942,7 @@ void m68k_op_or_8_re_pi(void)
 }
 
 
-void m68k_op_or_8_re_pi7(void)
+void m68k_op_or_8_re_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
@@ -1956,7 +1956,7 @@ void m68k_op_or_8_re_pi7(void)
 }
 
 
-void m68k_op_or_8_re_pd(void)
+void m68k_op_or_8_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
@@ -1970,7 +1970,7 @@ void m68k_op_or_8_re_pd(void)
 }
 
 
-void m68k_op_or_8_re_pd7(void)
+void m68k_op_or_8_re_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
@@ -1984,7 +1984,7 @@ void m68k_op_or_8_re_pd7(void)
 }
 
 
-void m68k_op_or_8_re_di(void)
+void m68k_op_or_8_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
@@ -1998,7 +1998,7 @@ void m68k_op_or_8_re_di(void)
 }
 
 
-void m68k_op_or_8_re_ix(void)
+void m68k_op_or_8_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
@@ -2012,7 +2012,7 @@ void m68k_op_or_8_re_ix(void)
 }
 
 
-void m68k_op_or_8_re_aw(void)
+void m68k_op_or_8_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
@@ -2026,7 +2026,7 @@ void m68k_op_or_8_re_aw(void)
 }
 
 
-void m68k_op_or_8_re_al(void)
+void m68k_op_or_8_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(ea));
@@ -2040,7 +2040,7 @@ void m68k_op_or_8_re_al(void)
 }
 
 
-void m68k_op_or_16_re_ai(void)
+void m68k_op_or_16_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
@@ -2054,7 +2054,7 @@ void m68k_op_or_16_re_ai(void)
 }
 
 
-void m68k_op_or_16_re_pi(void)
+void m68k_op_or_16_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
@@ -2068,7 +2068,7 @@ void m68k_op_or_16_re_pi(void)
 }
 
 
-void m68k_op_or_16_re_pd(void)
+void m68k_op_or_16_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
@@ -2082,7 +2082,7 @@ void m68k_op_or_16_re_pd(void)
 }
 
 
-void m68k_op_or_16_re_di(void)
+void m68k_op_or_16_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
@@ -2096,7 +2096,7 @@ void m68k_op_or_16_re_di(void)
 }
 
 
-void m68k_op_or_16_re_ix(void)
+void m68k_op_or_16_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
@@ -2110,7 +2110,7 @@ void m68k_op_or_16_re_ix(void)
 }
 
 
-void m68k_op_or_16_re_aw(void)
+void m68k_op_or_16_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
@@ -2124,7 +2124,7 @@ void m68k_op_or_16_re_aw(void)
 }
 
 
-void m68k_op_or_16_re_al(void)
+void m68k_op_or_16_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(ea));
@@ -2138,7 +2138,7 @@ void m68k_op_or_16_re_al(void)
 }
 
 
-void m68k_op_or_32_re_ai(void)
+void m68k_op_or_32_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_32();
 	uint res = DX | m68ki_read_32(ea);
@@ -2152,7 +2152,7 @@ void m68k_op_or_32_re_ai(void)
 }
 
 
-void m68k_op_or_32_re_pi(void)
+void m68k_op_or_32_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_32();
 	uint res = DX | m68ki_read_32(ea);
@@ -2166,7 +2166,7 @@ void m68k_op_or_32_re_pi(void)
 }
 
 
-void m68k_op_or_32_re_pd(void)
+void m68k_op_or_32_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_32();
 	uint res = DX | m68ki_read_32(ea);
@@ -2180,7 +2180,7 @@ void m68k_op_or_32_re_pd(void)
 }
 
 
-void m68k_op_or_32_re_di(void)
+void m68k_op_or_32_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_32();
 	uint res = DX | m68ki_read_32(ea);
@@ -2194,7 +2194,7 @@ void m68k_op_or_32_re_di(void)
 }
 
 
-void m68k_op_or_32_re_ix(void)
+void m68k_op_or_32_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_32();
 	uint res = DX | m68ki_read_32(ea);
@@ -2208,7 +2208,7 @@ void m68k_op_or_32_re_ix(void)
 }
 
 
-void m68k_op_or_32_re_aw(void)
+void m68k_op_or_32_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_32();
 	uint res = DX | m68ki_read_32(ea);
@@ -2222,7 +2222,7 @@ void m68k_op_or_32_re_aw(void)
 }
 
 
-void m68k_op_or_32_re_al(void)
+void m68k_op_or_32_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_32();
 	uint res = DX | m68ki_read_32(ea);
@@ -2236,7 +2236,7 @@ void m68k_op_or_32_re_al(void)
 }
 
 
-void m68k_op_ori_8_d(void)
+void m68k_op_ori_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8((DY |= OPER_I_8()));
 
@@ -2247,7 +2247,7 @@ void m68k_op_ori_8_d(void)
 }
 
 
-void m68k_op_ori_8_ai(void)
+void m68k_op_ori_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_AI_8();
@@ -2262,7 +2262,7 @@ void m68k_op_ori_8_ai(void)
 }
 
 
-void m68k_op_ori_8_pi(void)
+void m68k_op_ori_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PI_8();
@@ -2277,7 +2277,7 @@ void m68k_op_ori_8_pi(void)
 }
 
 
-void m68k_op_ori_8_pi7(void)
+void m68k_op_ori_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PI_8();
@@ -2292,7 +2292,7 @@ void m68k_op_ori_8_pi7(void)
 }
 
 
-void m68k_op_ori_8_pd(void)
+void m68k_op_ori_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PD_8();
@@ -2307,7 +2307,7 @@ void m68k_op_ori_8_pd(void)
 }
 
 
-void m68k_op_ori_8_pd7(void)
+void m68k_op_ori_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PD_8();
@@ -2322,7 +2322,7 @@ void m68k_op_ori_8_pd7(void)
 }
 
 
-void m68k_op_ori_8_di(void)
+void m68k_op_ori_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_DI_8();
@@ -2337,7 +2337,7 @@ void m68k_op_ori_8_di(void)
 }
 
 
-void m68k_op_ori_8_ix(void)
+void m68k_op_ori_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_IX_8();
@@ -2352,7 +2352,7 @@ void m68k_op_ori_8_ix(void)
 }
 
 
-void m68k_op_ori_8_aw(void)
+void m68k_op_ori_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AW_8();
@@ -2367,7 +2367,7 @@ void m68k_op_ori_8_aw(void)
 }
 
 
-void m68k_op_ori_8_al(void)
+void m68k_op_ori_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AL_8();
@@ -2382,7 +2382,7 @@ void m68k_op_ori_8_al(void)
 }
 
 
-void m68k_op_ori_16_d(void)
+void m68k_op_ori_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY |= OPER_I_16());
 
@@ -2393,7 +2393,7 @@ void m68k_op_ori_16_d(void)
 }
 
 
-void m68k_op_ori_16_ai(void)
+void m68k_op_ori_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_AI_16();
@@ -2408,7 +2408,7 @@ void m68k_op_ori_16_ai(void)
 }
 
 
-void m68k_op_ori_16_pi(void)
+void m68k_op_ori_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PI_16();
@@ -2423,7 +2423,7 @@ void m68k_op_ori_16_pi(void)
 }
 
 
-void m68k_op_ori_16_pd(void)
+void m68k_op_ori_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PD_16();
@@ -2438,7 +2438,7 @@ void m68k_op_ori_16_pd(void)
 }
 
 
-void m68k_op_ori_16_di(void)
+void m68k_op_ori_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_DI_16();
@@ -2453,7 +2453,7 @@ void m68k_op_ori_16_di(void)
 }
 
 
-void m68k_op_ori_16_ix(void)
+void m68k_op_ori_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_IX_16();
@@ -2468,7 +2468,7 @@ void m68k_op_ori_16_ix(void)
 }
 
 
-void m68k_op_ori_16_aw(void)
+void m68k_op_ori_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AW_16();
@@ -2483,7 +2483,7 @@ void m68k_op_ori_16_aw(void)
 }
 
 
-void m68k_op_ori_16_al(void)
+void m68k_op_ori_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AL_16();
@@ -2498,7 +2498,7 @@ void m68k_op_ori_16_al(void)
 }
 
 
-void m68k_op_ori_32_d(void)
+void m68k_op_ori_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY |= OPER_I_32();
 
@@ -2509,7 +2509,7 @@ void m68k_op_ori_32_d(void)
 }
 
 
-void m68k_op_ori_32_ai(void)
+void m68k_op_ori_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_AI_32();
@@ -2524,7 +2524,7 @@ void m68k_op_ori_32_ai(void)
 }
 
 
-void m68k_op_ori_32_pi(void)
+void m68k_op_ori_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PI_32();
@@ -2539,7 +2539,7 @@ void m68k_op_ori_32_pi(void)
 }
 
 
-void m68k_op_ori_32_pd(void)
+void m68k_op_ori_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PD_32();
@@ -2554,7 +2554,7 @@ void m68k_op_ori_32_pd(void)
 }
 
 
-void m68k_op_ori_32_di(void)
+void m68k_op_ori_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_DI_32();
@@ -2569,7 +2569,7 @@ void m68k_op_ori_32_di(void)
 }
 
 
-void m68k_op_ori_32_ix(void)
+void m68k_op_ori_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_IX_32();
@@ -2584,7 +2584,7 @@ void m68k_op_ori_32_ix(void)
 }
 
 
-void m68k_op_ori_32_aw(void)
+void m68k_op_ori_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AW_32();
@@ -2599,7 +2599,7 @@ void m68k_op_ori_32_aw(void)
 }
 
 
-void m68k_op_ori_32_al(void)
+void m68k_op_ori_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AL_32();
@@ -2614,13 +2614,13 @@ void m68k_op_ori_32_al(void)
 }
 
 
-void m68k_op_ori_16_toc(void)
+void m68k_op_ori_16_toc(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_set_ccr(m68ki_get_ccr() | OPER_I_8());
 }
 
 
-void m68k_op_ori_16_tos(void)
+void m68k_op_ori_16_tos(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -2633,7 +2633,7 @@ void m68k_op_ori_16_tos(void)
 }
 
 
-void m68k_op_pack_16_rr(void)
+void m68k_op_pack_16_rr(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -2648,7 +2648,7 @@ void m68k_op_pack_16_rr(void)
 }
 
 
-void m68k_op_pack_16_mm_ax7(void)
+void m68k_op_pack_16_mm_ax7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -2665,7 +2665,7 @@ void m68k_op_pack_16_mm_ax7(void)
 }
 
 
-void m68k_op_pack_16_mm_ay7(void)
+void m68k_op_pack_16_mm_ay7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -2682,7 +2682,7 @@ void m68k_op_pack_16_mm_ay7(void)
 }
 
 
-void m68k_op_pack_16_mm_axy7(void)
+void m68k_op_pack_16_mm_axy7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -2698,7 +2698,7 @@ void m68k_op_pack_16_mm_axy7(void)
 }
 
 
-void m68k_op_pack_16_mm(void)
+void m68k_op_pack_16_mm(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -2715,7 +2715,7 @@ void m68k_op_pack_16_mm(void)
 }
 
 
-void m68k_op_pea_32_ai(void)
+void m68k_op_pea_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_32();
 
@@ -2723,7 +2723,7 @@ void m68k_op_pea_32_ai(void)
 }
 
 
-void m68k_op_pea_32_di(void)
+void m68k_op_pea_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_32();
 
@@ -2731,7 +2731,7 @@ void m68k_op_pea_32_di(void)
 }
 
 
-void m68k_op_pea_32_ix(void)
+void m68k_op_pea_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_32();
 
@@ -2739,7 +2739,7 @@ void m68k_op_pea_32_ix(void)
 }
 
 
-void m68k_op_pea_32_aw(void)
+void m68k_op_pea_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_32();
 
@@ -2747,7 +2747,7 @@ void m68k_op_pea_32_aw(void)
 }
 
 
-void m68k_op_pea_32_al(void)
+void m68k_op_pea_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_32();
 
@@ -2755,7 +2755,7 @@ void m68k_op_pea_32_al(void)
 }
 
 
-void m68k_op_pea_32_pcdi(void)
+void m68k_op_pea_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_PCDI_32();
 
@@ -2763,7 +2763,7 @@ void m68k_op_pea_32_pcdi(void)
 }
 
 
-void m68k_op_pea_32_pcix(void)
+void m68k_op_pea_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_PCIX_32();
 
@@ -2771,7 +2771,7 @@ void m68k_op_pea_32_pcix(void)
 }
 
 
-void m68k_op_reset(void)
+void m68k_op_reset(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -2783,7 +2783,7 @@ void m68k_op_reset(void)
 }
 
 
-void m68k_op_ror_8_s(void)
+void m68k_op_ror_8_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -2803,7 +2803,7 @@ void m68k_op_ror_8_s(void)
 }
 
 
-void m68k_op_ror_16_s(void)
+void m68k_op_ror_16_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -2822,7 +2822,7 @@ void m68k_op_ror_16_s(void)
 }
 
 
-void m68k_op_ror_32_s(void)
+void m68k_op_ror_32_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -2841,7 +2841,7 @@ void m68k_op_ror_32_s(void)
 }
 
 
-void m68k_op_ror_8_r(void)
+void m68k_op_ror_8_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
@@ -2868,7 +2868,7 @@ void m68k_op_ror_8_r(void)
 }
 
 
-void m68k_op_ror_16_r(void)
+void m68k_op_ror_16_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
@@ -2895,7 +2895,7 @@ void m68k_op_ror_16_r(void)
 }
 
 
-void m68k_op_ror_32_r(void)
+void m68k_op_ror_32_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
@@ -2922,7 +2922,7 @@ void m68k_op_ror_32_r(void)
 }
 
 
-void m68k_op_ror_16_ai(void)
+void m68k_op_ror_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -2937,7 +2937,7 @@ void m68k_op_ror_16_ai(void)
 }
 
 
-void m68k_op_ror_16_pi(void)
+void m68k_op_ror_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -2952,7 +2952,7 @@ void m68k_op_ror_16_pi(void)
 }
 
 
-void m68k_op_ror_16_pd(void)
+void m68k_op_ror_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -2967,7 +2967,7 @@ void m68k_op_ror_16_pd(void)
 }
 
 
-void m68k_op_ror_16_di(void)
+void m68k_op_ror_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -2982,7 +2982,7 @@ void m68k_op_ror_16_di(void)
 }
 
 
-void m68k_op_ror_16_ix(void)
+void m68k_op_ror_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -2997,7 +2997,7 @@ void m68k_op_ror_16_ix(void)
 }
 
 
-void m68k_op_ror_16_aw(void)
+void m68k_op_ror_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -3012,7 +3012,7 @@ void m68k_op_ror_16_aw(void)
 }
 
 
-void m68k_op_ror_16_al(void)
+void m68k_op_ror_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -3027,7 +3027,7 @@ void m68k_op_ror_16_al(void)
 }
 
 
-void m68k_op_rol_8_s(void)
+void m68k_op_rol_8_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3047,7 +3047,7 @@ void m68k_op_rol_8_s(void)
 }
 
 
-void m68k_op_rol_16_s(void)
+void m68k_op_rol_16_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3066,7 +3066,7 @@ void m68k_op_rol_16_s(void)
 }
 
 
-void m68k_op_rol_32_s(void)
+void m68k_op_rol_32_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3085,7 +3085,7 @@ void m68k_op_rol_32_s(void)
 }
 
 
-void m68k_op_rol_8_r(void)
+void m68k_op_rol_8_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
@@ -3120,7 +3120,7 @@ void m68k_op_rol_8_r(void)
 }
 
 
-void m68k_op_rol_16_r(void)
+void m68k_op_rol_16_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
@@ -3155,7 +3155,7 @@ void m68k_op_rol_16_r(void)
 }
 
 
-void m68k_op_rol_32_r(void)
+void m68k_op_rol_32_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
@@ -3183,7 +3183,7 @@ void m68k_op_rol_32_r(void)
 }
 
 
-void m68k_op_rol_16_ai(void)
+void m68k_op_rol_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -3198,7 +3198,7 @@ void m68k_op_rol_16_ai(void)
 }
 
 
-void m68k_op_rol_16_pi(void)
+void m68k_op_rol_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -3213,7 +3213,7 @@ void m68k_op_rol_16_pi(void)
 }
 
 
-void m68k_op_rol_16_pd(void)
+void m68k_op_rol_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -3228,7 +3228,7 @@ void m68k_op_rol_16_pd(void)
 }
 
 
-void m68k_op_rol_16_di(void)
+void m68k_op_rol_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -3243,7 +3243,7 @@ void m68k_op_rol_16_di(void)
 }
 
 
-void m68k_op_rol_16_ix(void)
+void m68k_op_rol_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -3258,7 +3258,7 @@ void m68k_op_rol_16_ix(void)
 }
 
 
-void m68k_op_rol_16_aw(void)
+void m68k_op_rol_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -3273,7 +3273,7 @@ void m68k_op_rol_16_aw(void)
 }
 
 
-void m68k_op_rol_16_al(void)
+void m68k_op_rol_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -3288,7 +3288,7 @@ void m68k_op_rol_16_al(void)
 }
 
 
-void m68k_op_roxr_8_s(void)
+void m68k_op_roxr_8_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3309,7 +3309,7 @@ void m68k_op_roxr_8_s(void)
 }
 
 
-void m68k_op_roxr_16_s(void)
+void m68k_op_roxr_16_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3330,7 +3330,7 @@ void m68k_op_roxr_16_s(void)
 }
 
 
-void m68k_op_roxr_32_s(void)
+void m68k_op_roxr_32_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -3375,7 +3375,7 @@ void m68k_op_roxr_32_s(void)
 }
 
 
-void m68k_op_roxr_8_r(void)
+void m68k_op_roxr_8_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
@@ -3405,7 +3405,7 @@ void m68k_op_roxr_8_r(void)
 }
 
 
-void m68k_op_roxr_16_r(void)
+void m68k_op_roxr_16_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
@@ -3435,7 +3435,7 @@ void m68k_op_roxr_16_r(void)
 }
 
 
-void m68k_op_roxr_32_r(void)
+void m68k_op_roxr_32_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -3495,7 +3495,7 @@ void m68k_op_roxr_32_r(void)
 }
 
 
-void m68k_op_roxr_16_ai(void)
+void m68k_op_roxr_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -3512,7 +3512,7 @@ void m68k_op_roxr_16_ai(void)
 }
 
 
-void m68k_op_roxr_16_pi(void)
+void m68k_op_roxr_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -3529,7 +3529,7 @@ void m68k_op_roxr_16_pi(void)
 }
 
 
-void m68k_op_roxr_16_pd(void)
+void m68k_op_roxr_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -3546,7 +3546,7 @@ void m68k_op_roxr_16_pd(void)
 }
 
 
-void m68k_op_roxr_16_di(void)
+void m68k_op_roxr_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -3563,7 +3563,7 @@ void m68k_op_roxr_16_di(void)
 }
 
 
-void m68k_op_roxr_16_ix(void)
+void m68k_op_roxr_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -3580,7 +3580,7 @@ void m68k_op_roxr_16_ix(void)
 }
 
 
-void m68k_op_roxr_16_aw(void)
+void m68k_op_roxr_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -3597,7 +3597,7 @@ void m68k_op_roxr_16_aw(void)
 }
 
 
-void m68k_op_roxr_16_al(void)
+void m68k_op_roxr_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -3614,7 +3614,7 @@ void m68k_op_roxr_16_al(void)
 }
 
 
-void m68k_op_roxl_8_s(void)
+void m68k_op_roxl_8_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3635,7 +3635,7 @@ void m68k_op_roxl_8_s(void)
 }
 
 
-void m68k_op_roxl_16_s(void)
+void m68k_op_roxl_16_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -3656,7 +3656,7 @@ void m68k_op_roxl_16_s(void)
 }
 
 
-void m68k_op_roxl_32_s(void)
+void m68k_op_roxl_32_s(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -3701,7 +3701,7 @@ void m68k_op_roxl_32_s(void)
 }
 
 
-void m68k_op_roxl_8_r(void)
+void m68k_op_roxl_8_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
@@ -3732,7 +3732,7 @@ void m68k_op_roxl_8_r(void)
 }
 
 
-void m68k_op_roxl_16_r(void)
+void m68k_op_roxl_16_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
@@ -3762,7 +3762,7 @@ void m68k_op_roxl_16_r(void)
 }
 
 
-void m68k_op_roxl_32_r(void)
+void m68k_op_roxl_32_r(m68ki_cpu_core *m68ki_cpu_p)
 {
 #if M68K_USE_64_BIT
 
@@ -3822,7 +3822,7 @@ void m68k_op_roxl_32_r(void)
 }
 
 
-void m68k_op_roxl_16_ai(void)
+void m68k_op_roxl_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
@@ -3839,7 +3839,7 @@ void m68k_op_roxl_16_ai(void)
 }
 
 
-void m68k_op_roxl_16_pi(void)
+void m68k_op_roxl_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
@@ -3856,7 +3856,7 @@ void m68k_op_roxl_16_pi(void)
 }
 
 
-void m68k_op_roxl_16_pd(void)
+void m68k_op_roxl_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
@@ -3873,7 +3873,7 @@ void m68k_op_roxl_16_pd(void)
 }
 
 
-void m68k_op_roxl_16_di(void)
+void m68k_op_roxl_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
@@ -3890,7 +3890,7 @@ void m68k_op_roxl_16_di(void)
 }
 
 
-void m68k_op_roxl_16_ix(void)
+void m68k_op_roxl_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
@@ -3907,7 +3907,7 @@ void m68k_op_roxl_16_ix(void)
 }
 
 
-void m68k_op_roxl_16_aw(void)
+void m68k_op_roxl_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
@@ -3924,7 +3924,7 @@ void m68k_op_roxl_16_aw(void)
 }
 
 
-void m68k_op_roxl_16_al(void)
+void m68k_op_roxl_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
@@ -3941,7 +3941,7 @@ void m68k_op_roxl_16_al(void)
 }
 
 
-void m68k_op_rtd_32(void)
+void m68k_op_rtd_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
@@ -3956,7 +3956,7 @@ void m68k_op_rtd_32(void)
 }
 
 
-void m68k_op_rte_32(void)
+void m68k_op_rte_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -4042,7 +4042,7 @@ rte_loop:
 }
 
 
-void m68k_op_rtm_32(void)
+void m68k_op_rtm_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
 	{
@@ -4056,7 +4056,7 @@ void m68k_op_rtm_32(void)
 }
 
 
-void m68k_op_rtr_32(void)
+void m68k_op_rtr_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 	m68ki_set_ccr(m68ki_pull_16());
@@ -4064,14 +4064,14 @@ void m68k_op_rtr_32(void)
 }
 
 
-void m68k_op_rts_32(void)
+void m68k_op_rts_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 	m68ki_jump(m68ki_pull_32());
 }
 
 
-void m68k_op_sbcd_8_rr(void)
+void m68k_op_sbcd_8_rr(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = DY;
@@ -4097,7 +4097,7 @@ void m68k_op_sbcd_8_rr(void)
 }
 
 
-void m68k_op_sbcd_8_mm_ax7(void)
+void m68k_op_sbcd_8_mm_ax7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_A7_PD_8();
@@ -4123,7 +4123,7 @@ void m68k_op_sbcd_8_mm_ax7(void)
 }
 
 
-void m68k_op_sbcd_8_mm_ay7(void)
+void m68k_op_sbcd_8_mm_ay7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_AX_PD_8();
@@ -4149,7 +4149,7 @@ void m68k_op_sbcd_8_mm_ay7(void)
 }
 
 
-void m68k_op_sbcd_8_mm_axy7(void)
+void m68k_op_sbcd_8_mm_axy7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_A7_PD_8();
@@ -4175,7 +4175,7 @@ void m68k_op_sbcd_8_mm_axy7(void)
 }
 
 
-void m68k_op_sbcd_8_mm(void)
+void m68k_op_sbcd_8_mm(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_AX_PD_8();
@@ -4201,127 +4201,127 @@ void m68k_op_sbcd_8_mm(void)
 }
 
 
-void m68k_op_st_8_d(void)
+void m68k_op_st_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	DY |= 0xff;
 }
 
 
-void m68k_op_st_8_ai(void)
+void m68k_op_st_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), 0xff);
 }
 
 
-void m68k_op_st_8_pi(void)
+void m68k_op_st_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), 0xff);
 }
 
 
-void m68k_op_st_8_pi7(void)
+void m68k_op_st_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), 0xff);
 }
 
 
-void m68k_op_st_8_pd(void)
+void m68k_op_st_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), 0xff);
 }
 
 
-void m68k_op_st_8_pd7(void)
+void m68k_op_st_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), 0xff);
 }
 
 
-void m68k_op_st_8_di(void)
+void m68k_op_st_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), 0xff);
 }
 
 
-void m68k_op_st_8_ix(void)
+void m68k_op_st_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), 0xff);
 }
 
 
-void m68k_op_st_8_aw(void)
+void m68k_op_st_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), 0xff);
 }
 
 
-void m68k_op_st_8_al(void)
+void m68k_op_st_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), 0xff);
 }
 
 
-void m68k_op_sf_8_d(void)
+void m68k_op_sf_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	DY &= 0xffffff00;
 }
 
 
-void m68k_op_sf_8_ai(void)
+void m68k_op_sf_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), 0);
 }
 
 
-void m68k_op_sf_8_pi(void)
+void m68k_op_sf_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), 0);
 }
 
 
-void m68k_op_sf_8_pi7(void)
+void m68k_op_sf_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), 0);
 }
 
 
-void m68k_op_sf_8_pd(void)
+void m68k_op_sf_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), 0);
 }
 
 
-void m68k_op_sf_8_pd7(void)
+void m68k_op_sf_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), 0);
 }
 
 
-void m68k_op_sf_8_di(void)
+void m68k_op_sf_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), 0);
 }
 
 
-void m68k_op_sf_8_ix(void)
+void m68k_op_sf_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), 0);
 }
 
 
-void m68k_op_sf_8_aw(void)
+void m68k_op_sf_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), 0);
 }
 
 
-void m68k_op_sf_8_al(void)
+void m68k_op_sf_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), 0);
 }
 
 
-void m68k_op_shi_8_d(void)
+void m68k_op_shi_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_HI())
 	{
@@ -4333,7 +4333,7 @@ void m68k_op_shi_8_d(void)
 }
 
 
-void m68k_op_sls_8_d(void)
+void m68k_op_sls_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_LS())
 	{
@@ -4345,7 +4345,7 @@ void m68k_op_sls_8_d(void)
 }
 
 
-void m68k_op_scc_8_d(void)
+void m68k_op_scc_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_CC())
 	{
@@ -4357,7 +4357,7 @@ void m68k_op_scc_8_d(void)
 }
 
 
-void m68k_op_scs_8_d(void)
+void m68k_op_scs_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_CS())
 	{
@@ -4369,7 +4369,7 @@ void m68k_op_scs_8_d(void)
 }
 
 
-void m68k_op_sne_8_d(void)
+void m68k_op_sne_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_NE())
 	{
@@ -4381,7 +4381,7 @@ void m68k_op_sne_8_d(void)
 }
 
 
-void m68k_op_seq_8_d(void)
+void m68k_op_seq_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_EQ())
 	{
@@ -4393,7 +4393,7 @@ void m68k_op_seq_8_d(void)
 }
 
 
-void m68k_op_svc_8_d(void)
+void m68k_op_svc_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_VC())
 	{
@@ -4405,7 +4405,7 @@ void m68k_op_svc_8_d(void)
 }
 
 
-void m68k_op_svs_8_d(void)
+void m68k_op_svs_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_VS())
 	{
@@ -4417,7 +4417,7 @@ void m68k_op_svs_8_d(void)
 }
 
 
-void m68k_op_spl_8_d(void)
+void m68k_op_spl_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_PL())
 	{
@@ -4429,7 +4429,7 @@ void m68k_op_spl_8_d(void)
 }
 
 
-void m68k_op_smi_8_d(void)
+void m68k_op_smi_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_MI())
 	{
@@ -4441,7 +4441,7 @@ void m68k_op_smi_8_d(void)
 }
 
 
-void m68k_op_sge_8_d(void)
+void m68k_op_sge_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_GE())
 	{
@@ -4453,7 +4453,7 @@ void m68k_op_sge_8_d(void)
 }
 
 
-void m68k_op_slt_8_d(void)
+void m68k_op_slt_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_LT())
 	{
@@ -4465,7 +4465,7 @@ void m68k_op_slt_8_d(void)
 }
 
 
-void m68k_op_sgt_8_d(void)
+void m68k_op_sgt_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_GT())
 	{
@@ -4477,7 +4477,7 @@ void m68k_op_sgt_8_d(void)
 }
 
 
-void m68k_op_sle_8_d(void)
+void m68k_op_sle_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_LE())
 	{
@@ -4489,763 +4489,763 @@ void m68k_op_sle_8_d(void)
 }
 
 
-void m68k_op_shi_8_ai(void)
+void m68k_op_shi_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_HI() ? 0xff : 0);
 }
 
 
-void m68k_op_shi_8_pi(void)
+void m68k_op_shi_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_HI() ? 0xff : 0);
 }
 
 
-void m68k_op_shi_8_pi7(void)
+void m68k_op_shi_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_HI() ? 0xff : 0);
 }
 
 
-void m68k_op_shi_8_pd(void)
+void m68k_op_shi_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_HI() ? 0xff : 0);
 }
 
 
-void m68k_op_shi_8_pd7(void)
+void m68k_op_shi_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_HI() ? 0xff : 0);
 }
 
 
-void m68k_op_shi_8_di(void)
+void m68k_op_shi_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_HI() ? 0xff : 0);
 }
 
 
-void m68k_op_shi_8_ix(void)
+void m68k_op_shi_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_HI() ? 0xff : 0);
 }
 
 
-void m68k_op_shi_8_aw(void)
+void m68k_op_shi_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_HI() ? 0xff : 0);
 }
 
 
-void m68k_op_shi_8_al(void)
+void m68k_op_shi_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_HI() ? 0xff : 0);
 }
 
 
-void m68k_op_sls_8_ai(void)
+void m68k_op_sls_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_LS() ? 0xff : 0);
 }
 
 
-void m68k_op_sls_8_pi(void)
+void m68k_op_sls_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_LS() ? 0xff : 0);
 }
 
 
-void m68k_op_sls_8_pi7(void)
+void m68k_op_sls_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_LS() ? 0xff : 0);
 }
 
 
-void m68k_op_sls_8_pd(void)
+void m68k_op_sls_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_LS() ? 0xff : 0);
 }
 
 
-void m68k_op_sls_8_pd7(void)
+void m68k_op_sls_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_LS() ? 0xff : 0);
 }
 
 
-void m68k_op_sls_8_di(void)
+void m68k_op_sls_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_LS() ? 0xff : 0);
 }
 
 
-void m68k_op_sls_8_ix(void)
+void m68k_op_sls_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_LS() ? 0xff : 0);
 }
 
 
-void m68k_op_sls_8_aw(void)
+void m68k_op_sls_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_LS() ? 0xff : 0);
 }
 
 
-void m68k_op_sls_8_al(void)
+void m68k_op_sls_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_LS() ? 0xff : 0);
 }
 
 
-void m68k_op_scc_8_ai(void)
+void m68k_op_scc_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_CC() ? 0xff : 0);
 }
 
 
-void m68k_op_scc_8_pi(void)
+void m68k_op_scc_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_CC() ? 0xff : 0);
 }
 
 
-void m68k_op_scc_8_pi7(void)
+void m68k_op_scc_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_CC() ? 0xff : 0);
 }
 
 
-void m68k_op_scc_8_pd(void)
+void m68k_op_scc_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_CC() ? 0xff : 0);
 }
 
 
-void m68k_op_scc_8_pd7(void)
+void m68k_op_scc_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_CC() ? 0xff : 0);
 }
 
 
-void m68k_op_scc_8_di(void)
+void m68k_op_scc_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_CC() ? 0xff : 0);
 }
 
 
-void m68k_op_scc_8_ix(void)
+void m68k_op_scc_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_CC() ? 0xff : 0);
 }
 
 
-void m68k_op_scc_8_aw(void)
+void m68k_op_scc_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_CC() ? 0xff : 0);
 }
 
 
-void m68k_op_scc_8_al(void)
+void m68k_op_scc_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_CC() ? 0xff : 0);
 }
 
 
-void m68k_op_scs_8_ai(void)
+void m68k_op_scs_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_CS() ? 0xff : 0);
 }
 
 
-void m68k_op_scs_8_pi(void)
+void m68k_op_scs_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_CS() ? 0xff : 0);
 }
 
 
-void m68k_op_scs_8_pi7(void)
+void m68k_op_scs_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_CS() ? 0xff : 0);
 }
 
 
-void m68k_op_scs_8_pd(void)
+void m68k_op_scs_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_CS() ? 0xff : 0);
 }
 
 
-void m68k_op_scs_8_pd7(void)
+void m68k_op_scs_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_CS() ? 0xff : 0);
 }
 
 
-void m68k_op_scs_8_di(void)
+void m68k_op_scs_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_CS() ? 0xff : 0);
 }
 
 
-void m68k_op_scs_8_ix(void)
+void m68k_op_scs_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_CS() ? 0xff : 0);
 }
 
 
-void m68k_op_scs_8_aw(void)
+void m68k_op_scs_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_CS() ? 0xff : 0);
 }
 
 
-void m68k_op_scs_8_al(void)
+void m68k_op_scs_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_CS() ? 0xff : 0);
 }
 
 
-void m68k_op_sne_8_ai(void)
+void m68k_op_sne_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_NE() ? 0xff : 0);
 }
 
 
-void m68k_op_sne_8_pi(void)
+void m68k_op_sne_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_NE() ? 0xff : 0);
 }
 
 
-void m68k_op_sne_8_pi7(void)
+void m68k_op_sne_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_NE() ? 0xff : 0);
 }
 
 
-void m68k_op_sne_8_pd(void)
+void m68k_op_sne_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_NE() ? 0xff : 0);
 }
 
 
-void m68k_op_sne_8_pd7(void)
+void m68k_op_sne_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_NE() ? 0xff : 0);
 }
 
 
-void m68k_op_sne_8_di(void)
+void m68k_op_sne_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_NE() ? 0xff : 0);
 }
 
 
-void m68k_op_sne_8_ix(void)
+void m68k_op_sne_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_NE() ? 0xff : 0);
 }
 
 
-void m68k_op_sne_8_aw(void)
+void m68k_op_sne_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_NE() ? 0xff : 0);
 }
 
 
-void m68k_op_sne_8_al(void)
+void m68k_op_sne_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_NE() ? 0xff : 0);
 }
 
 
-void m68k_op_seq_8_ai(void)
+void m68k_op_seq_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_EQ() ? 0xff : 0);
 }
 
 
-void m68k_op_seq_8_pi(void)
+void m68k_op_seq_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_EQ() ? 0xff : 0);
 }
 
 
-void m68k_op_seq_8_pi7(void)
+void m68k_op_seq_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_EQ() ? 0xff : 0);
 }
 
 
-void m68k_op_seq_8_pd(void)
+void m68k_op_seq_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_EQ() ? 0xff : 0);
 }
 
 
-void m68k_op_seq_8_pd7(void)
+void m68k_op_seq_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_EQ() ? 0xff : 0);
 }
 
 
-void m68k_op_seq_8_di(void)
+void m68k_op_seq_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_EQ() ? 0xff : 0);
 }
 
 
-void m68k_op_seq_8_ix(void)
+void m68k_op_seq_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_EQ() ? 0xff : 0);
 }
 
 
-void m68k_op_seq_8_aw(void)
+void m68k_op_seq_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_EQ() ? 0xff : 0);
 }
 
 
-void m68k_op_seq_8_al(void)
+void m68k_op_seq_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_EQ() ? 0xff : 0);
 }
 
 
-void m68k_op_svc_8_ai(void)
+void m68k_op_svc_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_VC() ? 0xff : 0);
 }
 
 
-void m68k_op_svc_8_pi(void)
+void m68k_op_svc_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_VC() ? 0xff : 0);
 }
 
 
-void m68k_op_svc_8_pi7(void)
+void m68k_op_svc_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_VC() ? 0xff : 0);
 }
 
 
-void m68k_op_svc_8_pd(void)
+void m68k_op_svc_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_VC() ? 0xff : 0);
 }
 
 
-void m68k_op_svc_8_pd7(void)
+void m68k_op_svc_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_VC() ? 0xff : 0);
 }
 
 
-void m68k_op_svc_8_di(void)
+void m68k_op_svc_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_VC() ? 0xff : 0);
 }
 
 
-void m68k_op_svc_8_ix(void)
+void m68k_op_svc_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_VC() ? 0xff : 0);
 }
 
 
-void m68k_op_svc_8_aw(void)
+void m68k_op_svc_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_VC() ? 0xff : 0);
 }
 
 
-void m68k_op_svc_8_al(void)
+void m68k_op_svc_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_VC() ? 0xff : 0);
 }
 
 
-void m68k_op_svs_8_ai(void)
+void m68k_op_svs_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_VS() ? 0xff : 0);
 }
 
 
-void m68k_op_svs_8_pi(void)
+void m68k_op_svs_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_VS() ? 0xff : 0);
 }
 
 
-void m68k_op_svs_8_pi7(void)
+void m68k_op_svs_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_VS() ? 0xff : 0);
 }
 
 
-void m68k_op_svs_8_pd(void)
+void m68k_op_svs_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_VS() ? 0xff : 0);
 }
 
 
-void m68k_op_svs_8_pd7(void)
+void m68k_op_svs_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_VS() ? 0xff : 0);
 }
 
 
-void m68k_op_svs_8_di(void)
+void m68k_op_svs_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_VS() ? 0xff : 0);
 }
 
 
-void m68k_op_svs_8_ix(void)
+void m68k_op_svs_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_VS() ? 0xff : 0);
 }
 
 
-void m68k_op_svs_8_aw(void)
+void m68k_op_svs_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_VS() ? 0xff : 0);
 }
 
 
-void m68k_op_svs_8_al(void)
+void m68k_op_svs_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_VS() ? 0xff : 0);
 }
 
 
-void m68k_op_spl_8_ai(void)
+void m68k_op_spl_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_PL() ? 0xff : 0);
 }
 
 
-void m68k_op_spl_8_pi(void)
+void m68k_op_spl_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_PL() ? 0xff : 0);
 }
 
 
-void m68k_op_spl_8_pi7(void)
+void m68k_op_spl_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_PL() ? 0xff : 0);
 }
 
 
-void m68k_op_spl_8_pd(void)
+void m68k_op_spl_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_PL() ? 0xff : 0);
 }
 
 
-void m68k_op_spl_8_pd7(void)
+void m68k_op_spl_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_PL() ? 0xff : 0);
 }
 
 
-void m68k_op_spl_8_di(void)
+void m68k_op_spl_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_PL() ? 0xff : 0);
 }
 
 
-void m68k_op_spl_8_ix(void)
+void m68k_op_spl_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_PL() ? 0xff : 0);
 }
 
 
-void m68k_op_spl_8_aw(void)
+void m68k_op_spl_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_PL() ? 0xff : 0);
 }
 
 
-void m68k_op_spl_8_al(void)
+void m68k_op_spl_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_PL() ? 0xff : 0);
 }
 
 
-void m68k_op_smi_8_ai(void)
+void m68k_op_smi_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_MI() ? 0xff : 0);
 }
 
 
-void m68k_op_smi_8_pi(void)
+void m68k_op_smi_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_MI() ? 0xff : 0);
 }
 
 
-void m68k_op_smi_8_pi7(void)
+void m68k_op_smi_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_MI() ? 0xff : 0);
 }
 
 
-void m68k_op_smi_8_pd(void)
+void m68k_op_smi_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_MI() ? 0xff : 0);
 }
 
 
-void m68k_op_smi_8_pd7(void)
+void m68k_op_smi_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_MI() ? 0xff : 0);
 }
 
 
-void m68k_op_smi_8_di(void)
+void m68k_op_smi_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_MI() ? 0xff : 0);
 }
 
 
-void m68k_op_smi_8_ix(void)
+void m68k_op_smi_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_MI() ? 0xff : 0);
 }
 
 
-void m68k_op_smi_8_aw(void)
+void m68k_op_smi_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_MI() ? 0xff : 0);
 }
 
 
-void m68k_op_smi_8_al(void)
+void m68k_op_smi_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_MI() ? 0xff : 0);
 }
 
 
-void m68k_op_sge_8_ai(void)
+void m68k_op_sge_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_GE() ? 0xff : 0);
 }
 
 
-void m68k_op_sge_8_pi(void)
+void m68k_op_sge_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_GE() ? 0xff : 0);
 }
 
 
-void m68k_op_sge_8_pi7(void)
+void m68k_op_sge_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_GE() ? 0xff : 0);
 }
 
 
-void m68k_op_sge_8_pd(void)
+void m68k_op_sge_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_GE() ? 0xff : 0);
 }
 
 
-void m68k_op_sge_8_pd7(void)
+void m68k_op_sge_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_GE() ? 0xff : 0);
 }
 
 
-void m68k_op_sge_8_di(void)
+void m68k_op_sge_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_GE() ? 0xff : 0);
 }
 
 
-void m68k_op_sge_8_ix(void)
+void m68k_op_sge_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_GE() ? 0xff : 0);
 }
 
 
-void m68k_op_sge_8_aw(void)
+void m68k_op_sge_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_GE() ? 0xff : 0);
 }
 
 
-void m68k_op_sge_8_al(void)
+void m68k_op_sge_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_GE() ? 0xff : 0);
 }
 
 
-void m68k_op_slt_8_ai(void)
+void m68k_op_slt_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_LT() ? 0xff : 0);
 }
 
 
-void m68k_op_slt_8_pi(void)
+void m68k_op_slt_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_LT() ? 0xff : 0);
 }
 
 
-void m68k_op_slt_8_pi7(void)
+void m68k_op_slt_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_LT() ? 0xff : 0);
 }
 
 
-void m68k_op_slt_8_pd(void)
+void m68k_op_slt_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_LT() ? 0xff : 0);
 }
 
 
-void m68k_op_slt_8_pd7(void)
+void m68k_op_slt_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_LT() ? 0xff : 0);
 }
 
 
-void m68k_op_slt_8_di(void)
+void m68k_op_slt_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_LT() ? 0xff : 0);
 }
 
 
-void m68k_op_slt_8_ix(void)
+void m68k_op_slt_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_LT() ? 0xff : 0);
 }
 
 
-void m68k_op_slt_8_aw(void)
+void m68k_op_slt_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_LT() ? 0xff : 0);
 }
 
 
-void m68k_op_slt_8_al(void)
+void m68k_op_slt_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_LT() ? 0xff : 0);
 }
 
 
-void m68k_op_sgt_8_ai(void)
+void m68k_op_sgt_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_GT() ? 0xff : 0);
 }
 
 
-void m68k_op_sgt_8_pi(void)
+void m68k_op_sgt_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_GT() ? 0xff : 0);
 }
 
 
-void m68k_op_sgt_8_pi7(void)
+void m68k_op_sgt_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_GT() ? 0xff : 0);
 }
 
 
-void m68k_op_sgt_8_pd(void)
+void m68k_op_sgt_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_GT() ? 0xff : 0);
 }
 
 
-void m68k_op_sgt_8_pd7(void)
+void m68k_op_sgt_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_GT() ? 0xff : 0);
 }
 
 
-void m68k_op_sgt_8_di(void)
+void m68k_op_sgt_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_GT() ? 0xff : 0);
 }
 
 
-void m68k_op_sgt_8_ix(void)
+void m68k_op_sgt_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_GT() ? 0xff : 0);
 }
 
 
-void m68k_op_sgt_8_aw(void)
+void m68k_op_sgt_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_GT() ? 0xff : 0);
 }
 
 
-void m68k_op_sgt_8_al(void)
+void m68k_op_sgt_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_GT() ? 0xff : 0);
 }
 
 
-void m68k_op_sle_8_ai(void)
+void m68k_op_sle_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_AI_8(), COND_LE() ? 0xff : 0);
 }
 
 
-void m68k_op_sle_8_pi(void)
+void m68k_op_sle_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PI_8(), COND_LE() ? 0xff : 0);
 }
 
 
-void m68k_op_sle_8_pi7(void)
+void m68k_op_sle_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PI_8(), COND_LE() ? 0xff : 0);
 }
 
 
-void m68k_op_sle_8_pd(void)
+void m68k_op_sle_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_PD_8(), COND_LE() ? 0xff : 0);
 }
 
 
-void m68k_op_sle_8_pd7(void)
+void m68k_op_sle_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_A7_PD_8(), COND_LE() ? 0xff : 0);
 }
 
 
-void m68k_op_sle_8_di(void)
+void m68k_op_sle_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_DI_8(), COND_LE() ? 0xff : 0);
 }
 
 
-void m68k_op_sle_8_ix(void)
+void m68k_op_sle_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AY_IX_8(), COND_LE() ? 0xff : 0);
 }
 
 
-void m68k_op_sle_8_aw(void)
+void m68k_op_sle_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AW_8(), COND_LE() ? 0xff : 0);
 }
 
 
-void m68k_op_sle_8_al(void)
+void m68k_op_sle_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	m68ki_write_8(EA_AL_8(), COND_LE() ? 0xff : 0);
 }
 
 
-void m68k_op_stop(void)
+void m68k_op_stop(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(FLAG_S)
 	{
@@ -5260,7 +5260,7 @@ void m68k_op_stop(void)
 }
 
 
-void m68k_op_sub_8_er_d(void)
+void m68k_op_sub_8_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_8(DY);
@@ -5276,7 +5276,7 @@ void m68k_op_sub_8_er_d(void)
 }
 
 
-void m68k_op_sub_8_er_ai(void)
+void m68k_op_sub_8_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_AI_8();
@@ -5292,7 +5292,7 @@ void m68k_op_sub_8_er_ai(void)
 }
 
 
-void m68k_op_sub_8_er_pi(void)
+void m68k_op_sub_8_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PI_8();
@@ -5308,7 +5308,7 @@ void m68k_op_sub_8_er_pi(void)
 }
 
 
-void m68k_op_sub_8_er_pi7(void)
+void m68k_op_sub_8_er_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_A7_PI_8();
@@ -5324,7 +5324,7 @@ void m68k_op_sub_8_er_pi7(void)
 }
 
 
-void m68k_op_sub_8_er_pd(void)
+void m68k_op_sub_8_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PD_8();
@@ -5340,7 +5340,7 @@ void m68k_op_sub_8_er_pd(void)
 }
 
 
-void m68k_op_sub_8_er_pd7(void)
+void m68k_op_sub_8_er_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_A7_PD_8();
@@ -5356,7 +5356,7 @@ void m68k_op_sub_8_er_pd7(void)
 }
 
 
-void m68k_op_sub_8_er_di(void)
+void m68k_op_sub_8_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_DI_8();
@@ -5372,7 +5372,7 @@ void m68k_op_sub_8_er_di(void)
 }
 
 
-void m68k_op_sub_8_er_ix(void)
+void m68k_op_sub_8_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_IX_8();
@@ -5388,7 +5388,7 @@ void m68k_op_sub_8_er_ix(void)
 }
 
 
-void m68k_op_sub_8_er_aw(void)
+void m68k_op_sub_8_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AW_8();
@@ -5404,7 +5404,7 @@ void m68k_op_sub_8_er_aw(void)
 }
 
 
-void m68k_op_sub_8_er_al(void)
+void m68k_op_sub_8_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AL_8();
@@ -5420,7 +5420,7 @@ void m68k_op_sub_8_er_al(void)
 }
 
 
-void m68k_op_sub_8_er_pcdi(void)
+void m68k_op_sub_8_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCDI_8();
@@ -5436,7 +5436,7 @@ void m68k_op_sub_8_er_pcdi(void)
 }
 
 
-void m68k_op_sub_8_er_pcix(void)
+void m68k_op_sub_8_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCIX_8();
@@ -5452,7 +5452,7 @@ void m68k_op_sub_8_er_pcix(void)
 }
 
 
-void m68k_op_sub_8_er_i(void)
+void m68k_op_sub_8_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_I_8();
@@ -5468,7 +5468,7 @@ void m68k_op_sub_8_er_i(void)
 }
 
 
-void m68k_op_sub_16_er_d(void)
+void m68k_op_sub_16_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(DY);
@@ -5484,7 +5484,7 @@ void m68k_op_sub_16_er_d(void)
 }
 
 
-void m68k_op_sub_16_er_a(void)
+void m68k_op_sub_16_er_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(AY);
@@ -5500,7 +5500,7 @@ void m68k_op_sub_16_er_a(void)
 }
 
 
-void m68k_op_sub_16_er_ai(void)
+void m68k_op_sub_16_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_AI_16();
@@ -5516,7 +5516,7 @@ void m68k_op_sub_16_er_ai(void)
 }
 
 
-void m68k_op_sub_16_er_pi(void)
+void m68k_op_sub_16_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PI_16();
@@ -5532,7 +5532,7 @@ void m68k_op_sub_16_er_pi(void)
 }
 
 
-void m68k_op_sub_16_er_pd(void)
+void m68k_op_sub_16_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PD_16();
@@ -5548,7 +5548,7 @@ void m68k_op_sub_16_er_pd(void)
 }
 
 
-void m68k_op_sub_16_er_di(void)
+void m68k_op_sub_16_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_DI_16();
@@ -5564,7 +5564,7 @@ void m68k_op_sub_16_er_di(void)
 }
 
 
-void m68k_op_sub_16_er_ix(void)
+void m68k_op_sub_16_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_IX_16();
@@ -5580,7 +5580,7 @@ void m68k_op_sub_16_er_ix(void)
 }
 
 
-void m68k_op_sub_16_er_aw(void)
+void m68k_op_sub_16_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AW_16();
@@ -5596,7 +5596,7 @@ void m68k_op_sub_16_er_aw(void)
 }
 
 
-void m68k_op_sub_16_er_al(void)
+void m68k_op_sub_16_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AL_16();
@@ -5612,7 +5612,7 @@ void m68k_op_sub_16_er_al(void)
 }
 
 
-void m68k_op_sub_16_er_pcdi(void)
+void m68k_op_sub_16_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCDI_16();
@@ -5628,7 +5628,7 @@ void m68k_op_sub_16_er_pcdi(void)
 }
 
 
-void m68k_op_sub_16_er_pcix(void)
+void m68k_op_sub_16_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCIX_16();
@@ -5644,7 +5644,7 @@ void m68k_op_sub_16_er_pcix(void)
 }
 
 
-void m68k_op_sub_16_er_i(void)
+void m68k_op_sub_16_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_I_16();
@@ -5660,7 +5660,7 @@ void m68k_op_sub_16_er_i(void)
 }
 
 
-void m68k_op_sub_32_er_d(void)
+void m68k_op_sub_32_er_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = DY;
@@ -5676,7 +5676,7 @@ void m68k_op_sub_32_er_d(void)
 }
 
 
-void m68k_op_sub_32_er_a(void)
+void m68k_op_sub_32_er_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = AY;
@@ -5692,7 +5692,7 @@ void m68k_op_sub_32_er_a(void)
 }
 
 
-void m68k_op_sub_32_er_ai(void)
+void m68k_op_sub_32_er_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_AI_32();
@@ -5708,7 +5708,7 @@ void m68k_op_sub_32_er_ai(void)
 }
 
 
-void m68k_op_sub_32_er_pi(void)
+void m68k_op_sub_32_er_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PI_32();
@@ -5724,7 +5724,7 @@ void m68k_op_sub_32_er_pi(void)
 }
 
 
-void m68k_op_sub_32_er_pd(void)
+void m68k_op_sub_32_er_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PD_32();
@@ -5740,7 +5740,7 @@ void m68k_op_sub_32_er_pd(void)
 }
 
 
-void m68k_op_sub_32_er_di(void)
+void m68k_op_sub_32_er_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_DI_32();
@@ -5756,7 +5756,7 @@ void m68k_op_sub_32_er_di(void)
 }
 
 
-void m68k_op_sub_32_er_ix(void)
+void m68k_op_sub_32_er_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AY_IX_32();
@@ -5772,7 +5772,7 @@ void m68k_op_sub_32_er_ix(void)
 }
 
 
-void m68k_op_sub_32_er_aw(void)
+void m68k_op_sub_32_er_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AW_32();
@@ -5788,7 +5788,7 @@ void m68k_op_sub_32_er_aw(void)
 }
 
 
-void m68k_op_sub_32_er_al(void)
+void m68k_op_sub_32_er_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_AL_32();
@@ -5804,7 +5804,7 @@ void m68k_op_sub_32_er_al(void)
 }
 
 
-void m68k_op_sub_32_er_pcdi(void)
+void m68k_op_sub_32_er_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCDI_32();
@@ -5820,7 +5820,7 @@ void m68k_op_sub_32_er_pcdi(void)
 }
 
 
-void m68k_op_sub_32_er_pcix(void)
+void m68k_op_sub_32_er_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_PCIX_32();
@@ -5836,7 +5836,7 @@ void m68k_op_sub_32_er_pcix(void)
 }
 
 
-void m68k_op_sub_32_er_i(void)
+void m68k_op_sub_32_er_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = OPER_I_32();
@@ -5852,7 +5852,7 @@ void m68k_op_sub_32_er_i(void)
 }
 
 
-void m68k_op_sub_8_re_ai(void)
+void m68k_op_sub_8_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -5868,7 +5868,7 @@ void m68k_op_sub_8_re_ai(void)
 }
 
 
-void m68k_op_sub_8_re_pi(void)
+void m68k_op_sub_8_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -5884,7 +5884,7 @@ void m68k_op_sub_8_re_pi(void)
 }
 
 
-void m68k_op_sub_8_re_pi7(void)
+void m68k_op_sub_8_re_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -5900,7 +5900,7 @@ void m68k_op_sub_8_re_pi7(void)
 }
 
 
-void m68k_op_sub_8_re_pd(void)
+void m68k_op_sub_8_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -5916,7 +5916,7 @@ void m68k_op_sub_8_re_pd(void)
 }
 
 
-void m68k_op_sub_8_re_pd7(void)
+void m68k_op_sub_8_re_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -5932,7 +5932,7 @@ void m68k_op_sub_8_re_pd7(void)
 }
 
 
-void m68k_op_sub_8_re_di(void)
+void m68k_op_sub_8_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -5948,7 +5948,7 @@ void m68k_op_sub_8_re_di(void)
 }
 
 
-void m68k_op_sub_8_re_ix(void)
+void m68k_op_sub_8_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -5964,7 +5964,7 @@ void m68k_op_sub_8_re_ix(void)
 }
 
 
-void m68k_op_sub_8_re_aw(void)
+void m68k_op_sub_8_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -5980,7 +5980,7 @@ void m68k_op_sub_8_re_aw(void)
 }
 
 
-void m68k_op_sub_8_re_al(void)
+void m68k_op_sub_8_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint src = MASK_OUT_ABOVE_8(DX);
@@ -5996,7 +5996,7 @@ void m68k_op_sub_8_re_al(void)
 }
 
 
-void m68k_op_sub_16_re_ai(void)
+void m68k_op_sub_16_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -6012,7 +6012,7 @@ void m68k_op_sub_16_re_ai(void)
 }
 
 
-void m68k_op_sub_16_re_pi(void)
+void m68k_op_sub_16_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -6028,7 +6028,7 @@ void m68k_op_sub_16_re_pi(void)
 }
 
 
-void m68k_op_sub_16_re_pd(void)
+void m68k_op_sub_16_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -6044,7 +6044,7 @@ void m68k_op_sub_16_re_pd(void)
 }
 
 
-void m68k_op_sub_16_re_di(void)
+void m68k_op_sub_16_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -6060,7 +6060,7 @@ void m68k_op_sub_16_re_di(void)
 }
 
 
-void m68k_op_sub_16_re_ix(void)
+void m68k_op_sub_16_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -6076,7 +6076,7 @@ void m68k_op_sub_16_re_ix(void)
 }
 
 
-void m68k_op_sub_16_re_aw(void)
+void m68k_op_sub_16_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -6092,7 +6092,7 @@ void m68k_op_sub_16_re_aw(void)
 }
 
 
-void m68k_op_sub_16_re_al(void)
+void m68k_op_sub_16_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_16();
 	uint src = MASK_OUT_ABOVE_16(DX);
@@ -6108,7 +6108,7 @@ void m68k_op_sub_16_re_al(void)
 }
 
 
-void m68k_op_sub_32_re_ai(void)
+void m68k_op_sub_32_re_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_32();
 	uint src = DX;
@@ -6124,7 +6124,7 @@ void m68k_op_sub_32_re_ai(void)
 }
 
 
-void m68k_op_sub_32_re_pi(void)
+void m68k_op_sub_32_re_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_32();
 	uint src = DX;
@@ -6140,7 +6140,7 @@ void m68k_op_sub_32_re_pi(void)
 }
 
 
-void m68k_op_sub_32_re_pd(void)
+void m68k_op_sub_32_re_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_32();
 	uint src = DX;
@@ -6156,7 +6156,7 @@ void m68k_op_sub_32_re_pd(void)
 }
 
 
-void m68k_op_sub_32_re_di(void)
+void m68k_op_sub_32_re_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_32();
 	uint src = DX;
@@ -6172,7 +6172,7 @@ void m68k_op_sub_32_re_di(void)
 }
 
 
-void m68k_op_sub_32_re_ix(void)
+void m68k_op_sub_32_re_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_32();
 	uint src = DX;
@@ -6188,7 +6188,7 @@ void m68k_op_sub_32_re_ix(void)
 }
 
 
-void m68k_op_sub_32_re_aw(void)
+void m68k_op_sub_32_re_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_32();
 	uint src = DX;
@@ -6204,7 +6204,7 @@ void m68k_op_sub_32_re_aw(void)
 }
 
 
-void m68k_op_sub_32_re_al(void)
+void m68k_op_sub_32_re_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_32();
 	uint src = DX;
@@ -6220,7 +6220,7 @@ void m68k_op_sub_32_re_al(void)
 }
 
 
-void m68k_op_suba_16_d(void)
+void m68k_op_suba_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 
@@ -6228,7 +6228,7 @@ void m68k_op_suba_16_d(void)
 }
 
 
-void m68k_op_suba_16_a(void)
+void m68k_op_suba_16_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 
@@ -6236,7 +6236,7 @@ void m68k_op_suba_16_a(void)
 }
 
 
-void m68k_op_suba_16_ai(void)
+void m68k_op_suba_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AY_AI_16());
@@ -6245,7 +6245,7 @@ void m68k_op_suba_16_ai(void)
 }
 
 
-void m68k_op_suba_16_pi(void)
+void m68k_op_suba_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AY_PI_16());
@@ -6254,7 +6254,7 @@ void m68k_op_suba_16_pi(void)
 }
 
 
-void m68k_op_suba_16_pd(void)
+void m68k_op_suba_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AY_PD_16());
@@ -6263,7 +6263,7 @@ void m68k_op_suba_16_pd(void)
 }
 
 
-void m68k_op_suba_16_di(void)
+void m68k_op_suba_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AY_DI_16());
@@ -6272,7 +6272,7 @@ void m68k_op_suba_16_di(void)
 }
 
 
-void m68k_op_suba_16_ix(void)
+void m68k_op_suba_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AY_IX_16());
@@ -6281,7 +6281,7 @@ void m68k_op_suba_16_ix(void)
 }
 
 
-void m68k_op_suba_16_aw(void)
+void m68k_op_suba_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AW_16());
@@ -6290,7 +6290,7 @@ void m68k_op_suba_16_aw(void)
 }
 
 
-void m68k_op_suba_16_al(void)
+void m68k_op_suba_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_AL_16());
@@ -6299,7 +6299,7 @@ void m68k_op_suba_16_al(void)
 }
 
 
-void m68k_op_suba_16_pcdi(void)
+void m68k_op_suba_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_PCDI_16());
@@ -6308,7 +6308,7 @@ void m68k_op_suba_16_pcdi(void)
 }
 
 
-void m68k_op_suba_16_pcix(void)
+void m68k_op_suba_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_PCIX_16());
@@ -6317,7 +6317,7 @@ void m68k_op_suba_16_pcix(void)
 }
 
 
-void m68k_op_suba_16_i(void)
+void m68k_op_suba_16_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 	uint src = MAKE_INT_16(OPER_I_16());
@@ -6326,7 +6326,7 @@ void m68k_op_suba_16_i(void)
 }
 
 
-void m68k_op_suba_32_d(void)
+void m68k_op_suba_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 
@@ -6334,7 +6334,7 @@ void m68k_op_suba_32_d(void)
 }
 
 
-void m68k_op_suba_32_a(void)
+void m68k_op_suba_32_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AX;
 
@@ -6342,7 +6342,7 @@ void m68k_op_suba_32_a(void)
 }
 
 
-void m68k_op_suba_32_ai(void)
+void m68k_op_suba_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_AI_32();
 	uint* r_dst = &AX;
@@ -6351,7 +6351,7 @@ void m68k_op_suba_32_ai(void)
 }
 
 
-void m68k_op_suba_32_pi(void)
+void m68k_op_suba_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PI_32();
 	uint* r_dst = &AX;
@@ -6360,7 +6360,7 @@ void m68k_op_suba_32_pi(void)
 }
 
 
-void m68k_op_suba_32_pd(void)
+void m68k_op_suba_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_32();
 	uint* r_dst = &AX;
@@ -6369,7 +6369,7 @@ void m68k_op_suba_32_pd(void)
 }
 
 
-void m68k_op_suba_32_di(void)
+void m68k_op_suba_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_DI_32();
 	uint* r_dst = &AX;
@@ -6378,7 +6378,7 @@ void m68k_op_suba_32_di(void)
 }
 
 
-void m68k_op_suba_32_ix(void)
+void m68k_op_suba_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_IX_32();
 	uint* r_dst = &AX;
@@ -6387,7 +6387,7 @@ void m68k_op_suba_32_ix(void)
 }
 
 
-void m68k_op_suba_32_aw(void)
+void m68k_op_suba_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AW_32();
 	uint* r_dst = &AX;
@@ -6396,7 +6396,7 @@ void m68k_op_suba_32_aw(void)
 }
 
 
-void m68k_op_suba_32_al(void)
+void m68k_op_suba_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AL_32();
 	uint* r_dst = &AX;
@@ -6405,7 +6405,7 @@ void m68k_op_suba_32_al(void)
 }
 
 
-void m68k_op_suba_32_pcdi(void)
+void m68k_op_suba_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCDI_32();
 	uint* r_dst = &AX;
@@ -6414,7 +6414,7 @@ void m68k_op_suba_32_pcdi(void)
 }
 
 
-void m68k_op_suba_32_pcix(void)
+void m68k_op_suba_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_PCIX_32();
 	uint* r_dst = &AX;
@@ -6423,7 +6423,7 @@ void m68k_op_suba_32_pcix(void)
 }
 
 
-void m68k_op_suba_32_i(void)
+void m68k_op_suba_32_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint* r_dst = &AX;
@@ -6432,7 +6432,7 @@ void m68k_op_suba_32_i(void)
 }
 
 
-void m68k_op_subi_8_d(void)
+void m68k_op_subi_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = OPER_I_8();
@@ -6448,7 +6448,7 @@ void m68k_op_subi_8_d(void)
 }
 
 
-void m68k_op_subi_8_ai(void)
+void m68k_op_subi_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_AI_8();
@@ -6464,7 +6464,7 @@ void m68k_op_subi_8_ai(void)
 }
 
 
-void m68k_op_subi_8_pi(void)
+void m68k_op_subi_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PI_8();
@@ -6480,7 +6480,7 @@ void m68k_op_subi_8_pi(void)
 }
 
 
-void m68k_op_subi_8_pi7(void)
+void m68k_op_subi_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PI_8();
@@ -6496,7 +6496,7 @@ void m68k_op_subi_8_pi7(void)
 }
 
 
-void m68k_op_subi_8_pd(void)
+void m68k_op_subi_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_PD_8();
@@ -6512,7 +6512,7 @@ void m68k_op_subi_8_pd(void)
 }
 
 
-void m68k_op_subi_8_pd7(void)
+void m68k_op_subi_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_A7_PD_8();
@@ -6528,7 +6528,7 @@ void m68k_op_subi_8_pd7(void)
 }
 
 
-void m68k_op_subi_8_di(void)
+void m68k_op_subi_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_DI_8();
@@ -6544,7 +6544,7 @@ void m68k_op_subi_8_di(void)
 }
 
 
-void m68k_op_subi_8_ix(void)
+void m68k_op_subi_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AY_IX_8();
@@ -6560,7 +6560,7 @@ void m68k_op_subi_8_ix(void)
 }
 
 
-void m68k_op_subi_8_aw(void)
+void m68k_op_subi_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AW_8();
@@ -6576,7 +6576,7 @@ void m68k_op_subi_8_aw(void)
 }
 
 
-void m68k_op_subi_8_al(void)
+void m68k_op_subi_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_8();
 	uint ea = EA_AL_8();
@@ -6592,7 +6592,7 @@ void m68k_op_subi_8_al(void)
 }
 
 
-void m68k_op_subi_16_d(void)
+void m68k_op_subi_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = OPER_I_16();
@@ -6608,7 +6608,7 @@ void m68k_op_subi_16_d(void)
 }
 
 
-void m68k_op_subi_16_ai(void)
+void m68k_op_subi_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_AI_16();
@@ -6624,7 +6624,7 @@ void m68k_op_subi_16_ai(void)
 }
 
 
-void m68k_op_subi_16_pi(void)
+void m68k_op_subi_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PI_16();
@@ -6640,7 +6640,7 @@ void m68k_op_subi_16_pi(void)
 }
 
 
-void m68k_op_subi_16_pd(void)
+void m68k_op_subi_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_PD_16();
@@ -6656,7 +6656,7 @@ void m68k_op_subi_16_pd(void)
 }
 
 
-void m68k_op_subi_16_di(void)
+void m68k_op_subi_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_DI_16();
@@ -6672,7 +6672,7 @@ void m68k_op_subi_16_di(void)
 }
 
 
-void m68k_op_subi_16_ix(void)
+void m68k_op_subi_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AY_IX_16();
@@ -6688,7 +6688,7 @@ void m68k_op_subi_16_ix(void)
 }
 
 
-void m68k_op_subi_16_aw(void)
+void m68k_op_subi_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AW_16();
@@ -6704,7 +6704,7 @@ void m68k_op_subi_16_aw(void)
 }
 
 
-void m68k_op_subi_16_al(void)
+void m68k_op_subi_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_16();
 	uint ea = EA_AL_16();
@@ -6720,7 +6720,7 @@ void m68k_op_subi_16_al(void)
 }
 
 
-void m68k_op_subi_32_d(void)
+void m68k_op_subi_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = OPER_I_32();
@@ -6736,7 +6736,7 @@ void m68k_op_subi_32_d(void)
 }
 
 
-void m68k_op_subi_32_ai(void)
+void m68k_op_subi_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_AI_32();
@@ -6752,7 +6752,7 @@ void m68k_op_subi_32_ai(void)
 }
 
 
-void m68k_op_subi_32_pi(void)
+void m68k_op_subi_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PI_32();
@@ -6768,7 +6768,7 @@ void m68k_op_subi_32_pi(void)
 }
 
 
-void m68k_op_subi_32_pd(void)
+void m68k_op_subi_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_PD_32();
@@ -6784,7 +6784,7 @@ void m68k_op_subi_32_pd(void)
 }
 
 
-void m68k_op_subi_32_di(void)
+void m68k_op_subi_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_DI_32();
@@ -6800,7 +6800,7 @@ void m68k_op_subi_32_di(void)
 }
 
 
-void m68k_op_subi_32_ix(void)
+void m68k_op_subi_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AY_IX_32();
@@ -6816,7 +6816,7 @@ void m68k_op_subi_32_ix(void)
 }
 
 
-void m68k_op_subi_32_aw(void)
+void m68k_op_subi_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AW_32();
@@ -6832,7 +6832,7 @@ void m68k_op_subi_32_aw(void)
 }
 
 
-void m68k_op_subi_32_al(void)
+void m68k_op_subi_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_I_32();
 	uint ea = EA_AL_32();
@@ -6848,7 +6848,7 @@ void m68k_op_subi_32_al(void)
 }
 
 
-void m68k_op_subq_8_d(void)
+void m68k_op_subq_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -6864,7 +6864,7 @@ void m68k_op_subq_8_d(void)
 }
 
 
-void m68k_op_subq_8_ai(void)
+void m68k_op_subq_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_AI_8();
@@ -6880,7 +6880,7 @@ void m68k_op_subq_8_ai(void)
 }
 
 
-void m68k_op_subq_8_pi(void)
+void m68k_op_subq_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PI_8();
@@ -6896,7 +6896,7 @@ void m68k_op_subq_8_pi(void)
 }
 
 
-void m68k_op_subq_8_pi7(void)
+void m68k_op_subq_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_A7_PI_8();
@@ -6912,7 +6912,7 @@ void m68k_op_subq_8_pi7(void)
 }
 
 
-void m68k_op_subq_8_pd(void)
+void m68k_op_subq_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PD_8();
@@ -6928,7 +6928,7 @@ void m68k_op_subq_8_pd(void)
 }
 
 
-void m68k_op_subq_8_pd7(void)
+void m68k_op_subq_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_A7_PD_8();
@@ -6944,7 +6944,7 @@ void m68k_op_subq_8_pd7(void)
 }
 
 
-void m68k_op_subq_8_di(void)
+void m68k_op_subq_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_DI_8();
@@ -6960,7 +6960,7 @@ void m68k_op_subq_8_di(void)
 }
 
 
-void m68k_op_subq_8_ix(void)
+void m68k_op_subq_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_IX_8();
@@ -6976,7 +6976,7 @@ void m68k_op_subq_8_ix(void)
 }
 
 
-void m68k_op_subq_8_aw(void)
+void m68k_op_subq_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AW_8();
@@ -6992,7 +6992,7 @@ void m68k_op_subq_8_aw(void)
 }
 
 
-void m68k_op_subq_8_al(void)
+void m68k_op_subq_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AL_8();
@@ -7008,7 +7008,7 @@ void m68k_op_subq_8_al(void)
 }
 
 
-void m68k_op_subq_16_d(void)
+void m68k_op_subq_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -7024,7 +7024,7 @@ void m68k_op_subq_16_d(void)
 }
 
 
-void m68k_op_subq_16_a(void)
+void m68k_op_subq_16_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AY;
 
@@ -7032,7 +7032,7 @@ void m68k_op_subq_16_a(void)
 }
 
 
-void m68k_op_subq_16_ai(void)
+void m68k_op_subq_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_AI_16();
@@ -7048,7 +7048,7 @@ void m68k_op_subq_16_ai(void)
 }
 
 
-void m68k_op_subq_16_pi(void)
+void m68k_op_subq_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PI_16();
@@ -7064,7 +7064,7 @@ void m68k_op_subq_16_pi(void)
 }
 
 
-void m68k_op_subq_16_pd(void)
+void m68k_op_subq_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PD_16();
@@ -7080,7 +7080,7 @@ void m68k_op_subq_16_pd(void)
 }
 
 
-void m68k_op_subq_16_di(void)
+void m68k_op_subq_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_DI_16();
@@ -7096,7 +7096,7 @@ void m68k_op_subq_16_di(void)
 }
 
 
-void m68k_op_subq_16_ix(void)
+void m68k_op_subq_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_IX_16();
@@ -7112,7 +7112,7 @@ void m68k_op_subq_16_ix(void)
 }
 
 
-void m68k_op_subq_16_aw(void)
+void m68k_op_subq_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AW_16();
@@ -7128,7 +7128,7 @@ void m68k_op_subq_16_aw(void)
 }
 
 
-void m68k_op_subq_16_al(void)
+void m68k_op_subq_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AL_16();
@@ -7144,7 +7144,7 @@ void m68k_op_subq_16_al(void)
 }
 
 
-void m68k_op_subq_32_d(void)
+void m68k_op_subq_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
@@ -7160,7 +7160,7 @@ void m68k_op_subq_32_d(void)
 }
 
 
-void m68k_op_subq_32_a(void)
+void m68k_op_subq_32_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AY;
 
@@ -7168,7 +7168,7 @@ void m68k_op_subq_32_a(void)
 }
 
 
-void m68k_op_subq_32_ai(void)
+void m68k_op_subq_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_AI_32();
@@ -7184,7 +7184,7 @@ void m68k_op_subq_32_ai(void)
 }
 
 
-void m68k_op_subq_32_pi(void)
+void m68k_op_subq_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PI_32();
@@ -7200,7 +7200,7 @@ void m68k_op_subq_32_pi(void)
 }
 
 
-void m68k_op_subq_32_pd(void)
+void m68k_op_subq_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_PD_32();
@@ -7216,7 +7216,7 @@ void m68k_op_subq_32_pd(void)
 }
 
 
-void m68k_op_subq_32_di(void)
+void m68k_op_subq_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_DI_32();
@@ -7232,7 +7232,7 @@ void m68k_op_subq_32_di(void)
 }
 
 
-void m68k_op_subq_32_ix(void)
+void m68k_op_subq_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AY_IX_32();
@@ -7248,7 +7248,7 @@ void m68k_op_subq_32_ix(void)
 }
 
 
-void m68k_op_subq_32_aw(void)
+void m68k_op_subq_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AW_32();
@@ -7264,7 +7264,7 @@ void m68k_op_subq_32_aw(void)
 }
 
 
-void m68k_op_subq_32_al(void)
+void m68k_op_subq_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint ea = EA_AL_32();
@@ -7280,7 +7280,7 @@ void m68k_op_subq_32_al(void)
 }
 
 
-void m68k_op_subx_8_rr(void)
+void m68k_op_subx_8_rr(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_8(DY);
@@ -7298,7 +7298,7 @@ void m68k_op_subx_8_rr(void)
 }
 
 
-void m68k_op_subx_16_rr(void)
+void m68k_op_subx_16_rr(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(DY);
@@ -7316,7 +7316,7 @@ void m68k_op_subx_16_rr(void)
 }
 
 
-void m68k_op_subx_32_rr(void)
+void m68k_op_subx_32_rr(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DX;
 	uint src = DY;
@@ -7334,7 +7334,7 @@ void m68k_op_subx_32_rr(void)
 }
 
 
-void m68k_op_subx_8_mm_ax7(void)
+void m68k_op_subx_8_mm_ax7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_A7_PD_8();
@@ -7352,7 +7352,7 @@ void m68k_op_subx_8_mm_ax7(void)
 }
 
 
-void m68k_op_subx_8_mm_ay7(void)
+void m68k_op_subx_8_mm_ay7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_AX_PD_8();
@@ -7370,7 +7370,7 @@ void m68k_op_subx_8_mm_ay7(void)
 }
 
 
-void m68k_op_subx_8_mm_axy7(void)
+void m68k_op_subx_8_mm_axy7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_A7_PD_8();
@@ -7388,7 +7388,7 @@ void m68k_op_subx_8_mm_axy7(void)
 }
 
 
-void m68k_op_subx_8_mm(void)
+void m68k_op_subx_8_mm(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_AX_PD_8();
@@ -7406,7 +7406,7 @@ void m68k_op_subx_8_mm(void)
 }
 
 
-void m68k_op_subx_16_mm(void)
+void m68k_op_subx_16_mm(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_16();
 	uint ea  = EA_AX_PD_16();
@@ -7424,7 +7424,7 @@ void m68k_op_subx_16_mm(void)
 }
 
 
-void m68k_op_subx_32_mm(void)
+void m68k_op_subx_32_mm(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint src = OPER_AY_PD_32();
 	uint ea  = EA_AX_PD_32();
@@ -7442,7 +7442,7 @@ void m68k_op_subx_32_mm(void)
 }
 
 
-void m68k_op_swap_32(void)
+void m68k_op_swap_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 
@@ -7456,7 +7456,7 @@ void m68k_op_swap_32(void)
 }
 
 
-void m68k_op_tas_8_d(void)
+void m68k_op_tas_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &DY;
 
@@ -7468,7 +7468,7 @@ void m68k_op_tas_8_d(void)
 }
 
 
-void m68k_op_tas_8_ai(void)
+void m68k_op_tas_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_AI_8();
 	uint dst = m68ki_read_8(ea);
@@ -7481,7 +7481,7 @@ void m68k_op_tas_8_ai(void)
 }
 
 
-void m68k_op_tas_8_pi(void)
+void m68k_op_tas_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PI_8();
 	uint dst = m68ki_read_8(ea);
@@ -7494,7 +7494,7 @@ void m68k_op_tas_8_pi(void)
 }
 
 
-void m68k_op_tas_8_pi7(void)
+void m68k_op_tas_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PI_8();
 	uint dst = m68ki_read_8(ea);
@@ -7507,7 +7507,7 @@ void m68k_op_tas_8_pi7(void)
 }
 
 
-void m68k_op_tas_8_pd(void)
+void m68k_op_tas_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -7520,7 +7520,7 @@ void m68k_op_tas_8_pd(void)
 }
 
 
-void m68k_op_tas_8_pd7(void)
+void m68k_op_tas_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -7533,7 +7533,7 @@ void m68k_op_tas_8_pd7(void)
 }
 
 
-void m68k_op_tas_8_di(void)
+void m68k_op_tas_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_DI_8();
 	uint dst = m68ki_read_8(ea);
@@ -7546,7 +7546,7 @@ void m68k_op_tas_8_di(void)
 }
 
 
-void m68k_op_tas_8_ix(void)
+void m68k_op_tas_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AY_IX_8();
 	uint dst = m68ki_read_8(ea);
@@ -7559,7 +7559,7 @@ void m68k_op_tas_8_ix(void)
 }
 
 
-void m68k_op_tas_8_aw(void)
+void m68k_op_tas_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AW_8();
 	uint dst = m68ki_read_8(ea);
@@ -7572,7 +7572,7 @@ void m68k_op_tas_8_aw(void)
 }
 
 
-void m68k_op_tas_8_al(void)
+void m68k_op_tas_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint ea = EA_AL_8();
 	uint dst = m68ki_read_8(ea);
@@ -7585,14 +7585,14 @@ void m68k_op_tas_8_al(void)
 }
 
 
-void m68k_op_trap(void)
+void m68k_op_trap(m68ki_cpu_core *m68ki_cpu_p)
 {
 	/* Trap#n stacks exception frame type 0 */
 	m68ki_exception_trapN(EXCEPTION_TRAP_BASE + (REG_IR & 0xf));	/* HJB 990403 */
 }
 
 
-void m68k_op_trapt(void)
+void m68k_op_trapt(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7603,7 +7603,7 @@ void m68k_op_trapt(void)
 }
 
 
-void m68k_op_trapt_16(void)
+void m68k_op_trapt_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7615,7 +7615,7 @@ void m68k_op_trapt_16(void)
 }
 
 
-void m68k_op_trapt_32(void)
+void m68k_op_trapt_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7627,7 +7627,7 @@ void m68k_op_trapt_32(void)
 }
 
 
-void m68k_op_trapf(void)
+void m68k_op_trapf(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7637,7 +7637,7 @@ void m68k_op_trapf(void)
 }
 
 
-void m68k_op_trapf_16(void)
+void m68k_op_trapf_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7648,7 +7648,7 @@ void m68k_op_trapf_16(void)
 }
 
 
-void m68k_op_trapf_32(void)
+void m68k_op_trapf_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7659,7 +7659,7 @@ void m68k_op_trapf_32(void)
 }
 
 
-void m68k_op_traphi(void)
+void m68k_op_traphi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7671,7 +7671,7 @@ void m68k_op_traphi(void)
 }
 
 
-void m68k_op_trapls(void)
+void m68k_op_trapls(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7683,7 +7683,7 @@ void m68k_op_trapls(void)
 }
 
 
-void m68k_op_trapcc(void)
+void m68k_op_trapcc(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7695,7 +7695,7 @@ void m68k_op_trapcc(void)
 }
 
 
-void m68k_op_trapcs(void)
+void m68k_op_trapcs(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7707,7 +7707,7 @@ void m68k_op_trapcs(void)
 }
 
 
-void m68k_op_trapne(void)
+void m68k_op_trapne(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7719,7 +7719,7 @@ void m68k_op_trapne(void)
 }
 
 
-void m68k_op_trapeq(void)
+void m68k_op_trapeq(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7731,7 +7731,7 @@ void m68k_op_trapeq(void)
 }
 
 
-void m68k_op_trapvc(void)
+void m68k_op_trapvc(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7743,7 +7743,7 @@ void m68k_op_trapvc(void)
 }
 
 
-void m68k_op_trapvs(void)
+void m68k_op_trapvs(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7755,7 +7755,7 @@ void m68k_op_trapvs(void)
 }
 
 
-void m68k_op_trappl(void)
+void m68k_op_trappl(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7767,7 +7767,7 @@ void m68k_op_trappl(void)
 }
 
 
-void m68k_op_trapmi(void)
+void m68k_op_trapmi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7779,7 +7779,7 @@ void m68k_op_trapmi(void)
 }
 
 
-void m68k_op_trapge(void)
+void m68k_op_trapge(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7791,7 +7791,7 @@ void m68k_op_trapge(void)
 }
 
 
-void m68k_op_traplt(void)
+void m68k_op_traplt(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7803,7 +7803,7 @@ void m68k_op_traplt(void)
 }
 
 
-void m68k_op_trapgt(void)
+void m68k_op_trapgt(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7815,7 +7815,7 @@ void m68k_op_trapgt(void)
 }
 
 
-void m68k_op_traple(void)
+void m68k_op_traple(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7827,7 +7827,7 @@ void m68k_op_traple(void)
 }
 
 
-void m68k_op_traphi_16(void)
+void m68k_op_traphi_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7844,7 +7844,7 @@ void m68k_op_traphi_16(void)
 }
 
 
-void m68k_op_trapls_16(void)
+void m68k_op_trapls_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7861,7 +7861,7 @@ void m68k_op_trapls_16(void)
 }
 
 
-void m68k_op_trapcc_16(void)
+void m68k_op_trapcc_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7878,7 +7878,7 @@ void m68k_op_trapcc_16(void)
 }
 
 
-void m68k_op_trapcs_16(void)
+void m68k_op_trapcs_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7895,7 +7895,7 @@ void m68k_op_trapcs_16(void)
 }
 
 
-void m68k_op_trapne_16(void)
+void m68k_op_trapne_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7912,7 +7912,7 @@ void m68k_op_trapne_16(void)
 }
 
 
-void m68k_op_trapeq_16(void)
+void m68k_op_trapeq_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7929,7 +7929,7 @@ void m68k_op_trapeq_16(void)
 }
 
 
-void m68k_op_trapvc_16(void)
+void m68k_op_trapvc_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7946,7 +7946,7 @@ void m68k_op_trapvc_16(void)
 }
 
 
-void m68k_op_trapvs_16(void)
+void m68k_op_trapvs_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7963,7 +7963,7 @@ void m68k_op_trapvs_16(void)
 }
 
 
-void m68k_op_trappl_16(void)
+void m68k_op_trappl_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7980,7 +7980,7 @@ void m68k_op_trappl_16(void)
 }
 
 
-void m68k_op_trapmi_16(void)
+void m68k_op_trapmi_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -7997,7 +7997,7 @@ void m68k_op_trapmi_16(void)
 }
 
 
-void m68k_op_trapge_16(void)
+void m68k_op_trapge_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8014,7 +8014,7 @@ void m68k_op_trapge_16(void)
 }
 
 
-void m68k_op_traplt_16(void)
+void m68k_op_traplt_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8031,7 +8031,7 @@ void m68k_op_traplt_16(void)
 }
 
 
-void m68k_op_trapgt_16(void)
+void m68k_op_trapgt_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8048,7 +8048,7 @@ void m68k_op_trapgt_16(void)
 }
 
 
-void m68k_op_traple_16(void)
+void m68k_op_traple_16(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8065,7 +8065,7 @@ void m68k_op_traple_16(void)
 }
 
 
-void m68k_op_traphi_32(void)
+void m68k_op_traphi_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8081,7 +8081,7 @@ void m68k_op_traphi_32(void)
 }
 
 
-void m68k_op_trapls_32(void)
+void m68k_op_trapls_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8097,7 +8097,7 @@ void m68k_op_trapls_32(void)
 }
 
 
-void m68k_op_trapcc_32(void)
+void m68k_op_trapcc_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8113,7 +8113,7 @@ void m68k_op_trapcc_32(void)
 }
 
 
-void m68k_op_trapcs_32(void)
+void m68k_op_trapcs_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8129,7 +8129,7 @@ void m68k_op_trapcs_32(void)
 }
 
 
-void m68k_op_trapne_32(void)
+void m68k_op_trapne_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8145,7 +8145,7 @@ void m68k_op_trapne_32(void)
 }
 
 
-void m68k_op_trapeq_32(void)
+void m68k_op_trapeq_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8161,7 +8161,7 @@ void m68k_op_trapeq_32(void)
 }
 
 
-void m68k_op_trapvc_32(void)
+void m68k_op_trapvc_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8177,7 +8177,7 @@ void m68k_op_trapvc_32(void)
 }
 
 
-void m68k_op_trapvs_32(void)
+void m68k_op_trapvs_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8193,7 +8193,7 @@ void m68k_op_trapvs_32(void)
 }
 
 
-void m68k_op_trappl_32(void)
+void m68k_op_trappl_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8209,7 +8209,7 @@ void m68k_op_trappl_32(void)
 }
 
 
-void m68k_op_trapmi_32(void)
+void m68k_op_trapmi_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8225,7 +8225,7 @@ void m68k_op_trapmi_32(void)
 }
 
 
-void m68k_op_trapge_32(void)
+void m68k_op_trapge_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8241,7 +8241,7 @@ void m68k_op_trapge_32(void)
 }
 
 
-void m68k_op_traplt_32(void)
+void m68k_op_traplt_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8257,7 +8257,7 @@ void m68k_op_traplt_32(void)
 }
 
 
-void m68k_op_trapgt_32(void)
+void m68k_op_trapgt_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8273,7 +8273,7 @@ void m68k_op_trapgt_32(void)
 }
 
 
-void m68k_op_traple_32(void)
+void m68k_op_traple_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8289,7 +8289,7 @@ void m68k_op_traple_32(void)
 }
 
 
-void m68k_op_trapv(void)
+void m68k_op_trapv(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(COND_VC())
 	{
@@ -8299,7 +8299,7 @@ void m68k_op_trapv(void)
 }
 
 
-void m68k_op_tst_8_d(void)
+void m68k_op_tst_8_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_8(DY);
 
@@ -8310,7 +8310,7 @@ void m68k_op_tst_8_d(void)
 }
 
 
-void m68k_op_tst_8_ai(void)
+void m68k_op_tst_8_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_8();
 
@@ -8321,7 +8321,7 @@ void m68k_op_tst_8_ai(void)
 }
 
 
-void m68k_op_tst_8_pi(void)
+void m68k_op_tst_8_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_8();
 
@@ -8332,7 +8332,7 @@ void m68k_op_tst_8_pi(void)
 }
 
 
-void m68k_op_tst_8_pi7(void)
+void m68k_op_tst_8_pi7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PI_8();
 
@@ -8343,7 +8343,7 @@ void m68k_op_tst_8_pi7(void)
 }
 
 
-void m68k_op_tst_8_pd(void)
+void m68k_op_tst_8_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_8();
 
@@ -8354,7 +8354,7 @@ void m68k_op_tst_8_pd(void)
 }
 
 
-void m68k_op_tst_8_pd7(void)
+void m68k_op_tst_8_pd7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_A7_PD_8();
 
@@ -8365,7 +8365,7 @@ void m68k_op_tst_8_pd7(void)
 }
 
 
-void m68k_op_tst_8_di(void)
+void m68k_op_tst_8_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_8();
 
@@ -8376,7 +8376,7 @@ void m68k_op_tst_8_di(void)
 }
 
 
-void m68k_op_tst_8_ix(void)
+void m68k_op_tst_8_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_8();
 
@@ -8387,7 +8387,7 @@ void m68k_op_tst_8_ix(void)
 }
 
 
-void m68k_op_tst_8_aw(void)
+void m68k_op_tst_8_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_8();
 
@@ -8398,7 +8398,7 @@ void m68k_op_tst_8_aw(void)
 }
 
 
-void m68k_op_tst_8_al(void)
+void m68k_op_tst_8_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_8();
 
@@ -8409,7 +8409,7 @@ void m68k_op_tst_8_al(void)
 }
 
 
-void m68k_op_tst_8_pcdi(void)
+void m68k_op_tst_8_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8425,7 +8425,7 @@ void m68k_op_tst_8_pcdi(void)
 }
 
 
-void m68k_op_tst_8_pcix(void)
+void m68k_op_tst_8_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8441,7 +8441,7 @@ void m68k_op_tst_8_pcix(void)
 }
 
 
-void m68k_op_tst_8_i(void)
+void m68k_op_tst_8_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8457,7 +8457,7 @@ void m68k_op_tst_8_i(void)
 }
 
 
-void m68k_op_tst_16_d(void)
+void m68k_op_tst_16_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = MASK_OUT_ABOVE_16(DY);
 
@@ -8468,7 +8468,7 @@ void m68k_op_tst_16_d(void)
 }
 
 
-void m68k_op_tst_16_a(void)
+void m68k_op_tst_16_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8484,7 +8484,7 @@ void m68k_op_tst_16_a(void)
 }
 
 
-void m68k_op_tst_16_ai(void)
+void m68k_op_tst_16_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_16();
 
@@ -8495,7 +8495,7 @@ void m68k_op_tst_16_ai(void)
 }
 
 
-void m68k_op_tst_16_pi(void)
+void m68k_op_tst_16_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_16();
 
@@ -8506,7 +8506,7 @@ void m68k_op_tst_16_pi(void)
 }
 
 
-void m68k_op_tst_16_pd(void)
+void m68k_op_tst_16_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_16();
 
@@ -8517,7 +8517,7 @@ void m68k_op_tst_16_pd(void)
 }
 
 
-void m68k_op_tst_16_di(void)
+void m68k_op_tst_16_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_16();
 
@@ -8528,7 +8528,7 @@ void m68k_op_tst_16_di(void)
 }
 
 
-void m68k_op_tst_16_ix(void)
+void m68k_op_tst_16_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_16();
 
@@ -8539,7 +8539,7 @@ void m68k_op_tst_16_ix(void)
 }
 
 
-void m68k_op_tst_16_aw(void)
+void m68k_op_tst_16_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_16();
 
@@ -8550,7 +8550,7 @@ void m68k_op_tst_16_aw(void)
 }
 
 
-void m68k_op_tst_16_al(void)
+void m68k_op_tst_16_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_16();
 
@@ -8561,7 +8561,7 @@ void m68k_op_tst_16_al(void)
 }
 
 
-void m68k_op_tst_16_pcdi(void)
+void m68k_op_tst_16_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8577,7 +8577,7 @@ void m68k_op_tst_16_pcdi(void)
 }
 
 
-void m68k_op_tst_16_pcix(void)
+void m68k_op_tst_16_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8593,7 +8593,7 @@ void m68k_op_tst_16_pcix(void)
 }
 
 
-void m68k_op_tst_16_i(void)
+void m68k_op_tst_16_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8609,7 +8609,7 @@ void m68k_op_tst_16_i(void)
 }
 
 
-void m68k_op_tst_32_d(void)
+void m68k_op_tst_32_d(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = DY;
 
@@ -8620,7 +8620,7 @@ void m68k_op_tst_32_d(void)
 }
 
 
-void m68k_op_tst_32_a(void)
+void m68k_op_tst_32_a(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8636,7 +8636,7 @@ void m68k_op_tst_32_a(void)
 }
 
 
-void m68k_op_tst_32_ai(void)
+void m68k_op_tst_32_ai(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_AI_32();
 
@@ -8647,7 +8647,7 @@ void m68k_op_tst_32_ai(void)
 }
 
 
-void m68k_op_tst_32_pi(void)
+void m68k_op_tst_32_pi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PI_32();
 
@@ -8658,7 +8658,7 @@ void m68k_op_tst_32_pi(void)
 }
 
 
-void m68k_op_tst_32_pd(void)
+void m68k_op_tst_32_pd(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_PD_32();
 
@@ -8669,7 +8669,7 @@ void m68k_op_tst_32_pd(void)
 }
 
 
-void m68k_op_tst_32_di(void)
+void m68k_op_tst_32_di(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_DI_32();
 
@@ -8680,7 +8680,7 @@ void m68k_op_tst_32_di(void)
 }
 
 
-void m68k_op_tst_32_ix(void)
+void m68k_op_tst_32_ix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AY_IX_32();
 
@@ -8691,7 +8691,7 @@ void m68k_op_tst_32_ix(void)
 }
 
 
-void m68k_op_tst_32_aw(void)
+void m68k_op_tst_32_aw(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AW_32();
 
@@ -8702,7 +8702,7 @@ void m68k_op_tst_32_aw(void)
 }
 
 
-void m68k_op_tst_32_al(void)
+void m68k_op_tst_32_al(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint res = OPER_AL_32();
 
@@ -8713,7 +8713,7 @@ void m68k_op_tst_32_al(void)
 }
 
 
-void m68k_op_tst_32_pcdi(void)
+void m68k_op_tst_32_pcdi(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8729,7 +8729,7 @@ void m68k_op_tst_32_pcdi(void)
 }
 
 
-void m68k_op_tst_32_pcix(void)
+void m68k_op_tst_32_pcix(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8745,7 +8745,7 @@ void m68k_op_tst_32_pcix(void)
 }
 
 
-void m68k_op_tst_32_i(void)
+void m68k_op_tst_32_i(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8761,13 +8761,13 @@ void m68k_op_tst_32_i(void)
 }
 
 
-void m68k_op_unlk_32_a7(void)
+void m68k_op_unlk_32_a7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	REG_A[7] = m68ki_read_32(REG_A[7]);
 }
 
 
-void m68k_op_unlk_32(void)
+void m68k_op_unlk_32(m68ki_cpu_core *m68ki_cpu_p)
 {
 	uint* r_dst = &AY;
 
@@ -8776,7 +8776,7 @@ void m68k_op_unlk_32(void)
 }
 
 
-void m68k_op_unpk_16_rr(void)
+void m68k_op_unpk_16_rr(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8791,7 +8791,7 @@ void m68k_op_unpk_16_rr(void)
 }
 
 
-void m68k_op_unpk_16_mm_ax7(void)
+void m68k_op_unpk_16_mm_ax7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8810,7 +8810,7 @@ void m68k_op_unpk_16_mm_ax7(void)
 }
 
 
-void m68k_op_unpk_16_mm_ay7(void)
+void m68k_op_unpk_16_mm_ay7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8829,7 +8829,7 @@ void m68k_op_unpk_16_mm_ay7(void)
 }
 
 
-void m68k_op_unpk_16_mm_axy7(void)
+void m68k_op_unpk_16_mm_axy7(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
@@ -8847,7 +8847,7 @@ void m68k_op_unpk_16_mm_axy7(void)
 }
 
 
-void m68k_op_unpk_16_mm(void)
+void m68k_op_unpk_16_mm(m68ki_cpu_core *m68ki_cpu_p)
 {
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
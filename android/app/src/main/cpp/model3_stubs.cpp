@@ -7,6 +7,7 @@
 #include "OSD/Video.h"
 #include "Types.h"
 #include "Game.h"
+#include "Sound/Resampler.h"
 
 // Minimal OSD implementations for Android/SDL.
 
@@ -79,88 +80,14 @@ void EndFrameVideo() {}
 
 // SDL audio backend:
 // - Mix 4-channel Model3 output down to stereo (S16).
-// - Resample/convert to the opened device format via SDL_AudioStream.
-// - Feed a ring buffer consumed by the SDL audio callback (prevents choppy audio
-//   due to small queue bursts or timing jitter).
+// - Resample to the device's native rate with CResampler, whose rate control
+//   holds the buffer at the configured latency (no under-runs from clock drift).
+// - Feed a lock-free ring buffer consumed by the SDL audio callback.
 static SDL_AudioDeviceID g_audioDevice = 0;
 static SDL_AudioSpec g_audioSpec = {};
-static SDL_AudioStream* g_audioStream = nullptr;
-static std::vector<uint8_t> g_ring;
-static uint32_t g_ringRead = 0;
-static uint32_t g_ringWrite = 0;
-static SDL_mutex* g_audioMutex = nullptr;
-static uint32_t g_bytesPerSecond = 0;
-static uint32_t g_targetFillBytes = 0;
-
-static uint32_t RingUsed()
-{
-  if (g_ring.empty())
-    return 0;
-  if (g_ringWrite >= g_ringRead)
-    return g_ringWrite - g_ringRead;
-  return static_cast<uint32_t>(g_ring.size()) - (g_ringRead - g_ringWrite);
-}
-
-static uint32_t RingFree()
-{
-  if (g_ring.empty())
-    return 0;
-  // Keep one byte empty to distinguish full vs empty.
-  return static_cast<uint32_t>(g_ring.size() - 1) - RingUsed();
-}
-
-static void RingDropOldest(uint32_t bytes)
-{
-  if (g_ring.empty())
-    return;
-  const uint32_t used = RingUsed();
-  if (bytes >= used)
-  {
-    g_ringRead = g_ringWrite;
-    return;
-  }
-  g_ringRead = (g_ringRead + bytes) % static_cast<uint32_t>(g_ring.size());
-}
-
-static void RingWrite(const uint8_t* data, uint32_t bytes)
-{
-  if (g_ring.empty() || bytes == 0)
-    return;
-
-  // If we don't have room, drop oldest audio to keep latency bounded.
-  const uint32_t free = RingFree();
-  if (bytes > free)
-    RingDropOldest(bytes - free);
-
-  uint32_t remaining = bytes;
-  while (remaining > 0)
-  {
-    const uint32_t toEnd = static_cast<uint32_t>(g_ring.size()) - g_ringWrite;
-    const uint32_t chunk = (remaining < toEnd) ? remaining : toEnd;
-    std::memcpy(&g_ring[g_ringWrite], data + (bytes - remaining), chunk);
-    g_ringWrite = (g_ringWrite + chunk) % static_cast<uint32_t>(g_ring.size());
-    remaining -= chunk;
-  }
-}
-
-static uint32_t RingRead(uint8_t* out, uint32_t bytes)
-{
-  if (g_ring.empty() || bytes == 0)
-    return 0;
-  const uint32_t used = RingUsed();
-  const uint32_t toRead = (bytes < used) ? bytes : used;
-
-  uint32_t remaining = toRead;
-  while (remaining > 0)
-  {
-    const uint32_t toEnd = static_cast<uint32_t>(g_ring.size()) - g_ringRead;
-    const uint32_t chunk = (remaining < toEnd) ? remaining : toEnd;
-    std::memcpy(out + (toRead - remaining), &g_ring[g_ringRead], chunk);
-    g_ringRead = (g_ringRead + chunk) % static_cast<uint32_t>(g_ring.size());
-    remaining -= chunk;
-  }
-  return toRead;
-}
+static CAudioRing g_ring;
+static CResampler g_resampler;
+static unsigned g_targetFillFrames = 0;
 
 static INT16 Clamp16(int sample)
 {
@@ -169,7 +96,7 @@ static INT16 Clamp16(int sample)
   return static_cast<INT16>(sample);
 }
 
-bool OpenAudio(const Util::Config::Node&)
+bool OpenAudio(const Util::Config::Node& config)
 {
   if (g_audioDevice != 0)
     return true;
@@ -178,79 +105,54 @@ bool OpenAudio(const Util::Config::Node&)
   desired.freq = 48000; // common Android output rate; SDL may still choose a different one
   desired.format = AUDIO_S16SYS;
   desired.channels = 2; // stereo out
-  desired.samples = 4096;
+  desired.samples = 1024;
   desired.callback = [](void*, Uint8* stream, int len) {
-    if (!g_audioEnabled || g_ring.empty())
-    {
+    const unsigned frames = static_cast<unsigned>(len) / (2 * sizeof(INT16));
+    const unsigned got = g_ring.Read(reinterpret_cast<INT16*>(stream), frames);
+    if (got < frames)
+      std::memset(stream + got * 2 * sizeof(INT16), 0, (frames - got) * 2 * sizeof(INT16));
+    if (!g_audioEnabled)
       std::memset(stream, 0, static_cast<size_t>(len));
-      return;
-    }
-    if (g_audioMutex)
-      SDL_LockMutex(g_audioMutex);
-    const uint32_t got = RingRead(stream, static_cast<uint32_t>(len));
-    const uint32_t usedAfterRead = RingUsed();
-    if (g_audioMutex)
-      SDL_UnlockMutex(g_audioMutex);
-    if (got < static_cast<uint32_t>(len))
-      std::memset(stream + got, 0, static_cast<size_t>(len - got));
 
     // When audio is running low, wake the emulator sound thread (if enabled).
     // This matches the desktop "unsync'd sound board thread" design.
-    if (g_audioCallback && g_audioData && g_targetFillBytes != 0 && usedAfterRead < (g_targetFillBytes / 2))
+    if (g_audioCallback && g_audioData && g_ring.Available() < g_targetFillFrames)
       g_audioCallback(g_audioData);
   };
 
-  // Allow SDL to pick a workable device format/rate; we'll convert via SDL_AudioStream.
-  g_audioDevice = SDL_OpenAudioDevice(nullptr, 0, &desired, &g_audioSpec,
-                                      SDL_AUDIO_ALLOW_FREQUENCY_CHANGE | SDL_AUDIO_ALLOW_FORMAT_CHANGE | SDL_AUDIO_ALLOW_CHANNELS_CHANGE);
+  // Only the rate may differ from what we asked for; SDL converts format and channels.
+  g_audioDevice = SDL_OpenAudioDevice(nullptr, 0, &desired, &g_audioSpec, SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
   if (g_audioDevice == 0) {
     SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "SDL_OpenAudioDevice failed: %s", SDL_GetError());
     return false;
   }
 
-  g_bytesPerSecond = static_cast<uint32_t>(g_audioSpec.freq) *
-                     static_cast<uint32_t>(g_audioSpec.channels) *
-                     static_cast<uint32_t>(SDL_AUDIO_BITSIZE(g_audioSpec.format) / 8);
-  // Keep ~250ms buffered; ring holds 2s to bound worst-case jitter.
-  g_targetFillBytes = g_bytesPerSecond / 4;
-
-  g_ring.assign((g_bytesPerSecond * 2) + 1, 0);
-  g_ringRead = 0;
-  g_ringWrite = 0;
-
-  g_audioMutex = SDL_CreateMutex();
-  if (!g_audioMutex) {
-    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "SDL_CreateMutex failed: %s", SDL_GetError());
+  if (OKAY != g_resampler.Init(44100, g_audioSpec.freq, 2)) {
     SDL_CloseAudioDevice(g_audioDevice);
     g_audioDevice = 0;
-    g_ring.clear();
     return false;
   }
 
-  // Convert from core mix format (S16 stereo @ 44100) to device format.
-  g_audioStream = SDL_NewAudioStream(AUDIO_S16SYS, 2, 44100, g_audioSpec.format, g_audioSpec.channels, g_audioSpec.freq);
-  if (!g_audioStream) {
-    SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "SDL_NewAudioStream failed: %s", SDL_GetError());
-    SDL_CloseAudioDevice(g_audioDevice);
-    g_audioDevice = 0;
-    g_ring.clear();
-    SDL_DestroyMutex(g_audioMutex);
-    g_audioMutex = nullptr;
-    return false;
-  }
+  // Hold the configured latency, but never less than two device callbacks.
+  unsigned latencyMs = std::min(500u, std::max(10u, config["AudioLatency"].ValueAsDefault<unsigned>(50)));
+  g_targetFillFrames = std::max(static_cast<unsigned>(g_audioSpec.freq) * latencyMs / 1000, 2u * g_audioSpec.samples);
+  g_ring.Init(4 * g_targetFillFrames, 2);
+  std::vector<INT16> silence(static_cast<size_t>(g_targetFillFrames) * 2, 0);
+  g_ring.Write(silence.data(), g_targetFillFrames);
 
+  SDL_Log("Audio output: %d Hz, %u ms buffer", g_audioSpec.freq, g_targetFillFrames * 1000 / static_cast<unsigned>(g_audioSpec.freq));
   SDL_PauseAudioDevice(g_audioDevice, 0);
   return true;
 }
 
 bool OutputAudio(unsigned numSamples, INT16* leftFront, INT16* rightFront, INT16* leftRear, INT16* rightRear, bool flipStereo)
 {
-  if (!g_audioEnabled || g_audioDevice == 0)
+  if (g_audioDevice == 0)
     return true;
 
   // Downmix quad to stereo (S16 @ 44100 Hz).
   static thread_local std::vector<INT16> stereo;
-  stereo.clear();
+  static thread_local std::vector<INT16> resampled;
   stereo.resize(static_cast<size_t>(numSamples) * 2);
   for (unsigned i = 0; i < numSamples; ++i) {
     int lf = leftFront ? leftFront[i] : 0;
@@ -264,50 +166,24 @@ bool OutputAudio(unsigned numSamples, INT16* leftFront, INT16* rightFront, INT16
     stereo[(i * 2) + 1] = static_cast<INT16>(r);
   }
 
-  if (g_audioStream)
-  {
-    SDL_AudioStreamPut(g_audioStream, stereo.data(), static_cast<int>(stereo.size() * sizeof(INT16)));
-    // Pull converted data in chunks into the ring buffer.
-    uint8_t tmp[8192];
-    while (true)
-    {
-      const int got = SDL_AudioStreamGet(g_audioStream, tmp, static_cast<int>(sizeof(tmp)));
-      if (got <= 0)
-        break;
-      if (g_audioMutex)
-        SDL_LockMutex(g_audioMutex);
-      RingWrite(tmp, static_cast<uint32_t>(got));
-      if (g_audioMutex)
-        SDL_UnlockMutex(g_audioMutex);
-    }
-  }
+  // Convert to the device rate and queue. If the ring is full the rest of the
+  // chunk is dropped (rate control normally keeps it well below capacity).
+  resampled.resize(static_cast<size_t>(g_resampler.MaxOutputFrames(static_cast<int>(numSamples))) * 2);
+  g_resampler.UpdateBufferLevel(g_ring.Available(), g_targetFillFrames);
+  const int frames = g_resampler.Process(resampled.data(), stereo.data(), static_cast<int>(numSamples));
+  g_ring.Write(resampled.data(), static_cast<unsigned>(frames));
+
   // Tell the core whether the audio buffer is "full enough" (used by the
   // unsync'd sound-board thread to decide whether to run extra frames).
-  bool fullEnough = true;
-  if (g_audioMutex)
-    SDL_LockMutex(g_audioMutex);
-  if (g_targetFillBytes != 0)
-    fullEnough = RingUsed() >= g_targetFillBytes;
-  if (g_audioMutex)
-    SDL_UnlockMutex(g_audioMutex);
-  return fullEnough;
+  return g_ring.Available() >= g_targetFillFrames;
 }
 
 void CloseAudio()
 {
-  if (g_audioStream) {
-    SDL_FreeAudioStream(g_audioStream);
-    g_audioStream = nullptr;
-  }
-  if (g_audioMutex) {
-    SDL_DestroyMutex(g_audioMutex);
-    g_audioMutex = nullptr;
-  }
-  g_ring.clear();
-  g_bytesPerSecond = 0;
-  g_targetFillBytes = 0;
   if (g_audioDevice != 0) {
     SDL_CloseAudioDevice(g_audioDevice);
     g_audioDevice = 0;
   }
+  g_ring.Init(0, 2);
+  g_targetFillFrames = 0;
 }
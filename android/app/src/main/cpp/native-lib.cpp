@@ -27,11 +27,14 @@
 #include "Util/ConfigBuilders.h"
 #include "Version.h"
 #include "BlockFile.h"
+#include "RewindBuffer.h"
+#include "RunAhead.h"
 
 #include "android_input_system.h"
 #include "gles_presenter.h"
 #include "gles_stub_render3d.h"
 #include "Graphics/New3D/New3D.h"
+#include "Graphics/New3D/ProgramCache.h"
 
 // Minimal OSD glue -----------------------------------------------------------
 
@@ -57,6 +60,17 @@ public:
       m_inner->RenderFrame();
   }
 
+  void BuildScene(void) override
+  {
+    if (m_inner)
+      m_inner->BuildScene();
+  }
+
+  bool QueueScene(void) override
+  {
+    return m_inner && m_inner->QueueScene();
+  }
+
   void BeginFrame(void) override
   {
     if (m_inner)
@@ -117,6 +131,13 @@ public:
     return m_inner->GetLosValue(layer);
   }
 
+  Render3DStats GetFrameStats(void) override
+  {
+    if (!m_inner)
+      return Render3DStats();
+    return m_inner->GetFrameStats();
+  }
+
 private:
   IRender3D* m_inner = nullptr;
   CRender2D* m_render2d = nullptr;
@@ -171,6 +192,8 @@ struct Super3Host {
   std::atomic<int> requestSaveSlot{-1};
   std::atomic<int> requestLoadSlot{-1};
   std::atomic<int> requestMenuPause{-1}; // -1=no change, 0=resume, 1=pause
+  CRewindBuffer rewind;
+  CRunAhead runAhead;
   bool menuPaused = false;
   bool threadsPausedByMenu = false;
 
@@ -249,6 +272,7 @@ struct Super3Host {
     // rendering/input causes occasional stalls on Android.
     config.Set("MultiThreaded", true);
     config.Set("GPUMultiThreaded", false);
+    config.Set("PipelineDepth", "1");
     config.Set("EmulateSound", true);
     config.Set("EmulateDSB", true);
     config.Set("Balance", "0");
@@ -256,6 +280,14 @@ struct Super3Host {
     config.Set("BalanceFrontRear", "0");
     config.Set("NbSoundChannels", "4");
     config.Set("SoundFreq", "57.6");
+    config.Set("AudioLatency", "50");
+    config.Set("Rewind", false);
+    config.Set("RewindSeconds", "10");
+    config.Set("RewindInterval", "4");
+    config.Set("RewindBufferSize", "256");
+    config.Set("RunAhead", "0");
+    config.Set("CompressSaveStates", false);
+    config.Set("ROMCache", false);
     // Supermodel.ini commonly uses 200 as "100%".
     config.Set("SoundVolume", "100");
     config.Set("MusicVolume", "150");
@@ -263,9 +295,18 @@ struct Super3Host {
     config.Set("New3DEngine", true);
     config.Set("New3DAccurate", false);
     config.Set("QuadRendering", false);
+    config.Set("New3DThreads", "1");
+    config.Set("New3DVerify", false);
+    config.Set("New3DVerifyVertices", false);
+    config.Set("New3DGPUTextures", false);
+    config.Set("New3DAsyncLos", false);
+    config.Set("ShaderCache", true);
     config.Set("FlipStereo", false);
     // The core expects this node to exist (throws std::range_error otherwise).
     config.Set("PowerPCFrequency", "50");
+    config.Set("PowerPCDecodeCache", false);
+    config.Set("PowerPCDecodeCacheVerify", false);
+    config.Set("PowerPCIdleSkip", true);
     config.Set("InputSystem", "sdl");
     config.Set("ABSMiceOnly", true);
     config.Set("Outputs", "none");
@@ -437,6 +478,8 @@ struct Super3Host {
       return false;
     }
     loader = std::make_unique<GameLoader>(gamesXml);
+    if (config["ROMCache"].ValueAsDefault<bool>(false))
+      loader->SetCacheDirectory(JoinPath(userDataRoot.empty() ? std::string("super3") : userDataRoot, "ROMCache"));
     return true;
   }
 
@@ -521,6 +564,16 @@ struct Super3Host {
       SDL_Log("Model3 Reset...");
       model3->Reset();
 
+      if (config["Rewind"].ValueAsDefault<bool>(false)) {
+        const unsigned interval = std::max(1u, config["RewindInterval"].ValueAsDefault<unsigned>(4));
+        const unsigned maxStates = config["RewindSeconds"].ValueAsDefault<unsigned>(10) * 60 / interval;
+        const size_t maxBytes = size_t(config["RewindBufferSize"].ValueAsDefault<unsigned>(256)) << 20;
+        rewind.Init(maxStates, interval, maxBytes);
+      } else {
+        rewind.Init(0, 1, 0);
+      }
+      runAhead.Init(config["RunAhead"].ValueAsDefault<unsigned>(0));
+
       // Persisted test menu settings (e.g., Daytona 2 Link ID = SINGLE).
       LoadNVRAMIfPresent();
 
@@ -617,8 +670,23 @@ struct Super3Host {
           }
         }
 
-        if (threadsPausedByMenu) model3->RenderFrame();
-        else model3->RunFrame();
+        if (threadsPausedByMenu) {
+          model3->RenderFrame();
+        } else {
+          // While rewinding, each frame is run from an earlier state instead of being captured.
+          const bool rewinding = rewind.Enabled() && inputs.uiRewind && inputs.uiRewind->value;
+          if (rewinding) {
+            model3->PauseThreads();
+            rewind.StepBack(model3.get());
+            model3->ResumeThreads();
+          }
+          runAhead.RunFrame(model3.get());
+          if (!rewinding && rewind.CaptureDue()) {
+            model3->PauseThreads();
+            rewind.Capture(model3.get());
+            model3->ResumeThreads();
+          }
+        }
       }
     }
 
@@ -641,7 +709,7 @@ struct Super3Host {
       }
 
       CBlockFile SaveState;
-      if (OKAY != SaveState.Create(filePath, "Supermodel Save State", "Supermodel Version " SUPERMODEL_VERSION))
+      if (OKAY != SaveState.Create(filePath, "Supermodel Save State", "Supermodel Version " SUPERMODEL_VERSION, config["CompressSaveStates"].ValueAsDefault<bool>(false)))
       {
         ErrorLog("Unable to save state to '%s'.", filePath.c_str());
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unable to save state to '%s'.", filePath.c_str());
@@ -688,6 +756,7 @@ struct Super3Host {
 
       model3->LoadState(&SaveState);
       SaveState.Close();
+      rewind.Reset();
       SDL_Log("Loaded state from '%s'.", filePath.c_str());
     }
 
@@ -704,6 +773,8 @@ struct Super3Host {
 
     SDL_Log("Initializing New3D (GLES) ...");
     SDL_Log("New3DAccurate=%d", config["New3DAccurate"].ValueAsDefault<bool>(false) ? 1 : 0);
+    // Compiling shaders on GLES drivers can take seconds, so reuse the driver binaries from earlier runs
+    New3D::ProgramCache::SetDirectory(config["ShaderCache"].ValueAsDefault<bool>(true) ? JoinPath(userDataRoot.empty() ? std::string("super3") : userDataRoot, "ShaderCache") : "");
     new3d = std::make_unique<New3D::CNew3D>(config, game.name);
     if (new3d->Init(xOff, yOff, xRes, yRes, totalXRes, totalYRes) != 0)
     {
@@ -1039,6 +1110,7 @@ extern "C" int SDL_main(int argc, char* argv[]) {
 
   presenter.Shutdown();
   if (loadState.load(std::memory_order_acquire) == 1) {
+    host.runAhead.LogTimings();
     host.SaveNVRAM();
   }
   CloseAudio();
@@ -5,16 +5,13 @@
 #include <algorithm>
 #include <cstring>
 
+#include "Graphics/TileRaster.h"
 #include "OSD/Logger.h"
 #include "Util/NewConfig.h"
 
 namespace {
 // Palette data from Model 3 hardware is in little-endian format (ABGR when viewed as 32-bit).
-// Convert to ARGB (0xAARRGGBB) before handing it to the presenter.
-static inline uint32_t ABGRToARGB(uint32_t abgr)
-{
-  return (abgr & 0xFF00FF00u) | ((abgr & 0x00FF0000u) >> 16) | ((abgr & 0x000000FFu) << 16);
-}
+// TileRaster converts it to ARGB (0xAARRGGBB) before handing it to the presenter.
 static inline uint8_t GetA(uint32_t argb) { return static_cast<uint8_t>(argb >> 24); }
 static inline uint8_t GetR(uint32_t argb) { return static_cast<uint8_t>(argb >> 16); }
 static inline uint8_t GetG(uint32_t argb) { return static_cast<uint8_t>(argb >> 8); }
@@ -23,122 +20,6 @@ static inline uint32_t ARGB(uint8_t a, uint8_t r, uint8_t g, uint8_t b)
 {
   return (uint32_t(a) << 24) | (uint32_t(r) << 16) | (uint32_t(g) << 8) | uint32_t(b);
 }
-
-template <int bits, bool alphaTest, bool clip>
-static inline void DrawTileLine(uint32_t *line,
-                                int pixelOffset,
-                                uint16_t tile,
-                                int patternLine,
-                                const uint32_t *vram,
-                                const uint32_t *palette,
-                                uint16_t mask)
-{
-  static_assert(bits == 4 || bits == 8, "Tiles are either 4- or 8-bit");
-
-  if (bits == 8)
-    patternLine *= 2;
-
-  int patternOffset;
-  if (bits == 4)
-  {
-    patternOffset = ((tile & 0x3FFF) << 1) | ((tile >> 15) & 1);
-    patternOffset *= 32;
-    patternOffset /= 4;
-  }
-  else
-  {
-    patternOffset = tile & 0x3FFF;
-    patternOffset *= 64;
-    patternOffset /= 4;
-  }
-
-  uint32_t colorHi = tile & ((bits == 4) ? 0x7FF0 : 0x7F00);
-
-  if (bits == 4)
-  {
-    uint32_t pattern = vram[patternOffset + patternLine];
-    for (int p = 7; p >= 0; p--)
-    {
-      if (!clip || (unsigned int)pixelOffset < 496u)
-      {
-        uint16_t maskTest = 1 << (15 - ((pixelOffset + 0) / 32));
-        bool visible = (mask & maskTest) != 0;
-        uint32_t pixel = visible ? ABGRToARGB(palette[((pattern >> (p * 4)) & 0xF) | colorHi]) : 0;
-        if (!alphaTest || (visible && (pixel >> 24) != 0))
-          line[pixelOffset] = pixel;
-      }
-      ++pixelOffset;
-    }
-  }
-  else
-  {
-    for (int i = 0; i < 2; i++)
-    {
-      uint32_t pattern = vram[patternOffset + patternLine + i];
-      for (int p = 3; p >= 0; p--)
-      {
-        if (!clip || (unsigned int)pixelOffset < 496u)
-        {
-          uint16_t maskTest = 1 << (15 - ((pixelOffset + 0) / 32));
-          bool visible = (mask & maskTest) != 0;
-          uint32_t pixel = visible ? ABGRToARGB(palette[((pattern >> (p * 8)) & 0xFF) | colorHi]) : 0;
-          if (!alphaTest || (visible && (pixel >> 24) != 0))
-            line[pixelOffset] = pixel;
-        }
-        ++pixelOffset;
-      }
-    }
-  }
-}
-
-template <int bits, bool alphaTest>
-static void DrawLayer(uint32_t *pixels, int layerNum, const uint32_t *vram, const uint32_t *regs, const uint32_t *palette)
-{
-  const uint16_t *nameTableBase = (const uint16_t *)&vram[(0xF8000 + layerNum * 0x2000) / 4];
-  const uint16_t *hScrollTable = (const uint16_t *)&vram[(0xF6000 + layerNum * 0x400) / 4];
-  bool lineScrollMode = (regs[0x60 / 4 + layerNum] & 0x8000) != 0;
-  int hFullScroll = regs[0x60 / 4 + layerNum] & 0x3FF;
-  int vScroll = (regs[0x60 / 4 + layerNum] >> 16) & 0x1FF;
-
-  const uint16_t *maskTable = (const uint16_t *)&vram[0xF7000 / 4];
-  if (layerNum < 2)
-    maskTable += 1;
-
-  const uint16_t maskPolarity = (layerNum & 1) ? 0xFFFF : 0x0000;
-
-  uint32_t *line = pixels;
-
-  for (int y = 0; y < 384; y++)
-  {
-    int hScroll = (lineScrollMode ? hScrollTable[y] : hFullScroll) & 0x1FF;
-    int hTile = hScroll / 8;
-    int hFine = hScroll & 7;
-    int vFine = (y + vScroll) & 7;
-    const uint16_t *nameTable = &nameTableBase[(64 * ((y + vScroll) / 8)) & 0xFFF];
-    uint16_t mask = *maskTable ^ maskPolarity;
-
-    int pixelOffset = -hFine;
-    int extraTile = (hFine != 0) ? 1 : 0;
-
-    DrawTileLine<bits, alphaTest, true>(line, pixelOffset, nameTable[(hTile ^ 1) & 63], vFine, vram, palette, mask);
-    ++hTile;
-    pixelOffset += 8;
-
-    for (int tx = 1; tx < (62 - 1 + extraTile); tx++)
-    {
-      DrawTileLine<bits, alphaTest, false>(line, pixelOffset, nameTable[(hTile ^ 1) & 63], vFine, vram, palette, mask);
-      ++hTile;
-      pixelOffset += 8;
-    }
-
-    DrawTileLine<bits, alphaTest, true>(line, pixelOffset, nameTable[(hTile ^ 1) & 63], vFine, vram, palette, mask);
-    ++hTile;
-    pixelOffset += 8;
-
-    maskTable += 2;
-    line += 496;
-  }
-}
 } // namespace
 
 CRender2D::CRender2D(const Util::Config::Node &config) : m_config(config) {}
@@ -158,6 +39,8 @@ bool CRender2D::Init(unsigned /*xOffset*/, unsigned /*yOffset*/, unsigned xRes,
   m_topSurface.assign(m_xPixels * m_yPixels, 0);
   m_bottomSurface.assign(m_xPixels * m_yPixels, 0);
   m_frame.assign(m_xPixels * m_yPixels, ARGB(0xFF, 0, 0, 0));
+  m_surfacesValid = false;
+  InfoLog("Tilemap rasterizer: %s", TileRaster::GetKernelName(TileRaster::GetKernel()));
   return true;
 }
 
@@ -168,9 +51,33 @@ void CRender2D::AttachPalette(const uint32_t *palPtr[2])
   m_palette[1] = palPtr[1];
 }
 void CRender2D::AttachVRAM(const uint8_t *vramPtr) { m_vram = reinterpret_cast<const uint32_t *>(vramPtr); }
+void CRender2D::AttachDirtyLines(const uint8_t *dirtyPtr)
+{
+  m_dirtyLines = dirtyPtr;
+  m_surfacesValid = false;
+}
 
 void CRender2D::BeginFrame(void) {}
 
+// A surface line has to be redrawn if it changed in any of the layers drawn to it
+void CRender2D::GetSurfaceDirtyLines(uint8_t *lines, unsigned layers, bool all)
+{
+  if (all || !m_dirtyLines)
+  {
+    std::memset(lines, 1, 384);
+    return;
+  }
+  std::memset(lines, 0, 384);
+  for (int layerNum = 0; layerNum < 4; layerNum++)
+  {
+    if (layers & (1 << layerNum))
+    {
+      for (int y = 0; y < 384; y++)
+        lines[y] |= m_dirtyLines[layerNum * 384 + y];
+    }
+  }
+}
+
 std::pair<bool, bool> CRender2D::DrawTilemaps(uint32_t *pixelsBottom, uint32_t *pixelsTop)
 {
   if (!m_regs || !m_vram || !m_palette[0] || !m_palette[1])
@@ -178,6 +85,11 @@ std::pair<bool, bool> CRender2D::DrawTilemaps(uint32_t *pixelsBottom, uint32_t *
 
   unsigned priority = (m_regs[0x20 / 4] >> 8) & 0xF;
 
+  // Only lines the tile generator reports as modified are redrawn
+  GetSurfaceDirtyLines(m_bottomDirty, ~priority & 0xF, !m_surfacesValid);
+  GetSurfaceDirtyLines(m_topDirty, priority, !m_surfacesValid);
+  m_surfacesValid = true;
+
   bool noBottomSurface = true;
   static const int bottomOrder[4] = {3, 2, 1, 0};
   for (int i = 0; i < 4; i++)
@@ -188,20 +100,8 @@ std::pair<bool, bool> CRender2D::DrawTilemaps(uint32_t *pixelsBottom, uint32_t *
     bool selected = (priority & (1 << layerNum)) == 0;
     if (enabled && selected)
     {
-      if (noBottomSurface)
-      {
-        if (is4Bit)
-          DrawLayer<4, false>(pixelsBottom, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-        else
-          DrawLayer<8, false>(pixelsBottom, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-      }
-      else
-      {
-        if (is4Bit)
-          DrawLayer<4, true>(pixelsBottom, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-        else
-          DrawLayer<8, true>(pixelsBottom, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-      }
+      // Layers drawn over another one only draw their opaque pixels
+      TileRaster::DrawLayer(pixelsBottom, layerNum, is4Bit, !noBottomSurface, true, m_vram, m_regs, m_palette[layerNum / 2], m_bottomDirty);
       noBottomSurface = false;
     }
   }
@@ -216,20 +116,8 @@ std::pair<bool, bool> CRender2D::DrawTilemaps(uint32_t *pixelsBottom, uint32_t *
     bool selected = (priority & (1 << layerNum)) != 0;
     if (enabled && selected)
     {
-      if (noTopSurface)
-      {
-        if (is4Bit)
-          DrawLayer<4, false>(pixelsTop, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-        else
-          DrawLayer<8, false>(pixelsTop, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-      }
-      else
-      {
-        if (is4Bit)
-          DrawLayer<4, true>(pixelsTop, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-        else
-          DrawLayer<8, true>(pixelsTop, layerNum, m_vram, m_regs, m_palette[layerNum / 2]);
-      }
+      // Layers drawn over another one only draw their opaque pixels
+      TileRaster::DrawLayer(pixelsTop, layerNum, is4Bit, !noTopSurface, true, m_vram, m_regs, m_palette[layerNum / 2], m_topDirty);
       noTopSurface = false;
     }
   }
@@ -238,12 +126,19 @@ std::pair<bool, bool> CRender2D::DrawTilemaps(uint32_t *pixelsBottom, uint32_t *
 }
 
 void CRender2D::PreRenderFrame(void)
+{
+  DrawSurfaces();
+}
+
+void CRender2D::DrawSurfaces(void)
 {
   if (m_frame.empty())
     return;
   m_surfacesPresent = DrawTilemaps(m_bottomSurface.data(), m_topSurface.data());
 }
 
+void CRender2D::UploadSurfaces(void) {}
+
 void CRender2D::RenderFrameBottom(void)
 {
   if (m_frame.empty())